@@ -40,6 +40,9 @@ namespace seqan3::align_cfg
  *
  * The performance of the algorithm can further be improved if the number of maximal errors (edits) is known by using
  * the align_cfg::min_score configuration.
+ * If the alignment can be restricted to a band by using the align_cfg::band_fixed_size configuration, only the cells
+ * of the band are computed, i.e. the running time depends on the width of the band instead of the length of the
+ * second sequence.
  *
  * \include snippet/alignment/configuration/align_cfg_edit_example.cpp
  *
@@ -0,0 +1,37 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::executor configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/detail/configuration_element_executor_mode.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Executes the alignment algorithm in parallel on the threads of the given seqan3::thread_pool.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * This configuration behaves like seqan3::align_cfg::parallel with the number of threads of the pool, but the
+ * threads are not spawned for every call of seqan3::align_pairwise. The pool must outlive the returned
+ * seqan3::algorithm_result_generator_range. It cannot be combined with seqan3::align_cfg::parallel.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_executor_example.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ */
+using executor = seqan3::detail::executor_mode<
+    std::integral_constant<seqan3::detail::align_config_id, seqan3::detail::align_config_id::executor>>;
+
+} // namespace seqan3::align_cfg
@@ -6,12 +6,14 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides alignment configuration seqan3::align_cfg::score_type.
+ * \brief Provides alignment configuration seqan3::align_cfg::score_type and seqan3::align_cfg::adaptive_score_type.
  * \author Lydia Buntrock <lydia.buntrock AT fu-berlin.de>
  */
 
 #pragma once
 
+#include <cstdint>
+
 #include <seqan3/alignment/configuration/detail.hpp>
 #include <seqan3/core/configuration/pipeable_config_element.hpp>
 #include <seqan3/utility/concept.hpp>
@@ -58,4 +60,92 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::score_type};
 };
 
+/*!\brief A configuration element to compute vectorised alignments with the narrowest sufficient score type.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The vectorised alignment computes as many alignments simultaneously as score values fit into one simd vector.
+ * Narrower score types thus increase the throughput, but the scores of longer or more similar sequences can exceed
+ * their value range.
+ * With this option every batch is first computed with `int8_t` scores (`int16_t` for the amino acid scoring
+ * schemes). The computation detects every alignment whose intermediate scores leave the range of the score type,
+ * and only these alignments are recomputed with `int16_t` and, if still necessary, with `int32_t` scores.
+ * The scores are reported as `int32_t` and do not differ from the scores computed with seqan3::align_cfg::score_type
+ * `<int32_t>`.
+ *
+ * The adaptive score type is only used for the vectorised global alignment without a band that computes no more than
+ * the score and the sequence ids. Otherwise, the alignment is computed with `int32_t` scores.
+ * This configuration cannot be combined with seqan3::align_cfg::score_type.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_adaptive_score_type.cpp
+ */
+class adaptive_score_type : private pipeable_config_element
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr adaptive_score_type() = default;                                        //!< Defaulted.
+    constexpr adaptive_score_type(adaptive_score_type const &) = default;             //!< Defaulted.
+    constexpr adaptive_score_type(adaptive_score_type &&) = default;                  //!< Defaulted.
+    constexpr adaptive_score_type & operator=(adaptive_score_type const &) = default; //!< Defaulted.
+    constexpr adaptive_score_type & operator=(adaptive_score_type &&) = default;      //!< Defaulted.
+    ~adaptive_score_type() = default;                                                 //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::score_type};
+};
+
 } // namespace seqan3::align_cfg
+
+namespace seqan3::align_cfg::detail
+{
+/*!\brief Configuration element to detect score overflows in the vectorised alignment.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * If this element is present, the vectorised alignment tracks the smallest and the largest score of every alignment.
+ * Alignments with a score outside of the range shrunk by the headroom on both sides are not reported to the callback
+ * but to its member function `score_overflow`. The headroom must not be smaller than the largest absolute
+ * difference between two cells depending on each other, such that the first score outside of this range is still
+ * computed without an overflow.
+ *
+ * \note This configuration element is only added internally by seqan3::align_cfg::adaptive_score_type and is not
+ *       intended for public use.
+ */
+class score_overflow_detection : private pipeable_config_element
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr score_overflow_detection() = default;                                             //!< Defaulted.
+    constexpr score_overflow_detection(score_overflow_detection const &) = default;             //!< Defaulted.
+    constexpr score_overflow_detection(score_overflow_detection &&) = default;                  //!< Defaulted.
+    constexpr score_overflow_detection & operator=(score_overflow_detection const &) = default; //!< Defaulted.
+    constexpr score_overflow_detection & operator=(score_overflow_detection &&) = default;      //!< Defaulted.
+    ~score_overflow_detection() = default;                                                      //!< Defaulted.
+
+    /*!\brief Constructs the element with the given headroom.
+     * \param score_headroom The largest absolute score difference between two dependent cells.
+     */
+    constexpr explicit score_overflow_detection(int32_t const score_headroom) : score_headroom{score_headroom}
+    {}
+    //!\}
+
+    //!\brief The largest absolute score difference between two dependent cells.
+    int32_t score_headroom{};
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::score_overflow};
+};
+
+} // namespace seqan3::align_cfg::detail
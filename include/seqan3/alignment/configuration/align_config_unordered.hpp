@@ -0,0 +1,60 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::unordered configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Returns the results of a parallel alignment computation in the order in which they are computed.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * By default, the parallel alignment computation (see seqan3::align_cfg::parallel and seqan3::align_cfg::executor)
+ * returns the alignments in the order of the given sequence pairs. To do so, the results of a sequence pair are held
+ * back until the results of all previous pairs were returned. If the alignments take a very different time to
+ * compute, this configuration returns every alignment as soon as it is computed instead. The results must then be
+ * matched to the sequence pairs via the sequence ids (see seqan3::align_cfg::output_sequence1_id and
+ * seqan3::align_cfg::output_sequence2_id).
+ *
+ * This configuration has no effect if the alignments are not computed in parallel.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_unordered_example.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ */
+class unordered : private pipeable_config_element
+{
+public:
+    /*!\name Constructor, destructor and assignment
+     * \{
+     */
+    constexpr unordered() = default;                              //!< Defaulted.
+    constexpr unordered(unordered const &) = default;             //!< Defaulted.
+    constexpr unordered(unordered &&) = default;                  //!< Defaulted.
+    constexpr unordered & operator=(unordered const &) = default; //!< Defaulted.
+    constexpr unordered & operator=(unordered &&) = default;      //!< Defaulted.
+    ~unordered() = default;                                       //!< Defaulted.
+
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::unordered};
+};
+
+} // namespace seqan3::align_cfg
@@ -32,6 +32,9 @@ namespace seqan3::align_cfg
  * multiple alignments and not a single alignment. This means that you should provide many sequences to compute as
  * one batch rather than computing them separately as there won't be performance gains.
  *
+ * The edit distance is vectorised as well if neither the begin positions nor the alignment are requested. In this
+ * case, the bit-vectors of 4, 8 or 16 sequence pairs are stored in one SIMD register, depending on the architecture.
+ *
  * \sa For further information on SIMD see https://en.wikipedia.org/wiki/SIMD.
  *
  * ### Example
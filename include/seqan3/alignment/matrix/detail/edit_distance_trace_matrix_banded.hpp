@@ -0,0 +1,293 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::edit_distance_trace_matrix_banded.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_fwd.hpp>
+#include <seqan3/utility/detail/bits_of.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The trace matrix of seqan3::detail::edit_distance_unbanded if a band is configured.
+ * \ingroup alignment_matrix
+ * \tparam word_t         \copydoc default_edit_distance_trait_type::word_type
+ * \tparam is_semi_global \copydoc default_edit_distance_trait_type::is_semi_global
+ *
+ * \details
+ *
+ * In contrast to seqan3::detail::edit_distance_trace_matrix_full, only the cells of a column that are covered by the
+ * band are stored. Every column stores the same number of bits, where the first bit corresponds to the row of the
+ * first cell of the band in this column. The cells outside of the band have no trace direction.
+ */
+template <typename word_t, bool is_semi_global>
+class edit_distance_trace_matrix_banded
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_trace_matrix_banded() = default;                                                      //!< Defaulted
+    edit_distance_trace_matrix_banded(edit_distance_trace_matrix_banded const &) = default;             //!< Defaulted
+    edit_distance_trace_matrix_banded(edit_distance_trace_matrix_banded &&) = default;                  //!< Defaulted
+    edit_distance_trace_matrix_banded & operator=(edit_distance_trace_matrix_banded const &) = default; //!< Defaulted
+    edit_distance_trace_matrix_banded & operator=(edit_distance_trace_matrix_banded &&) = default;      //!< Defaulted
+    ~edit_distance_trace_matrix_banded() = default;                                                     //!< Defaulted
+
+protected:
+    //!\brief Allow seqan3::detail::edit_distance_unbanded_trace_matrix_policy to access the private constructor.
+    template <typename derived_t, typename edit_traits>
+    friend class edit_distance_unbanded_trace_matrix_policy;
+
+    //!\brief Allow seqan3::detail::edit_distance_unbanded_band_policy to add the columns.
+    template <typename derived_t, typename edit_traits>
+    friend class edit_distance_unbanded_band_policy;
+
+    /*!\brief Construct the trace matrix by giving the number of rows within the matrix.
+     * \param rows_size \copydoc rows_size
+     */
+    edit_distance_trace_matrix_banded(size_t const rows_size) : rows_size{rows_size}
+    {}
+    //!\}
+
+private:
+    struct trace_path_iterator;
+
+public:
+    //!\copydoc default_edit_distance_trait_type::word_type
+    using word_type = word_t;
+
+    //!\copydoc default_edit_distance_trait_type::word_size
+    static constexpr auto word_size = bits_of<word_type>;
+
+    //!\copydoc seqan3::detail::matrix::value_type
+    using value_type = detail::trace_directions;
+
+    //!\copydoc seqan3::detail::matrix::reference
+    using reference = value_type;
+
+    //!\copydoc seqan3::detail::matrix::size_type
+    using size_type = size_t;
+
+    /*!\brief Increase the capacity of the columns to a value that's greater or equal to `new_capacity`.
+     * \param new_capacity The new capacity.
+     * \details
+     *
+     * ### Exception
+     *
+     * Strong exception guarantee.
+     */
+    void reserve(size_t const new_capacity)
+    {
+        first_rows.reserve(new_capacity);
+    }
+
+    //!\copydoc seqan3::detail::matrix::at
+    reference at(matrix_coordinate const & coordinate) const noexcept
+    {
+        size_t const row = coordinate.row;
+        size_t const col = coordinate.col;
+
+        assert(row < rows());
+        assert(col < cols());
+
+        if (row == 0u)
+        {
+            if constexpr (is_semi_global)
+                return detail::trace_directions::none;
+
+            if (col == 0u)
+                return detail::trace_directions::none;
+
+            return detail::trace_directions::left;
+        }
+
+        int64_t const bit = static_cast<int64_t>(row) - first_rows[col];
+        if (bit < 0 || bit >= static_cast<int64_t>(blocks * word_size))
+            return detail::trace_directions::none;
+
+        size_t const idx = col * blocks + bit / word_size;
+        word_type const mask = word_type{1u} << (bit % word_size);
+
+        return ((left[idx] & mask) ? detail::trace_directions::left : detail::trace_directions::none)
+             | ((diagonal[idx] & mask) ? detail::trace_directions::diagonal : detail::trace_directions::none)
+             | ((up[idx] & mask) ? detail::trace_directions::up : detail::trace_directions::none);
+    }
+
+    //!\copydoc seqan3::detail::matrix::rows
+    size_t rows() const noexcept
+    {
+        return rows_size;
+    }
+
+    //!\copydoc seqan3::detail::matrix::cols
+    size_t cols() const noexcept
+    {
+        return first_rows.size();
+    }
+
+    /*!\brief Returns a trace path starting from the given coordinate and ending in the cell with
+     *        seqan3::detail::trace_directions::none.
+     * \param[in] trace_begin A seqan3::matrix_coordinate pointing to the begin of the trace to follow.
+     * \returns A std::ranges::subrange over the corresponding trace path.
+     * \throws std::invalid_argument if the specified coordinate is out of range.
+     */
+    auto trace_path(matrix_coordinate const & trace_begin) const
+    {
+        if (trace_begin.row >= rows() || trace_begin.col >= cols())
+            throw std::invalid_argument{"The given coordinate exceeds the matrix in vertical or horizontal direction."};
+
+        using path_t = std::ranges::subrange<trace_path_iterator, std::default_sentinel_t>;
+        return path_t{trace_path_iterator{this, trace_begin}, std::default_sentinel};
+    }
+
+protected:
+    /*!\brief Adds a column to the trace matrix.
+     * \param first_row The row of the first bit of the column; might be negative at the beginning of the band.
+     * \param left_bits The machine words which represent the trace_direction::left.
+     * \param diagonal_bits The machine words which represent the trace_direction::diagonal.
+     * \param up_bits The machine words which represent the trace_direction::up.
+     */
+    void add_column(int64_t const first_row,
+                    std::vector<word_type> const & left_bits,
+                    std::vector<word_type> const & diagonal_bits,
+                    std::vector<word_type> const & up_bits)
+    {
+        assert(first_rows.empty() || left_bits.size() == blocks);
+
+        blocks = left_bits.size();
+        first_rows.push_back(first_row);
+        left.insert(left.end(), left_bits.begin(), left_bits.end());
+        diagonal.insert(diagonal.end(), diagonal_bits.begin(), diagonal_bits.end());
+        up.insert(up.end(), up_bits.begin(), up_bits.end());
+    }
+
+private:
+    //!\copydoc seqan3::detail::matrix::rows
+    size_t rows_size{};
+    //!\brief The number of machine words per column.
+    size_t blocks{};
+    //!\brief The row of the first bit of each column.
+    std::vector<int64_t> first_rows{};
+    //!\brief The machine words which represent the trace_direction::left; stored column by column.
+    std::vector<word_type> left{};
+    //!\brief The machine words which represent the trace_direction::diagonal; stored column by column.
+    std::vector<word_type> diagonal{};
+    //!\brief The machine words which represent the trace_direction::up; stored column by column.
+    std::vector<word_type> up{};
+};
+
+/*!\brief The iterator needed to implement seqan3::detail::edit_distance_trace_matrix_banded::trace_path.
+ *
+ * \details
+ *
+ * See seqan3::detail::edit_distance_trace_matrix_full::trace_path_iterator.
+ * \extends std::input_iterator
+ */
+template <typename word_t, bool is_semi_global>
+struct edit_distance_trace_matrix_banded<word_t, is_semi_global>::trace_path_iterator
+{
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Input iterator tag.
+    using iterator_category = std::input_iterator_tag;
+    //!\copydoc seqan3::detail::trace_iterator_base::value_type
+    using value_type = detail::trace_directions;
+    //!\copydoc seqan3::detail::trace_iterator_base::difference_type
+    using difference_type = std::ptrdiff_t;
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\copydoc seqan3::detail::trace_iterator_base::operator*
+    constexpr value_type operator*() const
+    {
+        value_type const dir = parent->at(coordinate());
+
+        if (dir == value_type::none)
+            return value_type::none;
+
+        if ((dir & value_type::left) == value_type::left)
+            return value_type::left;
+        else if ((dir & value_type::up) == value_type::up)
+            return value_type::up;
+        else
+            return value_type::diagonal;
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::coordinate
+    [[nodiscard]] constexpr matrix_coordinate const & coordinate() const
+    {
+        return coordinate_;
+    }
+    //!\}
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    //!\copydoc seqan3::detail::trace_iterator_base::operator++
+    constexpr trace_path_iterator & operator++()
+    {
+        value_type const dir = *(*this);
+
+        if (dir == value_type::left)
+        {
+            coordinate_.col = std::max<size_t>(coordinate_.col, 1) - 1;
+        }
+        else if (dir == value_type::up)
+        {
+            coordinate_.row = std::max<size_t>(coordinate_.row, 1) - 1;
+        }
+        else if (dir == value_type::diagonal)
+        {
+            coordinate_.row = std::max<size_t>(coordinate_.row, 1) - 1;
+            coordinate_.col = std::max<size_t>(coordinate_.col, 1) - 1;
+        }
+
+        // Every cell of the band, except for the first row and column, has a trace direction.
+        assert(dir != value_type::none || coordinate_.row == 0 || coordinate_.col == 0);
+
+        return *this;
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::operator++
+    constexpr void operator++(int)
+    {
+        ++(*this);
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\copydoc seqan3::detail::trace_iterator_base::operator==(derived_t const &, std::default_sentinel_t const &)
+    friend bool operator==(trace_path_iterator const & it, std::default_sentinel_t)
+    {
+        return *it == value_type::none;
+    }
+    //!\}
+
+    //!\brief The parent trace matrix.
+    edit_distance_trace_matrix_banded const * parent{nullptr};
+    //!\brief The current coordinate.
+    matrix_coordinate coordinate_{};
+};
+
+} // namespace seqan3::detail
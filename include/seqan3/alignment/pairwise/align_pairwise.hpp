@@ -25,6 +25,7 @@
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/core/algorithm/algorithm_result_generator_range.hpp>
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
+#include <seqan3/core/algorithm/detail/algorithm_executor_streaming.hpp>
 #include <seqan3/core/detail/all_view.hpp>
 #include <seqan3/utility/simd/simd.hpp>
 #include <seqan3/utility/simd/simd_traits.hpp>
@@ -70,8 +71,10 @@ namespace seqan3
  * For each sequence pair one or more \ref seqan3::alignment_result "seqan3::alignment_result"s can be computed.
  * The seqan3::align_pairwise function returns an seqan3::algorithm_result_generator_range which can be used to iterate
  * over the alignments. If the `vectorised` configurations are omitted the alignments are computed on-demand when
- * iterating over the results. In case of a parallel execution all alignments are computed at once in parallel when
- * calling `begin` on the associated seqan3::algorithm_result_generator_range.
+ * iterating over the results. In case of a parallel execution the alignments are computed in parallel while iterating
+ * over the results. A bounded number of sequence pairs is processed ahead of the current result, such that the memory
+ * consumption does not depend on the number of sequence pairs. The results are returned in the order of the sequence
+ * pairs unless seqan3::align_cfg::unordered is specified.
  *
  * The following snippets demonstrate the single element and the range based interface.
  *
@@ -85,7 +88,8 @@ namespace seqan3
  *
  * Might throw std::bad_alloc if it fails to allocate the alignment matrix or seqan3::invalid_alignment_configuration
  * if the configuration is invalid.
- * Throws std::runtime_error if seqan3::align_cfg::parallel has been specified without a `thread_count` value.
+ * Throws std::runtime_error if seqan3::align_cfg::parallel has been specified without a `thread_count` value or
+ * seqan3::align_cfg::executor without a thread pool.
  *
  * ### Complexity
  *
@@ -179,17 +183,30 @@ constexpr auto align_pairwise(sequence_t && sequences, alignment_config_t const
 
     using indexed_sequences_t = decltype(indexed_sequence_chunk_view);
     using alignment_result_t = typename traits_t::alignment_result_type;
-    using execution_handler_t = std::conditional_t<complete_config_t::template exists<align_cfg::parallel>(),
+    using execution_handler_t = std::conditional_t<complete_config_t::template exists<align_cfg::parallel>()
+                                                       || complete_config_t::template exists<align_cfg::executor>(),
                                                    detail::execution_handler_parallel,
                                                    detail::execution_handler_sequential>;
-    using executor_t = detail::
-        algorithm_executor_blocking<indexed_sequences_t, decltype(algorithm), alignment_result_t, execution_handler_t>;
+    using algorithm_t = decltype(algorithm);
+    using executor_t = std::conditional_t<
+        std::same_as<execution_handler_t, detail::execution_handler_parallel>,
+        detail::algorithm_executor_streaming<indexed_sequences_t, algorithm_t, alignment_result_t>,
+        detail::algorithm_executor_blocking<indexed_sequences_t, algorithm_t, alignment_result_t, execution_handler_t>>;
 
     // Select the execution handler for the alignment configuration.
-    auto select_execution_handler = [parallel = complete_config.get_or(align_cfg::parallel{})]()
+    auto select_execution_handler = [parallel = complete_config.get_or(align_cfg::parallel{}),
+                                     executor = complete_config.get_or(align_cfg::executor{})]()
     {
         if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
         {
+            if constexpr (complete_config_t::template exists<align_cfg::executor>())
+            {
+                if (executor.pool == nullptr)
+                    throw std::runtime_error{"You must configure the thread pool in seqan3::align_cfg::executor."};
+
+                return execution_handler_t{executor.pool->scheduler()};
+            }
+
             auto thread_count = parallel.thread_count;
             if (!thread_count)
                 throw std::runtime_error{"You must configure the number of threads in seqan3::align_cfg::parallel."};
@@ -206,6 +223,13 @@ constexpr auto align_pairwise(sequence_t && sequences, alignment_config_t const
         select_execution_handler().bulk_execute(algorithm,
                                                 indexed_sequence_chunk_view,
                                                 get<align_cfg::on_result>(complete_config).callback);
+    else if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>) // Stream the results.
+        return algorithm_result_generator_range{
+            executor_t{std::move(indexed_sequence_chunk_view),
+                       std::move(algorithm),
+                       alignment_result_t{},
+                       select_execution_handler(),
+                       !complete_config_t::template exists<align_cfg::unordered>()}};
     else // Require two way execution: return the range over the alignments.
         return algorithm_result_generator_range{executor_t{std::move(indexed_sequence_chunk_view),
                                                            std::move(algorithm),
@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdlib>
 #include <functional>
+#include <limits>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -31,6 +34,7 @@
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_adaptive.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion_banded.hpp>
@@ -315,39 +319,92 @@ public:
         // Configure the algorithm
         // ----------------------------------------------------------------------------
 
-        // Use default edit distance if gaps are not set.
-        align_cfg::gap_cost_affine edit_gap_cost{};
-        auto const & gap_cost = config_with_result_type.get_or(edit_gap_cost);
-        auto const & scoring_scheme = get<align_cfg::scoring_scheme>(cfg).scheme;
+        if constexpr (alignment_configuration_traits<decltype(config_with_result_type)>::is_adaptive_score_type)
+            return std::pair{configure_adaptive_score_type<function_wrapper_t>(config_with_result_type),
+                             config_with_result_type};
+        else
+            return std::pair{configure_algorithm<function_wrapper_t>(config_with_result_type),
+                             config_with_result_type};
+    }
+
+private:
+    /*!\brief Adds maybe the default output arguments if the user did not provide any.
+     *
+     * \tparam config_t The original type of the alignment configuration.
+     *
+     * \param[in] config The original user configuration to check.
+     *
+     * \returns Either the original config if the user specified any output configuration or a new config with all
+     *          output options enabled.
+     */
+    template <typename config_t>
+    static constexpr auto maybe_default_output(config_t const & config) noexcept
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        if constexpr (traits_t::has_output_configuration)
+            return config;
+        else
+            return config | align_cfg::output_score{} | align_cfg::output_begin_position{}
+                 | align_cfg::output_end_position{} | align_cfg::output_alignment{} | align_cfg::output_sequence1_id{}
+                 | align_cfg::output_sequence2_id{};
+    }
 
+    /*!\brief Checks whether the configuration computes the edit distance.
+     * \tparam config_t The alignment configuration type.
+     * \param[in] cfg The passed configuration object.
+     */
+    template <typename config_t>
+    static constexpr bool is_edit_distance(config_t const & cfg)
+    {
         if constexpr (config_t::template exists<seqan3::align_cfg::method_global>())
         {
-            // Only use edit distance if ...
-            auto method_global_cfg = get<seqan3::align_cfg::method_global>(config_with_result_type);
-            // Only use edit distance if ...
-            if (gap_cost.open_score == 0 && // gap open score is not set,
-                !(method_global_cfg.free_end_gaps_sequence2_leading
-                  || method_global_cfg.free_end_gaps_sequence2_trailing)
-                && // none of the free end gaps are set for second seq,
-                (method_global_cfg.free_end_gaps_sequence1_leading
-                 == method_global_cfg
-                        .free_end_gaps_sequence1_trailing)) // free ends for leading and trailing gaps are equal in first seq.
+            // Use default edit distance if gaps are not set.
+            align_cfg::gap_cost_affine edit_gap_cost{};
+            auto const & gap_cost = cfg.get_or(edit_gap_cost);
+            [[maybe_unused]] auto const & scoring_scheme = get<align_cfg::scoring_scheme>(cfg).scheme;
+
+            // Only use edit distance if the gap open score is not set, none of the free end gaps are set for the
+            // second sequence and the free ends for leading and trailing gaps are equal in the first sequence.
+            auto method_global_cfg = get<seqan3::align_cfg::method_global>(cfg);
+            if (gap_cost.open_score == 0
+                && !(method_global_cfg.free_end_gaps_sequence2_leading
+                     || method_global_cfg.free_end_gaps_sequence2_trailing)
+                && (method_global_cfg.free_end_gaps_sequence1_leading
+                    == method_global_cfg.free_end_gaps_sequence1_trailing))
             {
-                // TODO: Instead of relying on nucleotide scoring schemes we need to be able to determine the edit distance
-                //       option via the scheme.
+                // TODO: Instead of relying on nucleotide scoring schemes we need to be able to determine the edit
+                //       distance option via the scheme.
                 if constexpr (is_type_specialisation_of_v<std::remove_cvref_t<decltype(scoring_scheme)>,
                                                           nucleotide_scoring_scheme>)
                 {
-                    if ((scoring_scheme.score('A'_dna15, 'A'_dna15) == 0)
-                        && (scoring_scheme.score('A'_dna15, 'C'_dna15)) == -1)
-                    {
-                        return std::pair{configure_edit_distance<function_wrapper_t>(config_with_result_type),
-                                         config_with_result_type};
-                    }
+                    return (scoring_scheme.score('A'_dna15, 'A'_dna15) == 0)
+                        && (scoring_scheme.score('A'_dna15, 'C'_dna15) == -1);
                 }
             }
         }
 
+        return false;
+    }
+
+    /*!\brief Configures the alignment algorithm with the score type of the given configuration.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t           The alignment configuration type.
+     * \param[in] cfg             The passed configuration object.
+     *
+     * \details
+     *
+     * Selects the edit distance algorithm if possible and the dynamic programming algorithm otherwise.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static constexpr function_wrapper_t configure_algorithm(config_t const & cfg)
+    {
+        if constexpr (config_t::template exists<seqan3::align_cfg::method_global>())
+        {
+            if (is_edit_distance(cfg))
+                return configure_edit_distance<function_wrapper_t>(cfg);
+        }
+
         // ----------------------------------------------------------------------------
         // Check if invalid configuration was used.
         // ----------------------------------------------------------------------------
@@ -357,31 +414,135 @@ public:
             throw invalid_alignment_configuration{"The align_cfg::min_score configuration is only allowed for the "
                                                   "specific edit distance computation."};
         // Configure the alignment algorithm.
-        return std::pair{configure_scoring_scheme<function_wrapper_t>(config_with_result_type),
-                         config_with_result_type};
+        return configure_scoring_scheme<function_wrapper_t>(cfg);
     }
 
-private:
-    /*!\brief Adds maybe the default output arguments if the user did not provide any.
+    /*!\brief Configures the algorithm for seqan3::align_cfg::adaptive_score_type.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t           The alignment configuration type.
+     * \param[in] cfg             The passed configuration object.
      *
-     * \tparam config_t The original type of the alignment configuration.
+     * \details
      *
-     * \param[in] config The original user configuration to check.
+     * Configures a seqan3::detail::pairwise_alignment_algorithm_adaptive. Its first stages compute the alignments
+     * with `int8_t` and `int16_t` scores and detect score overflows. Stages whose score type cannot represent the
+     * scoring scheme and the gap costs with sufficient headroom are skipped, as well as the `int8_t` stage for amino
+     * acid scoring schemes, whose score profile exceeds the range of `int8_t`.
+     * The last stage computes the remaining alignments with `int32_t` scores. If the configuration computes the edit
+     * distance, the last stage is the only one.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static function_wrapper_t configure_adaptive_score_type(config_t const & cfg)
+    {
+        using function_traits_t = alignment_function_traits<function_wrapper_t>;
+        using adaptive_algorithm_t =
+            pairwise_alignment_algorithm_adaptive<typename function_traits_t::sequence_input_type,
+                                                  typename function_traits_t::alignment_result_type>;
+        using stage_function_t = typename adaptive_algorithm_t::stage_function_type;
+
+        auto fixed_config = cfg.template remove<align_cfg::adaptive_score_type>();
+        using fixed_traits_t = alignment_configuration_traits<decltype(fixed_config)>;
+
+        adaptive_algorithm_t algorithm{};
+
+        if (!is_edit_distance(fixed_config))
+        {
+            int32_t const headroom = score_headroom(fixed_config);
+
+            if constexpr (!is_type_specialisation_of_v<typename fixed_traits_t::scoring_scheme_type,
+                                                       aminoacid_scoring_scheme>)
+                add_adaptive_stage<int8_t>(algorithm, fixed_config, headroom);
+
+            add_adaptive_stage<int16_t>(algorithm, fixed_config, headroom);
+        }
+
+        algorithm.add_stage(configure_algorithm<stage_function_t>(fixed_config),
+                            fixed_traits_t::alignments_per_vector,
+                            std::numeric_limits<size_t>::max());
+
+        return algorithm;
+    }
+
+    /*!\brief Adds a stage that computes the alignments with the given score type and detects score overflows.
+     * \tparam score_t              The score type of the stage.
+     * \tparam adaptive_algorithm_t The type of the seqan3::detail::pairwise_alignment_algorithm_adaptive.
+     * \tparam config_t             The alignment configuration type.
+     * \param[in] algorithm         The adaptive algorithm to add the stage to.
+     * \param[in] cfg               The passed configuration object.
+     * \param[in] headroom          The headroom needed to detect score overflows (see score_headroom()).
      *
-     * \returns Either the original config if the user specified any output configuration or a new config with all
-     *          output options enabled.
+     * \details
+     *
+     * The stage is skipped if the headroom takes more than a quarter of the positive range of the score type.
+     * The supported sequence size is limited by the index type of the vectorised alignment matrix and, if the leading
+     * end gaps are not free, by the gap costs of the first row and column of the alignment matrix.
+     */
+    template <typename score_t, typename adaptive_algorithm_t, typename config_t>
+    static void add_adaptive_stage(adaptive_algorithm_t & algorithm, config_t const & cfg, int32_t const headroom)
+    {
+        if (headroom > std::numeric_limits<score_t>::max() / 4)
+            return;
+
+        auto stage_config =
+            cfg | align_cfg::score_type<score_t>{} | align_cfg::detail::score_overflow_detection{headroom};
+        using stage_traits_t = alignment_configuration_traits<decltype(stage_config)>;
+        using index_t = typename simd_traits<typename stage_traits_t::matrix_index_type>::scalar_type;
+
+        size_t max_sequence_size = std::numeric_limits<index_t>::max() - 1u;
+
+        // Without free leading end gaps, the first row and column of a longer sequence certainly overflow.
+        auto const & method = get<align_cfg::method_global>(cfg);
+        auto const gap_cost =
+            cfg.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+        int64_t const gap_open = std::abs(static_cast<int64_t>(gap_cost.open_score));
+        int64_t const gap_extension = std::abs(static_cast<int64_t>(gap_cost.extension_score));
+        int64_t const score_range = std::numeric_limits<score_t>::max() - headroom;
+
+        if (!method.free_end_gaps_sequence1_leading && !method.free_end_gaps_sequence2_leading && gap_extension > 0)
+            max_sequence_size =
+                std::min<size_t>(max_sequence_size, std::max<int64_t>(score_range - gap_open, 0) / gap_extension);
+
+        using stage_function_t = typename adaptive_algorithm_t::stage_function_type;
+        algorithm.add_stage(configure_scoring_scheme<stage_function_t>(stage_config),
+                            stage_traits_t::alignments_per_vector,
+                            max_sequence_size);
+    }
+
+    /*!\brief Returns the largest absolute score difference between two dependent cells of the alignment matrix.
+     * \tparam config_t The alignment configuration type.
+     * \param[in] cfg The passed configuration object.
+     *
+     * \details
+     *
+     * A cell of the alignment matrix differs from the cells it depends on by at most the largest absolute score of the
+     * scoring scheme (including the score of the padding symbols) or the absolute gap open score plus twice the
+     * absolute gap extension score, since the gap recursion extends a gap before comparing it with a newly opened one.
      */
     template <typename config_t>
-    static constexpr auto maybe_default_output(config_t const & config) noexcept
+    static int32_t score_headroom(config_t const & cfg)
     {
-        using traits_t = alignment_configuration_traits<config_t>;
+        using alphabet_t = typename alignment_configuration_traits<config_t>::scoring_scheme_alphabet_type;
+        auto const & scoring_scheme = get<align_cfg::scoring_scheme>(cfg).scheme;
 
-        if constexpr (traits_t::has_output_configuration)
-            return config;
-        else
-            return config | align_cfg::output_score{} | align_cfg::output_begin_position{}
-                 | align_cfg::output_end_position{} | align_cfg::output_alignment{} | align_cfg::output_sequence1_id{}
-                 | align_cfg::output_sequence2_id{};
+        int64_t headroom = 1; // The score of the padding symbol in the simd matrix scoring scheme.
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                int64_t const score = scoring_scheme.score(assign_rank_to(rank1, alphabet_t{}),
+                                                           assign_rank_to(rank2, alphabet_t{}));
+                headroom = std::max(headroom, std::abs(score));
+            }
+        }
+
+        // Same default as in seqan3::detail::policy_affine_gap_recursion.
+        auto const gap_cost =
+            cfg.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10}, align_cfg::extension_score{-1}});
+        int64_t const gap_open = gap_cost.open_score;
+        int64_t const gap_extension = gap_cost.extension_score;
+        headroom = std::max(headroom, std::abs(gap_open) + 2 * std::abs(gap_extension));
+
+        return std::min<int64_t>(headroom, std::numeric_limits<int32_t>::max());
     }
 
     /*!\brief Configures the edit distance algorithm.
@@ -392,15 +553,6 @@ private:
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_edit_distance(config_t const & cfg)
     {
-        using traits_t = alignment_configuration_traits<config_t>;
-
-        // ----------------------------------------------------------------------------
-        // Unsupported configurations
-        // ----------------------------------------------------------------------------
-
-        if constexpr (traits_t::is_banded)
-            throw invalid_alignment_configuration{"Banded alignments are yet not supported."};
-
         // ----------------------------------------------------------------------------
         // Configure semi-global alignment
         // ----------------------------------------------------------------------------
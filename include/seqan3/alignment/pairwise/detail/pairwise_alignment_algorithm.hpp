@@ -146,7 +146,12 @@ public:
     }
     //!\}
 
-    //!\overload
+    /*!\overload
+     * \details
+     *
+     * If seqan3::align_cfg::detail::score_overflow_detection is configured, `callback.score_overflow(idx)` is invoked
+     * instead of the callback for every sequence pair whose scores might have overflowed.
+     */
     template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
         requires traits_type::is_vectorised && std::invocable<callback_t, alignment_result_type>
     auto operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
@@ -181,6 +186,17 @@ public:
         size_t index = 0;
         for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
         {
+            if constexpr (traits_type::detects_score_overflow)
+            {
+                // The score is not exact and the sequence pair must be recomputed with a wider score type.
+                if (this->score_overflowed(index))
+                {
+                    callback.score_overflow(idx);
+                    ++index;
+                    continue;
+                }
+            }
+
             original_score_t score = this->optimal_score[index]
                                    - (this->padding_offsets[index] * this->scoring_scheme.padding_match_score());
             matrix_coordinate coordinate{row_index_type{size_t{this->optimal_coordinate.row[index]}},
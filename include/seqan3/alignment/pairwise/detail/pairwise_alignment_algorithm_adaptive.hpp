@@ -0,0 +1,218 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_adaptive.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/utility/views/type_reduce.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the alignments of a batch with increasingly wider score types (see
+ *        seqan3::align_cfg::adaptive_score_type).
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ * \tparam indexed_sequence_pairs_t The type of the batch of indexed sequence pairs passed by the alignment executor;
+ *                                  must model seqan3::detail::indexed_sequence_pair_range.
+ * \tparam alignment_result_t The type of the alignment result; must be a type specialisation of
+ *                            seqan3::alignment_result.
+ *
+ * \details
+ *
+ * This algorithm stores a list of stages, which are alignment algorithms configured with increasingly wider score
+ * types. Every stage, except for the last one, detects score overflows (see
+ * seqan3::align_cfg::detail::score_overflow_detection) and reports the affected sequence pairs to
+ * seqan3::detail::pairwise_alignment_algorithm_adaptive::stage_callback::score_overflow instead of reporting a result.
+ * These sequence pairs and the sequence pairs that exceed the sequence size supported by the stage are passed on to
+ * the next stage. Within every stage, the sequence pairs are split into batches of the number of alignments that
+ * the stage computes simultaneously. The last stage must compute every sequence pair.
+ *
+ * The results are buffered and passed to the callback in the order of the input sequence pairs.
+ */
+template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename alignment_result_t>
+    requires is_type_specialisation_of_v<alignment_result_t, alignment_result>
+class pairwise_alignment_algorithm_adaptive
+{
+private:
+    //!\brief The reference type of the indexed sequence pairs.
+    using indexed_sequence_pair_reference_t = std::ranges::range_reference_t<indexed_sequence_pairs_t>;
+    //!\brief The type of the sequence pair.
+    using sequence_pair_t = std::remove_reference_t<std::tuple_element_t<0, indexed_sequence_pair_reference_t>>;
+    //!\brief The type of the first sequence after reducing it to a view.
+    using first_sequence_t = decltype(get<0>(std::declval<sequence_pair_t &>()) | views::type_reduce);
+    //!\brief The type of the second sequence after reducing it to a view.
+    using second_sequence_t = decltype(get<1>(std::declval<sequence_pair_t &>()) | views::type_reduce);
+    //!\brief The type of the sequence pair index.
+    using index_t = std::remove_cvref_t<std::tuple_element_t<1, indexed_sequence_pair_reference_t>>;
+
+public:
+    //!\brief The type of an indexed sequence pair passed to the stages.
+    using indexed_sequence_pair_type = std::tuple<std::tuple<first_sequence_t, second_sequence_t>, index_t>;
+    //!\brief The type of the batch passed to the stages.
+    using batch_type = std::vector<indexed_sequence_pair_type>;
+
+    /*!\brief The callback passed to the stages.
+     *
+     * \details
+     *
+     * The stages report the results and the score overflows in the order of the sequence pairs in the batch.
+     * The callback maps them to the position of the sequence pair within the input of the adaptive algorithm.
+     */
+    struct stage_callback
+    {
+        //!\brief Stores the result of the next sequence pair.
+        void operator()(alignment_result_t result)
+        {
+            (*results)[positions[lane++]] = std::move(result);
+        }
+
+        //!\brief Marks the next sequence pair for the computation in the next stage.
+        void score_overflow(index_t const &)
+        {
+            overflowed->push_back(positions[lane++]);
+        }
+
+        //!\brief The results in the order of the input sequence pairs.
+        std::vector<std::optional<alignment_result_t>> * results{};
+        //!\brief The positions of the sequence pairs that must be recomputed in the next stage.
+        std::vector<size_t> * overflowed{};
+        //!\brief The input positions of the sequence pairs in the current batch.
+        std::span<size_t const> positions{};
+        //!\brief The position of the next reported sequence pair within the current batch.
+        size_t lane{};
+    };
+
+    //!\brief The type of the type-erased alignment algorithm of a stage.
+    using stage_function_type = std::function<void(batch_type &, stage_callback &)>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_adaptive() = default;                                              //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive(pairwise_alignment_algorithm_adaptive const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive(pairwise_alignment_algorithm_adaptive &&) = default;      //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive &
+    operator=(pairwise_alignment_algorithm_adaptive const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_adaptive &
+    operator=(pairwise_alignment_algorithm_adaptive &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_adaptive() = default;            //!< Defaulted.
+    //!\}
+
+    /*!\brief Appends a stage.
+     * \param[in] algorithm The alignment algorithm of the stage.
+     * \param[in] alignments_per_batch The number of alignments that the stage computes simultaneously.
+     * \param[in] max_sequence_size The largest sequence size supported by the stage.
+     */
+    void add_stage(stage_function_type algorithm, size_t const alignments_per_batch, size_t const max_sequence_size)
+    {
+        assert(alignments_per_batch > 0u);
+        stages.push_back(stage{std::move(algorithm), alignments_per_batch, max_sequence_size});
+    }
+
+    /*!\brief Computes the alignments of the given indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_range_t The type of the indexed sequence pairs; must be
+     *                                        `indexed_sequence_pairs_t`.
+     * \tparam callback_t The type of the callback; must model std::invocable with `alignment_result_t`.
+     * \param[in] indexed_sequence_pairs The indexed sequence pairs to align.
+     * \param[in] callback The callback invoked with every alignment result in the order of the sequence pairs.
+     */
+    template <typename indexed_sequence_pairs_range_t, typename callback_t>
+        requires std::same_as<std::remove_cvref_t<indexed_sequence_pairs_range_t>, indexed_sequence_pairs_t>
+              && std::invocable<callback_t, alignment_result_t>
+    void operator()(indexed_sequence_pairs_range_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        batch_type sequence_pairs{};
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+            sequence_pairs.emplace_back(std::tuple{get<0>(sequence_pair) | views::type_reduce,
+                                                   get<1>(sequence_pair) | views::type_reduce},
+                                        idx);
+
+        std::vector<std::optional<alignment_result_t>> results(sequence_pairs.size());
+        std::vector<size_t> pending(sequence_pairs.size());
+        std::iota(pending.begin(), pending.end(), 0u);
+        std::vector<size_t> next_pending{};
+
+        batch_type batch{};
+        std::vector<size_t> batch_positions{};
+
+        for (stage & current_stage : stages)
+        {
+            next_pending.clear();
+
+            for (auto position_it = pending.begin(); position_it != pending.end();)
+            {
+                batch.clear();
+                batch_positions.clear();
+
+                for (; position_it != pending.end() && batch.size() < current_stage.alignments_per_batch;
+                     ++position_it)
+                {
+                    auto const & [sequences, idx] = sequence_pairs[*position_it];
+
+                    if (std::ranges::size(get<0>(sequences)) > current_stage.max_sequence_size
+                        || std::ranges::size(get<1>(sequences)) > current_stage.max_sequence_size)
+                    {
+                        next_pending.push_back(*position_it);
+                        continue;
+                    }
+
+                    batch.push_back(sequence_pairs[*position_it]);
+                    batch_positions.push_back(*position_it);
+                }
+
+                if (batch.empty())
+                    continue;
+
+                stage_callback batch_callback{&results, &next_pending, batch_positions};
+                current_stage.algorithm(batch, batch_callback);
+                assert(batch_callback.lane == batch.size());
+            }
+
+            std::swap(pending, next_pending);
+        }
+
+        assert(pending.empty()); // The last stage must compute all remaining sequence pairs.
+
+        for (std::optional<alignment_result_t> & result : results)
+            callback(std::move(*result));
+    }
+
+private:
+    //!\brief A stage of the adaptive algorithm.
+    struct stage
+    {
+        //!\brief The alignment algorithm.
+        stage_function_type algorithm;
+        //!\brief The number of alignments that are computed simultaneously.
+        size_t alignments_per_batch;
+        //!\brief The largest sequence size supported by the alignment algorithm.
+        size_t max_sequence_size;
+    };
+
+    //!\brief The stages ordered by increasing score type.
+    std::vector<stage> stages{};
+};
+
+} // namespace seqan3::detail
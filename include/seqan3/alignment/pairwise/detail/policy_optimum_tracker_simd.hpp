@@ -113,6 +113,14 @@ protected:
     using base_policy_t::optimal_score;
     //!\brief The individual offsets used for padding the sequences.
     std::array<original_score_type, simd_traits<score_type>::length> padding_offsets{};
+    //!\brief The smallest score computed in every alignment (only tracked if score overflows are detected).
+    score_type lowest_score{};
+    //!\brief The largest score computed in every alignment (only tracked if score overflows are detected).
+    score_type highest_score{};
+    //!\brief Every score below this bound is considered as overflow.
+    scalar_type lower_score_bound{std::numeric_limits<scalar_type>::lowest()};
+    //!\brief Every score above this bound is considered as overflow.
+    scalar_type upper_score_bound{std::numeric_limits<scalar_type>::max()};
 
     /*!\name Constructors, destructor and assignment
      * \{
@@ -130,12 +138,22 @@ protected:
      * \details
      *
      * Initialises the object to always track the last row and column, since this is needed for the vectorised global
-     * alignment.
+     * alignment. If seqan3::align_cfg::detail::score_overflow_detection is configured, the score range that is
+     * considered free of overflows is shrunk by the configured headroom.
      */
     policy_optimum_tracker_simd(alignment_configuration_t const & config) : base_policy_t{config}
     {
         base_policy_t::test_last_row_cell = true;
         base_policy_t::test_last_column_cell = true;
+
+        if constexpr (traits_type::detects_score_overflow)
+        {
+            int32_t const headroom = get<align_cfg::detail::score_overflow_detection>(config).score_headroom;
+            assert(headroom >= 0 && headroom < std::numeric_limits<scalar_type>::max() / 2);
+
+            lower_score_bound = std::numeric_limits<scalar_type>::lowest() + headroom;
+            upper_score_bound = std::numeric_limits<scalar_type>::max() - headroom;
+        }
     }
     //!\}
 
@@ -143,6 +161,43 @@ protected:
     void reset_optimum()
     {
         optimal_score = simd::fill<score_type>(std::numeric_limits<scalar_type>::lowest());
+        lowest_score = simd::fill<score_type>(0);
+        highest_score = simd::fill<score_type>(0);
+    }
+
+    /*!\brief Tracks every cell of the alignment matrix.
+     * \copydetails seqan3::detail::policy_optimum_tracker::track_cell
+     *
+     * If score overflows are detected, the smallest and the largest score of every alignment are recorded as well.
+     */
+    template <typename cell_t>
+    decltype(auto) track_cell(cell_t && cell, typename traits_type::matrix_coordinate_type coordinate) noexcept
+    {
+        if constexpr (traits_type::detects_score_overflow)
+        {
+            score_type const score = cell.best_score();
+            lowest_score = (score < lowest_score) ? score : lowest_score;
+            highest_score = (highest_score < score) ? score : highest_score;
+        }
+
+        return base_policy_t::track_cell(std::forward<cell_t>(cell), std::move(coordinate));
+    }
+
+    /*!\brief Whether a score of the alignment in the given lane exceeded the range free of overflows.
+     * \param[in] lane The lane of the alignment.
+     *
+     * \details
+     *
+     * Always `false` if seqan3::align_cfg::detail::score_overflow_detection is not configured.
+     * Otherwise, the scores of the alignment are exact if this function returns `false`, since the first score
+     * outside of the range is still computed without an overflow and is recorded by track_cell().
+     */
+    bool score_overflowed(size_t const lane) const noexcept
+    {
+        if constexpr (traits_type::detects_score_overflow)
+            return lowest_score[lane] < lower_score_bound || upper_score_bound < highest_score[lane];
+        else
+            return false;
     }
 
     /*!\brief Initialises the tracker and possibly the binary update operation.
@@ -17,6 +17,7 @@
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
+#include <seqan3/alignment/configuration/align_config_executor.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_on_result.hpp>
 #include <seqan3/alignment/configuration/align_config_output.hpp>
@@ -24,6 +25,7 @@
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_unordered.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
 #include <seqan3/alignment/matrix/detail/trace_directions.hpp>
@@ -114,7 +116,8 @@ public:
     //!\brief Flag to indicate vectorised mode.
     static constexpr bool is_vectorised = configuration_t::template exists<align_cfg::vectorised>();
     //!\brief Flag indicating whether parallel alignment mode is enabled.
-    static constexpr bool is_parallel = configuration_t::template exists<align_cfg::parallel>();
+    static constexpr bool is_parallel = configuration_t::template exists<align_cfg::parallel>()
+                                     || configuration_t::template exists<align_cfg::executor>();
     //!\brief Flag indicating whether global alignment method is enabled.
     static constexpr bool is_global = configuration_t::template exists<seqan3::align_cfg::method_global>();
     //!\brief Flag indicating whether local alignment mode is enabled.
@@ -145,14 +148,6 @@ public:
     using matrix_coordinate_type =
         lazy_conditional_t<is_vectorised, lazy<simd_matrix_coordinate, matrix_index_type>, matrix_coordinate>;
 
-    //!\brief The number of alignments that can be computed in one simd vector.
-    static constexpr size_t alignments_per_vector = []() constexpr
-    {
-        if constexpr (is_vectorised)
-            return simd_traits<score_type>::length;
-        else
-            return 1;
-    }();
     //!\brief Flag indicating whether the score shall be computed.
     static constexpr bool compute_score = configuration_t::template exists<align_cfg::output_score>();
     //!\brief Flag indicating whether the end positions shall be computed.
@@ -172,6 +167,24 @@ public:
                                                   || output_sequence2_id;
     //!\brief Flag indicating whether the trace matrix needs to be computed.
     static constexpr bool requires_trace_information = compute_begin_positions || compute_sequence_alignment;
+    //!\brief Flag indicating whether every batch starts with the narrowest score type that might be sufficient.
+    static constexpr bool is_adaptive_score_type = configuration_t::template exists<align_cfg::adaptive_score_type>()
+                                                && is_vectorised && is_global && !is_banded && !is_debug
+                                                && !compute_end_positions && !requires_trace_information;
+    //!\brief Flag indicating whether the vectorised alignment reports score overflows.
+    static constexpr bool detects_score_overflow =
+        configuration_t::template exists<align_cfg::detail::score_overflow_detection>();
+
+    //!\brief The number of alignments that can be computed in one simd vector.
+    static constexpr size_t alignments_per_vector = []() constexpr
+    {
+        if constexpr (is_adaptive_score_type)
+            return simd_traits<simd_type_t<int8_t>>::length;
+        else if constexpr (is_vectorised)
+            return simd_traits<score_type>::length;
+        else
+            return 1;
+    }();
 };
 
 //------------------------------------------------------------------------------
@@ -17,6 +17,7 @@
 #include <seqan3/alignment/configuration/align_config_edit.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded_simd.hpp>
 
 namespace seqan3::detail
 {
@@ -46,6 +47,11 @@ private:
 
     static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
 
+    //!\brief Whether the sequence pairs are computed with seqan3::detail::edit_distance_unbanded_simd.
+    static constexpr bool use_simd = configuration_traits_type::is_vectorised && !configuration_traits_type::is_banded
+                                  && !configuration_traits_type::compute_begin_positions
+                                  && !configuration_traits_type::compute_sequence_alignment;
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -86,18 +92,32 @@ public:
      *
      * Computes for each contained sequence pair the respective alignment and invokes the given callback for each
      * alignment result.
+     * If seqan3::align_cfg::vectorised is configured, both sequences have the same alphabet and neither the begin
+     * positions nor the alignment are requested, the sequence pairs are computed simultaneously by
+     * seqan3::detail::edit_distance_unbanded_simd.
      */
     template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
         requires std::invocable<callback_t, alignment_result_type>
     constexpr void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
     {
         using std::get;
+        using sequence_pair_t = std::tuple_element_t<0, std::ranges::range_value_t<indexed_sequence_pairs_t>>;
+        using first_alphabet_t = std::ranges::range_value_t<std::tuple_element_t<0, sequence_pair_t>>;
+        using second_alphabet_t = std::ranges::range_value_t<std::tuple_element_t<1, sequence_pair_t>>;
 
-        for (auto && [sequence_pair, index] : indexed_sequence_pairs)
-            compute_single_pair(index,
-                                get<0>(sequence_pair),
-                                get<1>(sequence_pair),
-                                std::forward<callback_t>(callback));
+        if constexpr (use_simd && std::same_as<first_alphabet_t, second_alphabet_t>)
+        {
+            edit_distance_unbanded_simd<config_t, typename traits_t::is_semi_global_type> algo{*cfg_ptr};
+            algo(std::forward<indexed_sequence_pairs_t>(indexed_sequence_pairs), callback);
+        }
+        else
+        {
+            for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+                compute_single_pair(index,
+                                    get<0>(sequence_pair),
+                                    get<1>(sequence_pair),
+                                    std::forward<callback_t>(callback));
+        }
     }
 
 private:
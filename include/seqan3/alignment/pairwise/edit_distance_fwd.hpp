@@ -30,6 +30,9 @@ class edit_distance_score_matrix_full; //forward declaration
 template <typename word_t, bool is_semi_global, bool use_max_errors>
 class edit_distance_trace_matrix_full; //forward declaration
 
+template <typename word_t, bool is_semi_global>
+class edit_distance_trace_matrix_banded; //forward declaration
+
 //!\brief Store no state for state_t.
 template <typename state_t, typename...>
 struct empty_state
@@ -97,6 +100,8 @@ struct default_edit_distance_trait_type
     static constexpr bool is_semi_global = is_semi_global_t::value;
     //!\brief Whether the alignment is a global alignment or not.
     static constexpr bool is_global = !is_semi_global;
+    //!\brief Whether the alignment is restricted to a band, i.e. seqan3::align_cfg::band_fixed_size is configured.
+    static constexpr bool is_banded = alignment_traits_type::is_banded;
     //!\brief Whether the alignment configuration indicates to compute and/or store the score.
     static constexpr bool compute_score = true;
     //!\brief Whether the alignment configuration indicates to compute and/or store the alignment of the sequences.
@@ -115,7 +120,10 @@ struct default_edit_distance_trait_type
     static constexpr bool compute_matrix = compute_score_matrix || compute_trace_matrix;
 
     //!\brief The type of the trace matrix.
-    using trace_matrix_type = edit_distance_trace_matrix_full<word_type, is_semi_global, use_max_errors>;
+    using trace_matrix_type =
+        std::conditional_t<is_banded,
+                           edit_distance_trace_matrix_banded<word_type, is_semi_global>,
+                           edit_distance_trace_matrix_full<word_type, is_semi_global, use_max_errors>>;
     //!\brief The type of the score matrix.
     using score_matrix_type = edit_distance_score_matrix_full<word_type, score_type, is_semi_global, use_max_errors>;
 };
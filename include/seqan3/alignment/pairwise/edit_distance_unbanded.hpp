@@ -6,19 +6,24 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides a pairwise alignment algorithm for edit distance but without band.
+ * \brief Provides a pairwise alignment algorithm for edit distance with or without band.
  * \author Marcel Ehrhardt <marcel.ehrhardt AT fu-berlin.de>
  */
 
 #pragma once
 
 #include <algorithm>
+#include <bit>
 #include <bitset>
 #include <ranges>
+#include <string>
 #include <utility>
 
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/exception.hpp>
 #include <seqan3/alignment/matrix/detail/advanceable_alignment_coordinate.hpp>
 #include <seqan3/alignment/matrix/detail/edit_distance_score_matrix_full.hpp>
+#include <seqan3/alignment/matrix/detail/edit_distance_trace_matrix_banded.hpp>
 #include <seqan3/alignment/matrix/detail/edit_distance_trace_matrix_full.hpp>
 #include <seqan3/alignment/matrix/detail/matrix_concept.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
@@ -403,6 +408,11 @@ protected:
     size_t end_positions_first() const noexcept
     {
         derived_t const * self = static_cast<derived_t const *>(this);
+        // The best score was never updated, i.e. it is located in the first column. Without band, this only happens
+        // for an empty database sequence. With band, the band might only cover the first column of the last row.
+        if (_best_score_col == self->database_it_end)
+            return 0u;
+
         // offset == 0u is a special case if database sequence is empty, because in this case the best column is zero.
         size_t offset = std::ranges::empty(self->database) ? 0u : 1u;
         return std::ranges::distance(std::ranges::begin(self->database), _best_score_col) + offset;
@@ -621,6 +631,387 @@ public:
     //!\}
 };
 
+/*!\brief Only available when default_edit_distance_trait_type::is_banded is true.
+ * \extends default_edit_distance_trait_type
+ *
+ * \details
+ *
+ * Computes the edit distance within the band of seqan3::align_cfg::band_fixed_size using the banded variant of the
+ * bit-vector algorithm by Hyyrö. Only the cells of the band are stored in the bit-vectors, i.e. the bit-vectors are
+ * a window over the rows of a column that moves down by one row from one column to the next. Instead of shifting the
+ * horizontal differences up by one row, the diagonal differences are shifted down by one row. Hence, computing a
+ * column takes `O(band size / w)` instead of `O(|query| / w)` operations, where `w` is the size of a machine word.
+ *
+ * Cells outside of the band cannot be part of an alignment. The differences of the cell above the band and the cell
+ * below the band are set s.t. these cells never contribute to the score of a cell within the band, i.e. they behave as
+ * if their score was infinite.
+ */
+template <typename derived_t, typename edit_traits>
+class edit_distance_unbanded_band_policy :
+    //!\cond
+    edit_traits
+//!\endcond
+{
+protected:
+    static_assert(edit_traits::is_banded, "This policy assumes that edit_traits::is_banded is true.");
+    static_assert(!edit_traits::compute_score_matrix, "The score matrix is not available for a banded edit distance.");
+
+    //!\brief Befriends the derived type.
+    friend derived_t;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_unbanded_band_policy() noexcept = default;                                     //!< Defaulted.
+    edit_distance_unbanded_band_policy(edit_distance_unbanded_band_policy const &) = default;    //!< Defaulted.
+    edit_distance_unbanded_band_policy(edit_distance_unbanded_band_policy &&) noexcept = default; //!< Defaulted.
+    edit_distance_unbanded_band_policy &
+    operator=(edit_distance_unbanded_band_policy const &) = default; //!< Defaulted.
+    edit_distance_unbanded_band_policy &
+    operator=(edit_distance_unbanded_band_policy &&) noexcept = default; //!< Defaulted.
+    ~edit_distance_unbanded_band_policy() noexcept = default;            //!< Defaulted.
+
+    //!\}
+
+    using typename edit_traits::score_type;
+    using typename edit_traits::word_type;
+    using edit_traits::word_size;
+
+    /*!\name Band Policy: Protected Attributes
+     * \copydoc edit_distance_unbanded_band_policy
+     * \{
+     */
+    //!\brief The lower diagonal of the band, restricted to the diagonals of the matrix.
+    int64_t lower_diagonal{};
+    //!\brief The upper diagonal of the band, restricted to the diagonals of the matrix.
+    int64_t upper_diagonal{};
+    //!\brief The number of cells of the band within one column.
+    size_t band_size{};
+    //!\brief The number of machine words of the bit-vectors; contains one additional bit for the cell below the band.
+    size_t band_blocks{};
+    //!\brief The score of the first cell of the band in the current column; only valid if it is below the first row.
+    score_type band_first_score{};
+
+    //!\brief The positive vertical differences of the band.
+    std::vector<word_type> band_vp{};
+    //!\brief The negative vertical differences of the band.
+    std::vector<word_type> band_vn{};
+    //!\brief The matches of the band with the current character of the database.
+    std::vector<word_type> band_b{};
+    //!\brief The diagonal differences of the band.
+    std::vector<word_type> band_d0{};
+    //!\brief The positive horizontal differences of the band.
+    std::vector<word_type> band_hp{};
+    //!\brief The negative horizontal differences of the band.
+    std::vector<word_type> band_hn{};
+    //!\brief The trace_direction::left of the band; only used if the trace matrix is computed.
+    std::vector<word_type> band_left{};
+    //!\brief The trace_direction::diagonal of the band; only used if the trace matrix is computed.
+    std::vector<word_type> band_diagonal{};
+    //!\}
+
+    /*!\name Band Policy: Protected Member Functions
+     * \copydoc edit_distance_unbanded_band_policy
+     * \{
+     */
+    /*!\brief Initialises the band policy and the first column.
+     * \throws seqan3::invalid_alignment_configuration if the band does not cover the begin or the end of the
+     *         alignment.
+     */
+    void band_init()
+    {
+        derived_t * self = static_cast<derived_t *>(this);
+
+        int64_t const query_size = std::ranges::size(self->query);
+        int64_t const database_size = std::ranges::size(self->database);
+        auto const band = get<align_cfg::band_fixed_size>(self->config);
+
+        lower_diagonal = band.lower_diagonal;
+        upper_diagonal = band.upper_diagonal;
+
+        // The first sequence (database) may have free end gaps, the second sequence (query) never has free end gaps.
+        std::string error_cause{};
+        if (upper_diagonal < lower_diagonal)
+            error_cause = " The upper diagonal is smaller than the lower diagonal.";
+        else if (upper_diagonal < 0 || (lower_diagonal > 0 && !edit_traits::is_semi_global))
+            error_cause = " The band starts in a region without free gaps.";
+        else if ((database_size - query_size < lower_diagonal)
+                 || (upper_diagonal + query_size < database_size && !edit_traits::is_semi_global))
+            error_cause = " The band ends in a region without free gaps.";
+
+        if (!error_cause.empty())
+            throw invalid_alignment_configuration{"The selected band [" + std::to_string(lower_diagonal) + ":"
+                                                  + std::to_string(upper_diagonal)
+                                                  + "] cannot be used with the current alignment configuration:"
+                                                  + error_cause};
+
+        // Diagonals outside of the matrix do not contain any cells.
+        lower_diagonal = std::max(lower_diagonal, -query_size);
+        upper_diagonal = std::min(upper_diagonal, database_size);
+        band_size = upper_diagonal - lower_diagonal + 1;
+        band_blocks = band_size / word_size + 1u;
+
+        band_vp.assign(band_blocks, ~word_type{0u});
+        band_vn.assign(band_blocks, word_type{0u});
+        band_b.resize(band_blocks);
+        band_d0.resize(band_blocks);
+        band_hp.resize(band_blocks);
+        band_hn.resize(band_blocks);
+        set_band_boundaries(-upper_diagonal);
+
+        // The band already bounds the computed cells, hence the last row is always active.
+        if constexpr (edit_traits::use_max_errors)
+        {
+            self->max_errors = -get<align_cfg::min_score>(self->config).score;
+            self->last_block = std::max<size_t>(self->vp.size(), 1u) - 1u;
+            self->last_score_mask = self->score_mask;
+        }
+
+        // The score of the last row in the first column is |query|, but this cell might not be covered by the band.
+        if constexpr (edit_traits::is_semi_global)
+            if (!is_in_band(query_size, 0))
+                self->_best_score = std::numeric_limits<score_type>::max();
+
+        if constexpr (edit_traits::compute_trace_matrix)
+        {
+            band_left.assign(band_blocks, word_type{0u});
+            band_diagonal.assign(band_blocks, word_type{0u});
+            std::vector<word_type> up{band_vp};
+            mask_band(up);
+            self->_trace_matrix.add_column(-upper_diagonal, band_left, band_diagonal, up);
+        }
+    }
+
+    //!\brief Computes all columns of the band.
+    void compute_band()
+    {
+        derived_t * self = static_cast<derived_t *>(this);
+        using query_alphabet_type = typename edit_traits::query_alphabet_type;
+
+        int64_t const query_size = std::ranges::size(self->query);
+        size_t const query_blocks = self->vp.size();
+        // In a semi-global alignment, the band leaves the matrix through the last row.
+        int64_t const column_count = std::min<int64_t>(std::ranges::size(self->database), query_size + upper_diagonal);
+
+        for (int64_t column = 0; column < column_count; ++column, ++self->database_it)
+        {
+            // The row of the first bit within the current column.
+            int64_t const first_row = column - upper_diagonal;
+            size_t const rank = seqan3::to_rank(static_cast<query_alphabet_type>(*self->database_it));
+
+            // The bit i of the bit-vectors corresponds to row first_row + i in both columns.
+            load_matches(self->bit_masks.data() + query_blocks * rank, query_blocks, first_row - 1);
+            compute_band_step(first_row);
+
+            // Track the score of the first cell of the band.
+            if (first_row >= 0)
+            {
+                score_type const previous_score = (first_row == 0) ? first_row_score(column) : band_first_score;
+                band_first_score = previous_score + !bit_at(band_d0, 1u);
+            }
+
+            shift_band();
+            set_band_boundaries(first_row + 1);
+
+            // Track the score of the last row.
+            if (is_in_band(query_size, column + 1))
+            {
+                if (is_in_band(query_size, column))
+                {
+                    size_t const bit = query_size - first_row;
+                    self->_score += bit_at(band_hp, bit);
+                    self->_score -= bit_at(band_hn, bit);
+                }
+                else
+                {
+                    self->_score = band_score(query_size, column + 1);
+                }
+
+                if constexpr (edit_traits::is_semi_global)
+                    self->update_best_score();
+            }
+
+            if constexpr (edit_traits::compute_trace_matrix)
+            {
+                mask_band(band_left);
+                mask_band(band_diagonal);
+                std::vector<word_type> up{band_vp};
+                mask_band(up);
+                self->_trace_matrix.add_column(first_row + 1, band_left, band_diagonal, up);
+            }
+        }
+    }
+
+    /*!\brief Computes the differences of the next column in the coordinates of the current column.
+     * \param first_row The row of the first bit in the current column.
+     */
+    void compute_band_step(int64_t const first_row) noexcept
+    {
+        word_type carry_d0{};
+        for (size_t block = 0u; block < band_blocks; ++block)
+        {
+            word_type const vp = band_vp[block];
+            word_type const vn = band_vn[block];
+            // The first cell of the band leaves the band and must not start a diagonal path.
+            word_type const x = (band_b[block] | vn) & ((block == 0u) ? ~word_type{1u} : ~word_type{0u});
+            word_type const t = vp + (x & vp) + carry_d0;
+
+            carry_d0 = (carry_d0 != 0u) ? t <= vp : t < vp;
+            band_d0[block] = (t ^ vp) | x;
+            band_hn[block] = vp & band_d0[block];
+            band_hp[block] = vn | ~(vp | band_d0[block]);
+        }
+
+        // The cell above the band in the next column counts as infinite.
+        band_hp[0] |= word_type{1u};
+        band_hn[0] &= ~word_type{1u};
+
+        // The score of the first row is fixed: it increases by one per column in a global alignment.
+        if (first_row < 0 && -first_row <= static_cast<int64_t>(band_size))
+        {
+            size_t const bit = -first_row;
+            word_type const mask = word_type{1u} << (bit % word_size);
+            band_hp[bit / word_size] = edit_traits::is_global ? (band_hp[bit / word_size] | mask)
+                                                              : (band_hp[bit / word_size] & ~mask);
+            band_hn[bit / word_size] &= ~mask;
+        }
+    }
+
+    //!\brief Computes the vertical differences of the next column and moves the bit-vectors down by one row.
+    void shift_band() noexcept
+    {
+        for (size_t block = 0u; block < band_blocks; ++block)
+        {
+            word_type const d0 = shift_down(band_d0, block);
+
+            if constexpr (edit_traits::compute_trace_matrix)
+            {
+                band_left[block] = shift_down(band_hp, block);
+                band_diagonal[block] = ~(band_b[block] ^ band_d0[block]) >> 1u;
+                if (block + 1u < band_blocks)
+                    band_diagonal[block] |= ~(band_b[block + 1u] ^ band_d0[block + 1u]) << (word_size - 1u);
+            }
+
+            band_vn[block] = band_hp[block] & d0;
+            band_vp[block] = band_hn[block] | ~(d0 | band_hp[block]);
+        }
+    }
+
+    /*!\brief Sets the vertical differences of the cells outside of the band.
+     * \param first_row The row of the first bit in the current column.
+     *
+     * \details
+     *
+     * The cells above the first row decrease by one per row, s.t. the first row keeps its initial score.
+     * The cells below the band increase by one per row.
+     */
+    void set_band_boundaries(int64_t const first_row) noexcept
+    {
+        size_t const rows_above = std::clamp<int64_t>(-first_row + 1, 0, band_size);
+        for (size_t block = 0u; block < band_blocks; ++block)
+        {
+            word_type const above = bit_range(block, 0u, rows_above);
+            word_type const below = bit_range(block, band_size, band_blocks * word_size);
+
+            band_vp[block] = (band_vp[block] & ~above) | below;
+            band_vn[block] = (band_vn[block] | above) & ~below;
+        }
+    }
+
+    /*!\brief Loads the bit masks of the query rows starting at `first_row` into #band_b.
+     * \param masks The bit masks of the current character of the database.
+     * \param mask_blocks The number of machine words of the bit masks.
+     * \param first_row The index of the query character of the first bit; might be negative.
+     */
+    void load_matches(word_type const * masks, size_t const mask_blocks, int64_t const first_row) noexcept
+    {
+        auto word_at = [&](int64_t const index) -> word_type
+        {
+            return (index >= 0 && index < static_cast<int64_t>(mask_blocks)) ? masks[index] : word_type{0u};
+        };
+
+        for (size_t block = 0u; block < band_blocks; ++block)
+        {
+            int64_t const bit = first_row + static_cast<int64_t>(block * word_size);
+            int64_t const signed_word_size = word_size;
+            int64_t const index = (bit >= 0) ? bit / signed_word_size : (bit - signed_word_size + 1) / signed_word_size;
+            size_t const offset = bit - index * signed_word_size;
+
+            band_b[block] = word_at(index) >> offset;
+            if (offset != 0u)
+                band_b[block] |= word_at(index + 1) << (word_size - offset);
+        }
+    }
+
+    /*!\brief Returns the score of a cell of the band in the current column.
+     * \param row The row of the cell; must be covered by the band.
+     * \param column The current column.
+     */
+    score_type band_score(int64_t const row, int64_t const column) const noexcept
+    {
+        int64_t const first_row = column - upper_diagonal;
+        // Start either from the first row or from the first cell of the band.
+        size_t const first_bit = std::max<int64_t>(-first_row, 0);
+        score_type score = (first_row <= 0) ? first_row_score(column) : band_first_score;
+
+        for (size_t block = 0u; block < band_blocks; ++block)
+        {
+            word_type const mask = bit_range(block, first_bit + 1u, row - first_row + 1);
+            score += std::popcount(band_vp[block] & mask);
+            score -= std::popcount(band_vn[block] & mask);
+        }
+
+        return score;
+    }
+
+    //!\brief Returns the score of the cell in the first row and the given column.
+    static score_type first_row_score(int64_t const column) noexcept
+    {
+        return edit_traits::is_global ? column : 0;
+    }
+
+    //!\brief Whether the cell is covered by the band.
+    bool is_in_band(int64_t const row, int64_t const column) const noexcept
+    {
+        return column - row >= lower_diagonal && column - row <= upper_diagonal;
+    }
+
+    //!\brief Returns the bit vector shifted down by one row, starting at the given block.
+    static word_type shift_down(std::vector<word_type> const & bits, size_t const block) noexcept
+    {
+        word_type const next = (block + 1u < bits.size()) ? bits[block + 1u] << (word_size - 1u) : word_type{0u};
+        return (bits[block] >> 1u) | next;
+    }
+
+    //!\brief Returns the given bit of the bit vector.
+    static bool bit_at(std::vector<word_type> const & bits, size_t const bit) noexcept
+    {
+        return (bits[bit / word_size] >> (bit % word_size)) & word_type{1u};
+    }
+
+    //!\brief Returns a mask of the bits within [first, last) of the given block.
+    static word_type bit_range(size_t const block, size_t const first, size_t const last) noexcept
+    {
+        size_t const begin = std::clamp(first, block * word_size, (block + 1u) * word_size) - block * word_size;
+        size_t const end = std::clamp(last, block * word_size, (block + 1u) * word_size) - block * word_size;
+
+        auto ones = [](size_t const count) -> word_type
+        {
+            return (count == word_size) ? ~word_type{0u} : (word_type{1u} << count) - 1u;
+        };
+
+        return (begin < end) ? ones(end) & ~ones(begin) : word_type{0u};
+    }
+
+    //!\brief Clears the bits outside of the band.
+    void mask_band(std::vector<word_type> & bits) const noexcept
+    {
+        for (size_t block = 0u; block < band_blocks; ++block)
+            bits[block] &= bit_range(block, 0u, band_size);
+    }
+    //!\}
+};
+
 /*!\brief The same as `value_t &` but it is default constructible and is re-assignable.
  * \tparam value_t The value type of the reference.
  */
@@ -682,6 +1073,7 @@ private:
  * \extends edit_distance_unbanded_score_matrix_policy
  * \extends edit_distance_unbanded_trace_matrix_policy
  * \extends edit_distance_unbanded_max_errors_policy
+ * \extends edit_distance_unbanded_band_policy
  */
 template <std::ranges::viewable_range database_t,
           std::ranges::viewable_range query_t,
@@ -709,6 +1101,10 @@ class edit_distance_unbanded :
     public edit_distance_base<edit_traits::compute_trace_matrix,
                               edit_distance_unbanded_trace_matrix_policy,
                               edit_traits,
+                              edit_distance_unbanded<database_t, query_t, align_config_t, edit_traits>>,
+    public edit_distance_base<edit_traits::is_banded,
+                              edit_distance_unbanded_band_policy,
+                              edit_traits,
                               edit_distance_unbanded<database_t, query_t, align_config_t, edit_traits>>
 //!\endcond
 {
@@ -736,6 +1132,9 @@ private:
     //!\brief Allows seqan3::detail::edit_distance_unbanded_trace_matrix_policy to access this class.
     template <typename other_derived_t, typename other_edit_traits>
     friend class edit_distance_unbanded_trace_matrix_policy;
+    //!\brief Allows seqan3::detail::edit_distance_unbanded_band_policy to access this class.
+    template <typename other_derived_t, typename other_edit_traits>
+    friend class edit_distance_unbanded_band_policy;
 
     using edit_traits::compute_begin_positions;
     using edit_traits::compute_end_positions;
@@ -744,6 +1143,7 @@ private:
     using edit_traits::compute_score_matrix;
     using edit_traits::compute_sequence_alignment;
     using edit_traits::compute_trace_matrix;
+    using edit_traits::is_banded;
     using edit_traits::is_global;
     using edit_traits::is_semi_global;
     using edit_traits::use_max_errors;
@@ -883,7 +1283,7 @@ public:
         score_mask = word_type{1u} << ((std::ranges::size(query) - 1u + word_size) % word_size);
 
         this->score_init();
-        if constexpr (use_max_errors)
+        if constexpr (use_max_errors && !is_banded)
             this->max_errors_init(block_count);
 
         if constexpr (compute_score_matrix)
@@ -903,7 +1303,10 @@ public:
             bit_masks[i] |= word_type{1u} << (j % word_size);
         }
 
-        add_state();
+        if constexpr (is_banded)
+            this->band_init();
+        else
+            add_state();
     }
     //!\}
 
@@ -1006,7 +1409,7 @@ private:
     void compute()
     {
         // limit search width for prefix search (if no matrix needs to be computed)
-        if constexpr (use_max_errors && is_global && !compute_matrix)
+        if constexpr (use_max_errors && is_global && !compute_matrix && !is_banded)
         {
             // Note: For global alignments we know that the database can only be max_length long to have a score less
             // than or equal max_errors in the last cell.
@@ -1026,7 +1429,9 @@ private:
         // distinguish between the version for needles not longer than
         // one machine word and the version for longer needles
         // A special cases is if the second sequence is empty (vp.size() == 0u).
-        if (vp.size() == 0u) // [[unlikely]]
+        if constexpr (is_banded)
+            this->compute_band();
+        else if (vp.size() == 0u) // [[unlikely]]
             compute_empty_query_sequence();
         else if (vp.size() == 1u)
             small_patterns();
@@ -0,0 +1,368 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::edit_distance_unbanded_simd.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/matrix/detail/advanceable_alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_concept.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/detail/bits_of.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the unbanded edit distance of several sequence pairs at once using inter-sequence vectorisation.
+ * \ingroup alignment_pairwise
+ * \tparam align_config_t The configuration type; must be of type seqan3::configuration.
+ * \tparam is_semi_global_t A std::bool_constant; whether leading and trailing gaps in the first sequence are free.
+ *
+ * \details
+ *
+ * This is the vectorised counterpart of seqan3::detail::edit_distance_unbanded. It runs Myers' bit-vector algorithm
+ * for every sequence pair in its own lane of a SIMD vector over 32 bit words, i.e. 4, 8 or 16 sequence pairs are
+ * computed simultaneously on SSE4, AVX2 or AVX512, respectively. The second sequence of a pair is split into blocks of
+ * 32 characters; the number of blocks is the maximum over all sequence pairs of one batch. Hence, this algorithm is
+ * most efficient for many sequence pairs of similar length, e.g. for the verification of read-vs-candidate pairs.
+ *
+ * Both sequences of a pair must have the same alphabet, since the characters are compared by their rank.
+ *
+ * The algorithm computes the score and the end positions. If seqan3::align_cfg::min_score is configured, a global
+ * alignment of a batch is terminated as soon as no sequence pair can reach the minimal score anymore.
+ * The begin positions and the alignment require the trace matrix and are computed by
+ * seqan3::detail::edit_distance_unbanded.
+ */
+template <typename align_config_t, typename is_semi_global_t>
+class edit_distance_unbanded_simd
+{
+private:
+    //!\brief The configuration traits.
+    using traits_type = alignment_configuration_traits<align_config_t>;
+    //!\brief The alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The alignment result value type.
+    using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::original_score_type;
+
+    //!\brief The type of one lane of a bit-vector.
+    using word_type = uint32_t;
+    //!\brief The SIMD vector holding one bit-vector word per sequence pair.
+    using word_simd_type = simd_type_t<word_type>;
+    //!\brief The SIMD vector holding one score per sequence pair.
+    using score_simd_type = simd_type_t<int32_t>;
+
+    static_assert(simd_traits<word_simd_type>::length == simd_traits<score_simd_type>::length,
+                  "The words and the scores must have the same number of lanes.");
+
+    //!\brief The number of bits of one lane.
+    static constexpr size_t word_size = bits_of<word_type>;
+    //!\brief Whether the alignment is semi-global.
+    static constexpr bool is_semi_global = is_semi_global_t::value;
+    //!\brief Whether the minimal score is configured.
+    static constexpr bool use_max_errors = align_config_t::template exists<align_cfg::min_score>();
+
+public:
+    //!\brief The number of sequence pairs that are computed simultaneously.
+    static constexpr size_t batch_size = simd_traits<word_simd_type>::length;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_unbanded_simd() = default;                                                //!< Defaulted.
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd const &) = default;             //!< Defaulted.
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd &&) = default;                  //!< Defaulted.
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd const &) = default; //!< Defaulted.
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd &&) = default;      //!< Defaulted.
+    ~edit_distance_unbanded_simd() = default;                                               //!< Defaulted.
+
+    /*!\brief Constructs the algorithm from the alignment configuration.
+     * \param[in] config The alignment configuration.
+     */
+    explicit edit_distance_unbanded_simd(align_config_t const & config)
+    {
+        if constexpr (use_max_errors)
+            max_errors = -get<align_cfg::min_score>(config).score;
+    }
+    //!\}
+
+    /*!\brief Computes the edit distance for every indexed sequence pair of the given range.
+     * \tparam indexed_sequence_pairs_t The type of the range of the indexed sequence pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback; must model std::invocable with the alignment result type.
+     * \param[in] indexed_sequence_pairs The indexed sequence pairs.
+     * \param[in] callback The callback that is invoked with the alignment results in the order of the pairs.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+        requires std::invocable<callback_t, alignment_result_type>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+        {
+            add_pair(get<0>(sequence_pair), get<1>(sequence_pair), index);
+
+            if (lane_count == batch_size)
+                compute_batch(callback);
+        }
+
+        if (lane_count > 0u)
+            compute_batch(callback);
+    }
+
+private:
+    /*!\brief Encodes a sequence pair in the next free lane.
+     * \param[in] database The first sequence.
+     * \param[in] query The second sequence, which is encoded as bit-vectors.
+     * \param[in] index The index of the sequence pair.
+     */
+    template <typename database_t, typename query_t>
+    void add_pair(database_t && database, query_t && query, size_t const index)
+    {
+        using query_alphabet_type = std::remove_cvref_t<std::ranges::range_reference_t<query_t>>;
+        static constexpr size_t sigma = alphabet_size<query_alphabet_type>;
+
+        static_assert(std::same_as<std::ranges::range_value_t<query_t>, std::ranges::range_value_t<database_t>>,
+                      "The characters are compared by their rank, hence both sequences must have the same alphabet.");
+
+        size_t const lane = lane_count++;
+        size_t const query_size = std::ranges::size(query);
+        size_t const database_size = std::ranges::size(database);
+        size_t const block_count = std::max<size_t>((query_size + word_size - 1u) / word_size, 1u);
+
+        indices[lane] = index;
+        query_sizes[lane] = query_size;
+        database_sizes[lane] = database_size;
+
+        // Blocks are stored one after another, s.t. adding blocks does not move the encoding of the other lanes.
+        if (block_count > blocks)
+        {
+            bit_masks.resize(block_count * sigma * batch_size, word_type{});
+            blocks = block_count;
+        }
+
+        for (size_t row = 0u; row < query_size; ++row)
+        {
+            size_t const block = row / word_size;
+            bit_masks[(block * sigma + to_rank(query[row])) * batch_size + lane] |= word_type{1u} << (row % word_size);
+        }
+
+        // The ranks of the first sequence are stored column-wise for all lanes.
+        if (database_size > columns)
+        {
+            ranks.resize(database_size * batch_size, 0u);
+            columns = database_size;
+        }
+
+        size_t column = 0u;
+        for (auto && symbol : database)
+            ranks[column++ * batch_size + lane] = to_rank(symbol);
+
+        sigma_size = sigma;
+    }
+
+    //!\brief Computes the edit distance of all encoded sequence pairs and invokes the callback with the results.
+    template <typename callback_t>
+    void compute_batch(callback_t & callback)
+    {
+        std::vector<word_simd_type> vp(blocks, ~simd::fill<word_simd_type>(0u));
+        std::vector<word_simd_type> vn(blocks, simd::fill<word_simd_type>(0u));
+        // The mask of the last row of a lane; only set in the block containing the last row.
+        std::vector<word_simd_type> score_masks(blocks, simd::fill<word_simd_type>(0u));
+
+        score_simd_type score = simd::fill<score_simd_type>(0);
+        score_simd_type database_size = simd::fill<score_simd_type>(0);
+        // In a global alignment, the score of an empty query increases in every column.
+        score_simd_type empty_query_delta = simd::fill<score_simd_type>(0);
+
+        for (size_t lane = 0u; lane < lane_count; ++lane)
+        {
+            score[lane] = query_sizes[lane];
+            database_size[lane] = database_sizes[lane];
+
+            if (query_sizes[lane] == 0u)
+                empty_query_delta[lane] = !is_semi_global;
+            else
+                score_masks[(query_sizes[lane] - 1u) / word_size][lane] = word_type{1u}
+                                                                       << ((query_sizes[lane] - 1u) % word_size);
+        }
+
+        score_simd_type best_score = score;
+        score_simd_type best_column = database_size;
+
+        size_t const max_columns = *std::ranges::max_element(database_sizes.begin(),
+                                                            database_sizes.begin() + lane_count);
+        // The bit-vectors of the current block, gathered lane by lane.
+        std::array<word_type, batch_size> lane_masks{};
+
+        size_t column = 0u;
+        for (; column < max_columns; ++column)
+        {
+            word_simd_type carry_d0 = simd::fill<word_simd_type>(0u);
+            word_simd_type carry_hp = simd::fill<word_simd_type>(is_semi_global ? 0u : 1u);
+            word_simd_type carry_hn = simd::fill<word_simd_type>(0u);
+            score_simd_type delta = empty_query_delta;
+
+            word_type const * column_ranks = ranks.data() + column * batch_size;
+            for (size_t block = 0u; block < blocks; ++block)
+            {
+                word_type const * block_masks = bit_masks.data() + block * sigma_size * batch_size;
+                for (size_t lane = 0u; lane < batch_size; ++lane)
+                    lane_masks[lane] = block_masks[column_ranks[lane] * batch_size + lane];
+                word_simd_type const b = std::bit_cast<word_simd_type>(lane_masks);
+
+                word_simd_type hp{};
+                word_simd_type hn{};
+                compute_step(b, vp[block], vn[block], hp, hn, carry_d0, carry_hp, carry_hn);
+
+                // Comparisons return -1 for true.
+                delta -= reinterpret_cast<score_simd_type>((hp & score_masks[block]) != 0u);
+                delta += reinterpret_cast<score_simd_type>((hn & score_masks[block]) != 0u);
+            }
+
+            score_simd_type const current_column = simd::fill<score_simd_type>(column);
+            score_simd_type const is_active = current_column < database_size;
+            score += delta & is_active;
+
+            if constexpr (is_semi_global)
+            {
+                score_simd_type const is_better = is_active & (score <= best_score);
+                best_score = is_better ? score : best_score;
+                best_column = is_better ? current_column + 1 : best_column;
+            }
+            else if constexpr (use_max_errors)
+            {
+                // The score changes by at most one per column, hence the score of the last column is at least the
+                // current score minus the number of remaining columns.
+                score_simd_type const remaining = database_size - current_column - 1;
+                score_simd_type const is_done = (remaining <= 0) | (score - remaining > max_errors);
+                if (std::ranges::all_of(std::views::iota(0u, lane_count),
+                                        [&](size_t lane)
+                                        {
+                                            return is_done[lane] != 0;
+                                        }))
+                {
+                    ++column;
+                    break;
+                }
+            }
+        }
+
+        if constexpr (!is_semi_global)
+            best_score = score;
+
+        for (size_t lane = 0u; lane < lane_count; ++lane)
+        {
+            bool is_valid = true;
+            if constexpr (use_max_errors)
+                is_valid = best_score[lane] <= max_errors && (is_semi_global || column >= database_sizes[lane]);
+
+            result_value_type res_vt{};
+
+            if constexpr (traits_type::output_sequence1_id)
+                res_vt.sequence1_id = indices[lane];
+
+            if constexpr (traits_type::output_sequence2_id)
+                res_vt.sequence2_id = indices[lane];
+
+            if constexpr (traits_type::compute_score)
+                res_vt.score = is_valid ? static_cast<score_type>(-best_score[lane]) : matrix_inf<score_type>;
+
+            if constexpr (traits_type::compute_end_positions)
+            {
+                size_t const end_column = (is_semi_global && is_valid) ? best_column[lane] : database_sizes[lane];
+                res_vt.end_positions = advanceable_alignment_coordinate<>{column_index_type{end_column},
+                                                                          row_index_type{query_sizes[lane]}};
+            }
+
+            callback(alignment_result_type{std::move(res_vt)});
+        }
+
+        reset();
+    }
+
+    //!\brief Computes one block of a column for all lanes (see seqan3::detail::edit_distance_unbanded).
+    static void compute_step(word_simd_type const & b,
+                             word_simd_type & vp,
+                             word_simd_type & vn,
+                             word_simd_type & hp,
+                             word_simd_type & hn,
+                             word_simd_type & carry_d0,
+                             word_simd_type & carry_hp,
+                             word_simd_type & carry_hn) noexcept
+    {
+        word_simd_type x = b | vn;
+        word_simd_type const t = vp + (x & vp) + carry_d0;
+
+        word_simd_type const d0 = (t ^ vp) | x;
+        hn = vp & d0;
+        hp = vn | ~(vp | d0);
+
+        // The carry of the addition is set if the sum wrapped around.
+        word_simd_type const is_less = reinterpret_cast<word_simd_type>(t < vp);
+        word_simd_type const is_equal = reinterpret_cast<word_simd_type>(t == vp);
+        carry_d0 = (is_less | (is_equal & -carry_d0)) & 1u;
+
+        x = (hp << 1u) | carry_hp;
+        vn = x & d0;
+        vp = (hn << 1u) | ~(x | d0) | carry_hn;
+
+        carry_hp = hp >> (word_size - 1u);
+        carry_hn = hn >> (word_size - 1u);
+    }
+
+    //!\brief Clears the encoded sequence pairs.
+    void reset() noexcept
+    {
+        std::ranges::fill(bit_masks, word_type{});
+        std::ranges::fill(ranks, word_type{});
+        lane_count = 0u;
+    }
+
+    //!\brief The maximal number of errors; only used if seqan3::align_cfg::min_score is configured.
+    int32_t max_errors{};
+
+    //!\brief The number of encoded sequence pairs.
+    size_t lane_count{};
+    //!\brief The maximal number of blocks of the encoded sequence pairs.
+    size_t blocks{};
+    //!\brief The maximal length of the first sequences of the encoded sequence pairs.
+    size_t columns{};
+    //!\brief The alphabet size of the second sequences.
+    size_t sigma_size{};
+
+    //!\brief The indices of the encoded sequence pairs.
+    std::array<size_t, batch_size> indices{};
+    //!\brief The lengths of the second sequences.
+    std::array<size_t, batch_size> query_sizes{};
+    //!\brief The lengths of the first sequences.
+    std::array<size_t, batch_size> database_sizes{};
+
+    //!\brief The bit-vectors of the second sequences, stored by block, rank and lane.
+    std::vector<word_type> bit_masks{};
+    //!\brief The ranks of the first sequences, stored by column and lane.
+    std::vector<word_type> ranks{};
+};
+
+} // namespace seqan3::detail
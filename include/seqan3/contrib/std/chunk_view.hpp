@@ -49,10 +49,14 @@ constexpr I div_ceil(I num, I denom)
     return r;
 }
 
-template <std::integral T>
+template <typename T>
 constexpr auto to_unsigned_like(T v) noexcept
 {
-    return static_cast<std::make_unsigned_t<T>>(v);
+    // Integer-class types, e.g. the difference type of std::views::iota over size_t, are not std::integral.
+    if constexpr (std::integral<T>)
+        return static_cast<std::make_unsigned_t<T>>(v);
+    else
+        return static_cast<size_t>(v);
 }
 
 } // namespace seqan::stl::detail::chunk
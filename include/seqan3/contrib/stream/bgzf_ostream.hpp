@@ -20,8 +20,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <functional>
+#include <utility>
+#include <vector>
 
 #include <seqan3/contrib/parallel/serialised_resource_pool.hpp>
 #include <seqan3/contrib/parallel/suspendable_queue.hpp>
@@ -84,6 +88,7 @@ public:
     {
         char    buffer[DefaultPageSize<detail::bgzf_compression>::MAX_BLOCK_SIZE];
         size_t  size;
+        size_t  uncompressedSize;
     };
 
     // Writes the output to the underlying stream when invoked.
@@ -91,12 +96,28 @@ public:
     {
         ostream_reference ostream;
 
+        // The uncompressed and compressed begin of every written block (only if trackBlocks is set).
+        bool                                           trackBlocks;
+        std::vector<std::pair<uint64_t, uint64_t>>     blockOffsets;
+        uint64_t                                       uncompressedOffset;
+        uint64_t                                       compressedOffset;
+
         BufferWriter(ostream_reference ostream) :
-            ostream(ostream)
+            ostream(ostream),
+            trackBlocks(false),
+            blockOffsets(),
+            uncompressedOffset(0),
+            compressedOffset(0)
         {}
 
         bool operator() (OutputBuffer const & outputBuffer)
         {
+            if (trackBlocks)
+                blockOffsets.emplace_back(uncompressedOffset, compressedOffset);
+
+            uncompressedOffset += outputBuffer.uncompressedSize;
+            compressedOffset += outputBuffer.size;
+
             ostream.write(outputBuffer.buffer, outputBuffer.size);
             return ostream.good();
         }
@@ -126,6 +147,7 @@ public:
     Serializer<OutputBuffer, BufferWriter> serializer;
     size_t                                 currentJobId;
     bool                                   currentJobAvail;
+    uint64_t                               submittedSize;   // uncompressed size of all submitted jobs
 
     struct CompressionThread
     {
@@ -153,6 +175,7 @@ public:
                 job.outputBuffer->size = _compressBlock(
                     job.outputBuffer->buffer, sizeof(job.outputBuffer->buffer),
                     &job.buffer[0], job.size, compressionCtx);
+                job.outputBuffer->uncompressedSize = job.size;
 
                 success = releaseValue(streamBuf->serializer, job.outputBuffer);
                 appendValue(streamBuf->idleQueue, jobId);
@@ -171,7 +194,8 @@ public:
         numJobs(numThreads * jobsPerThread),
         jobQueue(numJobs),
         idleQueue(numJobs),
-        serializer(ostream_, numThreads * jobsPerThread)
+        serializer(ostream_, numThreads * jobsPerThread),
+        submittedSize(0)
     {
         jobs.resize(numJobs);
         currentJobId = 0;
@@ -223,6 +247,7 @@ public:
         if (currentJobAvail)
         {
             jobs[currentJobId].size = size;
+            submittedSize += size;
             appendValue(jobQueue, currentJobId);
         }
 
@@ -293,6 +318,38 @@ public:
             overflow(EOF);
     }
 
+    // tellp() returns the uncompressed position; see virtual_offset() for the BGZF virtual file offset
+    pos_type seekoff(off_type ofs, std::ios_base::seekdir dir, std::ios_base::openmode openMode)
+    {
+        if (ofs == 0 && dir == std::ios_base::cur && (openMode & std::ios_base::out))
+            return pos_type(off_type(submittedSize + (this->pptr() - this->pbase())));
+
+        return pos_type(off_type(-1));
+    }
+
+    // Records the offsets of every block written from now on, which is needed by virtual_offset().
+    void track_block_offsets()
+    {
+        serializer.worker.trackBlocks = true;
+    }
+
+    // Converts an uncompressed position returned by tellp() into a BGZF virtual file offset.
+    // All blocks containing the position must have been written, i.e. flush() must have been called.
+    uint64_t virtual_offset(uint64_t uncompressedPos) const
+    {
+        BufferWriter const & writer = serializer.worker;
+        assert(writer.trackBlocks);
+
+        if (uncompressedPos >= writer.uncompressedOffset) // behind the last written block
+            return (writer.compressedOffset << 16) + (uncompressedPos - writer.uncompressedOffset);
+
+        auto block = std::ranges::upper_bound(writer.blockOffsets, uncompressedPos, std::less<>{},
+                                              [](auto const & offsets) { return offsets.first; });
+        assert(block != writer.blockOffsets.begin());
+        --block;
+        return (block->second << 16) + (uncompressedPos - block->first);
+    }
+
     // returns a reference to the output stream
     ostream_reference get_ostream() const    { return serializer.worker.ostream; };
 };
@@ -0,0 +1,350 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::algorithm_executor_streaming.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/execution_handler_parallel.hpp>
+#include <seqan3/utility/parallel/detail/spin_delay.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A streaming algorithm executor that computes the algorithm results in parallel with bounded memory.
+ * \ingroup core_algorithm
+ * \tparam resource_t The underlying range of inputs to be computed; must model std::ranges::viewable_range
+ *                    and std::ranges::forward_range.
+ * \tparam algorithm_t The algorithm to be invoked on the elements of the given resource; must model std::semiregular.
+ * \tparam algorithm_result_t The result type generated by the algorithm; must model std::semiregular.
+ *
+ * \details
+ *
+ * This executor provides the same interface as seqan3::detail::algorithm_executor_blocking with a
+ * seqan3::detail::execution_handler_parallel, but it does not compute all algorithm invocations before returning the
+ * first result. Instead, it keeps a fixed number of algorithm invocations in flight. Their results are stored in a
+ * reorder buffer with one bucket per invocation. As soon as a bucket has been consumed via
+ * seqan3::detail::algorithm_executor_streaming::next_result, the next element of the resource is submitted.
+ * Hence, the memory consumption does not depend on the size of the resource.
+ *
+ * ### Result order
+ *
+ * In the ordered mode, the results are returned in the order of the elements of the resource, i.e. the results of an
+ * invocation are only returned after the results of all previous invocations. If a single invocation takes long,
+ * the other threads continue with the remaining buckets of the buffer.
+ * In the unordered mode, the results of the invocations are returned in the order in which the invocations complete.
+ * The results of a single invocation are still returned together and in the order in which they were generated.
+ *
+ * ### Exception
+ *
+ * An exception thrown by an invocation of the algorithm is rethrown by the call of
+ * seqan3::detail::algorithm_executor_streaming::next_result that would return its results.
+ */
+template <std::ranges::viewable_range resource_t, std::semiregular algorithm_t, std::semiregular algorithm_result_t>
+    requires std::ranges::forward_range<resource_t>
+          && std::invocable<algorithm_t,
+                            std::ranges::range_reference_t<resource_t>,
+                            std::function<void(algorithm_result_t)>>
+class algorithm_executor_streaming
+{
+private:
+    //!\brief The underlying resource type.
+    using resource_type = std::views::all_t<resource_t>;
+    //!\brief The iterator over the underlying resource.
+    using resource_iterator_type = std::ranges::iterator_t<resource_type>;
+
+public:
+    //!\brief The number of buckets per thread that are used if no buffer size is given.
+    static constexpr size_t buckets_per_thread{4u};
+
+    /*!\name Constructors, destructor and assignment
+     * \brief The class is move-only, i.e. it is not copy-constructible or copy-assignable.
+     * \{
+     */
+    algorithm_executor_streaming() = delete;                                                 //!< Deleted.
+    algorithm_executor_streaming(algorithm_executor_streaming const &) = delete;             //!< Deleted.
+    algorithm_executor_streaming(algorithm_executor_streaming &&) = default;                 //!< Defaulted.
+    algorithm_executor_streaming & operator=(algorithm_executor_streaming const &) = delete; //!< Deleted.
+    algorithm_executor_streaming & operator=(algorithm_executor_streaming &&) = default;     //!< Defaulted.
+
+    //!\brief Waits for all algorithm invocations that are in flight.
+    ~algorithm_executor_streaming() = default;
+
+    /*!\brief Constructs this executor with the given resource range.
+     *
+     * \param[in] resource The underlying resource.
+     * \param[in] algorithm The algorithm to invoke on the elements of the underlying resource.
+     * \param[in] result A dummy result object to deduce the type of the underlying buffer value.
+     * \param[in] exec_handler The parallel execution handler.
+     * \param[in] ordered Whether the results are returned in the order of the resource.
+     * \param[in] buffer_size The maximal number of algorithm invocations in flight. If `0`, the number of threads
+     *                        of the execution handler times
+     *                        seqan3::detail::algorithm_executor_streaming::buckets_per_thread is used.
+     *
+     * \details
+     *
+     * No algorithm is invoked before the first call of seqan3::detail::algorithm_executor_streaming::next_result.
+     */
+    algorithm_executor_streaming(resource_t resource,
+                                 algorithm_t algorithm,
+                                 algorithm_result_t const SEQAN3_DOXYGEN_ONLY(result),
+                                 execution_handler_parallel && exec_handler,
+                                 bool const ordered = true,
+                                 size_t const buffer_size = 0u) :
+        state{std::make_unique<internal_state>(std::forward<resource_t>(resource),
+                                               std::move(algorithm),
+                                               std::move(exec_handler),
+                                               ordered,
+                                               buffer_size)}
+    {}
+    //!\}
+
+    /*!\brief Returns the next available algorithm result.
+     * \returns A std::optional that either contains the next algorithm result or is empty, i.e. the
+     *          underlying resource has been completely consumed.
+     * \throws The exception thrown by the algorithm invocation that generated the next result.
+     *
+     * \details
+     *
+     * Blocks until the bucket of the next result is complete. Before waiting, further elements of the resource are
+     * submitted until the buffer is full.
+     */
+    std::optional<algorithm_result_t> next_result()
+    {
+        assert(state != nullptr);
+
+        return state->next_result();
+    }
+
+    //!\brief Checks whether all elements of the input resource were submitted.
+    bool is_eof() noexcept
+    {
+        assert(state != nullptr);
+
+        return state->resource_it == std::ranges::end(state->resource);
+    }
+
+private:
+    //!\brief Stores the results of a single algorithm invocation.
+    struct bucket
+    {
+        //!\brief The results.
+        std::vector<algorithm_result_t> results{};
+        //!\brief The exception thrown by the algorithm.
+        std::exception_ptr exception{};
+        //!\brief Whether the algorithm invocation is complete; protected by the mutex of the internal state.
+        bool completed{false};
+    };
+
+    /*!\brief The internal state stored on the heap such that the algorithm invocations in flight can access it after
+     *        the executor was moved.
+     */
+    struct internal_state
+    {
+        //!\brief Initialises the state and the free buckets.
+        internal_state(resource_t resource,
+                       algorithm_t algorithm,
+                       execution_handler_parallel && exec_handler,
+                       bool const ordered,
+                       size_t const buffer_size) :
+            resource{std::forward<resource_t>(resource)},
+            resource_it{std::ranges::begin(this->resource)},
+            algorithm{std::move(algorithm)},
+            ordered{ordered},
+            exec_handler{std::move(exec_handler)}
+        {
+            size_t const bucket_count =
+                (buffer_size == 0u) ? this->exec_handler.thread_count() * buckets_per_thread : buffer_size;
+
+            buckets.resize(bucket_count);
+            free_buckets.reserve(bucket_count);
+            for (size_t i = bucket_count; i > 0u; --i)
+                free_buckets.push_back(i - 1u);
+        }
+
+        //!\copydoc seqan3::detail::algorithm_executor_streaming::next_result
+        std::optional<algorithm_result_t> next_result()
+        {
+            // Each invocation of the algorithm might produce zero results (e.g. a search might not find a query).
+            while (!current_bucket || current_position == buckets[*current_bucket].results.size())
+            {
+                if (current_bucket)
+                    release_bucket();
+
+                submit();
+
+                if (in_flight.empty())
+                    return std::nullopt;
+
+                current_bucket = wait_for_bucket();
+                current_position = 0u;
+
+                if (std::exception_ptr exception = std::exchange(buckets[*current_bucket].exception, nullptr))
+                {
+                    release_bucket();
+                    std::rethrow_exception(exception);
+                }
+            }
+
+            return std::ranges::iter_move(buckets[*current_bucket].results.begin() + current_position++);
+        }
+
+        //!\brief Submits the next elements of the resource until all buckets are in use.
+        void submit()
+        {
+            for (; !free_buckets.empty() && resource_it != std::ranges::end(resource); ++resource_it)
+            {
+                size_t const id = free_buckets.back();
+                free_buckets.pop_back();
+                in_flight.push_back(id);
+
+                exec_handler.execute(
+                    [this, id, algorithm = algorithm](auto && input, auto && callback) mutable
+                    {
+                        bucket & target = buckets[id];
+                        try
+                        {
+                            algorithm(std::forward<decltype(input)>(input), std::forward<decltype(callback)>(callback));
+                        }
+                        catch (...)
+                        {
+                            target.exception = std::current_exception();
+                        }
+
+                        // The executor might be destructed as soon as the mutex is released.
+                        std::lock_guard lock{mutex};
+                        target.completed = true;
+                        if (!ordered)
+                            completed_buckets.push_back(id);
+                        completed_cv.notify_one();
+                    },
+                    *resource_it,
+                    [&results = buckets[id].results](auto && algorithm_result)
+                    {
+                        results.push_back(std::move(algorithm_result));
+                    });
+            }
+        }
+
+        /*!\brief Waits for the next bucket that can be returned and removes it from the buckets in flight.
+         *
+         * \details
+         *
+         * If the calling thread belongs to the scheduler of the execution handler, e.g. if the algorithm is invoked
+         * from a task of the same scheduler, blocking it might deadlock because the invocations in flight can be
+         * queued behind it. Like seqan3::detail::task_group, it executes pending tasks of the scheduler instead.
+         */
+        size_t wait_for_bucket()
+        {
+            // Whether the next bucket can be returned; the mutex must be locked.
+            auto next_bucket_completed = [this]()
+            {
+                return ordered ? buckets[in_flight.front()].completed : !completed_buckets.empty();
+            };
+
+            std::unique_lock lock{mutex};
+            if (work_stealing_scheduler & scheduler = exec_handler.scheduler(); scheduler.is_worker_thread())
+            {
+                spin_delay delay{};
+                while (!next_bucket_completed())
+                {
+                    lock.unlock();
+                    if (!scheduler.run_pending_task())
+                        delay.wait();
+                    lock.lock();
+                }
+            }
+            completed_cv.wait(lock, next_bucket_completed);
+
+            if (ordered)
+            {
+                size_t const id = in_flight.front();
+                in_flight.pop_front();
+                return id;
+            }
+
+            size_t const id = completed_buckets.front();
+            completed_buckets.pop_front();
+            std::erase(in_flight, id);
+            return id;
+        }
+
+        //!\brief Clears the current bucket and makes it available for the next element of the resource.
+        void release_bucket()
+        {
+            bucket & current = buckets[*current_bucket];
+            current.results.clear(); // Keeps the memory for the next invocation.
+            current.completed = false;
+            free_buckets.push_back(*current_bucket);
+            current_bucket.reset();
+        }
+
+        //!\brief The underlying resource.
+        resource_type resource;
+        //!\brief The iterator over the resource pointing to the next element to submit.
+        resource_iterator_type resource_it;
+        //!\brief The algorithm to invoke.
+        algorithm_t algorithm;
+        //!\brief Whether the results are returned in the order of the resource.
+        bool ordered;
+
+        //!\brief The reorder buffer.
+        std::vector<bucket> buckets{};
+        //!\brief The ids of the buckets that are not in use.
+        std::vector<size_t> free_buckets{};
+        //!\brief The ids of the buckets in flight in the order of the resource.
+        std::deque<size_t> in_flight{};
+        //!\brief The ids of the completed buckets in the order of completion; only used in the unordered mode.
+        std::deque<size_t> completed_buckets{};
+        //!\brief The id of the bucket whose results are returned.
+        std::optional<size_t> current_bucket{};
+        //!\brief The position of the next result in the current bucket.
+        size_t current_position{};
+
+        //!\brief Protects the completion of the buckets.
+        std::mutex mutex{};
+        //!\brief Notifies the consumer about completed buckets.
+        std::condition_variable completed_cv{};
+
+        //!\brief The execution handler; destructed first to wait for the invocations in flight.
+        execution_handler_parallel exec_handler;
+    };
+
+    //!\brief The internal state.
+    std::unique_ptr<internal_state> state{};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::algorithm_executor_streaming
+ * \{
+ */
+
+//!\brief Deduce the type from the provided arguments.
+template <typename resource_rng_t, std::semiregular algorithm_t, std::semiregular algorithm_result_t>
+algorithm_executor_streaming(resource_rng_t &&,
+                             algorithm_t,
+                             algorithm_result_t const &,
+                             execution_handler_parallel &&,
+                             bool const = true,
+                             size_t const = 0u)
+    -> algorithm_executor_streaming<resource_rng_t, algorithm_t, algorithm_result_t>;
+//!\}
+} // namespace seqan3::detail
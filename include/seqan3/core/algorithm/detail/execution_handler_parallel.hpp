@@ -14,13 +14,14 @@
 
 #include <concepts>
 #include <functional>
+#include <memory>
 #include <ranges>
 #include <thread>
 #include <type_traits>
 #include <vector>
 
-#include <seqan3/contrib/parallel/buffer_queue.hpp>
 #include <seqan3/utility/parallel/detail/reader_writer_manager.hpp>
+#include <seqan3/utility/parallel/detail/work_stealing_scheduler.hpp>
 #include <seqan3/utility/type_traits/basic.hpp>
 
 namespace seqan3::detail
@@ -38,74 +39,66 @@ namespace seqan3::detail
  *
  * ### Concurrency
  *
- * This class maintains a thread pool and a concurrent queue to execute the algorithm tasks asynchronously.
- * On construction the active consumer threads are spawned in the thread pool and concurrently start fetching
- * algorithm tasks from the concurrent queue. At the same time only one producer thread is allowed to asynchronously
- * submit new algorithm tasks.
+ * This class submits the algorithm tasks to the process-wide seqan3::detail::work_stealing_scheduler with the
+ * requested number of threads (see seqan3::detail::work_stealing_scheduler::shared) and holds it until it is
+ * destructed. Execution handlers with the same number of threads share the threads of the scheduler.
+ * Alternatively, the tasks are submitted to the scheduler of a user-supplied seqan3::thread_pool.
+ * At the same time only one producer thread is allowed to asynchronously submit new algorithm tasks.
+ * An algorithm may split its work into further tasks via a seqan3::detail::task_group over
+ * seqan3::detail::work_stealing_scheduler::current(), which are then processed by idle threads.
  *
  * \note Instances of this class are not copyable.
  *
  * \warning This class is only thread-safe in a single producer context. Multiple consumers are allowed.
  *          Concurrent invocation of the interfaces are undefined behaviour.
- *
- * \attention This class cannot be reused for multiple calls. For this to work, it requires barriers and a queue that
- *            can be reopened.
  */
 class execution_handler_parallel
 {
-private:
-    //!\brief The type erased task type.
-    using task_type = std::function<void()>;
-
 public:
     /*!\name Constructors, destructor and assignment
      * \brief Instances of this class are not copyable.
      * \{
      */
 
-    /*!\brief Constructs the execution handler spawning `thread_count` many threads.
-     * \param thread_count The number of threads to spawn.
+    /*!\brief Constructs the execution handler using `thread_count` many threads.
+     * \param thread_count The number of threads to use.
      *
      * \details
      *
-     * Spawns `thread_count` many threads processing the tasks in the queue in parallel.
+     * Uses the process-wide scheduler with `thread_count` many threads, which processes the tasks in parallel.
+     * The threads are only spawned if no scheduler with this number of threads is in use or kept for reuse.
      */
-    execution_handler_parallel(size_t const thread_count) : state{std::make_unique<internal_state>()}
-    {
-        auto * q = &(state->queue);
-        for (size_t i = 0; i < thread_count; ++i)
-        {
-            state->thread_pool.emplace_back(
-                [q]()
-                {
-                    for (;;)
-                    {
-                        task_type task;
-                        if (q->wait_pop(task) == contrib::queue_op_status::closed)
-                            return;
+    execution_handler_parallel(size_t const thread_count) :
+        state{std::make_unique<internal_state>(work_stealing_scheduler::shared(thread_count))}
+    {}
 
-                        task();
-                    }
-                });
-        }
-    }
+    /*!\brief Constructs the execution handler using the threads of the given scheduler.
+     * \param scheduler The scheduler that processes the tasks; must outlive the execution handler.
+     *
+     * \details
+     *
+     * This is used for a user-supplied seqan3::thread_pool, e.g. via seqan3::align_cfg::executor.
+     */
+    explicit execution_handler_parallel(work_stealing_scheduler & scheduler) :
+        state{std::make_unique<internal_state>(nullptr, scheduler)}
+    {}
 
-    /*!\brief Constructs the execution handler spawning 1 thread.
+    /*!\brief Constructs the execution handler without threads.
      *
      * \details
      *
-     * ### Why only 1 thread?
+     * ### Why no threads?
      *
      * This class is not public. It handles the thread pool when, e.g., using the alignment or search algorithms in
      * parallel via the config. This config requires a value (no default), hence the number of threads is always
      * set by the user.
      *
-     * When we use an algorithm in parallel, we also default construct a execution_handler_parallel along the way. If
-     * the default is set to use all threads, we have to generate the thread pool and a queue. However, this default
-     * constructed execution_handler_parallel is immediately moved away and destructed.
+     * When we use an algorithm in parallel, we also default construct a execution_handler_parallel along the way.
+     * This default constructed execution_handler_parallel is immediately replaced by one with the configured number
+     * of threads, hence it does not acquire a scheduler. Like a moved-from execution handler, it must not be used
+     * before another execution handler is assigned to it.
      */
-    execution_handler_parallel() : execution_handler_parallel{1u}
-    {}
+    execution_handler_parallel() = default;
 
     execution_handler_parallel(execution_handler_parallel const &) = delete;             //!< Deleted.
     execution_handler_parallel(execution_handler_parallel &&) = default;                 //!< Defaulted.
@@ -140,8 +133,8 @@ public:
     {
         assert(state != nullptr);
 
-        // Note: Unfortunately, we can't use std::forward_as_tuple here because a std::function object (`task_type`)
-        // cannot be constructed if the tuple element type is a rvalue-reference.
+        // Note: We can't use std::forward_as_tuple here because the task is executed after this function returned, i.e.
+        // a rvalue-reference to the input might dangle.
         // So we capture the input as a `tuple<algorithm_input_t>` which either is a lvalue reference or has no
         // reference type according to the reference collapsing rules of forwarding references.
         // Then we forward the input into the tuple which either just stores the reference or the input is moved into
@@ -151,17 +144,14 @@ public:
         // Here is a discussion about the problem on stackoverflow:
         // https://stackoverflow.com/questions/26831382/capturing-perfectly-forwarded-variable-in-lambda/
 
-        // Asynchronously pushes the algorithm job as a task to the queue.
+        // Asynchronously submits the algorithm job as a task to the scheduler.
         // Note: that lambda is mutable, s.t. we can move out the content of input_tpl
-        task_type task =
+        state->tasks.run(
             [=, input_tpl = std::tuple<algorithm_input_t>{std::forward<algorithm_input_t>(input)}]() mutable
-        {
-            using forward_input_t = std::tuple_element_t<0, decltype(input_tpl)>;
-            algorithm(std::forward<forward_input_t>(std::get<0>(input_tpl)), std::move(callback));
-        };
-
-        [[maybe_unused]] contrib::queue_op_status status = state->queue.wait_push(std::move(task));
-        assert(status == contrib::queue_op_status::success);
+            {
+                using forward_input_t = std::tuple_element_t<0, decltype(input_tpl)>;
+                algorithm(std::forward<forward_input_t>(std::get<0>(input_tpl)), std::move(callback));
+            });
     }
 
     /*!\brief Asynchronously executes the algorithm for every element of the given input range.
@@ -192,12 +182,30 @@ public:
         wait();
     }
 
-    //!\brief Waits until all submitted algorithm jobs have been completed.
+    //!\brief Returns the number of threads that process the algorithm jobs.
+    size_t thread_count() const noexcept
+    {
+        assert(state != nullptr);
+
+        return state->thread_count;
+    }
+
+    //!\brief Returns the scheduler that processes the algorithm jobs.
+    work_stealing_scheduler & scheduler() const noexcept
+    {
+        assert(state != nullptr);
+
+        return *state->scheduler;
+    }
+
+    /*!\brief Waits until all submitted algorithm jobs have been completed.
+     * \throws The first exception thrown by an algorithm job.
+     */
     void wait()
     {
         assert(state != nullptr);
 
-        state->stop_and_wait();
+        state->tasks.wait();
     }
 
 private:
@@ -209,49 +217,32 @@ private:
      *
      * This class is only intended for use with a single producer model.
      */
-    class internal_state
+    struct internal_state
     {
-    public:
-        /*!\name Constructors, destructor and assignment
-        * \brief Instances of this class are not copyable and not movable.
-        * \{
-        */
-        internal_state() = default;                                  //!< Defaulted.
-        internal_state(internal_state const &) = delete;             //!< Deleted.
-        internal_state(internal_state &&) = delete;                  //!< Deleted.
-        internal_state & operator=(internal_state const &) = delete; //!< Deleted.
-        internal_state & operator=(internal_state &&) = delete;      //!< Deleted.
-
-        //!\brief Waits for threads to finish.
-        ~internal_state()
-        {
-            stop_and_wait();
-        }
-        //!\}
-
-        /*!\brief Waits until all threads have been joined.
-         *
-         * \details
-         *
-         * ### Thread safety
-         *
-         * This function is not thread-safe.
-         */
-        void stop_and_wait()
-        {
-            queue.close();
-
-            for (auto & t : thread_pool)
-            {
-                if (t.joinable())
-                    t.join();
-            }
-        }
-
-        //!\brief The thread pool.
-        std::vector<std::thread> thread_pool{};
-        //!\brief The concurrent queue containing the algorithms to process.
-        contrib::fixed_buffer_queue<task_type> queue{10000};
+        //!\brief Uses and holds the given shared scheduler.
+        explicit internal_state(std::shared_ptr<work_stealing_scheduler> scheduler) :
+            internal_state{scheduler, *scheduler}
+        {}
+
+        //!\brief Uses the given scheduler, which is held by `owner` if it is not `nullptr`.
+        internal_state(std::shared_ptr<work_stealing_scheduler> owner, work_stealing_scheduler & scheduler) :
+            owner{std::move(owner)},
+            scheduler{std::addressof(scheduler)},
+            thread_count{scheduler.thread_count()},
+            tasks{scheduler}
+        {}
+
+        //!\brief Holds a shared scheduler; declared first, such that the tasks are completed before it is released.
+        std::shared_ptr<work_stealing_scheduler> owner;
+
+        //!\brief The scheduler that processes the algorithm jobs.
+        work_stealing_scheduler * scheduler;
+
+        //!\brief The number of threads of the scheduler.
+        size_t thread_count;
+
+        //!\brief The submitted algorithm jobs of the thread pool.
+        task_group tasks;
     };
 
     //!\brief Manages the internal state.
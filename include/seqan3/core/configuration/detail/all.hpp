@@ -14,5 +14,6 @@
 
 #include <seqan3/core/configuration/detail/concept.hpp>
 #include <seqan3/core/configuration/detail/configuration_element_debug_mode.hpp>
+#include <seqan3/core/configuration/detail/configuration_element_executor_mode.hpp>
 #include <seqan3/core/configuration/detail/configuration_element_parallel_mode.hpp>
 #include <seqan3/core/configuration/detail/configuration_utility.hpp>
@@ -0,0 +1,57 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::executor_mode.
+ */
+
+#pragma once
+
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
+
+namespace seqan3::detail
+{
+/*!\brief A global configuration type used to execute algorithms in parallel on a user-supplied seqan3::thread_pool.
+ * \ingroup core_configuration
+ * \tparam wrapped_config_id_t The algorithm specific configuration id wrapped in a std::integral_constant.
+ *
+ * \details
+ *
+ * This type is used to enable the parallel mode of the algorithms with the threads of an existing pool.
+ * The configuration element only stores a pointer to the pool, i.e. the pool must outlive the algorithm.
+ */
+template <typename wrapped_config_id_t>
+class executor_mode : private pipeable_config_element
+{
+public:
+    /*!\name Constructors, assignment and destructor
+     * \{
+     */
+    executor_mode() = default;                                  //!< Defaulted.
+    executor_mode(executor_mode const &) = default;             //!< Defaulted.
+    executor_mode(executor_mode &&) = default;                  //!< Defaulted.
+    executor_mode & operator=(executor_mode const &) = default; //!< Defaulted.
+    executor_mode & operator=(executor_mode &&) = default;      //!< Defaulted.
+    ~executor_mode() = default;                                 //!< Defaulted.
+
+    /*!\brief Sets the thread pool that executes the algorithm.
+     * \param[in] pool_ The thread pool.
+     */
+    explicit executor_mode(thread_pool & pool_) noexcept : pool{&pool_}
+    {}
+    //!\}
+
+    //!\brief The thread pool that executes the algorithm.
+    thread_pool * pool{nullptr};
+
+    /*!\privatesection
+     * \brief Internal id to check for consistent configuration settings.
+     */
+    static constexpr typename wrapped_config_id_t::value_type id{wrapped_config_id_t::value};
+};
+} // namespace seqan3::detail
@@ -0,0 +1,196 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::memory_mapped_file.
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A read-only memory mapping of a whole file.
+ * \ingroup io
+ *
+ * \details
+ *
+ * This raii-wrapper maps a file into the address space of the process via `mmap` and unmaps it on destruction.
+ * The mapping is shared, i.e. multiple processes mapping the same file share the same pages in the page cache.
+ * It assumes owning semantics and is hence only move-constructible and move-assignable.
+ */
+class memory_mapped_file
+{
+public:
+    //!\brief The expected access pattern, passed to `madvise`.
+    enum class access_pattern : uint8_t
+    {
+        normal,     //!< No specific access pattern (`MADV_NORMAL`).
+        random,     //!< Pages are accessed in random order, read-ahead is not useful (`MADV_RANDOM`).
+        sequential, //!< Pages are accessed sequentially, aggressive read-ahead is useful (`MADV_SEQUENTIAL`).
+        will_need   //!< The whole file will be accessed soon, start reading it in the background (`MADV_WILLNEED`).
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_mapped_file() = default;                                       //!< Defaulted.
+    memory_mapped_file(memory_mapped_file const &) = delete;              //!< Deleted.
+    memory_mapped_file & operator=(memory_mapped_file const &) = delete; //!< Deleted.
+
+    //!\brief Move constructor.
+    memory_mapped_file(memory_mapped_file && other) noexcept :
+        mapping{std::exchange(other.mapping, nullptr)},
+        mapping_size{std::exchange(other.mapping_size, 0u)}
+    {}
+
+    //!\brief Move assignment.
+    memory_mapped_file & operator=(memory_mapped_file && other) noexcept
+    {
+        unmap();
+        mapping = std::exchange(other.mapping, nullptr);
+        mapping_size = std::exchange(other.mapping_size, 0u);
+        return *this;
+    }
+
+    //!\brief Unmaps the file.
+    ~memory_mapped_file()
+    {
+        unmap();
+    }
+
+    /*!\brief Maps the file at `path` read-only.
+     * \param[in] path The file to map.
+     * \param[in] pattern The expected access pattern.
+     * \param[in] populate Whether to read the whole file into memory while mapping it (`MAP_POPULATE`). This makes
+     *                     the construction slower, but avoids page faults on the first access. Ignored if the platform
+     *                     does not support `MAP_POPULATE`.
+     * \throws seqan3::file_open_error If the file cannot be opened or mapped.
+     *
+     * \details
+     *
+     * An empty file results in an empty mapping.
+     */
+    explicit memory_mapped_file(std::filesystem::path const & path,
+                                access_pattern const pattern = access_pattern::normal,
+                                [[maybe_unused]] bool const populate = false)
+    {
+        int const file_descriptor = ::open(path.c_str(), O_RDONLY);
+
+        if (file_descriptor == -1)
+            throw file_open_error{"Could not open " + path.string() + " for mapping: " + std::strerror(errno)};
+
+        struct stat file_status;
+        if (::fstat(file_descriptor, &file_status) == -1)
+        {
+            int const error = errno;
+            ::close(file_descriptor);
+            throw file_open_error{"Could not determine the size of " + path.string() + ": " + std::strerror(error)};
+        }
+
+        mapping_size = static_cast<size_t>(file_status.st_size);
+
+        if (mapping_size == 0u)
+        {
+            ::close(file_descriptor);
+            return;
+        }
+
+        int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+        if (populate)
+            flags |= MAP_POPULATE;
+#endif
+
+        void * address = ::mmap(nullptr, mapping_size, PROT_READ, flags, file_descriptor, 0);
+        int const error = errno;
+        ::close(file_descriptor); // The mapping stays valid after closing the file descriptor.
+
+        if (address == MAP_FAILED)
+        {
+            mapping_size = 0u;
+            throw file_open_error{"Could not map " + path.string() + " into memory: " + std::strerror(error)};
+        }
+
+        mapping = static_cast<char const *>(address);
+        advise(pattern);
+    }
+    //!\}
+
+    /*!\brief Changes the expected access pattern of the mapping.
+     * \param[in] pattern The expected access pattern.
+     *
+     * \details
+     *
+     * This is only a hint to the operating system, failures are ignored.
+     */
+    void advise(access_pattern const pattern) const noexcept
+    {
+        if (mapping == nullptr)
+            return;
+
+        int advice{};
+        switch (pattern)
+        {
+            case access_pattern::random:
+                advice = MADV_RANDOM;
+                break;
+            case access_pattern::sequential:
+                advice = MADV_SEQUENTIAL;
+                break;
+            case access_pattern::will_need:
+                advice = MADV_WILLNEED;
+                break;
+            default:
+                advice = MADV_NORMAL;
+        }
+
+        [[maybe_unused]] int const result = ::madvise(const_cast<char *>(mapping), mapping_size, advice);
+    }
+
+    //!\brief Returns a pointer to the first byte of the mapping or `nullptr` if nothing is mapped.
+    char const * data() const noexcept
+    {
+        return mapping;
+    }
+
+    //!\brief Returns the size of the mapping in bytes.
+    size_t size() const noexcept
+    {
+        return mapping_size;
+    }
+
+private:
+    //!\brief Unmaps the file if it is mapped.
+    void unmap() noexcept
+    {
+        if (mapping != nullptr)
+            ::munmap(const_cast<char *>(mapping), mapping_size);
+
+        mapping = nullptr;
+        mapping_size = 0u;
+    }
+
+    //!\brief The address of the mapping.
+    char const * mapping{nullptr};
+    //!\brief The size of the mapping in bytes.
+    size_t mapping_size{};
+};
+
+} // namespace seqan3::detail
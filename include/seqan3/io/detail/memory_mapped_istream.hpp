@@ -0,0 +1,165 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::memory_mapped_streambuf and seqan3::detail::memory_mapped_istream.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <ios>
+#include <istream>
+#include <streambuf>
+
+#include <seqan3/io/detail/memory_mapped_file.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A stream buffer that reads a file through a memory mapping.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The get area points into the mapping, hence reading does not copy the file into a buffer of the stream. Parsers
+ * that scan the get area, e.g. via seqan3::detail::fast_istreambuf_iterator::consume_chunks, work directly on the
+ * page cache. Since std::basic_streambuf::gbump takes an `int`, the get area ends at most 1 GiB after the current
+ * position and is moved forward by `underflow`. The get area always begins at the start of the mapping, hence
+ * every character that was read can be put back.
+ *
+ * The stream buffer supports seeking to any position within the file.
+ */
+class memory_mapped_streambuf : public std::streambuf
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_mapped_streambuf() = delete;                                            //!< Deleted.
+    memory_mapped_streambuf(memory_mapped_streambuf const &) = delete;             //!< Deleted.
+    memory_mapped_streambuf & operator=(memory_mapped_streambuf const &) = delete; //!< Deleted.
+    memory_mapped_streambuf(memory_mapped_streambuf &&) = delete;                  //!< Deleted.
+    memory_mapped_streambuf & operator=(memory_mapped_streambuf &&) = delete;      //!< Deleted.
+    ~memory_mapped_streambuf() override = default;                                 //!< Defaulted.
+
+    /*!\brief Maps the file at `path` and positions the stream buffer at its beginning.
+     * \param[in] path The file to read.
+     * \throws seqan3::file_open_error If the file cannot be opened or mapped.
+     */
+    explicit memory_mapped_streambuf(std::filesystem::path const & path) :
+        file{path, memory_mapped_file::access_pattern::sequential}
+    {
+        set_position(0u);
+    }
+    //!\}
+
+protected:
+    //!\brief Moves the end of the get area forward; returns `eof` if the end of the file is reached.
+    int_type underflow() override
+    {
+        if (gptr() == egptr())
+        {
+            if (position() == file.size())
+                return traits_type::eof();
+
+            set_position(position());
+        }
+
+        return traits_type::to_int_type(*gptr());
+    }
+
+    //!\brief Returns the number of characters until the end of the file.
+    std::streamsize showmanyc() override
+    {
+        return static_cast<std::streamsize>(file.size() - position());
+    }
+
+    //!\brief Moves the position relative to the beginning, the current position, or the end of the file.
+    pos_type seekoff(off_type const offset, std::ios_base::seekdir const direction, std::ios_base::openmode) override
+    {
+        off_type base{};
+
+        if (direction == std::ios_base::cur)
+            base = static_cast<off_type>(position());
+        else if (direction == std::ios_base::end)
+            base = static_cast<off_type>(file.size());
+
+        return seek(base + offset);
+    }
+
+    //!\brief Moves the position to `pos`.
+    pos_type seekpos(pos_type const pos, std::ios_base::openmode) override
+    {
+        return seek(static_cast<off_type>(pos));
+    }
+
+private:
+    //!\brief The maximal number of characters between the current position and the end of the get area.
+    static constexpr size_t max_window_size{size_t{1} << 30};
+
+    //!\brief Returns the current position within the file.
+    size_t position() const noexcept
+    {
+        return static_cast<size_t>(gptr() - eback());
+    }
+
+    //!\brief Moves the position to `offset` if it lies within the file.
+    pos_type seek(off_type const offset)
+    {
+        if (offset < 0 || static_cast<size_t>(offset) > file.size())
+            return pos_type(off_type(-1));
+
+        set_position(static_cast<size_t>(offset));
+        return pos_type(offset);
+    }
+
+    //!\brief Sets the get area such that it begins at the start of the mapping and `gptr()` is at `new_position`.
+    void set_position(size_t const new_position)
+    {
+        // The get area is never written to; the characters can only be put back if they are equal.
+        char * const begin = const_cast<char *>(file.data());
+        setg(begin, begin + new_position, begin + std::min(file.size(), new_position + max_window_size));
+    }
+
+    //!\brief The mapping of the file.
+    memory_mapped_file file;
+};
+
+/*!\brief An input stream over a seqan3::detail::memory_mapped_streambuf.
+ * \ingroup io
+ */
+class memory_mapped_istream : public std::istream
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_mapped_istream() = delete;                                          //!< Deleted.
+    memory_mapped_istream(memory_mapped_istream const &) = delete;             //!< Deleted.
+    memory_mapped_istream & operator=(memory_mapped_istream const &) = delete; //!< Deleted.
+    memory_mapped_istream(memory_mapped_istream &&) = delete;                  //!< Deleted.
+    memory_mapped_istream & operator=(memory_mapped_istream &&) = delete;      //!< Deleted.
+    ~memory_mapped_istream() override = default;                               //!< Defaulted.
+
+    /*!\brief Maps the file at `path`.
+     * \param[in] path The file to read.
+     * \throws seqan3::file_open_error If the file cannot be opened or mapped.
+     */
+    explicit memory_mapped_istream(std::filesystem::path const & path) : std::istream{nullptr}, buffer{path}
+    {
+        rdbuf(&buffer);
+    }
+    //!\}
+
+private:
+    //!\brief The stream buffer reading the mapping.
+    memory_mapped_streambuf buffer;
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,605 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_index.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <seqan3/io/detail/misc_input.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/utility/detail/to_little_endian.hpp>
+
+#if defined(SEQAN3_HAS_ZLIB)
+#    include <seqan3/contrib/stream/bgzf_ostream.hpp>
+#endif
+
+namespace seqan3
+{
+
+/*!\brief The BAI or CSI index of a coordinate-sorted BAM file.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * The index divides every reference sequence into a hierarchy of bins (see section 5 of the
+ * [SAM specification](https://samtools.github.io/hts-specs/SAMv1.pdf) and the
+ * [CSI specification](https://samtools.github.io/hts-specs/CSIv1.pdf)). Every alignment record is assigned to the
+ * smallest bin that contains it and every bin stores the chunks of the file, given as BGZF virtual file offsets, that
+ * contain its alignment records. A query for a region collects the chunks of all bins that overlap the region.
+ *
+ * The smallest bins span `2^min_shift` positions and there are `depth + 1` levels of bins. A BAI index always uses
+ * `min_shift = 14` and `depth = 5` and, hence, only supports positions smaller than `2^29`. The CSI index supports
+ * any combination.
+ *
+ * The index can be read from and written to a `.bai` or a `.csi` file. It is used by seqan3::sam_file_input::region
+ * and can be created while writing a BAM file with seqan3::sam_file_output (see
+ * seqan3::sam_file_output_options::create_index).
+ *
+ * \experimentalapi{Experimental since version 3.3.}
+ */
+class bam_index
+{
+public:
+    //!\brief A range of BGZF virtual file offsets `[begin, end)` that contains alignment records.
+    struct chunk
+    {
+        uint64_t begin{}; //!< The virtual file offset of the first alignment record.
+        uint64_t end{};   //!< The virtual file offset behind the last alignment record.
+
+        //!\brief Compares two chunks.
+        friend bool operator==(chunk const &, chunk const &) = default;
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_index() = default;                              //!< Defaulted; uses the parameters of a BAI index.
+    bam_index(bam_index const &) = default;             //!< Defaulted.
+    bam_index(bam_index &&) = default;                  //!< Defaulted.
+    bam_index & operator=(bam_index const &) = default; //!< Defaulted.
+    bam_index & operator=(bam_index &&) = default;      //!< Defaulted.
+    ~bam_index() = default;                             //!< Defaulted.
+
+    /*!\brief Constructs an empty index with the given binning parameters.
+     * \param[in] min_shift The number of bits of the positions spanned by the smallest bins.
+     * \param[in] depth The number of levels of bins below the root bin.
+     * \throws std::invalid_argument if `min_shift` or `depth` are not positive, if `depth` is greater than 9, or
+     *         if the binning covers more than `2^62` positions.
+     */
+    bam_index(int32_t const min_shift, int32_t const depth) : min_shift_bits{min_shift}, depth_levels{depth}
+    {
+        if (min_shift <= 0 || depth <= 0 || depth > 9 || min_shift + 3 * depth > 62)
+            throw std::invalid_argument{"The binning parameters of a BAM index must fulfil min_shift > 0, "
+                                        "0 < depth <= 9 and min_shift + 3 * depth <= 62."};
+    }
+
+    /*!\brief Reads the index from a BAI or CSI file.
+     * \param[in] filename The path to the index file.
+     * \throws seqan3::file_open_error if the file cannot be opened.
+     * \throws seqan3::format_error if the file is neither a valid BAI nor a valid CSI file.
+     */
+    explicit bam_index(std::filesystem::path const & filename)
+    {
+        std::ifstream file{filename, std::ios_base::in | std::ios::binary};
+        if (!file.good())
+            throw file_open_error{"Could not open file " + filename.string() + " for reading."};
+
+        auto stream = detail::make_secondary_istream(file); // CSI files are BGZF compressed.
+        read(*stream);
+    }
+    //!\}
+
+    //!\brief Returns the number of bits of the positions spanned by the smallest bins.
+    int32_t min_shift() const noexcept
+    {
+        return min_shift_bits;
+    }
+
+    //!\brief Returns the number of levels of bins below the root bin.
+    int32_t depth() const noexcept
+    {
+        return depth_levels;
+    }
+
+    //!\brief Returns the number of reference sequences.
+    size_t reference_count() const noexcept
+    {
+        return references.size();
+    }
+
+    /*!\brief Sets the number of reference sequences.
+     * \param[in] count The number of reference sequences.
+     * \details
+     *
+     * References without alignment records have an empty index. The number must not be smaller than the number of
+     * references that have alignment records.
+     */
+    void reference_count(size_t const count)
+    {
+        assert(count >= references.size() || std::ranges::all_of(references.begin() + count,
+                                                                  references.end(),
+                                                                  [](reference_index const & reference)
+                                                                  {
+                                                                      return reference.bins.empty();
+                                                                  }));
+        references.resize(count);
+    }
+
+    //!\brief Returns the number of alignment records without a reference id.
+    uint64_t unplaced_count() const noexcept
+    {
+        return unplaced;
+    }
+
+    /*!\brief Returns the chunks of the file that contain all alignment records overlapping a region.
+     * \param[in] ref_id The index of the reference sequence.
+     * \param[in] begin The begin position of the region (0-based).
+     * \param[in] end The end position of the region (0-based, exclusive).
+     * \returns The sorted and disjoint chunks of the file that need to be read.
+     *
+     * \details
+     *
+     * The chunks may also contain alignment records that do not overlap the region.
+     */
+    std::vector<chunk> query(int32_t const ref_id, int64_t begin, int64_t end) const
+    {
+        std::vector<chunk> chunks{};
+
+        begin = std::max<int64_t>(begin, 0);
+        end = std::min<int64_t>(end, max_position());
+
+        if (ref_id < 0 || static_cast<size_t>(ref_id) >= references.size() || begin >= end)
+            return chunks;
+
+        reference_index const & reference = references[ref_id];
+
+        // Alignment records that overlap the region start at or behind this offset.
+        uint64_t const min_offset = minimal_offset(reference, begin);
+
+        for_each_overlapping_bin(begin,
+                                 end,
+                                 [&](uint32_t const bin_number)
+                                 {
+                                     auto bin_it = reference.bins.find(bin_number);
+                                     if (bin_it == reference.bins.end())
+                                         return;
+
+                                     for (chunk const & c : bin_it->second.chunks)
+                                         if (c.end > min_offset)
+                                             chunks.push_back({std::max(c.begin, min_offset), c.end});
+                                 });
+
+        std::ranges::sort(chunks,
+                          [](chunk const & lhs, chunk const & rhs)
+                          {
+                              return lhs.begin < rhs.begin;
+                          });
+
+        // Merge overlapping and adjacent chunks.
+        size_t merged = 0;
+        for (size_t i = 1; i < chunks.size(); ++i)
+        {
+            if (chunks[i].begin <= chunks[merged].end)
+                chunks[merged].end = std::max(chunks[merged].end, chunks[i].end);
+            else
+                chunks[++merged] = chunks[i];
+        }
+        chunks.resize(std::min(chunks.size(), merged + 1));
+
+        return chunks;
+    }
+
+    /*!\brief Adds an alignment record to the index.
+     * \param[in] ref_id The index of the reference sequence or -1 if the record is unplaced.
+     * \param[in] begin The begin position of the alignment (0-based).
+     * \param[in] end The end position of the alignment (0-based, exclusive); at least `begin + 1` is used.
+     * \param[in] is_mapped Whether the record is mapped.
+     * \param[in] begin_offset The virtual file offset of the record.
+     * \param[in] end_offset The virtual file offset behind the record.
+     * \throws seqan3::format_error if the records are not added in coordinate-sorted order or if the position exceeds
+     *         the positions supported by the binning parameters.
+     */
+    void add_record(int32_t const ref_id,
+                    int64_t begin,
+                    int64_t end,
+                    bool const is_mapped,
+                    uint64_t const begin_offset,
+                    uint64_t const end_offset)
+    {
+        if (ref_id < 0)
+        {
+            ++unplaced;
+            return;
+        }
+
+        begin = std::max<int64_t>(begin, 0);
+        end = std::max(end, begin + 1);
+
+        if (unplaced > 0 || ref_id < last_ref_id || (ref_id == last_ref_id && begin < last_begin))
+            throw format_error{"The alignment records must be sorted by coordinate to create a BAM index."};
+
+        if (end > max_position())
+            throw format_error{"The alignment end position exceeds the maximal position supported by the BAM index. "
+                               "Please use a CSI index with a larger depth."};
+
+        last_ref_id = ref_id;
+        last_begin = begin;
+
+        if (static_cast<size_t>(ref_id) >= references.size())
+            references.resize(ref_id + 1);
+
+        reference_index & reference = references[ref_id];
+
+        // The chunks of a bin are extended as long as its records are adjacent in the file.
+        std::vector<chunk> & chunks = reference.bins[region_to_bin(begin, end)].chunks;
+        if (chunks.empty() || chunks.back().end != begin_offset)
+            chunks.push_back({begin_offset, end_offset});
+        else
+            chunks.back().end = end_offset;
+
+        // Windows in front of the record cannot be overlapped by this or any following record.
+        size_t const last_window = (end - 1) >> min_shift_bits;
+        if (reference.linear.size() <= last_window)
+            reference.linear.resize(last_window + 1, begin_offset);
+
+        if (reference.mapped_count + reference.unmapped_count == 0u)
+            reference.begin_offset = begin_offset;
+
+        reference.end_offset = end_offset;
+        ++(is_mapped ? reference.mapped_count : reference.unmapped_count);
+    }
+
+    /*!\brief Replaces every file offset stored in the index by its transformation.
+     * \tparam transformation_t The type of the transformation; must model std::regular_invocable with `uint64_t`.
+     * \param[in] transformation A monotonic transformation.
+     *
+     * \details
+     *
+     * This is used by seqan3::sam_file_output, which adds the records with their uncompressed positions in the file
+     * and converts them to virtual file offsets once the BGZF blocks are written.
+     */
+    template <std::regular_invocable<uint64_t> transformation_t>
+    void transform_offsets(transformation_t && transformation)
+    {
+        for (reference_index & reference : references)
+        {
+            for (auto & [bin_number, bin] : reference.bins)
+            {
+                bin.loffset = transformation(bin.loffset);
+                for (chunk & c : bin.chunks)
+                    c = {transformation(c.begin), transformation(c.end)};
+            }
+
+            for (uint64_t & offset : reference.linear)
+                offset = transformation(offset);
+
+            reference.begin_offset = transformation(reference.begin_offset);
+            reference.end_offset = transformation(reference.end_offset);
+        }
+    }
+
+    /*!\brief Writes the index to a file.
+     * \param[in] filename The path to the index file; a CSI index is written if the extension is `.csi` and a BAI
+     *                     index otherwise.
+     * \throws seqan3::file_open_error if the file cannot be opened or if a CSI index is written without ZLIB support.
+     * \throws seqan3::format_error if a BAI index is written for binning parameters other than `min_shift = 14` and
+     *         `depth = 5`.
+     */
+    void write(std::filesystem::path const & filename) const
+    {
+        bool const is_csi = filename.extension() == ".csi";
+
+        if (!is_csi && (min_shift_bits != 14 || depth_levels != 5))
+            throw format_error{"A BAI index requires min_shift = 14 and depth = 5. Please write a CSI index instead."};
+
+        std::ofstream file{filename, std::ios_base::out | std::ios::binary};
+        if (!file.good())
+            throw file_open_error{"Could not open file " + filename.string() + " for writing."};
+
+        if (is_csi)
+        {
+#if defined(SEQAN3_HAS_ZLIB)
+            contrib::bgzf_ostream stream{file};
+            write(stream, true);
+#else
+            throw file_open_error{"Trying to write a CSI index, but no ZLIB available."};
+#endif
+        }
+        else
+        {
+            write(file, false);
+        }
+    }
+
+private:
+    //!\brief A bin of the index.
+    struct bin_type
+    {
+        //!\brief The smallest virtual file offset of the records overlapping the first window of the bin (CSI).
+        uint64_t loffset{};
+        //!\brief The chunks of the file that contain the records of the bin.
+        std::vector<chunk> chunks{};
+    };
+
+    //!\brief The index of a reference sequence.
+    struct reference_index
+    {
+        //!\brief The bins that contain records.
+        std::map<uint32_t, bin_type> bins{};
+        //!\brief The smallest virtual file offset of the records overlapping each window of `2^min_shift` positions.
+        std::vector<uint64_t> linear{};
+        //!\brief The virtual file offset of the first record of the reference.
+        uint64_t begin_offset{};
+        //!\brief The virtual file offset behind the last record of the reference.
+        uint64_t end_offset{};
+        //!\brief The number of mapped records.
+        uint64_t mapped_count{};
+        //!\brief The number of unmapped records that have a position.
+        uint64_t unmapped_count{};
+    };
+
+    //!\brief The number of bits of the positions spanned by the smallest bins.
+    int32_t min_shift_bits{14};
+    //!\brief The number of levels of bins below the root bin.
+    int32_t depth_levels{5};
+    //!\brief The index of every reference sequence.
+    std::vector<reference_index> references{};
+    //!\brief The number of records without a reference id.
+    uint64_t unplaced{};
+    //!\brief The reference id of the last added record.
+    int32_t last_ref_id{-1};
+    //!\brief The begin position of the last added record.
+    int64_t last_begin{-1};
+
+    //!\brief Returns the first position that is not covered by the bins.
+    int64_t max_position() const noexcept
+    {
+        return int64_t{1} << (min_shift_bits + 3 * depth_levels);
+    }
+
+    //!\brief Returns the number of the first bin on the given level.
+    static uint32_t level_offset(int32_t const level) noexcept
+    {
+        return ((uint32_t{1} << (3 * level)) - 1u) / 7u;
+    }
+
+    //!\brief Returns the number of the pseudo bin that stores the metadata of a reference.
+    uint32_t pseudo_bin() const noexcept
+    {
+        return level_offset(depth_levels + 1);
+    }
+
+    //!\brief Returns the smallest bin that contains the region [begin, end); see the SAM specification.
+    uint32_t region_to_bin(int64_t const begin, int64_t end) const noexcept
+    {
+        --end;
+        for (int32_t level = depth_levels, shift = min_shift_bits; level > 0; --level, shift += 3)
+            if (begin >> shift == end >> shift)
+                return level_offset(level) + (begin >> shift);
+
+        return 0u;
+    }
+
+    //!\brief Calls `callback` with every bin that overlaps the region [begin, end); see the SAM specification.
+    template <typename callback_t>
+    void for_each_overlapping_bin(int64_t const begin, int64_t end, callback_t && callback) const
+    {
+        --end;
+        for (int32_t level = 0, shift = min_shift_bits + 3 * depth_levels; level <= depth_levels; ++level, shift -= 3)
+        {
+            for (int64_t bin = begin >> shift; bin <= end >> shift; ++bin)
+                callback(level_offset(level) + static_cast<uint32_t>(bin));
+        }
+    }
+
+    //!\brief Returns the virtual file offset of the first record that can overlap the given position.
+    uint64_t minimal_offset(reference_index const & reference, int64_t const position) const
+    {
+        if (!reference.linear.empty())
+        {
+            size_t const window = std::min<size_t>(position >> min_shift_bits, reference.linear.size() - 1u);
+            return reference.linear[window];
+        }
+
+        // A CSI index has no linear index: use the loffset of the smallest existing bin that contains the position.
+        for (int32_t level = depth_levels, shift = min_shift_bits; level >= 0; --level, shift += 3)
+        {
+            auto bin_it = reference.bins.find(level_offset(level) + (position >> shift));
+            if (bin_it != reference.bins.end())
+                return bin_it->second.loffset;
+        }
+
+        return 0u;
+    }
+
+    //!\brief Returns the loffset of a bin, which is computed from the linear index if available.
+    uint64_t bin_loffset(reference_index const & reference, uint32_t const bin_number, bin_type const & bin) const
+    {
+        if (reference.linear.empty())
+            return bin.loffset;
+
+        int32_t level = 0;
+        while (level < depth_levels && bin_number >= level_offset(level + 1))
+            ++level;
+
+        int32_t const shift = min_shift_bits + 3 * (depth_levels - level);
+        size_t const window = (static_cast<int64_t>(bin_number - level_offset(level)) << shift) >> min_shift_bits;
+        return reference.linear[std::min(window, reference.linear.size() - 1u)];
+    }
+
+    //!\brief Reads an integral value in little endian byte order.
+    template <std::integral number_type>
+    static number_type read_integral(std::istream & stream)
+    {
+        number_type value{};
+        stream.read(reinterpret_cast<char *>(&value), sizeof(value));
+
+        if (!stream.good())
+            throw format_error{"Unexpected end of the BAM index file."};
+
+        return detail::to_little_endian(value);
+    }
+
+    //!\brief Writes an integral value in little endian byte order.
+    template <std::integral number_type>
+    static void write_integral(std::ostream & stream, number_type value)
+    {
+        value = detail::to_little_endian(value);
+        stream.write(reinterpret_cast<char const *>(&value), sizeof(value));
+    }
+
+    //!\brief Reads a BAI or CSI index from a decompressed stream.
+    void read(std::istream & stream)
+    {
+        std::array<char, 4> magic{};
+        stream.read(magic.data(), magic.size());
+        std::string_view const magic_str{magic.data(), magic.size()};
+
+        bool const is_csi = magic_str == std::string_view{"CSI\1", 4};
+        if (!is_csi && magic_str != std::string_view{"BAI\1", 4})
+            throw format_error{"The file is neither a BAI nor a CSI index."};
+
+        if (is_csi)
+        {
+            int32_t const min_shift = read_integral<int32_t>(stream);
+            int32_t const depth = read_integral<int32_t>(stream);
+            *this = bam_index{min_shift, depth};
+
+            int32_t const aux_size = read_integral<int32_t>(stream);
+            stream.ignore(aux_size);
+        }
+
+        references.resize(read_integral<int32_t>(stream));
+
+        for (reference_index & reference : references)
+        {
+            int32_t const bin_count = read_integral<int32_t>(stream);
+
+            for (int32_t i = 0; i < bin_count; ++i)
+            {
+                uint32_t const bin_number = read_integral<uint32_t>(stream);
+                uint64_t const loffset = is_csi ? read_integral<uint64_t>(stream) : 0u;
+                int32_t const chunk_count = read_integral<int32_t>(stream);
+
+                std::vector<chunk> chunks(chunk_count);
+                for (chunk & c : chunks)
+                {
+                    c.begin = read_integral<uint64_t>(stream);
+                    c.end = read_integral<uint64_t>(stream);
+                }
+
+                if (bin_number == pseudo_bin())
+                {
+                    if (chunk_count != 2)
+                        throw format_error{"The metadata of a BAM index reference must consist of two chunks."};
+
+                    reference.begin_offset = chunks[0].begin;
+                    reference.end_offset = chunks[0].end;
+                    reference.mapped_count = chunks[1].begin;
+                    reference.unmapped_count = chunks[1].end;
+                }
+                else
+                {
+                    reference.bins[bin_number] = bin_type{loffset, std::move(chunks)};
+                }
+            }
+
+            if (!is_csi)
+            {
+                reference.linear.resize(read_integral<int32_t>(stream));
+                for (uint64_t & offset : reference.linear)
+                    offset = read_integral<uint64_t>(stream);
+            }
+        }
+
+        // The number of unplaced records is optional.
+        uint64_t value{};
+        if (stream.read(reinterpret_cast<char *>(&value), sizeof(value)))
+            unplaced = detail::to_little_endian(value);
+    }
+
+    //!\brief Writes a BAI or CSI index to an uncompressed stream.
+    void write(std::ostream & stream, bool const is_csi) const
+    {
+        if (is_csi)
+        {
+            stream.write("CSI\1", 4);
+            write_integral(stream, min_shift_bits);
+            write_integral(stream, depth_levels);
+            write_integral(stream, int32_t{0}); // no auxiliary data
+        }
+        else
+        {
+            stream.write("BAI\1", 4);
+        }
+
+        write_integral(stream, static_cast<int32_t>(references.size()));
+
+        for (reference_index const & reference : references)
+        {
+            bool const has_records = reference.mapped_count + reference.unmapped_count > 0u;
+            write_integral(stream, static_cast<int32_t>(reference.bins.size() + has_records));
+
+            for (auto const & [bin_number, bin] : reference.bins)
+            {
+                write_integral(stream, bin_number);
+                if (is_csi)
+                    write_integral(stream, bin_loffset(reference, bin_number, bin));
+
+                write_integral(stream, static_cast<int32_t>(bin.chunks.size()));
+                for (chunk const & c : bin.chunks)
+                {
+                    write_integral(stream, c.begin);
+                    write_integral(stream, c.end);
+                }
+            }
+
+            if (has_records)
+            {
+                write_integral(stream, pseudo_bin());
+                if (is_csi)
+                    write_integral(stream, uint64_t{0});
+
+                write_integral(stream, int32_t{2});
+                write_integral(stream, reference.begin_offset);
+                write_integral(stream, reference.end_offset);
+                write_integral(stream, reference.mapped_count);
+                write_integral(stream, reference.unmapped_count);
+            }
+
+            if (!is_csi)
+            {
+                write_integral(stream, static_cast<int32_t>(reference.linear.size()));
+                for (uint64_t const offset : reference.linear)
+                    write_integral(stream, offset);
+            }
+        }
+
+        write_integral(stream, unplaced);
+
+        if (!stream.good())
+            throw file_open_error{"Could not write the BAM index."};
+    }
+};
+
+} // namespace seqan3
@@ -0,0 +1,264 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::bam_record_view.
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <ranges>
+#include <string_view>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/alphabet/nucleotide/dna16sam.hpp>
+#include <seqan3/alphabet/quality/phred94.hpp>
+#include <seqan3/io/sam_file/format_bam.hpp>
+#include <seqan3/io/sam_file/sam_flag.hpp>
+#include <seqan3/io/sam_file/sam_tag_dictionary.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A non-owning view of a BAM alignment record that decodes the fields on access.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * The view stores the binary representation of a record as given by the BAM specification, starting with the
+ * `refID` field. The fixed-length fields, e.g. the flag, the reference id and the position, are read directly from
+ * the bytes. The variable-length fields are returned as lazy views that decode the CIGAR operations, the 4-bit
+ * encoded bases and the qualities on the fly. Only seqan3::bam_record_view::tags copies its data.
+ *
+ * In contrast to seqan3::sam_record, no memory is allocated when reading a record. The view is returned by
+ * seqan3::sam_file_input::lazy_records and is only valid until the next record is read.
+ *
+ * The CIGAR string of records with more than 65535 operations is stored in the `CG` tag. In this case,
+ * seqan3::bam_record_view::cigar_sequence returns the placeholder CIGAR string `kSmN` of the record.
+ *
+ * \experimentalapi{Experimental since version 3.3.}
+ */
+class bam_record_view
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    bam_record_view() = default;                                    //!< Defaulted.
+    bam_record_view(bam_record_view const &) = default;             //!< Defaulted.
+    bam_record_view(bam_record_view &&) = default;                  //!< Defaulted.
+    bam_record_view & operator=(bam_record_view const &) = default; //!< Defaulted.
+    bam_record_view & operator=(bam_record_view &&) = default;      //!< Defaulted.
+    ~bam_record_view() = default;                                   //!< Defaulted.
+
+    /*!\brief Constructs the view from the bytes of a record.
+     * \param[in] bytes The bytes of the record following the `block_size` field.
+     *
+     * \details
+     *
+     * The bytes must contain all fixed-length and variable-length fields of the record. Records returned by
+     * seqan3::sam_file_input::lazy_records are checked for this when they are read.
+     */
+    explicit bam_record_view(std::string_view const bytes) noexcept : bytes{bytes}
+    {
+        assert(bytes.size() >= fixed_size);
+    }
+    //!\}
+
+    //!\brief Returns the bytes of the record following the `block_size` field.
+    std::string_view raw_bytes() const noexcept
+    {
+        return bytes;
+    }
+
+    /*!\name Fixed-length fields
+     * \{
+     */
+    //!\brief The reference id of the record or std::nullopt if the record is unplaced.
+    std::optional<int32_t> reference_id() const noexcept
+    {
+        return optional_field(0);
+    }
+
+    //!\brief The 0-based position of the record or std::nullopt if it has no position.
+    std::optional<int32_t> reference_position() const noexcept
+    {
+        return optional_field(4);
+    }
+
+    //!\brief The mapping quality.
+    uint8_t mapping_quality() const noexcept
+    {
+        return static_cast<uint8_t>(bytes[9]);
+    }
+
+    //!\brief The flag.
+    sam_flag flag() const noexcept
+    {
+        return static_cast<sam_flag>(field<uint16_t>(14));
+    }
+
+    //!\brief The reference id of the mate or std::nullopt if the mate is unplaced.
+    std::optional<int32_t> mate_reference_id() const noexcept
+    {
+        return optional_field(20);
+    }
+
+    //!\brief The 0-based position of the mate or std::nullopt if it has no position.
+    std::optional<int32_t> mate_position() const noexcept
+    {
+        return optional_field(24);
+    }
+
+    //!\brief The template length.
+    int32_t template_length() const noexcept
+    {
+        return field<int32_t>(28);
+    }
+    //!\}
+
+    /*!\name Variable-length fields
+     * \{
+     */
+    //!\brief The id (read name) of the record.
+    std::string_view id() const noexcept
+    {
+        return bytes.substr(fixed_size, read_name_size() - 1u); // without the \0 character
+    }
+
+    //!\brief A view over the seqan3::cigar elements of the record.
+    auto cigar_sequence() const
+    {
+        char const * const data = bytes.data() + cigar_offset();
+
+        return std::views::iota(size_t{}, cigar_count())
+             | std::views::transform(
+                   [data](size_t const index)
+                   {
+                       // The cigar operation is encoded in 4 bits.
+                       constexpr std::array<char, 16> cigar_operation_mapping{
+                           'M', 'I', 'D', 'N', 'S', 'H', 'P', '=', 'X', '*', '*', '*', '*', '*', '*', '*'};
+
+                       uint32_t operation_and_count{};
+                       std::memcpy(&operation_and_count, data + index * sizeof(uint32_t), sizeof(uint32_t));
+
+                       return cigar{operation_and_count >> 4,
+                                    assign_char_strictly_to(cigar_operation_mapping[operation_and_count & 0x0f],
+                                                            cigar::operation{})};
+                   });
+    }
+
+    //!\brief The number of bases of the record.
+    size_t sequence_size() const noexcept
+    {
+        return static_cast<size_t>(field<int32_t>(16));
+    }
+
+    //!\brief A view over the seqan3::dna16sam bases of the record.
+    auto sequence() const
+    {
+        char const * const data = bytes.data() + sequence_offset();
+
+        return std::views::iota(size_t{}, sequence_size())
+             | std::views::transform(
+                   [data](size_t const index)
+                   {
+                       // 1 byte encodes two bases; the first base is stored in the upper 4 bits.
+                       uint8_t const byte = static_cast<uint8_t>(data[index / 2]);
+                       return dna16sam{}.assign_rank(index % 2 == 0 ? byte >> 4 : byte & 0x0f);
+                   });
+    }
+
+    /*!\brief A view over the seqan3::phred94 qualities of the record.
+     *
+     * \details
+     *
+     * The view is empty if the record has no qualities, i.e. if they are stored as `0xFF` bytes. This corresponds to
+     * the `*` in the QUAL field of the SAM format.
+     */
+    auto base_qualities() const
+    {
+        size_t const offset = quality_offset();
+        bool const has_qualities = sequence_size() == 0u || static_cast<uint8_t>(bytes[offset]) != 0xFF;
+
+        return bytes.substr(offset, has_qualities ? sequence_size() : 0u)
+             | std::views::transform(
+                   [](char const quality)
+                   {
+                       return assign_char_to(static_cast<char>(quality + 33), phred94{});
+                   });
+    }
+
+    //!\brief Decodes the optional fields of the record into a seqan3::sam_tag_dictionary.
+    sam_tag_dictionary tags() const
+    {
+        sam_tag_dictionary dictionary{};
+        format_bam{}.read_sam_dict(bytes.substr(quality_offset() + sequence_size()), dictionary);
+        return dictionary;
+    }
+    //!\}
+
+private:
+    //!\brief The size of the fixed-length fields following the `block_size` field.
+    static constexpr size_t fixed_size{32u};
+
+    //!\brief The bytes of the record following the `block_size` field.
+    std::string_view bytes{};
+
+    //!\brief Reads the fixed-length field at the given byte offset.
+    template <typename number_type>
+    number_type field(size_t const offset) const noexcept
+    {
+        number_type value{};
+        std::memcpy(&value, bytes.data() + offset, sizeof(number_type));
+        return value;
+    }
+
+    //!\brief Reads an int32_t field at the given byte offset, which is -1 if the value is not set.
+    std::optional<int32_t> optional_field(size_t const offset) const noexcept
+    {
+        int32_t const value = field<int32_t>(offset);
+        return value < 0 ? std::nullopt : std::optional<int32_t>{value};
+    }
+
+    //!\brief The length of the read name including the \0 character.
+    size_t read_name_size() const noexcept
+    {
+        return static_cast<uint8_t>(bytes[8]);
+    }
+
+    //!\brief The number of CIGAR operations.
+    size_t cigar_count() const noexcept
+    {
+        return field<uint16_t>(12);
+    }
+
+    //!\brief The offset of the CIGAR operations.
+    size_t cigar_offset() const noexcept
+    {
+        return fixed_size + read_name_size();
+    }
+
+    //!\brief The offset of the 4-bit encoded bases.
+    size_t sequence_offset() const noexcept
+    {
+        return cigar_offset() + cigar_count() * sizeof(uint32_t);
+    }
+
+    //!\brief The offset of the qualities.
+    size_t quality_offset() const noexcept
+    {
+        return sequence_offset() + (sequence_size() + 1u) / 2u;
+    }
+};
+
+} // namespace seqan3
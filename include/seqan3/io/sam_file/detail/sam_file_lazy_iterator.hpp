@@ -0,0 +1,123 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::sam_file_lazy_iterator.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <iterator>
+#include <string_view>
+
+#include <seqan3/io/sam_file/bam_record_view.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Input iterator over the records of a BAM file as seqan3::bam_record_view.
+ * \tparam file_type The type of the file, i.e. a specialisation of seqan3::sam_file_input.
+ * \implements std::input_iterator
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * The iterator reads the bytes of the next record from the file without decoding them. Like
+ * seqan3::detail::in_file_iterator, it is a single-pass iterator and all copies refer to the current record of the
+ * file. The iterator may be compared against std::default_sentinel_t.
+ */
+template <typename file_type>
+class sam_file_lazy_iterator
+{
+    static_assert(!std::is_const_v<file_type>,
+                  "You cannot iterate over const files, because the iterator changes the file.");
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The value type.
+    using value_type = bam_record_view;
+    //!\brief The reference type; the view is returned by value.
+    using reference = bam_record_view;
+    //!\brief The difference type. A signed integer type, usually std::ptrdiff_t.
+    using difference_type = std::ptrdiff_t;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Tag this class as an input iterator.
+    using iterator_category = std::input_iterator_tag;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sam_file_lazy_iterator() = default;                                           //!< Defaulted.
+    sam_file_lazy_iterator(sam_file_lazy_iterator const &) = default;             //!< Defaulted.
+    sam_file_lazy_iterator & operator=(sam_file_lazy_iterator const &) = default; //!< Defaulted.
+    sam_file_lazy_iterator(sam_file_lazy_iterator &&) = default;                  //!< Defaulted.
+    sam_file_lazy_iterator & operator=(sam_file_lazy_iterator &&) = default;      //!< Defaulted.
+    ~sam_file_lazy_iterator() = default;                                          //!< Defaulted.
+
+    //!\brief Construct with reference to host and read the first record.
+    explicit sam_file_lazy_iterator(file_type & host) : host{&host}
+    {
+        read_next_record();
+    }
+    //!\}
+
+    /*!\name Iterator operations
+     * \{
+     */
+    //!\brief Move to the next record in the file.
+    sam_file_lazy_iterator & operator++()
+    {
+        assert(host != nullptr);
+        read_next_record();
+        return *this;
+    }
+
+    //!\brief Post-increment is the same as pre-increment, but returns void.
+    void operator++(int)
+    {
+        ++(*this);
+    }
+
+    //!\brief Returns the view of the current record, which is valid until the iterator is incremented.
+    reference operator*() const noexcept
+    {
+        assert(host != nullptr);
+        return record;
+    }
+    //!\}
+
+    //!\brief Checks whether `it` is equal to the sentinel.
+    friend bool operator==(sam_file_lazy_iterator const & it, std::default_sentinel_t const &) noexcept
+    {
+        return it.at_end;
+    }
+
+private:
+    //!\brief Reads the bytes of the next record.
+    void read_next_record()
+    {
+        std::string_view const bytes = host->read_next_raw_record();
+        at_end = bytes.empty();
+
+        if (!at_end)
+            record = bam_record_view{bytes};
+    }
+
+    //!\brief Pointer to the file.
+    file_type * host{};
+    //!\brief The view of the current record.
+    bam_record_view record{};
+    //!\brief Whether all records were read.
+    bool at_end{false};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,318 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::sam_file_parallel_reader.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <ios>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <seqan3/io/sam_file/format_bam.hpp>
+#include <seqan3/io/sam_file/input_format_concept.hpp>
+#include <seqan3/utility/parallel/detail/work_stealing_scheduler.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Decodes the records of a BAM file in parallel and returns them in the order of the file.
+ * \tparam file_type The type of the file, i.e. a specialisation of seqan3::sam_file_input.
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * The reader owns a fixed number of slots, four per thread. Each slot holds a chunk of whole records, which is split
+ * from the (decompressed) stream without decoding the records, and the batch of records decoded from this chunk. The
+ * slots form a ring: the chunks are decoded as tasks on seqan3::detail::work_stealing_scheduler::shared, while the
+ * calling thread returns the records of the oldest slot. The reader shares the ownership of the scheduler, which is
+ * hence not destructed before the tasks of the slots have finished. When all records of a slot were returned, the slot
+ * is filled with the next chunk of the stream. The number of records held in memory is therefore bounded, and the
+ * records as well as the chunks are reused.
+ *
+ * Every slot has its own copy of the format, hence the format does not need to be thread-safe. The header must be
+ * read before the reader is constructed and is only read by the tasks afterwards.
+ *
+ * Errors are reported in the order of the file: if splitting or decoding a chunk fails, the records preceding the
+ * erroneous record are returned before the exception is rethrown.
+ */
+template <typename file_type>
+class sam_file_parallel_reader
+{
+private:
+    //!\brief The type of the record.
+    using record_type = typename file_type::record_type;
+    //!\brief The type of the header.
+    using header_type = typename file_type::header_type;
+    //!\brief The type of the options.
+    using options_type = decltype(std::declval<file_type &>().options);
+    //!\brief The type of the pointer to the reference sequences.
+    using ref_sequences_ptr_type = typename file_type::traits_type::ref_sequences const *;
+    //!\brief The type of the format.
+    using format_type = sam_file_input_format_exposer<format_bam>;
+
+    //!\brief The number of slots per thread.
+    static constexpr size_t slots_per_thread{4u};
+    //!\brief The maximal number of records in a chunk.
+    static constexpr size_t records_per_chunk{1024u};
+
+    //!\brief A stream buffer that reads from the bytes of a chunk.
+    class chunk_streambuf : public std::streambuf
+    {
+    public:
+        //!\brief Reads from the given bytes.
+        void assign(std::string & bytes)
+        {
+            setg(bytes.data(), bytes.data(), bytes.data() + bytes.size());
+        }
+
+    protected:
+        //!\brief Returns the current position within the chunk; seeking is not supported.
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode) override
+        {
+            if (off != 0 || dir != std::ios_base::cur)
+                return pos_type(off_type(-1));
+
+            return pos_type(gptr() - eback());
+        }
+    };
+
+    //!\brief A chunk of records and its decoded batch.
+    struct slot
+    {
+        //!\brief Constructs the slot with a copy of the format.
+        slot(work_stealing_scheduler & scheduler, format_type const & format) : format{format}, decoding{scheduler}
+        {}
+
+        //!\brief The bytes of the records, each preceded by its `block_size`.
+        std::string chunk{};
+        //!\brief The number of records in the chunk; after decoding, the number of successfully decoded records.
+        size_t record_count{};
+        //!\brief The decoded records; may be larger than seqan3::detail::sam_file_parallel_reader::slot::record_count.
+        std::vector<record_type> records{};
+        //!\brief The exception thrown while splitting or decoding the chunk.
+        std::exception_ptr exception{};
+        //!\brief Whether the slot holds a chunk.
+        bool filled{false};
+        //!\brief The format used to decode the chunk.
+        format_type format;
+        //!\brief The stream buffer over the chunk.
+        chunk_streambuf buffer{};
+        //!\brief The stream over the chunk.
+        std::istream stream{&buffer};
+        //!\brief The task decoding the chunk; destructed first, such that the task does not outlive the slot.
+        task_group decoding;
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sam_file_parallel_reader() = delete;                                             //!< Deleted.
+    sam_file_parallel_reader(sam_file_parallel_reader const &) = delete;             //!< Deleted.
+    sam_file_parallel_reader & operator=(sam_file_parallel_reader const &) = delete; //!< Deleted.
+    sam_file_parallel_reader(sam_file_parallel_reader &&) = delete;                  //!< Deleted.
+    sam_file_parallel_reader & operator=(sam_file_parallel_reader &&) = delete;      //!< Deleted.
+    ~sam_file_parallel_reader() = default;                                           //!< Waits for all tasks.
+
+    /*!\brief Constructs the reader and starts decoding the first chunks.
+     * \param[in] thread_count The number of threads that decode the chunks.
+     * \param[in] format The format of the file; the header must have been read.
+     * \param[in] stream The (decompressed) stream of the file; positioned after `first_record`.
+     * \param[in] header The header of the file.
+     * \param[in] reference_sequences The reference sequences given by the user or `nullptr`.
+     * \param[in] options The options of the file.
+     * \param[in] first_record The bytes of the first record following its `block_size` field.
+     */
+    sam_file_parallel_reader(size_t const thread_count,
+                             format_type const & format,
+                             std::istream & stream,
+                             header_type & header,
+                             ref_sequences_ptr_type const reference_sequences,
+                             options_type const & options,
+                             std::string_view const first_record) :
+        scheduler{work_stealing_scheduler::shared(thread_count)},
+        format{format},
+        stream{&stream},
+        header{&header},
+        reference_sequences{reference_sequences},
+        options{options}
+    {
+        assert(thread_count > 0u);
+
+        for (size_t i = 0; i < slots_per_thread * thread_count; ++i)
+            slots.emplace_back(*scheduler, this->format);
+
+        append_record(slots.front(), first_record);
+
+        for (slot & current : slots)
+            fill(current);
+    }
+    //!\}
+
+    /*!\brief Moves the next record into `record`.
+     * \param[in, out] record The record to fill; its previous content is reused for a later record.
+     * \returns `true` if a record was read, `false` if all records were read.
+     * \throws seqan3::format_error if a record is invalid.
+     */
+    bool read_next_record(record_type & record)
+    {
+        while (true)
+        {
+            slot & current = slots[front];
+
+            if (!current.filled)
+                return false;
+
+            if (!front_is_decoded)
+            {
+                current.decoding.wait();
+                front_is_decoded = true;
+                record_index = 0u;
+            }
+
+            if (record_index < current.record_count)
+            {
+                std::ranges::swap(record, current.records[record_index++]);
+                return true;
+            }
+
+            if (current.exception)
+            {
+                current.filled = false;
+                std::rethrow_exception(std::exchange(current.exception, nullptr));
+            }
+
+            // All records of the slot were returned: fill it with the next chunk.
+            front_is_decoded = false;
+            current.chunk.clear();
+            current.record_count = 0u;
+            fill(current);
+            front = (front + 1u) % slots.size();
+        }
+    }
+
+private:
+    //!\brief Appends a record to the chunk of the slot.
+    static void append_record(slot & current, std::string_view const bytes)
+    {
+        int32_t const block_size = bytes.size();
+        current.chunk.append(reinterpret_cast<char const *>(&block_size), sizeof(block_size));
+        current.chunk.append(bytes);
+        ++current.record_count;
+    }
+
+    //!\brief Splits the next chunk from the stream into the slot and submits the task decoding it.
+    void fill(slot & current)
+    {
+        try
+        {
+            while (!stream_at_end && current.record_count < records_per_chunk)
+            {
+                if (std::istreambuf_iterator<char>{*stream} == std::istreambuf_iterator<char>{})
+                {
+                    stream_at_end = true;
+                    break;
+                }
+
+                std::string_view const bytes =
+                    file_type::read_raw_record(format, *stream, reference_sequences, *header, position);
+                stream_at_end = bytes.empty();
+
+                if (!stream_at_end)
+                    append_record(current, bytes);
+            }
+        }
+        catch (...)
+        {
+            current.exception = std::current_exception();
+            stream_at_end = true;
+        }
+
+        current.filled = current.record_count > 0u || current.exception;
+
+        if (current.record_count > 0u)
+        {
+            current.decoding.run(
+                [this, &current]()
+                {
+                    decode(current);
+                });
+        }
+    }
+
+    //!\brief Decodes the chunk of the slot into its records.
+    void decode(slot & current) const
+    {
+        if (current.records.size() < current.record_count)
+            current.records.resize(current.record_count);
+
+        current.buffer.assign(current.chunk);
+        current.stream.clear();
+        std::streampos record_position{};
+
+        for (size_t i = 0; i < current.record_count; ++i)
+        {
+            try
+            {
+                file_type::read_record(current.format,
+                                       current.stream,
+                                       options,
+                                       reference_sequences,
+                                       *header,
+                                       record_position,
+                                       current.records[i]);
+            }
+            catch (...)
+            {
+                // An error while decoding precedes an error while splitting.
+                current.exception = std::current_exception();
+                current.record_count = i;
+                return;
+            }
+        }
+    }
+
+    //!\brief The shared scheduler decoding the chunks; declared first, such that it outlives the slots.
+    std::shared_ptr<work_stealing_scheduler> scheduler{};
+    //!\brief The format splitting the stream.
+    format_type format;
+    //!\brief The stream of the file.
+    std::istream * stream{};
+    //!\brief The header of the file.
+    header_type * header{};
+    //!\brief The reference sequences given by the user or `nullptr`.
+    ref_sequences_ptr_type reference_sequences{};
+    //!\brief The options of the file.
+    options_type options{};
+    //!\brief The position of the last record split from the stream.
+    std::streampos position{};
+    //!\brief Whether all records were split from the stream.
+    bool stream_at_end{false};
+    //!\brief The slot whose records are returned.
+    size_t front{};
+    //!\brief Whether the chunk of the front slot was decoded.
+    bool front_is_decoded{false};
+    //!\brief The index of the next record of the front slot.
+    size_t record_index{};
+    //!\brief The slots; declared last, such that the tasks are completed before the other members are destructed.
+    std::deque<slot> slots{};
+};
+
+} // namespace seqan3::detail
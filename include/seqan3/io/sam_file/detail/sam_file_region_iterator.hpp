@@ -0,0 +1,204 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::sam_file_region_iterator.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <ios>
+#include <iterator>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+#include <seqan3/io/sam_file/bam_index.hpp>
+#include <seqan3/io/sam_file/format_bam.hpp>
+#include <seqan3/io/sam_file/input_format_concept.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Input iterator over the alignment records of a BAM file that overlap a region.
+ * \tparam file_type The type of the file, i.e. a specialisation of seqan3::sam_file_input.
+ * \implements std::input_iterator
+ * \ingroup io_sam_file
+ *
+ * \details
+ *
+ * The iterator visits the chunks of the file that a seqan3::bam_index reports for the region. Within the chunks,
+ * it skips all records that do not overlap the region and stops at the first record that begins behind the region.
+ * Like seqan3::detail::in_file_iterator, it is a single-pass iterator that dereferences to the record buffer of the
+ * file. The iterator may be compared against std::default_sentinel_t.
+ */
+template <typename file_type>
+class sam_file_region_iterator
+{
+    static_assert(!std::is_const_v<file_type>,
+                  "You cannot iterate over const files, because the iterator changes the file.");
+
+public:
+    /*!\name Member types
+     * \brief The associated types are derived from the `file_type`.
+     * \{
+     */
+    //!\brief The value type.
+    using value_type = typename file_type::value_type;
+    //!\brief The reference type.
+    using reference = typename file_type::reference;
+    //!\brief The const reference type.
+    using const_reference = typename file_type::reference;
+    //!\brief The size type.
+    using size_type = typename file_type::size_type;
+    //!\brief The difference type. A signed integer type, usually std::ptrdiff_t.
+    using difference_type = typename file_type::difference_type;
+    //!\brief The pointer type.
+    using pointer = typename file_type::value_type *;
+    //!\brief Tag this class as an input iterator.
+    using iterator_category = std::input_iterator_tag;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sam_file_region_iterator() = default;                                             //!< Defaulted.
+    sam_file_region_iterator(sam_file_region_iterator const &) = default;             //!< Defaulted.
+    sam_file_region_iterator & operator=(sam_file_region_iterator const &) = default; //!< Defaulted.
+    sam_file_region_iterator(sam_file_region_iterator &&) = default;                  //!< Defaulted.
+    sam_file_region_iterator & operator=(sam_file_region_iterator &&) = default;      //!< Defaulted.
+    ~sam_file_region_iterator() = default;                                            //!< Defaulted.
+
+    /*!\brief Constructs the iterator and buffers the first record that overlaps the region.
+     * \param[in] host The file; its format must be seqan3::format_bam.
+     * \param[in] chunks The sorted chunks of the file that contain the records overlapping the region.
+     * \param[in] ref_id The reference id of the region.
+     * \param[in] begin The begin position of the region.
+     * \param[in] end The end position of the region (exclusive).
+     */
+    sam_file_region_iterator(file_type & host,
+                             std::vector<bam_index::chunk> chunks,
+                             int32_t const ref_id,
+                             int64_t const begin,
+                             int64_t const end) :
+        host{&host},
+        chunks{std::move(chunks)},
+        ref_id{ref_id},
+        begin{begin},
+        end{end}
+    {
+        read_next_overlapping_record();
+    }
+    //!\}
+
+    /*!\name Iterator operations
+     * \{
+     */
+    //!\brief Move to the next record that overlaps the region.
+    sam_file_region_iterator & operator++()
+    {
+        assert(host != nullptr);
+        read_next_overlapping_record();
+        return *this;
+    }
+
+    //!\brief Post-increment is the same as pre-increment, but returns void.
+    void operator++(int)
+    {
+        ++(*this);
+    }
+
+    //!\brief Dereference returns the currently buffered record.
+    reference operator*() const noexcept
+    {
+        assert(host != nullptr);
+        return host->record_buffer;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \brief Only (in-)equality comparison of iterator with std::default_sentinel_t is supported.
+     * \{
+     */
+    //!\brief Checks whether `it` is equal to the sentinel.
+    friend bool operator==(sam_file_region_iterator const & it, std::default_sentinel_t const &) noexcept
+    {
+        return it.at_end;
+    }
+    //!\}
+
+private:
+    //!\brief Reads records until a record overlaps the region or no record can overlap the region anymore.
+    void read_next_overlapping_record()
+    {
+        while (chunk_index < chunks.size())
+        {
+            if (seek_required)
+            {
+                host->secondary_stream->seekg(std::streampos{static_cast<std::streamoff>(chunks[chunk_index].begin)});
+                if (host->secondary_stream->fail())
+                    throw std::runtime_error{"Seeking to file position failed!"};
+
+                host->at_end = false;
+                seek_required = false;
+            }
+
+            host->read_next_record_sequentially();
+            if (host->at_end)
+                break;
+
+            uint64_t const position = static_cast<std::streamoff>(host->position_buffer);
+
+            // Skip the chunks that end before the record, i.e. that were completely read.
+            while (chunk_index < chunks.size() && chunks[chunk_index].end <= position)
+                ++chunk_index;
+
+            if (chunk_index == chunks.size())
+                break;
+
+            if (position < chunks[chunk_index].begin) // The record lies between two chunks.
+            {
+                seek_required = true;
+                continue;
+            }
+
+            auto const & location =
+                std::get<sam_file_input_format_exposer<format_bam>>(host->format).last_record_location();
+
+            // The file is sorted by coordinate, hence no later record overlaps the region.
+            if (location.ref_id != ref_id || location.begin >= end)
+                break;
+
+            if (std::max(location.end, location.begin + 1) > begin)
+                return;
+        }
+
+        at_end = true;
+    }
+
+    //!\brief Pointer to the file.
+    file_type * host{};
+    //!\brief The chunks of the file that contain the records overlapping the region.
+    std::vector<bam_index::chunk> chunks{};
+    //!\brief The chunk that is currently read.
+    size_t chunk_index{};
+    //!\brief Whether the file needs to seek to the begin of the current chunk.
+    bool seek_required{true};
+    //!\brief Whether all records overlapping the region were visited.
+    bool at_end{false};
+    //!\brief The reference id of the region.
+    int32_t ref_id{};
+    //!\brief The begin position of the region.
+    int64_t begin{};
+    //!\brief The end position of the region (exclusive).
+    int64_t end{};
+};
+
+} // namespace seqan3::detail
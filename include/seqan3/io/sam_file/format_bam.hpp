@@ -135,6 +135,28 @@ protected:
     template <typename stream_t, typename header_type>
     void write_header(stream_t & stream, sam_file_output_options const & options, header_type & header);
 
+    //!\brief The location of an alignment record; used to create and query a seqan3::bam_index.
+    struct record_location
+    {
+        int32_t ref_id{-1};  //!< The reference id or -1 if the record is unplaced.
+        int32_t begin{-1};   //!< The begin position of the alignment or -1.
+        int32_t end{-1};     //!< The end position of the alignment (exclusive); `begin` if the CIGAR string is empty.
+        bool is_mapped{};    //!< Whether the record is mapped.
+        size_t byte_size{};  //!< The size of the record in bytes.
+    };
+
+    //!\brief The location of the last alignment record that was read or written.
+    record_location last_record_location{};
+
+    template <typename stream_type, typename ref_seqs_type, typename ref_ids_type>
+    std::string_view read_raw_alignment_record(stream_type & stream,
+                                               ref_seqs_type & ref_seqs,
+                                               sam_file_header<ref_ids_type> & header,
+                                               std::streampos & position_buffer);
+
+    //!\brief Decodes the tags of a record in seqan3::bam_record_view::tags.
+    friend class bam_record_view;
+
 private:
     //!\brief A variable that tracks whether the content of header has been read or not.
     bool header_was_read{false};
@@ -142,6 +164,9 @@ private:
     //!\brief Local buffer to read into while avoiding reallocation.
     std::string string_buffer{};
 
+    //!\brief Stores the bytes of a raw record that spans multiple buffers of the stream.
+    std::string raw_record_buffer{};
+
     //!\brief Stores all fixed length variables which can be read/written directly by reinterpreting the binary stream.
     struct alignment_record_core
     {                             // naming corresponds to official SAM/BAM specifications
@@ -239,11 +264,123 @@ private:
 
     void read_sam_dict(std::string_view const tag_str, sam_tag_dictionary & target);
 
+    template <typename stream_view_type, typename ref_ids_type, typename ref_seqs_type>
+    void read_header_block(stream_view_type && stream_view,
+                           sam_file_header<ref_ids_type> & header,
+                           ref_seqs_type & ref_seqs);
+
     std::vector<cigar> parse_binary_cigar(std::string_view const cigar_str) const;
 
+    /*!\brief Returns the number of reference positions spanned by a binary CIGAR string.
+     * \param[in] cigar_str The binary CIGAR string.
+     */
+    static int32_t binary_cigar_reference_length(std::string_view const cigar_str) noexcept
+    {
+        // The operations M, D, N, = and X (ranks 0, 2, 3, 7 and 8) consume the reference.
+        constexpr uint32_t consumes_reference = 0b1'1000'1101;
+
+        int32_t length{};
+        for (size_t i = 0; i + sizeof(uint32_t) <= cigar_str.size(); i += sizeof(uint32_t))
+        {
+            uint32_t operation{};
+            std::memcpy(&operation, cigar_str.data() + i, sizeof(operation));
+
+            if ((consumes_reference >> (operation & 0x0f)) & 1u)
+                length += operation >> 4;
+        }
+
+        return length;
+    }
+
     static std::string get_tag_dict_str(sam_tag_dictionary const & tag_dict);
 };
 
+/*!\brief Reads the header of a BAM file, i.e. the magic string, the header text and the reference information.
+ * \param[in, out] stream_view The stream view to read from.
+ * \param[in, out] header The header to fill.
+ * \param[in] ref_seqs The reference sequences given by the user or std::ignore.
+ * \throws seqan3::format_error if the header is invalid or does not match the reference information.
+ */
+template <typename stream_view_type, typename ref_ids_type, typename ref_seqs_type>
+inline void format_bam::read_header_block(stream_view_type && stream_view,
+                                          sam_file_header<ref_ids_type> & header,
+                                          ref_seqs_type & ref_seqs)
+{
+    // magic BAM string
+    if (!std::ranges::equal(stream_view | detail::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
+        throw format_error{"File is not in BAM format."};
+
+    int32_t l_text{}; // length of header text including \0 character
+    int32_t n_ref{};  // number of reference sequences
+    int32_t l_name{}; // 1 + length of reference name including \0 character
+    int32_t l_ref{};  // length of reference sequence
+
+    read_integral_byte_field(stream_view, l_text);
+
+    if (l_text > 0) // header text is present
+        read_header(stream_view | detail::take_exactly_or_throw(l_text), header, ref_seqs);
+
+    read_integral_byte_field(stream_view, n_ref);
+
+    for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
+    {
+        read_integral_byte_field(stream_view, l_name);
+
+        string_buffer.resize(l_name - 1);
+        std::ranges::copy_n(std::ranges::begin(stream_view),
+                            l_name - 1,
+                            string_buffer.data()); // copy without \0 character
+        ++std::ranges::begin(stream_view);         // skip \0 character
+
+        read_integral_byte_field(stream_view, l_ref);
+
+        if constexpr (detail::decays_to_ignore_v<ref_seqs_type>) // no reference information given
+        {
+            // If there was no header text, we parse reference sequences block as header information
+            if (l_text == 0)
+            {
+                auto & reference_ids = header.ref_ids();
+                // put the length of the reference sequence into ref_id_info
+                header.ref_id_info.emplace_back(l_ref, "");
+                // put the reference name into reference_ids
+                reference_ids.push_back(string_buffer);
+                // assign the reference name an ascending reference id (starts at index 0).
+                header.ref_dict.emplace(reference_ids.back(), reference_ids.size() - 1);
+                continue;
+            }
+        }
+
+        auto id_it = header.ref_dict.find(string_buffer);
+
+        // sanity checks of reference information to existing header object:
+        if (id_it == header.ref_dict.end()) // [unlikely]
+        {
+            throw format_error{detail::to_string("Unknown reference name '" + string_buffer
+                                                     + "' found in BAM file header (header.ref_ids():",
+                                                 header.ref_ids(),
+                                                 ").")};
+        }
+        else if (id_it->second != ref_idx) // [unlikely]
+        {
+            throw format_error{detail::to_string("Reference id '",
+                                                 string_buffer,
+                                                 "' at position ",
+                                                 ref_idx,
+                                                 " does not correspond to the position ",
+                                                 id_it->second,
+                                                 " in the header (header.ref_ids():",
+                                                 header.ref_ids(),
+                                                 ").")};
+        }
+        else if (std::get<0>(header.ref_id_info[id_it->second]) != l_ref) // [unlikely]
+        {
+            throw format_error{"Provided reference has unequal length as specified in the header."};
+        }
+    }
+
+    header_was_read = true;
+}
+
 //!\copydoc seqan3::sam_file_input_format::read_alignment_record
 template <typename stream_type, // constraints checked by file
           typename seq_legal_alph_type,
@@ -299,79 +436,7 @@ format_bam::read_alignment_record(stream_type & stream,
     // -------------------------------------------------------------------------------------------------------------
     if (!header_was_read)
     {
-        // magic BAM string
-        if (!std::ranges::equal(stream_view | detail::take_exactly_or_throw(4), std::string_view{"BAM\1"}))
-            throw format_error{"File is not in BAM format."};
-
-        int32_t l_text{}; // length of header text including \0 character
-        int32_t n_ref{};  // number of reference sequences
-        int32_t l_name{}; // 1 + length of reference name including \0 character
-        int32_t l_ref{};  // length of reference sequence
-
-        read_integral_byte_field(stream_view, l_text);
-
-        if (l_text > 0) // header text is present
-            read_header(stream_view | detail::take_exactly_or_throw(l_text), header, ref_seqs);
-
-        read_integral_byte_field(stream_view, n_ref);
-
-        for (int32_t ref_idx = 0; ref_idx < n_ref; ++ref_idx)
-        {
-            read_integral_byte_field(stream_view, l_name);
-
-            string_buffer.resize(l_name - 1);
-            std::ranges::copy_n(std::ranges::begin(stream_view),
-                                l_name - 1,
-                                string_buffer.data()); // copy without \0 character
-            ++std::ranges::begin(stream_view);         // skip \0 character
-
-            read_integral_byte_field(stream_view, l_ref);
-
-            if constexpr (detail::decays_to_ignore_v<ref_seqs_type>) // no reference information given
-            {
-                // If there was no header text, we parse reference sequences block as header information
-                if (l_text == 0)
-                {
-                    auto & reference_ids = header.ref_ids();
-                    // put the length of the reference sequence into ref_id_info
-                    header.ref_id_info.emplace_back(l_ref, "");
-                    // put the reference name into reference_ids
-                    reference_ids.push_back(string_buffer);
-                    // assign the reference name an ascending reference id (starts at index 0).
-                    header.ref_dict.emplace(reference_ids.back(), reference_ids.size() - 1);
-                    continue;
-                }
-            }
-
-            auto id_it = header.ref_dict.find(string_buffer);
-
-            // sanity checks of reference information to existing header object:
-            if (id_it == header.ref_dict.end()) // [unlikely]
-            {
-                throw format_error{detail::to_string("Unknown reference name '" + string_buffer
-                                                         + "' found in BAM file header (header.ref_ids():",
-                                                     header.ref_ids(),
-                                                     ").")};
-            }
-            else if (id_it->second != ref_idx) // [unlikely]
-            {
-                throw format_error{detail::to_string("Reference id '",
-                                                     string_buffer,
-                                                     "' at position ",
-                                                     ref_idx,
-                                                     " does not correspond to the position ",
-                                                     id_it->second,
-                                                     " in the header (header.ref_ids():",
-                                                     header.ref_ids(),
-                                                     ").")};
-            }
-            else if (std::get<0>(header.ref_id_info[id_it->second]) != l_ref) // [unlikely]
-            {
-                throw format_error{"Provided reference has unequal length as specified in the header."};
-            }
-        }
-
-        header_was_read = true;
+        read_header_block(stream_view, header, ref_seqs);
 
         if (std::ranges::begin(stream_view) == std::ranges::end(stream_view)) // no records follow
             return;
@@ -428,6 +493,13 @@ format_bam::read_alignment_record(stream_type & stream,
 
     considered_bytes += core.l_read_name;
 
+    last_record_location = {core.refID,
+                            core.pos,
+                            core.pos + binary_cigar_reference_length(record_str.substr(considered_bytes,
+                                                                                       core.n_cigar_op * 4)),
+                            !static_cast<bool>(core.flag & sam_flag::unmapped),
+                            static_cast<size_t>(core.block_size) + 4u};
+
     // read cigar string
     // -------------------------------------------------------------------------------------------------------------
     if constexpr (!detail::decays_to_ignore_v<cigar_type>)
@@ -519,6 +591,101 @@ format_bam::read_alignment_record(stream_type & stream,
     }
 }
 
+/*!\brief Reads the next alignment record without decoding it.
+ * \param[in, out] stream The input stream to read from.
+ * \param[in] ref_seqs The reference sequences given by the user or std::ignore.
+ * \param[in, out] header The header; it is filled when the first record is read.
+ * \param[out] position_buffer The position of the record in the stream.
+ * \returns The bytes of the record following the `block_size` field or an empty view if no record follows.
+ * \throws seqan3::format_error if the record is invalid.
+ *
+ * \details
+ *
+ * The returned bytes point into the buffer of the stream if the record is contained in it. Otherwise, the bytes are
+ * copied into a buffer of the format. In both cases, they are valid until the next record is read.
+ */
+template <typename stream_type, typename ref_seqs_type, typename ref_ids_type>
+inline std::string_view format_bam::read_raw_alignment_record(stream_type & stream,
+                                                              ref_seqs_type & ref_seqs,
+                                                              sam_file_header<ref_ids_type> & header,
+                                                              std::streampos & position_buffer)
+{
+    if (!header_was_read)
+    {
+        auto stream_view = seqan3::detail::istreambuf(stream);
+        read_header_block(stream_view, header, ref_seqs);
+
+        if (std::ranges::begin(stream_view) == std::ranges::end(stream_view)) // no records follow
+            return {};
+    }
+
+    position_buffer = stream.tellg();
+
+    auto stream_it = detail::fast_istreambuf_iterator{*stream.rdbuf()};
+
+    int32_t block_size{};
+    read_integral_byte_field(stream_it.cache_bytes(sizeof(block_size)), block_size);
+
+    if (block_size < static_cast<int32_t>(sizeof(alignment_record_core) - 4)) // [[unlikely]]
+        throw format_error{"The block size of a BAM record is smaller than the size of its fixed-length fields."};
+
+    // A record that spans multiple buffers of the stream is copied into stream_it, which is destroyed on return.
+    bool const is_buffered = stream.rdbuf()->in_avail() >= block_size;
+    std::string_view record_str = stream_it.cache_bytes(block_size);
+
+    if (!is_buffered)
+    {
+        raw_record_buffer.assign(record_str);
+        record_str = raw_record_buffer;
+    }
+
+    int32_t ref_id{};
+    int32_t position{};
+    uint16_t n_cigar_op{};
+    sam_flag flag{};
+    int32_t l_seq{};
+    uint8_t const l_read_name = static_cast<uint8_t>(record_str[8]);
+    read_integral_byte_field(record_str, ref_id);
+    read_integral_byte_field(record_str.substr(4), position);
+    read_integral_byte_field(record_str.substr(12), n_cigar_op);
+    std::memcpy(&flag, record_str.data() + 14, sizeof(flag));
+    read_integral_byte_field(record_str.substr(16), l_seq);
+
+    if (l_read_name < 1 || l_seq < 0) // [[unlikely]]
+        throw format_error{"The read name length or the sequence length of a BAM record is invalid."};
+
+    // The variable-length fields are accessed without bounds checks by seqan3::bam_record_view.
+    size_t const cigar_begin = sizeof(alignment_record_core) - 4 + l_read_name;
+    size_t const variable_size = size_t{n_cigar_op} * 4 + (static_cast<size_t>(l_seq) + 1) / 2 + l_seq;
+
+    if (cigar_begin + variable_size > static_cast<size_t>(block_size)) // [[unlikely]]
+    {
+        throw format_error{detail::to_string("The variable-length fields of a BAM record need ",
+                                             cigar_begin + variable_size,
+                                             " bytes, but its block size is only ",
+                                             block_size,
+                                             ".")};
+    }
+
+    if (ref_id >= static_cast<int32_t>(header.ref_ids().size()) || ref_id < -1) // [[unlikely]]
+    {
+        throw format_error{detail::to_string("Reference id index '",
+                                             ref_id,
+                                             "' is not in range of ",
+                                             "header.ref_ids(), which has size ",
+                                             header.ref_ids().size(),
+                                             ".")};
+    }
+
+    last_record_location = {ref_id,
+                            position,
+                            position + binary_cigar_reference_length(record_str.substr(cigar_begin, n_cigar_op * 4)),
+                            !static_cast<bool>(flag & sam_flag::unmapped),
+                            static_cast<size_t>(block_size) + 4u};
+
+    return record_str;
+}
+
 //!\copydoc seqan3::sam_file_output_format::write_alignment_record
 template <typename stream_type,
           typename header_type,
@@ -736,6 +903,12 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type & st
                           core.l_seq +           // quality string
                           tag_dict_binary_str.size();
 
+        last_record_location = {core.refID,
+                                core.pos,
+                                core.pos + ref_length,
+                                !static_cast<bool>(flag & sam_flag::unmapped),
+                                static_cast<size_t>(core.block_size) + 4u};
+
         std::ranges::copy_n(reinterpret_cast<char *>(&core), sizeof(core), stream_it); // write core
 
         if (std::ranges::empty(id)) // empty id is represented as * for backward compatibility
@@ -16,8 +16,10 @@
 #include <concepts>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <ranges>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -32,6 +34,11 @@
 #include <seqan3/io/detail/misc_input.hpp>
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/exception.hpp>
+#include <seqan3/io/sam_file/bam_index.hpp>
+#include <seqan3/io/sam_file/bam_record_view.hpp>
+#include <seqan3/io/sam_file/detail/sam_file_lazy_iterator.hpp>
+#include <seqan3/io/sam_file/detail/sam_file_parallel_reader.hpp>
+#include <seqan3/io/sam_file/detail/sam_file_region_iterator.hpp>
 #include <seqan3/io/sam_file/format_bam.hpp>
 #include <seqan3/io/sam_file/format_sam.hpp>
 #include <seqan3/io/sam_file/input_format_concept.hpp>
@@ -708,6 +715,125 @@ public:
         return *header_ptr;
     }
 
+    /*!\brief Returns the remaining records of a BAM file as seqan3::bam_record_view, which decode fields on access.
+     * \returns A single-pass input range over seqan3::bam_record_view.
+     * \throws seqan3::format_error if the format of the file is not seqan3::format_bam.
+     *
+     * \details
+     *
+     * In contrast to the range interface of the file, the records are not decoded into the selected fields. Each
+     * seqan3::bam_record_view refers to the bytes of the record in the buffer of the stream and is valid until the
+     * next record is read. This is considerably faster if only some fields of the records are accessed, e.g. for
+     * filtering or counting records by their flag, reference id or position.
+     *
+     * If a record was already read, e.g. by begin() or header(), the range starts at this record. Otherwise, it
+     * starts at the first record. If records were decoded in parallel (see seqan3::sam_file_input_options), the
+     * range starts at an unspecified record. Iterating over the range invalidates all iterators of the file.
+     *
+     * \experimentalapi{Experimental since version 3.3.}
+     */
+    auto lazy_records()
+    {
+        if constexpr (!list_traits::contains<format_bam, valid_formats>)
+        {
+            throw format_error{"Lazy records are only supported for BAM files."};
+        }
+        else
+        {
+            if (!std::holds_alternative<detail::sam_file_input_format_exposer<format_bam>>(format))
+                throw format_error{"Lazy records are only supported for BAM files."};
+
+            if (first_record_was_read && !at_end && parallel_reader == nullptr) // read the buffered record again
+            {
+                secondary_stream->seekg(position_buffer);
+                if (secondary_stream->fail())
+                    throw std::runtime_error{"Seeking to file position failed!"};
+            }
+
+            parallel_reader.reset();
+            first_record_was_read = true;
+
+            return std::ranges::subrange{detail::sam_file_lazy_iterator<sam_file_input>{*this},
+                                         std::default_sentinel};
+        }
+    }
+
+    /*!\name Region queries
+     * \brief Provides random access to the records of an indexed BAM file.
+     * \{
+     */
+    /*!\brief Reads the seqan3::bam_index that is used by region().
+     * \param[in] filename The path to the BAI or CSI file.
+     * \throws seqan3::file_open_error if the file cannot be opened.
+     * \throws seqan3::format_error if the file is not a valid index.
+     *
+     * \details
+     *
+     * Calling this function is only necessary if the file was constructed from a stream or if the index is not
+     * stored next to the BAM file.
+     */
+    void load_index(std::filesystem::path const & filename)
+    {
+        index = std::make_unique<bam_index>(filename);
+    }
+
+    /*!\brief Returns the records that overlap a region of a reference sequence.
+     * \param[in] ref_name The name of the reference sequence as given in the header.
+     * \param[in] begin The 0-based begin position of the region.
+     * \param[in] end The 0-based end position of the region (exclusive).
+     * \returns A single-pass input range over the records overlapping `[begin, end)`.
+     * \throws seqan3::format_error if the format of the file is not seqan3::format_bam.
+     * \throws seqan3::file_open_error if no index was loaded and neither `<file>.bai`, `<file>.csi` nor the file
+     *         with the extension `.bai` exists.
+     * \throws std::invalid_argument if the header does not contain the reference sequence.
+     *
+     * \details
+     *
+     * A record overlaps the region if the part of the reference sequence that it is aligned to (as given by its
+     * position and CIGAR string) overlaps the region. Unmapped records with a position occupy a single position.
+     * The records are visited in the order of the file. The index is read on the first call unless load_index()
+     * was called before. The file must be sorted by coordinate.
+     *
+     * The returned range shares the record buffer and the stream with the file: iterating over it invalidates all
+     * iterators of the file and of other regions. Afterwards, begin() continues at an unspecified record.
+     *
+     * \experimentalapi{Experimental since version 3.3.}
+     */
+    auto region(std::string_view const ref_name, int64_t const begin, int64_t const end)
+    {
+        if constexpr (!list_traits::contains<format_bam, valid_formats>)
+        {
+            throw format_error{"Region queries are only supported for BAM files."};
+        }
+        else
+        {
+            if (!std::holds_alternative<detail::sam_file_input_format_exposer<format_bam>>(format))
+                throw format_error{"Region queries are only supported for BAM files."};
+
+            auto const & ref_ids = header().ref_ids();
+            auto ref_it = std::ranges::find_if(ref_ids,
+                                               [ref_name](auto const & id)
+                                               {
+                                                   return std::ranges::equal(id, ref_name);
+                                               });
+
+            if (ref_it == std::ranges::end(ref_ids))
+                throw std::invalid_argument{"The reference sequence " + std::string{ref_name}
+                                            + " is not contained in the header."};
+
+            if (index == nullptr)
+                load_default_index();
+
+            parallel_reader.reset();
+
+            int32_t const ref_id = std::ranges::distance(std::ranges::begin(ref_ids), ref_it);
+            using region_iterator_t = detail::sam_file_region_iterator<sam_file_input>;
+            return std::ranges::subrange{region_iterator_t{*this, index->query(ref_id, begin, end), ref_id, begin, end},
+                                         std::default_sentinel};
+        }
+    }
+    //!\}
+
 protected:
     //!\privatesection
 
@@ -723,6 +849,29 @@ protected:
 
         secondary_stream = detail::make_secondary_istream(*primary_stream, filename);
         detail::set_format(format, filename);
+        file_name = std::move(filename);
+    }
+
+    //!\brief Reads the index `<file>.bai`, `<file>.csi` or the file with the extension `.bai`.
+    void load_default_index()
+    {
+        std::filesystem::path bai_file_name = file_name;
+        std::filesystem::path csi_file_name = file_name;
+        std::filesystem::path replaced_file_name = file_name;
+        bai_file_name += ".bai";
+        csi_file_name += ".csi";
+        replaced_file_name.replace_extension(".bai");
+
+        for (std::filesystem::path const & index_file_name : {bai_file_name, csi_file_name, replaced_file_name})
+        {
+            if (!file_name.empty() && std::filesystem::exists(index_file_name))
+            {
+                load_index(index_file_name);
+                return;
+            }
+        }
+
+        throw file_open_error{"Could not find an index for " + file_name.string() + "."};
     }
 
     //!/brief Initialisation based on a format (construction via stream).
@@ -739,6 +888,11 @@ protected:
     //!\brief The file header object.
     std::unique_ptr<header_type> header_ptr{new header_type{}};
 
+    //!\brief The path of the file; empty if the file was constructed from a stream.
+    std::filesystem::path file_name{};
+    //!\brief The index used by region(); read on demand.
+    std::unique_ptr<bam_index> index{};
+
     /*!\name Data buffers
      * \{
      */
@@ -782,6 +936,11 @@ protected:
     format_type format;
     //!\}
 
+    /*!\brief Decodes the records of a BAM file in parallel if seqan3::sam_file_input_options::thread_count is greater
+     *        than 1; `nullptr` otherwise.
+     */
+    std::unique_ptr<detail::sam_file_parallel_reader<sam_file_input>> parallel_reader{};
+
     /*!\name Reference information
      * \{
      */
@@ -828,58 +987,189 @@ protected:
     }
     //!\}
 
+    /*!\brief Reads a record with the given format.
+     * \param[in, out] f The format.
+     * \param[in, out] stream The stream to read from.
+     * \param[in] options The options of the file.
+     * \param[in] reference_sequences The reference sequences given by the user or `nullptr`.
+     * \param[in, out] header The header of the file.
+     * \param[out] position The position of the record in the stream.
+     * \param[out] record The record to fill.
+     */
+    template <typename format_t>
+    static void read_record(format_t & f,
+                            std::basic_istream<stream_char_type> & stream,
+                            sam_file_input_options<typename traits_type::sequence_legal_alphabet> const & options,
+                            typename traits_type::ref_sequences const * const reference_sequences,
+                            header_type & header,
+                            std::streampos & position,
+                            record_type & record)
+    {
+        // clear the record
+        record.clear();
+        detail::get_or_ignore<field::header_ptr>(record) = &header;
+
+        auto call_read_func = [&](auto & ref_seq_info)
+        {
+            f.read_alignment_record(stream,
+                                    options,
+                                    ref_seq_info,
+                                    header,
+                                    position,
+                                    detail::get_or_ignore<field::seq>(record),
+                                    detail::get_or_ignore<field::qual>(record),
+                                    detail::get_or_ignore<field::id>(record),
+                                    detail::get_or_ignore<field::ref_seq>(record),
+                                    detail::get_or_ignore<field::ref_id>(record),
+                                    detail::get_or_ignore<field::ref_offset>(record),
+                                    detail::get_or_ignore<field::cigar>(record),
+                                    detail::get_or_ignore<field::flag>(record),
+                                    detail::get_or_ignore<field::mapq>(record),
+                                    detail::get_or_ignore<field::mate>(record),
+                                    detail::get_or_ignore<field::tags>(record),
+                                    detail::get_or_ignore<field::evalue>(record),
+                                    detail::get_or_ignore<field::bit_score>(record));
+        };
+
+        if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
+            call_read_func(*reference_sequences);
+        else
+            call_read_func(std::ignore);
+    }
+
     //!\brief Tell the format to move to the next record and update the buffer.
     void read_next_record()
     {
-        // clear the record
-        record_buffer.clear();
-        detail::get_or_ignore<field::header_ptr>(record_buffer) = header_ptr.get();
+        if constexpr (list_traits::contains<format_bam, valid_formats>)
+        {
+            if (parallel_reader != nullptr
+                || (options.thread_count > 1u
+                    && std::holds_alternative<detail::sam_file_input_format_exposer<format_bam>>(format)))
+            {
+                read_next_record_in_parallel();
+                return;
+            }
+        }
+
+        read_next_record_sequentially();
+    }
 
+    //!\brief Reads the next record with the format of the file.
+    void read_next_record_sequentially()
+    {
         // at end if we could not read further
         if (std::istreambuf_iterator<stream_char_type>{*secondary_stream}
             == std::istreambuf_iterator<stream_char_type>{})
         {
+            record_buffer.clear();
+            detail::get_or_ignore<field::header_ptr>(record_buffer) = header_ptr.get();
             at_end = true;
             return;
         }
 
-        auto call_read_func = [this](auto & ref_seq_info)
+        assert(!format.valueless_by_exception());
+
+        std::visit(
+            [&](auto & f)
+            {
+                read_record(f,
+                            *secondary_stream,
+                            options,
+                            reference_sequences_ptr,
+                            *header_ptr,
+                            position_buffer,
+                            record_buffer);
+            },
+            format);
+    }
+
+    /*!\brief Takes the next record from the seqan3::detail::sam_file_parallel_reader.
+     *
+     * \details
+     *
+     * The reader is constructed when the first record is read in parallel. The header and the first record are read
+     * by this thread, such that the format of the file knows the header if the reader is reset.
+     */
+    void read_next_record_in_parallel()
+    {
+        if (parallel_reader == nullptr)
+        {
+            std::string_view const bytes = read_next_raw_record();
+
+            if (at_end)
+            {
+                record_buffer.clear();
+                detail::get_or_ignore<field::header_ptr>(record_buffer) = header_ptr.get();
+                return;
+            }
+
+            parallel_reader = std::make_unique<detail::sam_file_parallel_reader<sam_file_input>>(
+                options.thread_count,
+                std::get<detail::sam_file_input_format_exposer<format_bam>>(format),
+                *secondary_stream,
+                *header_ptr,
+                reference_sequences_ptr,
+                options,
+                bytes);
+        }
+
+        at_end = !parallel_reader->read_next_record(record_buffer);
+    }
+
+    //!\brief Befriend iterator so it can access the buffers.
+    friend iterator;
+    /*!\brief Reads the bytes of a record of a BAM file without decoding them.
+     * \param[in, out] f The format.
+     * \param[in, out] stream The stream to read from.
+     * \param[in] reference_sequences The reference sequences given by the user or `nullptr`.
+     * \param[in, out] header The header of the file.
+     * \param[out] position The position of the record in the stream.
+     * \returns The bytes of the record; valid until the next record is read. Empty if no record follows.
+     */
+    static std::string_view read_raw_record(detail::sam_file_input_format_exposer<format_bam> & f,
+                                            std::basic_istream<stream_char_type> & stream,
+                                            typename traits_type::ref_sequences const * const reference_sequences,
+                                            header_type & header,
+                                            std::streampos & position)
+    {
+        auto call_read_func = [&](auto & ref_seq_info)
         {
-            std::visit(
-                [&](auto & f)
-                {
-                    f.read_alignment_record(*secondary_stream,
-                                            options,
-                                            ref_seq_info,
-                                            *header_ptr,
-                                            position_buffer,
-                                            detail::get_or_ignore<field::seq>(record_buffer),
-                                            detail::get_or_ignore<field::qual>(record_buffer),
-                                            detail::get_or_ignore<field::id>(record_buffer),
-                                            detail::get_or_ignore<field::ref_seq>(record_buffer),
-                                            detail::get_or_ignore<field::ref_id>(record_buffer),
-                                            detail::get_or_ignore<field::ref_offset>(record_buffer),
-                                            detail::get_or_ignore<field::cigar>(record_buffer),
-                                            detail::get_or_ignore<field::flag>(record_buffer),
-                                            detail::get_or_ignore<field::mapq>(record_buffer),
-                                            detail::get_or_ignore<field::mate>(record_buffer),
-                                            detail::get_or_ignore<field::tags>(record_buffer),
-                                            detail::get_or_ignore<field::evalue>(record_buffer),
-                                            detail::get_or_ignore<field::bit_score>(record_buffer));
-                },
-                format);
+            return f.read_raw_alignment_record(stream, ref_seq_info, header, position);
         };
 
-        assert(!format.valueless_by_exception());
-
         if constexpr (!std::same_as<typename traits_type::ref_sequences, ref_info_not_given>)
-            call_read_func(*reference_sequences_ptr);
+            return call_read_func(*reference_sequences);
         else
-            call_read_func(std::ignore);
+            return call_read_func(std::ignore);
     }
 
-    //!\brief Befriend iterator so it can access the buffers.
-    friend iterator;
+    /*!\brief Reads the bytes of the next record of a BAM file without decoding them.
+     * \returns The bytes of the record; valid until the next record is read. Empty if the file is at end.
+     */
+    std::string_view read_next_raw_record()
+    {
+        // at end if we could not read further
+        if (std::istreambuf_iterator<stream_char_type>{*secondary_stream}
+            == std::istreambuf_iterator<stream_char_type>{})
+        {
+            at_end = true;
+            return {};
+        }
+
+        auto & f = std::get<detail::sam_file_input_format_exposer<format_bam>>(format);
+        std::string_view const bytes =
+            read_raw_record(f, *secondary_stream, reference_sequences_ptr, *header_ptr, position_buffer);
+
+        at_end = bytes.empty();
+        return bytes;
+    }
+
+    //!\brief Befriend the region iterator so it can access the buffers.
+    friend detail::sam_file_region_iterator<sam_file_input>;
+    //!\brief Befriend the lazy iterator so it can read raw records.
+    friend detail::sam_file_lazy_iterator<sam_file_input>;
+    //!\brief Befriend the parallel reader so it can decode records.
+    friend detail::sam_file_parallel_reader<sam_file_input>;
 };
 
 /*!\name Type deduction guides
@@ -15,6 +15,7 @@
 #include <fstream>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <seqan3/alphabet/cigar/cigar.hpp>
@@ -54,6 +55,19 @@ public:
     {
         format_type::read_alignment_record(std::forward<ts>(args)...);
     }
+
+    //!\brief Forwards to `format_type::read_raw_alignment_record`; only available for seqan3::format_bam.
+    template <typename... ts>
+    std::string_view read_raw_alignment_record(ts &&... args)
+    {
+        return format_type::read_raw_alignment_record(std::forward<ts>(args)...);
+    }
+
+    //!\brief Returns the location of the last read alignment record; only available for seqan3::format_bam.
+    auto const & last_record_location() const noexcept
+    {
+        return format_type::last_record_location;
+    }
 };
 
 } // namespace seqan3::detail
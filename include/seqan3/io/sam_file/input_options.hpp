@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3
@@ -25,7 +27,22 @@ namespace seqan3
 template <typename sequence_legal_alphabet>
 struct sam_file_input_options
 {
-    // options to define
+    /*!\brief The number of threads that decode the records of a BAM file (default: 1).
+     *
+     * \details
+     *
+     * If more than one thread is used, the file splits the BAM stream into chunks of whole records and decodes the
+     * chunks in parallel on seqan3::detail::work_stealing_scheduler::shared. The records are still returned in the
+     * order of the file. The BGZF blocks are decompressed by seqan3::contrib::bgzf_thread_count many threads,
+     * independently of this option.
+     *
+     * While reading in parallel, the file reads ahead of the current record. Hence, `file_position()` of the iterator
+     * does not report the position of the current record and seeking is not supported. The option is ignored for SAM
+     * files.
+     *
+     * \experimentalapi{Experimental since version 3.3.}
+     */
+    size_t thread_count{1u};
 };
 
 } // namespace seqan3
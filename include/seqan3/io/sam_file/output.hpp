@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <filesystem>
 #include <fstream>
@@ -27,6 +28,7 @@
 #include <seqan3/io/detail/record_like.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/io/record.hpp>
+#include <seqan3/io/sam_file/bam_index.hpp>
 #include <seqan3/io/sam_file/format_bam.hpp>
 #include <seqan3/io/sam_file/format_sam.hpp>
 #include <seqan3/io/sam_file/header.hpp>
@@ -155,23 +157,22 @@ public:
     sam_file_output(sam_file_output &&) = default;
     //!\brief Move assignment is defaulted.
     sam_file_output & operator=(sam_file_output &&) = default;
-    //!\brief The destructor will write the header if it has not been written before.
+    /*!\brief The destructor will write the header if it has not been written before.
+     *
+     * \details
+     *
+     * The destructor calls seqan3::sam_file_output::close, i.e. it also writes the index if
+     * seqan3::sam_file_output_options::create_index is set. Errors are discarded; call
+     * seqan3::sam_file_output::close explicitly to handle them.
+     */
     ~sam_file_output()
     {
-        if (header_has_been_written)
-            return;
-
-        assert(!format.valueless_by_exception());
-
-        std::visit(
-            [&](auto & f)
-            {
-                if constexpr (std::same_as<ref_ids_type, ref_info_not_given>)
-                    f.write_header(*secondary_stream, options, std::ignore);
-                else
-                    f.write_header(*secondary_stream, options, *header_ptr);
-            },
-            format);
+        try
+        {
+            close();
+        }
+        catch (...)
+        {}
     }
 
     /*!\brief Construct from filename.
@@ -216,6 +217,8 @@ public:
 
         // initialise format handler or throw if format is not found
         detail::set_format(format, filename);
+
+        file_name = std::move(filename);
     }
 
     /*!\brief Construct from an existing stream and with specified format.
@@ -399,7 +402,7 @@ public:
      *
      * ### Exceptions
      *
-     * Basic exception safety.
+     * Basic exception safety. Throws std::logic_error if the file was closed.
      *
      * ### Example
      *
@@ -442,7 +445,7 @@ public:
      *
      * ### Exceptions
      *
-     * Basic exception safety.
+     * Basic exception safety. Throws std::logic_error if the file was closed.
      *
      * ### Example
      *
@@ -488,7 +491,7 @@ public:
      *
      * ### Exceptions
      *
-     * Basic exception safety.
+     * Basic exception safety. Throws std::logic_error if the file was closed.
      *
      * ### Example
      *
@@ -516,7 +519,7 @@ public:
      *
      * ### Exceptions
      *
-     * Basic exception safety.
+     * Basic exception safety. Throws std::logic_error if the file was closed.
      *
      * ### Example
      *
@@ -548,7 +551,7 @@ public:
      *
      * ### Exceptions
      *
-     * Basic exception safety.
+     * Basic exception safety. Throws std::logic_error if the file was closed.
      *
      * ### Example
      *
@@ -577,6 +580,45 @@ public:
     }
     //!\}
 
+    /*!\brief Writes the header if it has not been written before and the index if requested.
+     * \throws seqan3::format_error if seqan3::sam_file_output_options::create_index is set, but the file is not a
+     *         BAM file opened by file name.
+     * \throws seqan3::file_open_error if the index file cannot be opened.
+     *
+     * \details
+     *
+     * If seqan3::sam_file_output_options::create_index is set, the index is written to `<file>.bai` or `<file>.csi`.
+     * Writing a record after the file was closed throws std::logic_error. Further calls do nothing; the destructor
+     * calls this function as well, but discards errors.
+     */
+    void close()
+    {
+        if (is_closed || secondary_stream == nullptr)
+            return;
+
+        is_closed = true;
+
+        if (!header_has_been_written)
+        {
+            assert(!format.valueless_by_exception());
+
+            prepare_index();
+
+            std::visit(
+                [&](auto & f)
+                {
+                    if constexpr (std::same_as<ref_ids_type, ref_info_not_given>)
+                        f.write_header(*secondary_stream, options, std::ignore);
+                    else
+                        f.write_header(*secondary_stream, options, *header_ptr);
+                },
+                format);
+            header_has_been_written = true;
+        }
+
+        write_index();
+    }
+
     //!\brief The options are public and its members can be set directly.
     sam_file_output_options options;
 
@@ -650,6 +692,114 @@ protected:
     //!\brief The file header object (will be set on construction).
     std::unique_ptr<header_type> header_ptr;
 
+    /*!\name Index creation
+     * \{
+     */
+    //!\brief The path of the file; empty if the file was constructed from a stream.
+    std::filesystem::path file_name{};
+    //!\brief The index that is created if seqan3::sam_file_output_options::create_index is set.
+    std::unique_ptr<bam_index> index{};
+    //!\brief The number of reference sequences in the headers of the written records.
+    size_t index_reference_count{};
+#if defined(SEQAN3_HAS_ZLIB)
+    //!\brief The BGZF stream buffer of the file; its block offsets translate the record positions of the index.
+    contrib::basic_bgzf_ostreambuf<stream_char_type> * bgzf_buffer{nullptr};
+#endif
+
+    //!\brief Whether prepare_index() was called; the options are only checked once.
+    bool index_was_prepared{false};
+    //!\brief Whether close() was called.
+    bool is_closed{false};
+
+    /*!\brief Creates the index before the first record or the header is written.
+     * \throws seqan3::format_error if an index is requested, but the file is not a BAM file opened by file name.
+     */
+    void prepare_index()
+    {
+        if (options.create_index == bam_index_type::none || index_was_prepared)
+            return;
+
+        index_was_prepared = true;
+
+#if defined(SEQAN3_HAS_ZLIB)
+        if constexpr (list_traits::contains<format_bam, valid_formats>)
+        {
+            using bgzf_buffer_t = contrib::basic_bgzf_ostreambuf<stream_char_type>;
+            using bam_exposer_t = detail::sam_file_output_format_exposer<format_bam>;
+
+            if (!file_name.empty() && std::holds_alternative<bam_exposer_t>(format))
+                bgzf_buffer = dynamic_cast<bgzf_buffer_t *>(secondary_stream->rdbuf());
+        }
+
+        if (bgzf_buffer == nullptr)
+#endif
+            throw format_error{"An index can only be created for BAM files that are opened by file name."};
+
+#if defined(SEQAN3_HAS_ZLIB)
+        bgzf_buffer->track_block_offsets();
+        // The CSI index supports reference sequences of up to 2^32 positions.
+        index = options.create_index == bam_index_type::bai ? std::make_unique<bam_index>()
+                                                            : std::make_unique<bam_index>(14, 6);
+#endif
+    }
+
+    /*!\brief Adds the last written record to the index.
+     * \param[in] reference_count The number of reference sequences in the header of the record.
+     */
+    void update_index([[maybe_unused]] size_t const reference_count)
+    {
+#if defined(SEQAN3_HAS_ZLIB)
+        if constexpr (list_traits::contains<format_bam, valid_formats>)
+        {
+            if (index == nullptr)
+                return;
+
+            index_reference_count = std::max(index_reference_count, reference_count);
+
+            auto const & location =
+                std::get<detail::sam_file_output_format_exposer<format_bam>>(format).last_record_location();
+            // The stream buffer reports uncompressed positions that are translated when the index is written.
+            uint64_t const end = bgzf_buffer->pubseekoff(0, std::ios_base::cur, std::ios_base::out);
+
+            index->add_record(location.ref_id,
+                              location.begin,
+                              location.end,
+                              location.is_mapped,
+                              end - location.byte_size,
+                              end);
+        }
+#endif
+    }
+
+    //!\brief Writes the index to `<file>.bai` or `<file>.csi`.
+    void write_index()
+    {
+#if defined(SEQAN3_HAS_ZLIB)
+        if (index == nullptr)
+            return;
+
+        // All blocks must be written to know their offsets.
+        secondary_stream->flush();
+        bgzf_buffer->flush();
+
+        index->transform_offsets(
+            [this](uint64_t const position)
+            {
+                return bgzf_buffer->virtual_offset(position);
+            });
+
+        if constexpr (!std::same_as<ref_ids_type, ref_info_not_given>)
+            index_reference_count = std::max(index_reference_count, header_ptr->ref_id_info.size());
+
+        index->reference_count(std::max(index->reference_count(), index_reference_count));
+
+        std::filesystem::path index_file_name = file_name;
+        index_file_name += options.create_index == bam_index_type::bai ? ".bai" : ".csi";
+        index->write(index_file_name);
+#endif
+    }
+    //!\}
+
     //!\brief Fill the header reference dictionary, with the given info.
     template <typename ref_ids_type_, typename ref_lengths_type>
     void initialise_header_information(ref_ids_type_ && ref_ids, ref_lengths_type && ref_lengths)
@@ -682,8 +832,13 @@ protected:
     {
         static_assert((sizeof...(pack_type) == 13), "Wrong parameter list passed to write_record.");
 
+        if (is_closed)
+            throw std::logic_error{"Records cannot be written to a file that was closed."};
+
         assert(!format.valueless_by_exception());
 
+        prepare_index();
+
         std::visit(
             [&](auto & f)
             {
@@ -713,6 +868,13 @@ protected:
             format);
 
         header_has_been_written = true; // when writing a record, the header is written automatically
+
+        if constexpr (!std::same_as<record_header_ptr_t, std::nullptr_t>)
+            update_index(record_header_ptr->ref_id_info.size());
+        else if constexpr (!std::same_as<ref_ids_type, ref_info_not_given>)
+            update_index(header_ptr->ref_id_info.size());
+        else
+            update_index(0u);
     }
 
     //!\brief Befriend iterator so it can access the buffers.
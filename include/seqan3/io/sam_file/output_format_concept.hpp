@@ -55,6 +55,12 @@ public:
         format_type::write_alignment_record(std::forward<ts>(args)...);
     }
 
+    //!\brief Returns the location of the last written alignment record; only available for seqan3::format_bam.
+    auto const & last_record_location() const noexcept
+    {
+        return format_type::last_record_location;
+    }
+
     //!\brief Forwards to `format_type::write_header`.
     template <typename stream_t, typename header_type>
     void write_header(stream_t & stream, sam_file_output_options const & options, header_type & header)
@@ -12,11 +12,23 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <seqan3/core/platform.hpp>
 
 namespace seqan3
 {
 
+/*!\brief The type of the index that is created alongside a BAM file (see seqan3::sam_file_output_options).
+ * \ingroup io_sam_file
+ */
+enum class bam_index_type : uint8_t
+{
+    none, //!< Do not create an index.
+    bai,  //!< Create a BAI index (`<file>.bam.bai`).
+    csi   //!< Create a CSI index (`<file>.bam.csi`).
+};
+
 /*!\brief The options type defines various option members that influence the behavior of all or some formats.
  * \ingroup io_sam_file
  *
@@ -42,6 +54,17 @@ struct sam_file_output_options
      * `false`.
      */
     bool sam_require_header = true;
+
+    /*!\brief Whether to create a seqan3::bam_index alongside the written BAM file.
+     *
+     * \details
+     *
+     * The index is written to `<file>.bai` or `<file>.csi` by seqan3::sam_file_output::close or the destructor. It can
+     * only be created if the file was opened by file name, its format is seqan3::format_bam and the records are
+     * sorted by coordinate. Otherwise, a seqan3::format_error is thrown when the first record is written or, if no
+     * record is written, by seqan3::sam_file_output::close. Set this option before writing to the file.
+     */
+    bam_index_type create_index = bam_index_type::none;
 };
 
 } // namespace seqan3
@@ -35,3 +35,4 @@
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
 #include <seqan3/io/sequence_file/output_options.hpp>
 #include <seqan3/io/sequence_file/record.hpp>
+#include <seqan3/io/sequence_file/record_batch.hpp>
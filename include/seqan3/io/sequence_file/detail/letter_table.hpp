@@ -0,0 +1,317 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::letter_table and seqan3::detail::append_chars.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+
+#include <seqan3/alphabet/adaptation/char.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/alphabet/views/char_to.hpp>
+#include <seqan3/utility/simd/detail/builtin_simd_intrinsics.hpp>
+
+namespace seqan3::detail
+{
+
+//!\brief The role of a character within a field of a sequence file.
+//!\ingroup io_sequence_file
+enum class letter_category : uint8_t
+{
+    letter,  //!< The character is converted to a letter of the field.
+    skip,    //!< The character is ignored, e.g. whitespace.
+    stop,    //!< The character ends the field.
+    invalid  //!< The character is not allowed within the field.
+};
+
+/*!\brief Converts the characters of a field of a sequence file to an alphabet via lookup tables.
+ * \ingroup io_sequence_file
+ * \tparam alphabet_t The alphabet of the field; must model seqan3::writable_alphabet.
+ *
+ * \details
+ *
+ * For each of the 256 characters, the table stores its seqan3::detail::letter_category and the letter it is
+ * converted to. Hence, a character is classified and converted with two loads instead of evaluating the character
+ * predicates and seqan3::assign_char_to for every character.
+ *
+ * The characters are processed line by line. A line that only consists of letters, which is the common case, is
+ * appended at once. If the alphabet has a size of one byte and all letters are smaller than 128, 32 (AVX2) or 16
+ * (SSSE3) characters are converted at once by looking up the low half of each character in the row of the table
+ * selected by its high half (`pshufb`).
+ */
+template <writable_alphabet alphabet_t>
+class letter_table
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    letter_table() = delete;                                 //!< Deleted.
+    letter_table(letter_table const &) = default;             //!< Defaulted.
+    letter_table(letter_table &&) = default;                  //!< Defaulted.
+    letter_table & operator=(letter_table const &) = default; //!< Defaulted.
+    letter_table & operator=(letter_table &&) = default;      //!< Defaulted.
+    ~letter_table() = default;                                //!< Defaulted.
+
+    /*!\brief Constructs the table from a function that classifies characters.
+     * \tparam classify_t The type of the function; must be invocable with `char` and return a
+     *                    seqan3::detail::letter_category.
+     * \param[in] classify The function that classifies the characters.
+     */
+    template <typename classify_t>
+    constexpr explicit letter_table(classify_t && classify)
+    {
+        for (size_t rank = 0; rank < table_size; ++rank)
+        {
+            char const chr = static_cast<char>(rank);
+            categories[rank] = classify(chr);
+
+            if (categories[rank] != letter_category::letter)
+                continue;
+
+            letters[rank] = assign_char_to(chr, alphabet_t{});
+
+            if constexpr (is_byte_alphabet)
+            {
+                uint8_t const row = rank >> 4;
+                letter_bytes[rank] = std::bit_cast<uint8_t>(letters[rank]);
+                flagged_letter_bytes[rank] = letter_bytes[rank] | 0x80u;
+                is_vectorisable = is_vectorisable && letter_bytes[rank] < 0x80u;
+
+                if (active_row_count == 0u || active_rows[active_row_count - 1u] != row)
+                    active_rows[active_row_count++] = row;
+            }
+        }
+    }
+    //!\}
+
+    //!\brief Returns the category of the character.
+    constexpr letter_category category(char const chr) const noexcept
+    {
+        return categories[static_cast<uint8_t>(chr)];
+    }
+
+    /*!\brief Appends the letters of the characters to `field` until a character is not a letter or skipped.
+     * \tparam field_t The type of the field; its value type must be `alphabet_t`.
+     * \param[in] chars The characters to convert.
+     * \param[in,out] field The container to append the letters to.
+     * \param[in] max_letters The maximal number of letters to append.
+     * \returns The number of processed characters, i.e. the position of the first character that is a
+     *          seqan3::detail::letter_category::stop or seqan3::detail::letter_category::invalid character, or the
+     *          number of characters processed until `max_letters` were appended.
+     */
+    template <typename field_t>
+        requires std::same_as<std::ranges::range_value_t<field_t>, alphabet_t>
+    size_t append_to(std::string_view const chars,
+                     field_t & field,
+                     size_t const max_letters = std::numeric_limits<size_t>::max()) const
+    {
+        size_t position = 0u;
+        size_t letter_count = 0u;
+
+        while (position < chars.size() && letter_count < max_letters)
+        {
+            // Usually, a line only consists of letters and is appended at once. The line break and lines containing
+            // other characters are processed character by character.
+            size_t const line_end = std::min(chars.find('\n', position), chars.size());
+            size_t const line_size = std::min(line_end - position, max_letters - letter_count);
+
+            if (append_letters(chars.substr(position, line_size), field))
+            {
+                position += line_size;
+                letter_count += line_size;
+            }
+
+            for (size_t const end = std::min(line_end + 1u, chars.size()); position < end && letter_count < max_letters;
+                 ++position)
+            {
+                uint8_t const rank = static_cast<uint8_t>(chars[position]);
+
+                if (categories[rank] == letter_category::letter)
+                {
+                    field.push_back(letters[rank]);
+                    ++letter_count;
+                }
+                else if (categories[rank] != letter_category::skip)
+                {
+                    return position;
+                }
+            }
+        }
+
+        return position;
+    }
+
+private:
+    //!\brief Whether the letters are single bytes that can be written directly.
+    static constexpr bool is_byte_alphabet = sizeof(alphabet_t) == 1u && std::is_trivially_copyable_v<alphabet_t>;
+
+    //!\brief Appends the letters of the characters if all characters are letters.
+    template <typename field_t>
+    bool append_letters(std::string_view const chars, field_t & field) const
+    {
+        if constexpr (is_byte_alphabet && std::ranges::contiguous_range<field_t>
+                      && requires { field.insert(field.end(), size_t{}, alphabet_t{}); })
+        {
+            // Inserting copies is cheaper than resize, which value-initialises every letter.
+            size_t const field_size = std::ranges::size(field);
+            field.insert(field.end(), chars.size(), alphabet_t{});
+
+            if (!convert(chars, reinterpret_cast<uint8_t *>(std::ranges::data(field) + field_size)))
+            {
+                field.resize(field_size);
+                return false;
+            }
+
+            return true;
+        }
+        else
+        {
+            static_assert(static_cast<uint8_t>(letter_category::letter) == 0u);
+
+            // No early exit, such that the loop does not branch for every character.
+            uint8_t categories_of_chars{};
+            for (char const chr : chars)
+                categories_of_chars |= static_cast<uint8_t>(categories[static_cast<uint8_t>(chr)]);
+
+            if (categories_of_chars != 0u)
+                return false;
+
+            for (char const chr : chars)
+                field.push_back(letters[static_cast<uint8_t>(chr)]);
+
+            return true;
+        }
+    }
+
+    /*!\brief Writes the letter bytes of the characters to `out`.
+     * \returns `true` if all characters are letters; otherwise, the content of `out` is unspecified.
+     */
+    bool convert(std::string_view const chars, uint8_t * const out) const noexcept
+    {
+        size_t position = 0u;
+
+#if defined(__AVX2__)
+        if (is_vectorisable)
+        {
+            __m256i const low_mask = _mm256_set1_epi8(0x0F);
+
+            for (; position + 32u <= chars.size(); position += 32u)
+            {
+                __m256i const block = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(chars.data() + position));
+                __m256i const low = _mm256_and_si256(block, low_mask);
+                __m256i const high = _mm256_and_si256(_mm256_srli_epi16(block, 4), low_mask);
+                __m256i flagged = _mm256_setzero_si256();
+
+                for (size_t i = 0; i < active_row_count; ++i)
+                {
+                    uint8_t const * const row_begin = &flagged_letter_bytes[active_rows[i] * 16u];
+                    __m256i const row =
+                        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(row_begin)));
+                    __m256i const in_row = _mm256_cmpeq_epi8(high, _mm256_set1_epi8(active_rows[i]));
+                    flagged = _mm256_or_si256(flagged, _mm256_and_si256(in_row, _mm256_shuffle_epi8(row, low)));
+                }
+
+                // Only letters have the highest bit set.
+                if (_mm256_movemask_epi8(flagged) != -1)
+                    return false;
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + position),
+                                    _mm256_and_si256(flagged, _mm256_set1_epi8(0x7F)));
+            }
+        }
+#elif defined(__SSSE3__)
+        if (is_vectorisable)
+        {
+            __m128i const low_mask = _mm_set1_epi8(0x0F);
+
+            for (; position + 16u <= chars.size(); position += 16u)
+            {
+                __m128i const block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(chars.data() + position));
+                __m128i const low = _mm_and_si128(block, low_mask);
+                __m128i const high = _mm_and_si128(_mm_srli_epi16(block, 4), low_mask);
+                __m128i flagged = _mm_setzero_si128();
+
+                for (size_t i = 0; i < active_row_count; ++i)
+                {
+                    __m128i const row =
+                        _mm_loadu_si128(reinterpret_cast<__m128i const *>(&flagged_letter_bytes[active_rows[i] * 16u]));
+                    __m128i const in_row = _mm_cmpeq_epi8(high, _mm_set1_epi8(active_rows[i]));
+                    flagged = _mm_or_si128(flagged, _mm_and_si128(in_row, _mm_shuffle_epi8(row, low)));
+                }
+
+                // Only letters have the highest bit set.
+                if (_mm_movemask_epi8(flagged) != 0xFFFF)
+                    return false;
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + position),
+                                 _mm_and_si128(flagged, _mm_set1_epi8(0x7F)));
+            }
+        }
+#endif
+
+        // No early exit, such that the loop does not branch for every character.
+        uint8_t categories_of_chars{};
+        for (; position < chars.size(); ++position)
+        {
+            uint8_t const rank = static_cast<uint8_t>(chars[position]);
+            out[position] = letter_bytes[rank];
+            categories_of_chars |= static_cast<uint8_t>(categories[rank]);
+        }
+
+        return categories_of_chars == 0u;
+    }
+
+    //!\brief The number of characters.
+    static constexpr size_t table_size{256u};
+
+    //!\brief The category of each character.
+    std::array<letter_category, table_size> categories{};
+    //!\brief The letter of each character; only valid for seqan3::detail::letter_category::letter.
+    std::array<alphabet_t, table_size> letters{};
+    //!\brief The byte of the letter of each character; only used if the alphabet has a size of one byte.
+    std::array<uint8_t, table_size> letter_bytes{};
+    //!\brief The byte of the letter of each character with the highest bit set; `0` for other characters.
+    std::array<uint8_t, table_size> flagged_letter_bytes{};
+    //!\brief The high halves of the characters that are letters.
+    std::array<uint8_t, 16u> active_rows{};
+    //!\brief The number of seqan3::detail::letter_table::active_rows.
+    size_t active_row_count{};
+    //!\brief Whether the letters are converted with SIMD instructions, i.e. all letter bytes are smaller than 128.
+    bool is_vectorisable{is_byte_alphabet};
+};
+
+/*!\brief Appends characters to a field without validating them, e.g. to an ID.
+ * \ingroup io_sequence_file
+ * \tparam field_t The type of the field; its value type must model seqan3::writable_alphabet.
+ * \param[in,out] field The container to append the characters to.
+ * \param[in] chars The characters to append.
+ */
+template <typename field_t>
+inline void append_chars(field_t & field, std::string_view const chars)
+{
+    using alphabet_t = std::ranges::range_value_t<field_t>;
+
+    if constexpr (builtin_character<alphabet_t>)
+        field.insert(field.end(), chars.begin(), chars.end());
+    else
+        std::ranges::copy(chars | views::char_to<alphabet_t>, std::back_inserter(field));
+}
+
+} // namespace seqan3::detail
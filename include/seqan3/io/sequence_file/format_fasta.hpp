@@ -29,6 +29,7 @@
 #include <seqan3/core/range/type_traits.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
+#include <seqan3/io/sequence_file/detail/letter_table.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/input_options.hpp>
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
@@ -194,32 +195,29 @@ private:
             if (options.truncate_ids)
             {
 #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE
+                // The ID is scanned within the buffer of the stream, see fast_istreambuf_iterator::consume_chunks.
                 auto it = stream_view.begin();
-                auto e = stream_view.end();
                 ++it; // already checked `is_id`
 
                 if (options.fasta_ignore_blanks_before_id)
-                {
-                    for (; (it != e) && (is_blank)(*it); ++it) // skip leading ' '
-                    {}
-                }
+                    skip_blanks(it);
 
-                bool at_delimiter = false;
-                for (; it != e; ++it)
-                {
-                    if ((is_cntrl || is_blank)(*it))
+                bool const at_delimiter = it.consume_chunks(
+                    [&](std::string_view const chunk) -> size_t
                     {
-                        at_delimiter = true;
-                        break;
-                    }
-                    id.push_back(assign_char_to(*it, std::ranges::range_value_t<id_type>{}));
-                }
+                        size_t const id_size = std::ranges::find_if(chunk, is_cntrl || is_blank) - chunk.begin();
+                        detail::append_chars(id, chunk.substr(0u, id_size));
+                        return id_size;
+                    });
 
                 if (!at_delimiter)
                     throw unexpected_end_of_input{"FASTA ID line did not end in newline."};
 
-                for (; (it != e) && ((!is_char<'\n'>)(*it)); ++it)
-                {}
+                it.consume_chunks(
+                    [](std::string_view const chunk) -> size_t
+                    {
+                        return std::min(chunk.find('\n'), chunk.size());
+                    });
 
 #else  // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
                 if (options.fasta_ignore_blanks_before_id)
@@ -248,25 +246,18 @@ private:
             {
 #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE
                 auto it = stream_view.begin();
-                auto e = stream_view.end();
                 ++it; // skip leading '>' or ';'
 
                 if (options.fasta_ignore_blanks_before_id)
-                {
-                    for (; (it != e) && (is_blank)(*it); ++it) // skip leading ' '
-                    {}
-                }
+                    skip_blanks(it);
 
-                bool at_delimiter = false;
-                for (; it != e; ++it)
-                {
-                    if ((is_char<'\n'>)(*it))
+                bool const at_delimiter = it.consume_chunks(
+                    [&](std::string_view const chunk) -> size_t
                     {
-                        at_delimiter = true;
-                        break;
-                    }
-                    id.push_back(assign_char_to(*it, std::ranges::range_value_t<id_type>{}));
-                }
+                        size_t const line_size = std::min(chunk.find('\n'), chunk.size());
+                        detail::append_chars(id, chunk.substr(0u, line_size));
+                        return line_size;
+                    });
 
                 if (!at_delimiter)
                     throw unexpected_end_of_input{"FASTA ID line did not end in newline."};
@@ -292,6 +283,17 @@ private:
         }
     }
 
+    //!\brief Skips the blanks at the current position of the stream.
+    template <typename iterator_t>
+    static void skip_blanks(iterator_t & it)
+    {
+        it.consume_chunks(
+            [](std::string_view const chunk) -> size_t
+            {
+                return std::ranges::find_if(chunk, !is_blank) - chunk.begin();
+            });
+    }
+
     //!\brief Implementation of reading the sequence.
     template <typename stream_view_t, typename seq_legal_alph_type, typename seq_type>
     void read_seq(stream_view_t & stream_view, sequence_file_input_options<seq_legal_alph_type> const &, seq_type & seq)
@@ -309,24 +311,36 @@ private:
             if (it == e)
                 throw unexpected_end_of_input{"No sequence information given!"};
 
-            for (; (it != e) && ((!is_id)(*it)); ++it)
-            {
-                if ((is_space || is_digit)(*it))
+            static detail::letter_table<std::ranges::range_value_t<seq_type>> const sequence_table{
+                [is_legal_alph](char const chr)
                 {
-                    continue;
-                }
-                else if (is_legal_alph(*it))
-                {
-                    seq.push_back(assign_char_to(*it, std::ranges::range_value_t<seq_type>{}));
-                }
-                else
+                    if ((is_space || is_digit)(chr))
+                        return detail::letter_category::skip;
+                    else if (is_legal_alph(chr))
+                        return detail::letter_category::letter;
+                    else
+                        return detail::letter_category::invalid;
+                }};
+
+            it.consume_chunks(
+                [&](std::string_view const chunk) -> size_t
                 {
+                    // The sequence ends at the next ID, i.e. before the next '>' or ';'.
+                    std::string_view sequence_chars = chunk.substr(0u, chunk.find('>'));
+                    sequence_chars = sequence_chars.substr(0u, sequence_chars.find(';'));
 
-                    throw parse_error{std::string{"Encountered an unexpected letter: "} + "char_is_valid_for<"
-                                      + detail::type_name_as_string<seq_legal_alph_type>
-                                      + "> evaluated to false on " + detail::make_printable(*it)};
-                }
-            }
+                    size_t const position = sequence_table.append_to(sequence_chars, seq);
+
+                    if (position < sequence_chars.size())
+                    {
+                        throw parse_error{std::string{"Encountered an unexpected letter: "} + "char_is_valid_for<"
+                                          + detail::type_name_as_string<seq_legal_alph_type>
+                                          + "> evaluated to false on "
+                                          + detail::make_printable(sequence_chars[position])};
+                    }
+
+                    return sequence_chars.size();
+                });
 
 #else  // ↑↑↑ WORKAROUND | ORIGINAL ↓↓↓
 
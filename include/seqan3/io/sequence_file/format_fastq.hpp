@@ -29,6 +29,7 @@
 #include <seqan3/core/range/type_traits.hpp>
 #include <seqan3/io/detail/ignore_output_iterator.hpp>
 #include <seqan3/io/detail/misc.hpp>
+#include <seqan3/io/sequence_file/detail/letter_table.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/input_options.hpp>
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
@@ -132,132 +133,125 @@ protected:
         ++stream_it; // skip '@'
 
 #if SEQAN3_WORKAROUND_VIEW_PERFORMANCE // can't have nice things :'(
+        // The fields are scanned within the buffer of the stream; see detail::fast_istreambuf_iterator::consume_chunks.
         auto e = std::ranges::end(stream_view);
-        if constexpr (!detail::decays_to_ignore_v<id_type>)
-        {
-            if (options.truncate_ids)
-            {
-                for (; (stream_it != e) && (!(is_cntrl || is_blank))(*stream_it); ++stream_it)
-                {
-                    if constexpr (builtin_character<std::ranges::range_value_t<id_type>>)
-                        id.push_back(*stream_it);
-                    else
-                        id.push_back(assign_char_to(*stream_it, std::ranges::range_value_t<id_type>{}));
-                }
-                for (; (stream_it != e) && (!is_char<'\n'>)(*stream_it); ++stream_it)
-                {}
-            }
-            else
+        bool id_is_truncated = false;
+
+        bool const id_line_ended = stream_it.consume_chunks(
+            [&](std::string_view const chunk) -> size_t
             {
-                for (; (stream_it != e) && (!is_char<'\n'>)(*stream_it); ++stream_it)
+                size_t const line_size = std::min(chunk.find('\n'), chunk.size());
+
+                if constexpr (!detail::decays_to_ignore_v<id_type>)
                 {
-                    if constexpr (builtin_character<std::ranges::range_value_t<id_type>>)
-                        id.push_back(*stream_it);
-                    else
-                        id.push_back(assign_char_to(*stream_it, std::ranges::range_value_t<id_type>{}));
+                    std::string_view id_chars = id_is_truncated ? std::string_view{} : chunk.substr(0u, line_size);
+
+                    if (options.truncate_ids)
+                    {
+                        auto delimiter = std::ranges::find_if(id_chars, is_cntrl || is_blank);
+                        id_is_truncated = delimiter != id_chars.end();
+                        id_chars = id_chars.substr(0u, delimiter - id_chars.begin());
+                    }
+
+                    detail::append_chars(id, id_chars);
                 }
-            }
-        }
-        else
-        {
-            for (; (stream_it != e) && (!is_char<'\n'>)(*stream_it); ++stream_it)
-            {}
-        }
 
-        if (stream_it == e)
-        {
+                return line_size;
+            });
+
+        if (!id_line_ended)
             throw unexpected_end_of_input{"Expected end of ID-line, got end-of-file."};
-        }
+
         ++stream_it; // skip newline
 
         /* Sequence */
-        if constexpr (!detail::decays_to_ignore_v<seq_type>)
-        {
-            for (; (stream_it != e) && (!is_char<'+'>)(*stream_it); ++stream_it)
+        bool const sequence_ended = stream_it.consume_chunks(
+            [&](std::string_view const chunk) -> size_t
             {
-                if ((!is_space)(*stream_it))
+                size_t const sequence_chars_size = std::min(chunk.find('+'), chunk.size());
+                std::string_view const sequence_chars = chunk.substr(0u, sequence_chars_size);
+
+                if constexpr (!detail::decays_to_ignore_v<seq_type>)
                 {
-                    if constexpr (builtin_character<std::ranges::range_value_t<seq_type>>)
-                    {
-                        sequence.push_back(*stream_it);
-                    }
-                    else
+                    size_t const position =
+                        field_table<std::ranges::range_value_t<seq_type>, seq_legal_alph_type>().append_to(
+                            sequence_chars,
+                            sequence);
+
+                    if (position < sequence_chars.size())
                     {
-                        if (!char_is_valid_for<seq_legal_alph_type>(*stream_it))
-                        {
-                            throw parse_error{std::string{"Encountered bad letter for seq: "}
-                                              + detail::make_printable(*stream_it)};
-                        }
-                        sequence.push_back(assign_char_to(*stream_it, std::ranges::range_value_t<seq_type>{}));
+                        throw parse_error{std::string{"Encountered bad letter for seq: "}
+                                          + detail::make_printable(sequence_chars[position])};
                     }
                 }
-            }
+                else // consume, but count
+                {
+                    sequence_size_after += std::ranges::count_if(sequence_chars, !is_space);
+                }
+
+                return sequence_chars_size;
+            });
+
+        if constexpr (!detail::decays_to_ignore_v<seq_type>)
             sequence_size_after = size(sequence);
-        }
-        else // consume, but count
-        {
-            for (; (stream_it != e) && (!is_char<'+'>)(*stream_it); ++stream_it)
-                if ((!is_space)(*stream_it))
-                    ++sequence_size_after;
-        }
 
         /* 2nd ID line */
-        if (stream_it == e)
+        if (!sequence_ended)
             throw unexpected_end_of_input{"Expected second ID-line, got end-of-file."};
 
-        if (*stream_it != '+')
-        {
-            throw parse_error{std::string{"Expected '+' on beginning of 2nd ID line, got: "}
-                              + detail::make_printable(*stream_it)};
-        }
-
-        for (; (stream_it != e) && (!is_char<'\n'>)(*stream_it); ++stream_it)
-        {}
+        bool const second_id_line_ended = stream_it.consume_chunks(
+            [](std::string_view const chunk) -> size_t
+            {
+                return std::min(chunk.find('\n'), chunk.size());
+            });
 
-        if (stream_it == e)
+        if (!second_id_line_ended)
             throw unexpected_end_of_input{"Expected end of second ID-line, got end-of-file."};
 
         ++stream_it;
 
         /* Qualities */
-        if constexpr (!detail::decays_to_ignore_v<qual_type>)
-        {
-            while (sequence_size_after > sequence_size_before)
-            {
-                if (stream_it == e)
-                    throw unexpected_end_of_input{"Expected qualities, got end-of-file."};
+        size_t remaining_qualities = sequence_size_after - sequence_size_before;
 
-                if ((!is_space)(*stream_it))
+        stream_it.consume_chunks(
+            [&](std::string_view const chunk) -> size_t
+            {
+                if constexpr (!detail::decays_to_ignore_v<qual_type>)
                 {
-                    --sequence_size_after;
-                    if constexpr (builtin_character<std::ranges::range_value_t<qual_type>>)
-                    {
-                        qualities.push_back(*stream_it);
-                    }
-                    else
+                    using quality_alphabet_t = std::ranges::range_value_t<qual_type>;
+
+                    size_t const quality_size_before = size(qualities);
+                    size_t const position =
+                        field_table<quality_alphabet_t, quality_alphabet_t>().append_to(chunk,
+                                                                                        qualities,
+                                                                                        remaining_qualities);
+                    remaining_qualities -= size(qualities) - quality_size_before;
+
+                    if (remaining_qualities > 0u && position < chunk.size())
                     {
-                        if (!char_is_valid_for<std::ranges::range_value_t<qual_type>>(*stream_it))
-                        {
-                            throw parse_error{std::string{"Encountered bad letter for qual: "}
-                                              + detail::make_printable(*stream_it)};
-                        }
-                        qualities.push_back(assign_char_to(*stream_it, std::ranges::range_value_t<qual_type>{}));
+                        throw parse_error{std::string{"Encountered bad letter for qual: "}
+                                          + detail::make_printable(chunk[position])};
                     }
+
+                    return position;
                 }
-                ++stream_it;
-            }
-        }
-        else // consume
-        {
-            while (sequence_size_after > sequence_size_before)
-            {
-                if (stream_it == e)
-                    throw unexpected_end_of_input{"File ended before expected number of qualities could be read."};
+                else // consume
+                {
+                    size_t position = 0u;
+                    for (; position < chunk.size() && remaining_qualities > 0u; ++position)
+                        if ((!is_space)(chunk[position]))
+                            --remaining_qualities;
 
-                if ((!is_space)(*stream_it))
-                    --sequence_size_after;
-                ++stream_it;
-            }
+                    return position;
+                }
+            });
+
+        if (remaining_qualities > 0u)
+        {
+            if constexpr (!detail::decays_to_ignore_v<qual_type>)
+                throw unexpected_end_of_input{"Expected qualities, got end-of-file."};
+            else
+                throw unexpected_end_of_input{"File ended before expected number of qualities could be read."};
         }
 
         if (stream_it != e)
@@ -417,6 +411,25 @@ protected:
             stream_it.write_end_of_line(options.add_carriage_return);
         }
     }
+
+private:
+    //!\brief Returns the table converting characters to `alphabet_type`; whitespace is skipped.
+    template <typename alphabet_type, typename legal_alphabet_type>
+    static detail::letter_table<alphabet_type> const & field_table()
+    {
+        static detail::letter_table<alphabet_type> const table{
+            [](char const chr)
+            {
+                if (is_space(chr))
+                    return detail::letter_category::skip;
+                else if (builtin_character<alphabet_type> || char_is_valid_for<legal_alphabet_type>(chr))
+                    return detail::letter_category::letter;
+                else
+                    return detail::letter_category::invalid;
+            }};
+
+        return table;
+    }
 };
 
 } // namespace seqan3
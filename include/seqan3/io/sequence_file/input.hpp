@@ -26,6 +26,7 @@
 #include <seqan3/alphabet/quality/phred42.hpp>
 #include <seqan3/alphabet/quality/qualified.hpp>
 #include <seqan3/io/detail/in_file_iterator.hpp>
+#include <seqan3/io/detail/memory_mapped_istream.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/exception.hpp>
@@ -36,6 +37,7 @@
 #include <seqan3/io/sequence_file/format_genbank.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/record.hpp>
+#include <seqan3/io/sequence_file/record_batch.hpp>
 #include <seqan3/io/stream/concept.hpp>
 #include <seqan3/utility/type_list/traits.hpp>
 
@@ -256,8 +258,13 @@ public:
     //!\brief The type of the record, a specialisation of seqan3::record; acts as a tuple of the selected field types.
     using record_type = sequence_record<detail::select_types_with_ids_t<field_types, field_ids, selected_field_ids>,
                                         selected_field_ids>;
+    //!\brief The type of the batch filled by read_batch().
+    using record_batch_type = sequence_record_batch<sequence_type, id_type, quality_type>;
     //!\}
 
+    //!\brief The input file options type.
+    using sequence_file_input_options_type = sequence_file_input_options<typename traits_type::sequence_legal_alphabet>;
+
     /*!\name Range associated types
      * \brief The types necessary to facilitate the behaviour of an input range (used in record-wise reading).
      * \{
@@ -299,6 +306,7 @@ public:
     /*!\brief Construct from filename.
      * \param[in] filename      Path to the file you wish to open.
      * \param[in] fields_tag    A seqan3::fields tag. [optional]
+     * \param[in] file_options  The initial seqan3::sequence_file_input_options. [optional]
      * \throws seqan3::file_open_error If the file could not be opened, e.g. non-existant, non-readable, unknown format.
      *
      * \details
@@ -311,14 +319,41 @@ public:
      * This constructor transparently applies a decompression stream on top of the file stream in case
      * the file is detected as being compressed.
      * See the section on \link io_compression compression and decompression \endlink for more information.
+     *
+     * ### Memory mapping
+     *
+     * If seqan3::sequence_file_input_options::memory_map is set in `file_options`, a non-empty regular file is
+     * mapped into memory and parsed directly from the mapping. Other files, e.g. named pipes, and files that cannot
+     * be mapped are read via a std::ifstream, which is also the default.
+     *
+     * \attention The mapped file must not be truncated while it is read. Accessing the pages past the new end of the
+     *            file raises SIGBUS, which terminates the program; this cannot be reported as an exception.
      */
     sequence_file_input(std::filesystem::path filename,
-                        selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{}, stream_deleter_default}
+                        selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{},
+                        sequence_file_input_options_type const & file_options = sequence_file_input_options_type{}) :
+        options{file_options}
     {
-        primary_stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
-        static_cast<std::basic_ifstream<char> *>(primary_stream.get())
-            ->open(filename, std::ios_base::in | std::ios::binary);
+        std::error_code error{};
+        if (options.memory_map && std::filesystem::is_regular_file(filename, error)
+            && std::filesystem::file_size(filename, error) > 0u && !error)
+        {
+            try
+            {
+                primary_stream = stream_ptr_t{new detail::memory_mapped_istream{filename}, stream_deleter_default};
+            }
+            catch (file_open_error const &)
+            {} // Fall back to std::ifstream.
+        }
+
+        if (!primary_stream)
+        {
+            stream_buffer.resize(stream_buffer_size);
+            primary_stream = stream_ptr_t{new std::ifstream{}, stream_deleter_default};
+            primary_stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
+            static_cast<std::basic_ifstream<char> *>(primary_stream.get())
+                ->open(filename, std::ios_base::in | std::ios::binary);
+        }
 
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for reading."};
@@ -470,8 +505,48 @@ public:
     }
     //!\}
 
-    //!\brief The input file options type.
-    using sequence_file_input_options_type = sequence_file_input_options<typename traits_type::sequence_legal_alphabet>;
+    /*!\brief Reads the next records of the file into a batch.
+     * \param[in, out] batch The batch to fill; it is cleared before reading.
+     * \param[in] max_records The maximal number of records to read.
+     * \returns The number of records read, which is 0 if the file is at end.
+     * \throws seqan3::format_error if a record is invalid.
+     *
+     * \details
+     *
+     * The fields of the records are stored in the seqan3::concatenated_sequences of the batch. In contrast to the
+     * range interface, the format is invoked only once per batch and, if the batch is reused, no memory is allocated
+     * per record.
+     *
+     * If a record was already read, e.g. by begin(), the batch starts with this record. Afterwards, begin() returns
+     * the record following the batch. Reading a batch invalidates all iterators of the file.
+     *
+     * \experimentalapi{Experimental since version 3.3.}
+     */
+    size_t read_batch(record_batch_type & batch, size_t const max_records)
+    {
+        batch.clear();
+
+        if (first_record_was_read)
+        {
+            if (at_end)
+                return 0u;
+
+            if (max_records > 0u) // the buffered record was not returned yet
+            {
+                batch.push_back(record_buffer);
+                first_record_was_read = false;
+            }
+        }
+
+        format->read_sequence_records(*secondary_stream,
+                                      record_buffer,
+                                      batch,
+                                      max_records - batch.size(),
+                                      position_buffer,
+                                      options);
+        return batch.size();
+    }
+
     //!\brief The options are public and its members can be set directly.
     sequence_file_input_options_type options;
 
@@ -482,8 +557,10 @@ protected:
      */
     //!\brief Buffer for a single record.
     record_type record_buffer;
-    //!\brief A larger (compared to stl default) stream buffer to use when reading from a file.
-    std::vector<char> stream_buffer{std::vector<char>(1'000'000)};
+    //!\brief The size of seqan3::sequence_file_input::stream_buffer.
+    static constexpr size_t stream_buffer_size{1'000'000};
+    //!\brief A larger (compared to stl default) stream buffer to use when reading from a file via std::ifstream.
+    std::vector<char> stream_buffer{};
     //!\brief Buffer for the previous record position.
     std::streampos position_buffer{};
     //!\}
@@ -570,6 +647,26 @@ private:
                                           record_type & record_buffer,
                                           std::streampos & position_buffer,
                                           sequence_file_input_options_type const & options) = 0;
+
+        /*!\brief Reads format specific records from the given istream into a batch.
+         *
+         * \param[in, out] instream The input stream to extract the records from.
+         * \param[in, out] record_buffer The record buffer that each record is read into before it is appended.
+         * \param[in, out] batch The batch to append the records to.
+         * \param[in] max_records The maximal number of records to read.
+         * \param[in, out] position_buffer The buffer to store the position of the current record.
+         * \param[in] options User specific format options set from outside.
+         *
+         * \details
+         *
+         * Stops at the end of the stream. The records are read with a single virtual call.
+         */
+        virtual void read_sequence_records(std::istream & instream,
+                                           record_type & record_buffer,
+                                           record_batch_type & batch,
+                                           size_t const max_records,
+                                           std::streampos & position_buffer,
+                                           sequence_file_input_options_type const & options) = 0;
     };
 
     /*!\brief The specific selected format to read the records from.
@@ -614,6 +711,32 @@ private:
             }
         }
 
+        //!\copydoc sequence_format_base::read_sequence_records
+        void read_sequence_records(std::istream & instream,
+                                   record_type & record_buffer,
+                                   record_batch_type & batch,
+                                   size_t const max_records,
+                                   std::streampos & position_buffer,
+                                   sequence_file_input_options_type const & options) override
+        {
+            for (size_t i = 0; i < max_records; ++i)
+            {
+                // stop if we could not read further
+                if (std::istreambuf_iterator<stream_char_type>{instream}
+                    == std::istreambuf_iterator<stream_char_type>{})
+                    return;
+
+                record_buffer.clear();
+                _format.read_sequence_record(instream,
+                                             options,
+                                             position_buffer,
+                                             detail::get_or_ignore<field::seq>(record_buffer),
+                                             detail::get_or_ignore<field::id>(record_buffer),
+                                             detail::get_or_ignore<field::qual>(record_buffer));
+                batch.push_back(record_buffer);
+            }
+        }
+
         //!\brief The selected format stored as a format exposer object.
         detail::sequence_file_input_format_exposer<format_t> _format{};
     };
@@ -31,6 +31,15 @@ struct sequence_file_input_options
     bool embl_genbank_complete_header = false;
     //!\brief Remove spaces after ">" (or ";") before the actual ID.
     bool fasta_ignore_blanks_before_id = true;
+    /*!\brief Map regular files into memory instead of reading them via a stream buffer.
+     *
+     * \details
+     *
+     * Only evaluated by the seqan3::sequence_file_input constructor that takes a file name, i.e. the options need to
+     * be passed to that constructor. Mapping avoids copying the file into a stream buffer, but if the file is
+     * truncated while it is read, e.g. by another process, the program is terminated by SIGBUS.
+     */
+    bool memory_map = false;
 };
 
 } // namespace seqan3
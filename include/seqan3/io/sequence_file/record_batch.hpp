@@ -0,0 +1,132 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sequence_record_batch.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/alphabet/container/concatenated_sequences.hpp>
+#include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/sequence_file/record.hpp>
+#include <seqan3/utility/type_traits/basic.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A reusable batch of records of seqan3::sequence_file_input.
+ * \ingroup io_sequence_file
+ * \tparam sequence_type The type of field::seq, e.g. `std::vector<seqan3::dna5>`.
+ * \tparam id_type The type of field::id, e.g. `std::string`.
+ * \tparam quality_type The type of field::qual, e.g. `std::vector<seqan3::phred42>`.
+ *
+ * \details
+ *
+ * The batch stores each field of all records in one seqan3::concatenated_sequences, i.e. in one contiguous buffer
+ * instead of one container per record. It is filled by seqan3::sequence_file_input::read_batch, which clears the
+ * batch before reading. Clearing keeps the capacity of the buffers, hence reading into the same batch again does
+ * not allocate memory once the buffers are large enough.
+ *
+ * The fields are random access ranges over the records. They can be passed to algorithms like seqan3::search or
+ * seqan3::align_pairwise as they are, or split into chunks with seqan3::views::chunk to distribute the records of a
+ * batch over several threads. Fields that are not selected in the file remain empty.
+ *
+ * \experimentalapi{Experimental since version 3.3.}
+ */
+template <typename sequence_type, typename id_type, typename quality_type>
+class sequence_record_batch
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sequence_record_batch() = default;                                          //!< Defaulted.
+    sequence_record_batch(sequence_record_batch const &) = default;             //!< Defaulted.
+    sequence_record_batch & operator=(sequence_record_batch const &) = default; //!< Defaulted.
+    sequence_record_batch(sequence_record_batch &&) = default;                  //!< Defaulted.
+    sequence_record_batch & operator=(sequence_record_batch &&) = default;      //!< Defaulted.
+    ~sequence_record_batch() = default;                                         //!< Defaulted.
+    //!\}
+
+    /*!\name Fields
+     * \{
+     */
+    //!\brief The sequences of the records.
+    concatenated_sequences<sequence_type> const & sequences() const noexcept
+    {
+        return sequence_buffer;
+    }
+
+    //!\brief The ids of the records.
+    concatenated_sequences<id_type> const & ids() const noexcept
+    {
+        return id_buffer;
+    }
+
+    //!\brief The qualities of the records.
+    concatenated_sequences<quality_type> const & base_qualities() const noexcept
+    {
+        return quality_buffer;
+    }
+    //!\}
+
+    //!\brief Returns the number of records.
+    size_t size() const noexcept
+    {
+        return record_count;
+    }
+
+    //!\brief Whether the batch contains no records.
+    bool empty() const noexcept
+    {
+        return record_count == 0u;
+    }
+
+    //!\brief Removes all records but keeps the capacity of the buffers.
+    void clear() noexcept
+    {
+        sequence_buffer.clear();
+        id_buffer.clear();
+        quality_buffer.clear();
+        record_count = 0u;
+    }
+
+    /*!\brief Appends the fields of a record.
+     * \tparam field_types The types of the fields of the record.
+     * \tparam field_ids The ids of the fields of the record.
+     * \param[in] record The record to append.
+     */
+    template <typename field_types, typename field_ids>
+    void push_back(sequence_record<field_types, field_ids> const & record)
+    {
+        auto append = [](auto & buffer, auto const & value)
+        {
+            if constexpr (!detail::decays_to_ignore_v<decltype(value)>)
+                buffer.push_back(value);
+        };
+
+        append(sequence_buffer, detail::get_or_ignore<field::seq>(record));
+        append(id_buffer, detail::get_or_ignore<field::id>(record));
+        append(quality_buffer, detail::get_or_ignore<field::qual>(record));
+        ++record_count;
+    }
+
+private:
+    //!\brief The sequences of the records.
+    concatenated_sequences<sequence_type> sequence_buffer{};
+    //!\brief The ids of the records.
+    concatenated_sequences<id_type> id_buffer{};
+    //!\brief The qualities of the records.
+    concatenated_sequences<quality_type> quality_buffer{};
+    //!\brief The number of records.
+    size_t record_count{};
+};
+
+} // namespace seqan3
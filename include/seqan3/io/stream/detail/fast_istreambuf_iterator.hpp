@@ -17,6 +17,7 @@
 #include <cassert>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <seqan3/io/stream/detail/stream_buffer_exposer.hpp>
@@ -203,6 +204,38 @@ public:
         return result;
     }
 
+    /*!\brief Passes the get area of the stream buffer to `consume` until it does not consume all characters.
+     * \tparam consume_t The type of the callable; must be invocable with `std::basic_string_view<char_t>` and return
+     *                   the number of consumed characters.
+     * \param[in] consume The callable that processes a contiguous chunk of characters.
+     * \returns `true` if `consume` stopped within a chunk, `false` if the stream is at end.
+     *
+     * \details
+     *
+     * The characters consumed by `consume` are skipped. This allows scanning the buffered characters with
+     * std::basic_string_view::find, i.e. `memchr`, instead of inspecting every character through the iterator.
+     */
+    template <typename consume_t>
+    bool consume_chunks(consume_t && consume)
+    {
+        assert(stream_buf != nullptr);
+
+        while (stream_buf->gptr() != stream_buf->egptr())
+        {
+            size_t const chunk_size = stream_buf->egptr() - stream_buf->gptr();
+            size_t const consumed = consume(std::basic_string_view<char_t, traits_t>{stream_buf->gptr(), chunk_size});
+            assert(consumed <= chunk_size);
+            stream_buf->gbump(consumed);
+
+            if (consumed < chunk_size)
+                return true;
+
+            stream_buf->underflow();
+        }
+
+        return false;
+    }
+
     /*!\name Arithmetic operators
      * \{
      */
@@ -46,15 +46,17 @@
  * into one search configuration. In general, the same configuration element cannot occur more than once inside of
  * a configuration specification. The following table shows which combinations are possible.
  *
- * | **Configuration group**                                                     | **0** | **1** | **2** | **3** | **4** | **5** | **6** |
- * |:----------------------------------------------------------------------------|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|
- * | \ref seqan3::search_cfg::max_error_total  "0: Max error total"              |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |
- * | \ref seqan3::search_cfg::max_error_substitution "1: Max error substitution" |  ✅   |   ❌   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |
- * | \ref seqan3::search_cfg::max_error_insertion "2: Max error insertion"       |  ✅   |   ✅   |  ❌   |  ✅   |   ✅   |  ✅   |  ✅   |
- * | \ref seqan3::search_cfg::max_error_deletion "3: Max error deletion"         |  ✅   |   ✅   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |
- * | \ref search_configuration_subsection_output "4: Output"                     |  ✅   |   ✅   |  ✅   |  ✅   |   ❌   |  ✅   |  ✅   |
- * | \ref search_configuration_subsection_hit_strategy "5: Hit"                  |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ❌   |  ✅   |
- * | \ref seqan3::search_cfg::parallel "6: Parallel"                             |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ❌   |
+ * | **Configuration group**                                                     | **0** | **1** | **2** | **3** | **4** | **5** | **6** | **7** | **8** |
+ * |:----------------------------------------------------------------------------|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|
+ * | \ref seqan3::search_cfg::max_error_total  "0: Max error total"              |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::max_error_substitution "1: Max error substitution" |  ✅   |   ❌   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::max_error_insertion "2: Max error insertion"       |  ✅   |   ✅   |  ❌   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::max_error_deletion "3: Max error deletion"         |  ✅   |   ✅   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref search_configuration_subsection_output "4: Output"                     |  ✅   |   ✅   |  ✅   |  ✅   |   ❌   |  ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref search_configuration_subsection_hit_strategy "5: Hit"                  |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ❌   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::parallel "6: Parallel"                             |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ❌   |  ✅   |  ❌   |
+ * | \ref seqan3::search_cfg::batch "7: Batch"                                   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |  ❌   |  ✅   |
+ * | \ref seqan3::search_cfg::executor "8: Executor"                             |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ❌   |  ✅   |  ❌   |
  *
  * \subsection search_configuration_subsection_error 0 - 3: Max Error Configuration
  *
@@ -156,10 +158,31 @@
  *
  * This configuration determines the maximal number of threads the search algorithm can use.
  *
- * The seqan3::search_cfg::parallel configuration element can be combined with any other search configuration.
+ * The seqan3::search_cfg::parallel configuration element can be combined with any other search configuration except
+ * seqan3::search_cfg::executor.
  *
  * \include test/snippet/search/configuration_parallel.cpp
  *
+ * \subsection search_configuration_subsection_batch 7: Batch Configuration
+ *
+ * This configuration searches the queries in batches of the given size and advances all queries of a batch in
+ * lock-step. This hides the memory latency of the index and increases the throughput for many short queries.
+ * See seqan3::search_cfg::batch for details.
+ *
+ * The seqan3::search_cfg::batch configuration element can be combined with any other search configuration.
+ *
+ * \include test/snippet/search/configuration_batch.cpp
+ *
+ * \subsection search_configuration_subsection_executor 8: Executor Configuration
+ *
+ * This configuration executes the search in parallel on the threads of a seqan3::thread_pool that can be reused by
+ * many calls of seqan3::search. See seqan3::search_cfg::executor for details.
+ *
+ * The seqan3::search_cfg::executor configuration element can be combined with any other search configuration except
+ * seqan3::search_cfg::parallel.
+ *
+ * \include test/snippet/search/configuration_executor.cpp
+ *
  * ### User callback
  *
  * In the default case, a call to seqan3::search returns a lazy range over the results of the search. This lazy range
@@ -179,7 +202,9 @@
 
 #pragma once
 
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/default_configuration.hpp>
+#include <seqan3/search/configuration/executor.hpp>
 #include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/configuration/max_error.hpp>
 #include <seqan3/search/configuration/max_error_common.hpp>
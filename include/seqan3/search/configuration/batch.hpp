@@ -0,0 +1,73 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::search_cfg::batch configuration.
+ */
+
+#pragma once
+
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/search/configuration/detail.hpp>
+
+namespace seqan3::search_cfg
+{
+/*!\brief Searches the queries in batches, advancing all queries of a batch in lock-step.
+ * \ingroup search_configuration
+ * \see search_configuration
+ *
+ * \details
+ *
+ * By default, each query is searched on its own. Every step of the backward search computes a rank in the index that
+ * depends on the previous one, hence the search mostly waits for cache misses.
+ *
+ * With this configuration, the queries are searched in batches of seqan3::search_cfg::batch::size queries.
+ * In each round, every pending search of the batch is extended by one character. Before a search is extended, the
+ * memory the extension accesses is prefetched, such that the cache misses of different queries overlap.
+ * This increases the throughput for many short queries, for example when searching k-mers or seeds.
+ *
+ * The batch size must be greater than `0`. If combined with seqan3::search_cfg::parallel, each thread searches
+ * whole batches.
+ *
+ * The batched search finds the same hits as the default search, but explores the search space breadth-first.
+ * Hence, results that are not ordered by position, i.e. if only seqan3::search_cfg::output_index_cursor is
+ * configured, may be reported in a different order. For the seqan3::bi_fm_index, the approximate search uses
+ * backtracking like the search in the seqan3::fm_index instead of search schemes.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/configuration_batch.cpp
+ */
+class batch : private pipeable_config_element
+{
+public:
+    //!\brief The number of queries that are searched together [default: 64].
+    size_t size{64u};
+
+    /*!\name Constructors, assignment and destructor
+     * \{
+     */
+    constexpr batch() = default;                          //!< Defaulted.
+    constexpr batch(batch const &) = default;             //!< Defaulted.
+    constexpr batch(batch &&) = default;                  //!< Defaulted.
+    constexpr batch & operator=(batch const &) = default; //!< Defaulted.
+    constexpr batch & operator=(batch &&) = default;      //!< Defaulted.
+    ~batch() = default;                                   //!< Defaulted.
+
+    /*!\brief Initialises the batch configuration.
+     * \param[in] size The number of queries that are searched together.
+     */
+    constexpr explicit batch(size_t const size) noexcept : size{size}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::search_config_id id{seqan3::detail::search_config_id::batch};
+};
+
+} // namespace seqan3::search_cfg
@@ -27,6 +27,11 @@ namespace seqan3::search_cfg
  *
  * The config element takes the number of threads as a parameter, which must be greater than `0`.
  *
+ * The queries are distributed over the threads. When searching a seqan3::bi_fm_index with two or more errors for
+ * all hits (seqan3::search_cfg::hit_all, seqan3::search_cfg::hit_all_best, or seqan3::search_cfg::hit_strata), the
+ * search of a single query is additionally split into tasks that idle threads can take over. The results are the same
+ * as for the sequential search.
+ *
  * ### Example
  *
  * \include test/snippet/search/configuration_parallel.cpp
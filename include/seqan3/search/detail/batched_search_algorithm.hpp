@@ -0,0 +1,388 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::batched_search_algorithm.
+ */
+
+#pragma once
+
+#include <numeric>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/search/detail/search_common.hpp>
+#include <seqan3/search/detail/search_traits.hpp>
+#include <seqan3/search/detail/unidirectional_search_algorithm.hpp>
+#include <seqan3/search/fm_index/concept.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The algorithm that searches a batch of queries in an FM index in lock-step.
+ * \ingroup search
+ * \tparam configuration_t The search configuration type.
+ * \tparam index_t The type of index.
+ * \tparam policies_t A template parameter pack over the policies to specify the behavior of the algorithm.
+ *
+ * \details
+ *
+ * The algorithm explores the same search tree as the seqan3::detail::unidirectional_search_algorithm, but
+ * breadth-first and for all queries of a batch at once: Each pending search state is extended by one character per
+ * round. The memory accessed by the extension of a state is prefetched a few states in advance, such that the cache
+ * misses of independent queries overlap instead of stalling the search one after another.
+ *
+ * \sa seqan3::search_cfg::batch
+ */
+template <typename configuration_t, typename index_t, typename... policies_t>
+class batched_search_algorithm : protected policies_t...
+{
+private:
+    //!\brief The search configuration traits.
+    using traits_t = search_traits<configuration_t>;
+    //!\brief The search result type.
+    using search_result_type = typename traits_t::search_result_type;
+    //!\brief The cursor type of the index.
+    using cursor_type = typename index_t::cursor_type;
+    //!\brief The size type of the cursor.
+    using size_type = typename cursor_type::size_type;
+
+    static_assert(!std::same_as<search_result_type, empty_type>, "The search result type was not configured.");
+
+    //!\brief A pending search state, i.e. one node of the backtracking tree of a query.
+    struct search_state
+    {
+        //!\brief The position of the query within the batch.
+        size_t query_id;
+        //!\brief The cursor representing the searched prefix.
+        cursor_type cursor;
+        //!\brief The length of the query prefix that has already been searched.
+        size_type query_pos;
+        //!\brief The number of errors left for the remaining suffix of the query.
+        search_param error_left;
+        //!\brief The error type of the previous step.
+        error_type prev_error;
+    };
+
+    //!\brief The number of states that are prefetched in advance.
+    static constexpr size_t prefetch_distance{16u};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    batched_search_algorithm() = default;                                             //!< Defaulted.
+    batched_search_algorithm(batched_search_algorithm const &) = default;             //!< Defaulted.
+    batched_search_algorithm(batched_search_algorithm &&) = default;                  //!< Defaulted.
+    batched_search_algorithm & operator=(batched_search_algorithm const &) = default; //!< Defaulted.
+    batched_search_algorithm & operator=(batched_search_algorithm &&) = default;      //!< Defaulted.
+    ~batched_search_algorithm() = default;                                            //!< Defaulted.
+
+    /*!\brief Constructs from a configuration object and an index.
+     * \param[in] cfg The configuration object that guides the search algorithm.
+     * \param[in] index The index used in the algorithm.
+     *
+     * \details
+     *
+     * Initialises the stratum value from the configuration if it was set by the user.
+     */
+    batched_search_algorithm(configuration_t const & cfg, index_t const & index) : policies_t{cfg}...
+    {
+        stratum = cfg.get_or(search_cfg::hit_strata{0}).stratum;
+        index_ptr = &index;
+    }
+    //!\}
+
+    /*!\brief Searches a batch of query sequences in an FM index.
+     *
+     * \tparam indexed_query_batch_t The type of the batch; must model std::ranges::forward_range over indexed
+     *                               queries. An indexed query models seqan3::tuple_like with exactly two elements and
+     *                               the second tuple element must model std::ranges::random_access_range over the
+     *                               index's alphabet.
+     * \tparam callback_t The callback type to be invoked on a search result; must model std::invocable with the
+     *                    search result.
+     *
+     * \param[in] indexed_query_batch The indexed query sequences to be searched in the index.
+     * \param[in] callback The callback to call on a search result.
+     *
+     * \details
+     *
+     * The results are reported query by query in the order of the batch.
+     *
+     * ### Complexity
+     *
+     * \f$O(|query|^e)\f$ per query where \f$e\f$ is the maximum number of errors.
+     */
+    template <typename indexed_query_batch_t, typename callback_t>
+        requires std::ranges::forward_range<indexed_query_batch_t>
+              && (std::tuple_size_v<std::ranges::range_reference_t<indexed_query_batch_t>> == 2)
+              && std::invocable<callback_t, search_result_type>
+    void operator()(indexed_query_batch_t && indexed_query_batch, callback_t && callback)
+    {
+        std::vector<std::ranges::range_reference_t<indexed_query_batch_t>> batch{};
+        for (auto && indexed_query : indexed_query_batch)
+            batch.push_back(indexed_query);
+
+        auto queries = batch
+                     | std::views::transform(
+                           [](auto & indexed_query) -> decltype(auto)
+                           {
+                               return std::get<1>(indexed_query);
+                           });
+
+        std::vector<search_param> error_states{};
+        error_states.reserve(batch.size());
+        for (auto && query : queries)
+            error_states.push_back(this->max_error_counts(query)); // see policy_max_error
+
+        std::vector<std::vector<cursor_type>> internal_hits(batch.size());
+        perform_search_by_hit_strategy(internal_hits, queries, error_states);
+
+        // see policy_search_result_builder
+        for (size_t i = 0; i < batch.size(); ++i)
+            this->make_results(std::move(internal_hits[i]), std::get<0>(batch[i]), callback);
+    }
+
+private:
+    //!\brief A pointer to the fm index which is used to perform the search.
+    index_t const * index_ptr{nullptr};
+
+    //!\brief The stratum value if set.
+    uint8_t stratum{};
+
+    /*!\brief Searches the batch depending on the search strategy (hit configuration) given in the configuration.
+     * \tparam queries_t The type of the queries; must model std::ranges::random_access_range.
+     * \param[in, out] internal_hits The result vectors to be filled; one for each query.
+     * \param[in] queries The query sequences to be searched.
+     * \param[in] error_states The number of errors for matching each query sequence.
+     *
+     * \details
+     *
+     * Mirrors seqan3::detail::unidirectional_search_algorithm: Without seqan3::search_cfg::hit_all, each query is
+     * searched with an increasing number of total errors until a hit was found. Queries are dropped from the batch
+     * as soon as they found a hit or reached their maximal number of errors.
+     */
+    template <typename queries_t>
+    void perform_search_by_hit_strategy(std::vector<std::vector<cursor_type>> & internal_hits,
+                                        queries_t & queries,
+                                        std::vector<search_param> const & error_states)
+    {
+        std::vector<search_state> states{};
+        states.reserve(internal_hits.size());
+
+        auto add_state = [&](size_t const query_id, uint8_t const total)
+        {
+            search_param error_left{error_states[query_id]};
+            error_left.total = total;
+            states.push_back(search_state{query_id, index_ptr->cursor(), 0u, error_left, error_type::none});
+        };
+
+        if constexpr (!traits_t::search_all_hits)
+        {
+            std::vector<size_t> pending(internal_hits.size());
+            std::iota(pending.begin(), pending.end(), 0u);
+            std::vector<uint8_t> hit_total(internal_hits.size());
+
+            for (uint8_t total = 0; !pending.empty(); ++total)
+            {
+                states.clear();
+                for (size_t const query_id : pending)
+                {
+                    add_state(query_id, total);
+                    hit_total[query_id] = total;
+                }
+
+                // See unidirectional_search_algorithm::perform_search_by_hit_strategy for the meaning of abort_on_hit.
+                search_lockstep<!traits_t::search_all_best_hits>(internal_hits, queries, states);
+
+                std::erase_if(pending,
+                              [&](size_t const query_id)
+                              {
+                                  return !internal_hits[query_id].empty() || error_states[query_id].total <= total;
+                              });
+            }
+
+            if constexpr (traits_t::search_strata_hits)
+            {
+                states.clear();
+                for (size_t query_id = 0; query_id < internal_hits.size(); ++query_id)
+                {
+                    if (!internal_hits[query_id].empty())
+                    {
+                        internal_hits[query_id].clear();
+                        add_state(query_id, hit_total[query_id] + stratum);
+                    }
+                }
+
+                search_lockstep<false>(internal_hits, queries, states);
+            }
+        }
+        else // traits_t::search_all
+        {
+            for (size_t query_id = 0; query_id < internal_hits.size(); ++query_id)
+                add_state(query_id, error_states[query_id].total);
+
+            search_lockstep<false>(internal_hits, queries, states);
+        }
+    }
+
+    /*!\brief Advances the search states round by round until all of them are exhausted.
+     * \tparam abort_on_hit If the flag is set, the search of a query stops on its first hit.
+     * \tparam queries_t The type of the queries; must model std::ranges::random_access_range.
+     * \param[in, out] internal_hits The result vectors to be filled; one for each query.
+     * \param[in] queries The query sequences to be searched.
+     * \param[in] states The initial search states; the vector is used as buffer for the rounds.
+     */
+    template <bool abort_on_hit, typename queries_t>
+    void search_lockstep(std::vector<std::vector<cursor_type>> & internal_hits,
+                         queries_t & queries,
+                         std::vector<search_state> & states)
+    {
+        std::vector<search_state> next_states{};
+        next_states.reserve(states.size());
+
+        while (!states.empty())
+        {
+            // Insertions do not access the index and are appended to the current round, i.e. `states` may grow.
+            for (size_t i = 0; i < states.size(); ++i)
+            {
+                if (i + prefetch_distance < states.size())
+                    states[i + prefetch_distance].cursor.prefetch_extend_right();
+
+                // Copy the state since appending an insertion may reallocate `states`.
+                search_state const state{states[i]};
+
+                if (abort_on_hit && !internal_hits[state.query_id].empty())
+                    continue;
+
+                search_step(internal_hits[state.query_id], queries[state.query_id], state, states, next_states);
+            }
+
+            states.clear();
+            std::swap(states, next_states);
+        }
+    }
+
+    template <typename query_t>
+    void search_step(std::vector<cursor_type> & query_hits,
+                     query_t & query,
+                     search_state const & state,
+                     std::vector<search_state> & states,
+                     std::vector<search_state> & next_states);
+};
+
+/*!\brief Advances a single search state by one character.
+ * \tparam query_t Must model std::ranges::random_access_range over the index's alphabet.
+ * \param[in, out] query_hits The hits of the query the state belongs to.
+ * \param[in] query The query sequence the state belongs to.
+ * \param[in] state The state to advance.
+ * \param[in, out] states The states of the current round; insertions are appended.
+ * \param[in, out] next_states The states of the next round; all states that extended the cursor are appended.
+ *
+ * \details
+ *
+ * The cases and the pruning rules are the same as in seqan3::detail::unidirectional_search_algorithm::search_trivial,
+ * but instead of recursing, the children of the state are queued.
+ */
+template <typename configuration_t, typename index_t, typename... policies_t>
+template <typename query_t>
+inline void batched_search_algorithm<configuration_t, index_t, policies_t...>::search_step(
+    std::vector<cursor_type> & query_hits,
+    query_t & query,
+    search_state const & state,
+    std::vector<search_state> & states,
+    std::vector<search_state> & next_states)
+{
+    auto const & [query_id, cursor, query_pos, error_left, prev_error] = state;
+
+    if (query_pos == std::ranges::size(query))
+    {
+        query_hits.push_back(cursor);
+        return;
+    }
+
+    auto queue = [query_id = query_id](std::vector<search_state> & target,
+                                       cursor_type const & cur,
+                                       size_type const pos,
+                                       search_param const errors,
+                                       error_type const error)
+    {
+        target.push_back(search_state{query_id, cur, pos, errors, error});
+    };
+
+    auto const query_rank = seqan3::to_rank(query[query_pos]);
+    cursor_type cur{cursor};
+
+    // Exact case (no errors left)
+    if (error_left.total == 0)
+    {
+        if (cur.extend_right(query[query_pos]))
+            queue(next_states, cur, query_pos + 1, error_left, error_type::matchmm);
+
+        return;
+    }
+
+    // Insertion
+    // Only allow insertions if there is no match and we are not at the beginning of the query.
+    bool const allow_insertion = (cur.query_length() > 0) ? cur.last_rank() != query_rank : true;
+
+    if (allow_insertion && (prev_error != error_type::deletion || error_left.substitution == 0)
+        && error_left.insertion > 0)
+    {
+        search_param error_left2{error_left};
+        error_left2.insertion--;
+        error_left2.total--;
+        queue(states, cur, query_pos + 1, error_left2, error_type::insertion);
+    }
+
+    // Do not allow deletions at the beginning of the query sequence
+    if (((query_pos > 0 && error_left.deletion > 0) || error_left.substitution > 0) && cur.extend_right())
+    {
+        do
+        {
+            // Match (when error_left.substitution > 0) and Mismatch
+            if (error_left.substitution > 0)
+            {
+                bool delta = cur.last_rank() != query_rank;
+                search_param error_left2{error_left};
+                error_left2.total -= delta;
+                error_left2.substitution -= delta;
+                queue(next_states, cur, query_pos + 1, error_left2, error_type::matchmm);
+            }
+
+            // Deletion (Do not allow deletions at the beginning of the query sequence.)
+            if (query_pos > 0)
+            {
+                // Match (when error_left.substitution == 0)
+                if (error_left.substitution == 0 && cur.last_rank() == query_rank)
+                    queue(next_states, cur, query_pos + 1, error_left, error_type::matchmm);
+
+                // Do not allow deletions after an insertion. Only search for characters different from the
+                // corresponding query character. (Same character is covered by a match.)
+                if ((prev_error != error_type::insertion || error_left.substitution == 0) && error_left.deletion > 0
+                    && cur.last_rank() != query_rank)
+                {
+                    search_param error_left2{error_left};
+                    error_left2.total--;
+                    error_left2.deletion--;
+                    queue(next_states, cur, query_pos, error_left2, error_type::deletion);
+                }
+            }
+        }
+        while (cur.cycle_back());
+    }
+    else
+    {
+        // Match (when error_left.substitution == 0)
+        if (cur.extend_right(query[query_pos]))
+            queue(next_states, cur, query_pos + 1, error_left, error_type::matchmm);
+    }
+}
+
+} // namespace seqan3::detail
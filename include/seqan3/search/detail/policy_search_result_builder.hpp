@@ -129,22 +129,28 @@ private:
      *
      * \details
      *
-     * For each cursor `in internal_hits`, this function calls `cursor.layz_locate()` if the search configuration
-     * requires it (search_traits_type::output_requires_locate_call) and then constructs a seqan3::search_result from
-     * the resulting data. The seqan3::search_result will be filled only with the data that was asked for by the user
-     * via the `search_traits_type::output_[...]` trait (e.g. `search_traits_type::output_query_id`).
+     * For each cursor `in internal_hits`, this function calls `cursor.locate()` or `cursor.lazy_locate()` if the
+     * search configuration requires it (search_traits_type::output_requires_locate_call) and then constructs a
+     * seqan3::search_result from the resulting data. `cursor.locate()` is only called if the index resolves all
+     * occurrences together (`index_cursor_t::locates_interval`) and more than a single hit is reported; otherwise the
+     * occurrences are located one by one while they are reported. The seqan3::search_result will be filled only with
+     * the data that was asked for by the user via the `search_traits_type::output_[...]` trait (e.g.
+     * `search_traits_type::output_query_id`).
      */
     template <typename index_cursor_t, typename query_index_t, typename callback_t>
     void make_results_impl(std::vector<index_cursor_t> internal_hits,
                            [[maybe_unused]] query_index_t idx,
                            callback_t && callback)
     {
+        // Locating all text positions of a cursor at once only pays off if the index shares the work between them.
         auto maybe_locate = [](auto const & cursor)
         {
-            if constexpr (search_traits_type::output_requires_locate_call)
-                return cursor.lazy_locate();
-            else
+            if constexpr (!search_traits_type::output_requires_locate_call)
                 return std::views::single(std::tuple{0, 0});
+            else if constexpr (index_cursor_t::locates_interval && !search_traits_type::search_single_best_hit)
+                return cursor.locate();
+            else
+                return cursor.lazy_locate();
         };
 
         for (auto const & cursor : internal_hits)
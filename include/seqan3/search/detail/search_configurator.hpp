@@ -13,10 +13,12 @@
 #pragma once
 
 #include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/configuration/max_error.hpp>
 #include <seqan3/search/configuration/output.hpp>
 #include <seqan3/search/configuration/result_type.hpp>
+#include <seqan3/search/detail/batched_search_algorithm.hpp>
 #include <seqan3/search/detail/policy_max_error.hpp>
 #include <seqan3/search/detail/policy_search_result_builder.hpp>
 #include <seqan3/search/detail/search_scheme_algorithm.hpp>
@@ -76,9 +78,15 @@ private:
     struct select_search_algorithm
     {
         //!\brief The selected algorithm type based on the index.
-        using type = lazy_conditional_t<template_specialisation_of<typename index_t::cursor_type, bi_fm_index_cursor>,
-                                        lazy<search_scheme_algorithm, configuration_t, index_t, policies_t...>,
-                                        lazy<unidirectional_search_algorithm, configuration_t, index_t, policies_t...>>;
+        using index_algorithm_type =
+            lazy_conditional_t<template_specialisation_of<typename index_t::cursor_type, bi_fm_index_cursor>,
+                               lazy<search_scheme_algorithm, configuration_t, index_t, policies_t...>,
+                               lazy<unidirectional_search_algorithm, configuration_t, index_t, policies_t...>>;
+
+        //!\brief The selected algorithm type based on the index and on whether the queries are searched in batches.
+        using type = lazy_conditional_t<search_traits<configuration_t>::search_in_batches,
+                                        lazy<batched_search_algorithm, configuration_t, index_t, policies_t...>,
+                                        index_algorithm_type>;
     };
 
 public:
@@ -155,14 +163,19 @@ public:
      *
      * \details
      *
-     * If the cursor of `index_t` models seqan3::detail::template_specialisation_of a seqan3::bi_fm_index_cursor,
-     * then the seqan3::detail::search_scheme_algorithm is chosen. Otherwise, the
+     * If seqan3::search_cfg::batch is configured, the seqan3::detail::batched_search_algorithm is chosen and
+     * `query_t` is a range over indexed queries.
+     * Otherwise, if the cursor of `index_t` models seqan3::detail::template_specialisation_of a
+     * seqan3::bi_fm_index_cursor, then the seqan3::detail::search_scheme_algorithm is chosen. Otherwise, the
      * seqan3::detail::unidirectional_search_algorithm is chosen.
      */
     template <typename query_t, typename configuration_t, typename index_t>
     static auto configure_algorithm(configuration_t const & cfg, index_t const & index)
     {
-        using query_index_t = std::tuple_element_t<0, query_t>;
+        using indexed_query_t = lazy_conditional_t<search_traits<configuration_t>::search_in_batches,
+                                                   lazy<std::ranges::range_reference_t, query_t>,
+                                                   query_t>;
+        using query_index_t = std::tuple_element_t<0, indexed_query_t>;
         using search_result_t = typename select_search_result<configuration_t, index_t, query_index_t>::type;
         using callback_t = std::function<void(search_result_t)>;
         using type_erased_algorithm_t = std::function<void(query_t, callback_t)>;
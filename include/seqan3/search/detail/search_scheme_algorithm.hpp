@@ -12,13 +12,20 @@
 
 #pragma once
 
+#include <deque>
+#include <map>
+#include <mutex>
 #include <type_traits>
+#include <vector>
 
+#include <seqan3/core/detail/template_inspection.hpp>
 #include <seqan3/search/detail/search_common.hpp>
+#include <seqan3/search/detail/search_scheme_generator.hpp>
 #include <seqan3/search/detail/search_scheme_precomputed.hpp>
 #include <seqan3/search/detail/search_traits.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/utility/parallel/detail/work_stealing_scheduler.hpp>
 #include <seqan3/utility/type_traits/detail/transformation_trait_or.hpp>
 #include <seqan3/utility/views/slice.hpp>
 
@@ -173,14 +180,19 @@ private:
     }
 };
 
-/*!\brief Computes a (non-optimal) search scheme. Currently the generated search scheme represents trivial backtracking.
+/*!\brief Computes a search scheme for any number of errors.
  * \ingroup search
  * \param[in] min_error Minimum number of errors allowed.
  * \param[in] max_error Maximum number of errors allowed.
  *
+ * \details
+ *
+ * Generates the search scheme with seqan3::detail::generate_search_scheme using the default options, i.e. blocks of
+ * the same length and a cost model of a random DNA text.
+ *
  * ### Complexity
  *
- * Constant.
+ * See seqan3::detail::generate_search_scheme.
  *
  * ### Exceptions
  *
@@ -188,13 +200,51 @@ private:
  */
 inline std::vector<search_dyn> compute_ss(uint8_t const min_error, uint8_t const max_error)
 {
-    // TODO: Replace this at least by the pigeonhole principle or even better by 01*0 schemes.
-    // NOTE: Make sure that the searches are sorted by their asymptotical running time (i.e. upper error bound string),
-    //       s.t. easy to compute searches come first. This improves the running time of algorithms that abort after the
-    //       first hit (e.g. search strategy: best). Even though it is not guaranteed, this seems to be a good greedy
-    //       approach.
-    std::vector<search_dyn> scheme{{{1}, {min_error}, {max_error}}};
-    return scheme;
+    return generate_search_scheme(min_error, max_error).searches;
+}
+
+/*!\brief The maximal number of errors for which the default search generates a search scheme at runtime.
+ * \ingroup search
+ *
+ * \details
+ *
+ * The number of error distributions, and hence the time and memory needed to generate a search scheme, grows
+ * exponentially with the number of errors. Searches with more errors use trivial backtracking.
+ */
+inline constexpr uint8_t max_generated_search_scheme_error{6};
+
+/*!\brief Returns the search scheme computed by seqan3::detail::compute_ss, which is stored for the rest of the process.
+ * \ingroup search
+ * \param[in] min_error Minimum number of errors allowed.
+ * \param[in] max_error Maximum number of errors allowed.
+ *
+ * \details
+ *
+ * Only meant for up to seqan3::detail::max_generated_search_scheme_error errors, for which the search scheme is
+ * generated within milliseconds.
+ *
+ * ### Thread safety
+ *
+ * Thread-safe. The search scheme is computed without holding the lock, such that searches with other numbers of
+ * errors are not blocked. Concurrent first calls with the same errors may each compute the search scheme; only the
+ * first one is stored.
+ */
+inline search_scheme_dyn_type const & cached_compute_ss(uint8_t const min_error, uint8_t const max_error)
+{
+    static std::mutex mutex{};
+    static std::map<std::pair<uint8_t, uint8_t>, search_scheme_dyn_type> search_schemes{};
+
+    {
+        std::lock_guard lock{mutex};
+        if (auto it = search_schemes.find({min_error, max_error}); it != search_schemes.end())
+            return it->second;
+    }
+
+    search_scheme_dyn_type search_scheme{compute_ss(min_error, max_error)};
+
+    // References to the elements of a std::map stay valid when other elements are inserted.
+    std::lock_guard lock{mutex};
+    return search_schemes.try_emplace(std::pair{min_error, max_error}, std::move(search_scheme)).first->second;
 }
 
 /*!\brief Returns for each search the cumulative length of blocks in the order of blocks in each search and the
@@ -203,6 +253,8 @@ inline std::vector<search_dyn> compute_ss(uint8_t const min_error, uint8_t const
  * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
  * \param[in] search_scheme Search scheme that will be used for searching.
  * \param[in] query_length  Length of the query that will be searched in an index.
+ * \param[in] block_weights The relative length of each block from left to right; if empty, the blocks have the same
+ *                          length (see seqan3::detail::search_scheme_blocks_length).
  * \returns A range of pairs containing for each search the cumulative lengths of blocks and the starting position
  *          in the query.
  *
@@ -215,7 +267,9 @@ inline std::vector<search_dyn> compute_ss(uint8_t const min_error, uint8_t const
  * Strong exception guarantee.
  */
 template <typename search_scheme_t>
-inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size_t const query_length)
+inline auto search_scheme_block_info(search_scheme_t const & search_scheme,
+                                     size_t const query_length,
+                                     std::vector<size_t> const & block_weights = {})
 {
     using blocks_length_type = typename search_scheme_t::value_type::blocks_length_type;
 
@@ -247,6 +301,9 @@ inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size
     for (uint8_t block_id = 0; block_id < rest; ++block_id)
         ++blocks_length[block_id];
 
+    if (!block_weights.empty())
+        std::ranges::copy(search_scheme_blocks_length(blocks, query_length, block_weights), blocks_length.begin());
+
     for (uint8_t search_id = 0; search_id < search_scheme.size(); ++search_id)
     {
         auto const & search = search_scheme[search_id];
@@ -269,6 +326,85 @@ inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size
     return result;
 }
 
+/*!\brief The delegate of a search that is split into tasks.
+ * \ingroup search
+ * \tparam cursor_t The type of the cursor.
+ *
+ * \details
+ *
+ * If a search is invoked with this delegate, the subtrees of the first approximate search step, i.e. the children
+ * iterated by seqan3::detail::search_ss_children, are searched by tasks of a seqan3::detail::task_group. The subtrees
+ * use a delegate that does not split any further.
+ *
+ * The hits are stored in slots in the order in which the sequential search would report them: each subtree writes
+ * to its own slot, the hits found by the search itself are written to the slot following the last spawned subtree.
+ * Only the thread running the search itself adds slots; the slots are stored in a std::deque, such that adding a slot
+ * does not invalidate the slots of running tasks.
+ */
+template <typename cursor_t>
+class search_scheme_task_splitter
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    search_scheme_task_splitter() = delete;                                                 //!< Deleted.
+    search_scheme_task_splitter(search_scheme_task_splitter const &) = delete;             //!< Deleted.
+    search_scheme_task_splitter(search_scheme_task_splitter &&) = default;                 //!< Defaulted.
+    search_scheme_task_splitter & operator=(search_scheme_task_splitter const &) = delete; //!< Deleted.
+    search_scheme_task_splitter & operator=(search_scheme_task_splitter &&) = default;     //!< Defaulted.
+    ~search_scheme_task_splitter() = default;                                              //!< Defaulted.
+
+    //!\brief Constructs the delegate for the given task group.
+    explicit search_scheme_task_splitter(task_group & tasks) : tasks{std::addressof(tasks)}
+    {}
+    //!\}
+
+    //!\brief Stores a hit found by the search itself.
+    void operator()(cursor_t const & cursor)
+    {
+        slots.back().push_back(cursor);
+    }
+
+    /*!\brief Searches a subtree in a new task.
+     * \tparam subtree_search_t The type of the subtree search; must be invocable with a delegate taking `cursor_t`.
+     * \param[in] subtree_search The subtree search.
+     */
+    template <typename subtree_search_t>
+    void spawn(subtree_search_t subtree_search)
+    {
+        std::vector<cursor_t> & slot = slots.emplace_back();
+        tasks->run(
+            [subtree_search = std::move(subtree_search), &slot]()
+            {
+                subtree_search(
+                    [&slot](cursor_t const & cursor)
+                    {
+                        slot.push_back(cursor);
+                    });
+            });
+        slots.emplace_back();
+    }
+
+    /*!\brief Invokes the delegate on all hits in the order of the sequential search.
+     * \param[in] delegate The delegate to invoke.
+     * \attention All tasks must be completed.
+     */
+    template <typename delegate_t>
+    void report(delegate_t && delegate) const
+    {
+        for (std::vector<cursor_t> const & slot : slots)
+            for (cursor_t const & cursor : slot)
+                delegate(cursor);
+    }
+
+private:
+    //!\brief The task group running the subtree searches.
+    task_group * tasks;
+    //!\brief The hits in the order of the sequential search.
+    std::deque<std::vector<cursor_t>> slots = std::deque<std::vector<cursor_t>>(1u);
+};
+
 //!\cond
 // forward declaration
 template <bool abort_on_hit,
@@ -510,19 +646,21 @@ inline bool search_ss_children(cursor_t cur,
     {
         size_type const chars_left = blocks_length[block_id] - (rb - lb - 1);
 
-        size_type lb2 = lb - !go_right;
-        size_type rb2 = rb + go_right;
+        size_type const lb2 = lb - !go_right;
+        size_type const rb2 = rb + go_right;
 
-        do
+        // Searches the subtree of a child. All variables are captured by value, such that the subtree can be searched
+        // by a task while the cursor moves on to the next child.
+        auto search_child = [=, &query, &search, &blocks_length](cursor_t const & child, auto && subtree_delegate)
         {
-            bool const delta = cur.last_rank() != to_rank(query[(go_right ? rb : lb) - 1]);
+            bool const delta = child.last_rank() != to_rank(query[(go_right ? rb : lb) - 1]);
 
             // skip if there are more min errors left in the current block than characters in the block
             // i.e. chars_left - 1 < min_error_left_in_block - delta
             // TODO: move that outside the if / do-while struct
             // TODO: incorporate error_left.deletion into formula
             if (error_left.deletion == 0 && chars_left + delta < min_error_left_in_block + 1u)
-                continue;
+                return false;
 
             if (!delta || error_left.substitution > 0)
             {
@@ -537,7 +675,7 @@ inline bool search_ss_children(cursor_t cur,
                     // Thus do not change the direction (go_right) yet.
                     if (error_left.deletion > 0)
                     {
-                        if (search_ss_deletion<abort_on_hit>(cur,
+                        if (search_ss_deletion<abort_on_hit>(child,
                                                              query,
                                                              lb2,
                                                              rb2,
@@ -547,7 +685,7 @@ inline bool search_ss_children(cursor_t cur,
                                                              search,
                                                              blocks_length,
                                                              error_left2,
-                                                             delegate)
+                                                             subtree_delegate)
                             && abort_on_hit)
                         {
                             return true;
@@ -558,7 +696,7 @@ inline bool search_ss_children(cursor_t cur,
                         uint8_t const block_id2 = std::min<uint8_t>(block_id + 1, search.blocks() - 1);
                         bool const go_right2 = block_id2 == 0 ? true : search.pi[block_id2] > search.pi[block_id2 - 1];
 
-                        if (search_ss<abort_on_hit>(cur,
+                        if (search_ss<abort_on_hit>(child,
                                                     query,
                                                     lb2,
                                                     rb2,
@@ -568,7 +706,7 @@ inline bool search_ss_children(cursor_t cur,
                                                     search,
                                                     blocks_length,
                                                     error_left2,
-                                                    delegate)
+                                                    subtree_delegate)
                             && abort_on_hit)
                         {
                             return true;
@@ -577,7 +715,7 @@ inline bool search_ss_children(cursor_t cur,
                 }
                 else
                 {
-                    if (search_ss<abort_on_hit>(cur,
+                    if (search_ss<abort_on_hit>(child,
                                                 query,
                                                 lb2,
                                                 rb2,
@@ -587,7 +725,7 @@ inline bool search_ss_children(cursor_t cur,
                                                 search,
                                                 blocks_length,
                                                 error_left2,
-                                                delegate)
+                                                subtree_delegate)
                         && abort_on_hit)
                     {
                         return true;
@@ -605,7 +743,7 @@ inline bool search_ss_children(cursor_t cur,
                 search_param error_left3{error_left};
                 error_left3.total--;
                 error_left3.deletion--;
-                search_ss<abort_on_hit>(cur,
+                search_ss<abort_on_hit>(child,
                                         query,
                                         lb,
                                         rb,
@@ -615,7 +753,24 @@ inline bool search_ss_children(cursor_t cur,
                                         search,
                                         blocks_length,
                                         error_left3,
-                                        delegate);
+                                        subtree_delegate);
+            }
+            return false;
+        };
+
+        do
+        {
+            if constexpr (is_type_specialisation_of_v<std::remove_cvref_t<delegate_t>, search_scheme_task_splitter>)
+            {
+                delegate.spawn(
+                    [search_child, child = cur](auto && subtree_delegate)
+                    {
+                        search_child(child, subtree_delegate);
+                    });
+            }
+            else if (search_child(cur, delegate) && abort_on_hit)
+            {
+                return true;
             }
         }
         while ((go_right && cur.cycle_back()) || (!go_right && cur.cycle_front()));
@@ -765,6 +920,8 @@ inline bool search_ss(cursor_t cur,
  * \param[in] query         Query sequence to be searched in the index.
  * \param[in] error_left    Number of errors left for matching the remaining suffix of the query sequence.
  * \param[in] search_scheme Search scheme to be used for searching.
+ * \param[in] block_weights The relative length of each block from left to right; if empty, the blocks have the same
+ *                          length.
  * \param[in] delegate      Function that is called on every hit.
  *
  * ### Complexity
@@ -781,10 +938,54 @@ inline void search_ss(index_t const & index,
                       query_t & query,
                       search_param const error_left,
                       search_scheme_t const & search_scheme,
+                      std::vector<size_t> const & block_weights,
                       delegate_t && delegate)
 {
     // retrieve cumulative block lengths and starting position
-    auto const block_info = search_scheme_block_info(search_scheme, std::ranges::size(query));
+    auto const block_info = search_scheme_block_info(search_scheme, std::ranges::size(query), block_weights);
+
+    // If the search runs on a thread of a seqan3::detail::work_stealing_scheduler, e.g. if seqan3::search_cfg::parallel
+    // is configured, the searches and the subtrees of their first approximate search step are searched by tasks.
+    // Idle threads of the scheduler then steal the tasks of expensive queries. Aborting on the first hit depends on the
+    // order of the searches and easy searches with few errors do not benefit, hence those are searched sequentially.
+    if constexpr (!abort_on_hit)
+    {
+        work_stealing_scheduler * const scheduler = work_stealing_scheduler::current();
+        if (scheduler != nullptr && scheduler->thread_count() > 1u && error_left.total >= 2u)
+        {
+            using cursor_t = std::remove_cvref_t<decltype(index.cursor())>;
+
+            task_group tasks{*scheduler};
+            std::vector<search_scheme_task_splitter<cursor_t>> splitters{};
+            splitters.reserve(search_scheme.size());
+
+            for (uint8_t search_id = 0; search_id < search_scheme.size(); ++search_id)
+            {
+                auto & splitter = splitters.emplace_back(tasks);
+                tasks.run(
+                    [&, search_id]()
+                    {
+                        auto const & [blocks_length, start_pos] = block_info[search_id];
+                        search_ss<abort_on_hit>(index.cursor(),
+                                                query,
+                                                start_pos,
+                                                start_pos + 1,
+                                                0,
+                                                0,
+                                                true,
+                                                search_scheme[search_id],
+                                                blocks_length,
+                                                error_left,
+                                                splitter);
+                    });
+            }
+            tasks.wait();
+
+            for (auto const & splitter : splitters)
+                splitter.report(delegate);
+            return;
+        }
+    }
 
     for (uint8_t search_id = 0; search_id < search_scheme.size(); ++search_id)
     {
@@ -810,6 +1011,54 @@ inline void search_ss(index_t const & index,
     }
 }
 
+/*!\brief Searches a query sequence in a bidirectional index using search schemes with blocks of the same length.
+ * \ingroup search
+ * \tparam abort_on_hit     If the flag is set, the search aborts on the first hit.
+ * \tparam index_t          index_t::cursor_type must model seqan3::detail::template_specialisation_of
+ *                          a seqan3::bi_fm_index_cursor.
+ * \tparam query_t          Must model std::ranges::random_access_range over the index's alphabet.
+ * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \tparam delegate_t       Takes `typename index_t::cursor_type` as argument.
+ * \param[in] index         String index built on the text that will be searched.
+ * \param[in] query         Query sequence to be searched in the index.
+ * \param[in] error_left    Number of errors left for matching the remaining suffix of the query sequence.
+ * \param[in] search_scheme Search scheme to be used for searching.
+ * \param[in] delegate      Function that is called on every hit.
+ */
+template <bool abort_on_hit, typename index_t, typename query_t, typename search_scheme_t, typename delegate_t>
+inline void search_ss(index_t const & index,
+                      query_t & query,
+                      search_param const error_left,
+                      search_scheme_t const & search_scheme,
+                      delegate_t && delegate)
+{
+    search_ss<abort_on_hit>(index, query, error_left, search_scheme, std::vector<size_t>{}, delegate);
+}
+
+/*!\brief Searches a query sequence in a bidirectional index using a search scheme with weighted blocks.
+ * \ingroup search
+ * \tparam abort_on_hit     If the flag is set, the search aborts on the first hit.
+ * \tparam index_t          index_t::cursor_type must model seqan3::detail::template_specialisation_of
+ *                          a seqan3::bi_fm_index_cursor.
+ * \tparam query_t          Must model std::ranges::random_access_range over the index's alphabet.
+ * \tparam delegate_t       Takes `typename index_t::cursor_type` as argument.
+ * \param[in] index         String index built on the text that will be searched.
+ * \param[in] query         Query sequence to be searched in the index.
+ * \param[in] error_left    Number of errors left for matching the remaining suffix of the query sequence.
+ * \param[in] search_scheme Search scheme to be used for searching, e.g. generated by
+ *                          seqan3::detail::generate_search_scheme.
+ * \param[in] delegate      Function that is called on every hit.
+ */
+template <bool abort_on_hit, typename index_t, typename query_t, typename delegate_t>
+inline void search_ss(index_t const & index,
+                      query_t & query,
+                      search_param const error_left,
+                      weighted_search_scheme const & search_scheme,
+                      delegate_t && delegate)
+{
+    search_ss<abort_on_hit>(index, query, error_left, search_scheme.searches, search_scheme.block_weights, delegate);
+}
+
 /*!\brief Searches a query sequence in a bidirectional index.
  * \ingroup search
  * \tparam abort_on_hit    If the flag is set, the search aborts on the first hit.
@@ -836,6 +1085,17 @@ inline void search_scheme_algorithm<configuration_t, index_t, policies_t...>::se
     search_param const error_left,
     delegate_t && delegate)
 {
+    search_scheme_dyn_type const trivial_search_scheme{{{1}, {0}, {error_left.total}}};
+
+    // Every block needs at least one character, use trivial backtracking for shorter queries.
+    auto search_with_blocks = [&](auto const & search_scheme)
+    {
+        if (std::ranges::size(query) < search_scheme.front().blocks())
+            search_ss<abort_on_hit>(*index_ptr, query, error_left, trivial_search_scheme, delegate);
+        else
+            search_ss<abort_on_hit>(*index_ptr, query, error_left, search_scheme, delegate);
+    };
+
     switch (error_left.total)
     {
     case 0:
@@ -850,9 +1110,17 @@ inline void search_scheme_algorithm<configuration_t, index_t, policies_t...>::se
     case 3:
         search_ss<abort_on_hit>(*index_ptr, query, error_left, optimum_search_scheme<0, 3>, delegate);
         break;
+    case 4:
+        search_with_blocks(precomputed_search_scheme<0, 4>);
+        break;
+    case 5:
+        search_with_blocks(precomputed_search_scheme<0, 5>);
+        break;
     default:
-        auto const & search_scheme{compute_ss(0, error_left.total)};
-        search_ss<abort_on_hit>(*index_ptr, query, error_left, search_scheme, delegate);
+        if (error_left.total <= max_generated_search_scheme_error)
+            search_with_blocks(cached_compute_ss(0, error_left.total));
+        else
+            search_ss<abort_on_hit>(*index_ptr, query, error_left, trivial_search_scheme, delegate);
         break;
     }
 }
@@ -0,0 +1,973 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the generation of search schemes at runtime.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/search/detail/search_scheme_precomputed.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Estimates the number of nodes of the backtracking tree that a search visits.
+ * \ingroup search
+ *
+ * \details
+ *
+ * The model assumes that every character of the query is either matched or substituted, i.e. it counts the strings
+ * within the error bounds of a search (Hamming distance). A string of length `d` occurs in the text with the
+ * probability seqan3::detail::search_scheme_cost_model::occurrence_probability, hence the expected number of nodes
+ * visited at depth `d` is the number of considered strings of length `d` times this probability.
+ *
+ * A default constructed model, or one constructed from the alphabet size and the text length, assumes a uniformly
+ * distributed random text. A model constructed from an index counts the distinct substrings of the indexed text up to
+ * a given depth and extrapolates the growth of the last measured level. This reflects repeats and a skewed
+ * composition of the text, which make approximate searches more expensive than on a random text.
+ */
+class search_scheme_cost_model
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    search_scheme_cost_model() = default;                                             //!< Defaulted.
+    search_scheme_cost_model(search_scheme_cost_model const &) = default;             //!< Defaulted.
+    search_scheme_cost_model(search_scheme_cost_model &&) = default;                  //!< Defaulted.
+    search_scheme_cost_model & operator=(search_scheme_cost_model const &) = default; //!< Defaulted.
+    search_scheme_cost_model & operator=(search_scheme_cost_model &&) = default;      //!< Defaulted.
+    ~search_scheme_cost_model() = default;                                            //!< Defaulted.
+
+    /*!\brief Constructs the model of a uniformly distributed random text.
+     * \param[in] sigma The size of the alphabet.
+     * \param[in] text_length The length of the text.
+     * \throws std::invalid_argument if `sigma` is smaller than 2.
+     */
+    search_scheme_cost_model(size_t const sigma, size_t const text_length) : sigma{sigma}, text_length{text_length}
+    {
+        if (sigma < 2u)
+            throw std::invalid_argument{"The alphabet of a search_scheme_cost_model needs at least two characters."};
+    }
+
+    /*!\brief Constructs the model by counting the distinct substrings of an indexed text.
+     * \tparam index_t The type of the index; must provide a cursor with `extend_right()` and `cycle_back()`.
+     * \param[in] index The index.
+     * \param[in] max_nodes The maximal number of nodes per level of the suffix tree to visit [default: 2^20].
+     *
+     * \details
+     *
+     * The substrings are counted up to the depth at which the suffix tree of a random text may have `max_nodes` many
+     * nodes, i.e. up to depth \f$\lfloor\log_\sigma(\mathrm{max\_nodes})\rfloor\f$. This visits at most about
+     * `2 * max_nodes` nodes of the index.
+     */
+    template <typename index_t>
+        requires requires (index_t const & index) { index.cursor(); }
+    explicit search_scheme_cost_model(index_t const & index, size_t const max_nodes = size_t{1u} << 20) :
+        search_scheme_cost_model{seqan3::alphabet_size<typename index_t::alphabet_type>, index.size()}
+    {
+        size_t max_depth{};
+        for (double nodes = sigma; nodes <= max_nodes; nodes *= sigma)
+            ++max_depth;
+
+        distinct_substrings.assign(max_depth + 1u, 0.0);
+        distinct_substrings[0] = 1.0;
+        if (max_depth > 0u && index.size() > 0u)
+            count_distinct_substrings(index.cursor(), 1u);
+    }
+    //!\}
+
+    //!\brief Returns the size of the alphabet.
+    size_t alphabet_size() const noexcept
+    {
+        return sigma;
+    }
+
+    /*!\brief Returns the probability that a string of the given length occurs in the text.
+     * \param[in] depth The length of the string.
+     */
+    double occurrence_probability(size_t const depth) const noexcept
+    {
+        double const strings = std::pow(static_cast<double>(sigma), static_cast<double>(depth));
+        double const positions = std::max(static_cast<double>(text_length) - depth + 1.0, 0.0);
+        if (!std::isfinite(strings))
+            return 0.0;
+
+        double distinct{};
+        if (depth < distinct_substrings.size())
+        {
+            distinct = distinct_substrings[depth];
+        }
+        else if (distinct_substrings.size() >= 2u)
+        {
+            // Continue the growth of the deepest measured level and saturate like a random text of this many strings.
+            size_t const last = distinct_substrings.size() - 1u;
+            double const growth = std::clamp(distinct_substrings[last] / std::max(distinct_substrings[last - 1u], 1.0),
+                                             1.0,
+                                             static_cast<double>(sigma));
+            double const possible = std::max(distinct_substrings[last], 1.0) * std::pow(growth, depth - last);
+            distinct = -possible * std::expm1(-positions / possible);
+        }
+        else
+        {
+            // The expected number of distinct substrings of a uniformly distributed random text.
+            distinct = -strings * std::expm1(-positions / strings);
+        }
+
+        return std::min(distinct / strings, 1.0);
+    }
+
+    /*!\brief Returns a textual description of the model that identifies it, e.g. to cache search schemes.
+     * \details The description consists of a single line.
+     */
+    std::string description() const
+    {
+        std::ostringstream stream{};
+        stream.precision(std::numeric_limits<double>::max_digits10);
+        stream << "sigma " << sigma << " text_length " << text_length << " distinct_substrings "
+               << distinct_substrings.size();
+        for (double const count : distinct_substrings)
+            stream << ' ' << count;
+        return stream.str();
+    }
+
+private:
+    //!\brief Counts the children of the node of the cursor and recursively their children.
+    template <typename cursor_t>
+    void count_distinct_substrings(cursor_t cursor, size_t const depth)
+    {
+        if (!cursor.extend_right())
+            return;
+
+        do
+        {
+            ++distinct_substrings[depth];
+            if (depth + 1u < distinct_substrings.size())
+                count_distinct_substrings(cursor, depth + 1u);
+        }
+        while (cursor.cycle_back());
+    }
+
+    //!\brief The size of the alphabet.
+    size_t sigma{4u};
+    //!\brief The length of the text.
+    size_t text_length{size_t{1u} << 32};
+    //!\brief The number of distinct substrings of the text for each length; empty for a random text.
+    std::vector<double> distinct_substrings{};
+};
+
+//!\brief A search scheme together with the relative lengths of its blocks.
+//!\ingroup search
+struct weighted_search_scheme
+{
+    //!\brief The searches.
+    search_scheme_dyn_type searches{};
+    //!\brief The relative length of each block from left to right; empty if the blocks have the same length.
+    std::vector<size_t> block_weights{};
+};
+
+//!\brief The options of seqan3::detail::generate_search_scheme.
+//!\ingroup search
+struct search_scheme_generator_options
+{
+    //!\brief The query length that the search scheme is optimised for.
+    size_t query_length{100u};
+    //!\brief The cost model that estimates the running time of a search.
+    search_scheme_cost_model cost_model{};
+    /*!\brief Error distributions are moved between searches as long as this decreases the expected costs if the
+     *        number of error distributions times the number of search orders does not exceed this limit
+     *        [default: 8192, i.e. up to 5 errors].
+     * \details With the default limit, generating a search scheme takes 0.2 to 0.5 seconds for 4 errors and 0.5 to
+     *          1.3 seconds for 5 errors, depending on the machine (measured at -O2). A limit of 40000 improves the
+     *          search schemes for 6 errors, which then takes several seconds. A limit of 0 disables the improvement.
+     */
+    size_t improvement_limit{8192u};
+    /*!\brief The maximal number of error distributions that are enumerated for a number of blocks
+     *        [default: 1'000'000, i.e. up to 10 errors].
+     * \details The number of error distributions grows exponentially with the number of errors. Without improvement,
+     *          generating a search scheme takes milliseconds for 6 errors, 0.1 seconds for 9 errors and about a second
+     *          for 10 errors.
+     */
+    size_t distribution_limit{1'000'000u};
+    //!\brief Whether the lengths of the blocks are optimised; the blocks have the same length otherwise.
+    bool optimise_block_lengths{false};
+
+    /*!\brief Returns a textual description of the options that identifies them, e.g. to cache search schemes.
+     * \details The description consists of a single line.
+     */
+    std::string description() const
+    {
+        return "query_length " + std::to_string(query_length) + " improvement_limit "
+             + std::to_string(improvement_limit) + " distribution_limit " + std::to_string(distribution_limit)
+             + " optimise_block_lengths " + std::to_string(optimise_block_lengths) + ' ' + cost_model.description();
+    }
+};
+
+/*!\brief Returns the length of each block from left to right.
+ * \ingroup search
+ * \param[in] blocks The number of blocks.
+ * \param[in] query_length The length of the query.
+ * \param[in] block_weights The relative length of each block; the blocks have the same length if empty.
+ *
+ * \details
+ *
+ * Blocks of the same length differ by at most one, the first `query_length % blocks` blocks are longer.
+ * Otherwise, the block boundaries are the weighted boundaries rounded down.
+ */
+inline std::vector<size_t>
+search_scheme_blocks_length(uint8_t const blocks, size_t const query_length, std::vector<size_t> const & block_weights)
+{
+    std::vector<size_t> blocks_length(blocks, query_length / blocks);
+
+    size_t const total_weight = std::accumulate(block_weights.begin(), block_weights.end(), size_t{});
+    if (block_weights.size() != blocks || total_weight == 0u)
+    {
+        for (uint8_t block_id = 0; block_id < query_length % blocks; ++block_id)
+            ++blocks_length[block_id];
+        return blocks_length;
+    }
+
+    size_t weight{};
+    size_t boundary{};
+    for (uint8_t block_id = 0; block_id < blocks; ++block_id)
+    {
+        weight += block_weights[block_id];
+        size_t const next_boundary = query_length * weight / total_weight;
+        blocks_length[block_id] = next_boundary - boundary;
+        boundary = next_boundary;
+    }
+    return blocks_length;
+}
+
+//!\cond
+// Helper functions of seqan3::detail::search_scheme_cost and seqan3::detail::generate_search_scheme.
+namespace search_scheme_generation
+{
+
+// Computes the expected number of visited nodes for a fixed query length.
+class cost_function
+{
+public:
+    cost_function(search_scheme_cost_model const & cost_model, size_t const query_length) :
+        occurrence_probability(query_length + 1u),
+        mismatches{cost_model.alphabet_size() - 1.0}
+    {
+        for (size_t depth = 0; depth <= query_length; ++depth)
+            occurrence_probability[depth] = cost_model.occurrence_probability(depth);
+    }
+
+    double operator()(search_scheme_dyn_type const & search_scheme, std::vector<size_t> const & blocks_length) const
+    {
+        double cost{};
+        for (search_dyn const & search : search_scheme)
+        {
+            // strings[e] is the number of considered strings of the current length with e errors.
+            std::vector<double> strings(search.u.back() + 1u);
+            strings[0] = 1.0;
+            size_t depth{};
+
+            auto apply_bounds = [&](uint8_t const block_id, size_t const remaining)
+            {
+                for (size_t errors = 0; errors < strings.size(); ++errors)
+                    if (errors > search.u[block_id] || errors + remaining < search.l[block_id])
+                        strings[errors] = 0.0;
+            };
+
+            for (uint8_t block_id = 0; block_id < search.blocks(); ++block_id)
+            {
+                size_t const length = blocks_length[search.pi[block_id] - 1];
+                apply_bounds(block_id, length);
+
+                for (size_t remaining = length; remaining-- > 0u;)
+                {
+                    for (size_t errors = strings.size(); errors-- > 1u;)
+                        strings[errors] += strings[errors - 1u] * mismatches;
+                    apply_bounds(block_id, remaining);
+
+                    double const nodes = std::accumulate(strings.begin(), strings.end(), 0.0);
+                    cost += nodes * occurrence_probability[++depth];
+                }
+            }
+        }
+        return cost;
+    }
+
+private:
+    std::vector<double> occurrence_probability;
+    double mismatches;
+};
+
+// Returns whether there are at most `limit` error distributions over the blocks with at most max_error errors.
+inline bool error_distributions_within(uint8_t const blocks, uint8_t const max_error, size_t const limit)
+{
+    // The number of distributions is binomial(max_error + blocks, blocks). The partial products are increasing.
+    size_t count{1u};
+    for (size_t i = 1; i <= blocks; ++i)
+    {
+        if (count > std::numeric_limits<size_t>::max() / (max_error + i))
+            return false;
+
+        count = count * (max_error + i) / i;
+        if (count > limit)
+            return false;
+    }
+    return true;
+}
+
+// Returns all error distributions over the blocks with a total number of errors in [min_error, max_error].
+inline std::vector<std::vector<uint8_t>>
+error_distributions(uint8_t const blocks, uint8_t const min_error, uint8_t const max_error)
+{
+    std::vector<std::vector<uint8_t>> distributions{};
+    std::vector<uint8_t> distribution(blocks);
+
+    auto enumerate = [&](auto & self, uint8_t const block_id, uint8_t const errors) -> void
+    {
+        if (block_id == blocks)
+        {
+            if (errors >= min_error)
+                distributions.push_back(distribution);
+            return;
+        }
+
+        for (uint8_t block_errors = 0; errors + block_errors <= max_error; ++block_errors)
+        {
+            distribution[block_id] = block_errors;
+            self(self, block_id + 1, errors + block_errors);
+        }
+    };
+    enumerate(enumerate, 0, 0);
+
+    return distributions;
+}
+
+// Returns the orders that start with a block and extend it first to one side and then to the other side.
+inline std::vector<std::vector<uint8_t>> search_orders(uint8_t const blocks)
+{
+    std::vector<std::vector<uint8_t>> orders{};
+    for (uint8_t start = 0; start < blocks; ++start)
+    {
+        std::vector<uint8_t> left_first{start};
+        for (uint8_t block_id = start; block_id-- > 0;)
+            left_first.push_back(block_id);
+        for (uint8_t block_id = start + 1; block_id < blocks; ++block_id)
+            left_first.push_back(block_id);
+
+        std::vector<uint8_t> right_first{start};
+        for (uint8_t block_id = start + 1; block_id < blocks; ++block_id)
+            right_first.push_back(block_id);
+        for (uint8_t block_id = start; block_id-- > 0;)
+            right_first.push_back(block_id);
+
+        orders.push_back(std::move(left_first));
+        if (right_first != orders.back())
+            orders.push_back(std::move(right_first));
+    }
+    return orders;
+}
+
+// Returns the cumulative errors of an error distribution in the order of the blocks.
+inline std::vector<uint8_t> cumulative_errors(std::vector<uint8_t> const & distribution,
+                                              std::vector<uint8_t> const & order)
+{
+    std::vector<uint8_t> cumulative(order.size());
+    uint8_t errors{};
+    for (size_t i = 0; i < order.size(); ++i)
+        cumulative[i] = errors += distribution[order[i]];
+    return cumulative;
+}
+
+// Returns the number of non-decreasing sequences whose i-th value is in [l[i], u[i]].
+inline size_t count_sequences(std::vector<uint8_t> const & l, std::vector<uint8_t> const & u)
+{
+    std::vector<size_t> sequences(u.back() + 1u);
+    for (size_t value = l[0]; value <= u[0]; ++value)
+        sequences[value] = 1u;
+
+    for (size_t i = 1; i < l.size(); ++i)
+    {
+        size_t smaller_or_equal{};
+        for (size_t value = 0; value < sequences.size(); ++value)
+        {
+            smaller_or_equal += sequences[value];
+            sequences[value] = (value >= l[i] && value <= u[i]) ? smaller_or_equal : 0u;
+        }
+    }
+
+    return std::accumulate(sequences.begin(), sequences.end(), size_t{});
+}
+
+// Appends searches with the given order that cover exactly the given (unique) cumulative errors.
+inline void cover(std::vector<std::vector<uint8_t>> const & cumulative,
+                  std::vector<uint8_t> const & order,
+                  search_scheme_dyn_type & search_scheme)
+{
+    if (cumulative.empty())
+        return;
+
+    std::vector<uint8_t> l{cumulative.front()};
+    std::vector<uint8_t> u{cumulative.front()};
+    for (std::vector<uint8_t> const & errors : cumulative)
+    {
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            l[i] = std::min(l[i], errors[i]);
+            u[i] = std::max(u[i], errors[i]);
+        }
+    }
+
+    // A single search covers the cumulative errors if they are all sequences within the bounds.
+    if (count_sequences(l, u) == cumulative.size())
+    {
+        search_dyn & search = search_scheme.emplace_back();
+        for (uint8_t const block_id : order)
+            search.pi.push_back(block_id + 1);
+        search.l = std::move(l);
+        search.u = std::move(u);
+        return;
+    }
+
+    // Otherwise, split them by the errors after the first block whose bounds differ.
+    size_t split{};
+    while (l[split] == u[split])
+        ++split;
+
+    for (uint8_t errors = l[split]; errors <= u[split]; ++errors)
+    {
+        std::vector<std::vector<uint8_t>> part{};
+        for (std::vector<uint8_t> const & sequence : cumulative)
+            if (sequence[split] == errors)
+                part.push_back(sequence);
+        cover(part, order, search_scheme);
+    }
+}
+
+// The error distributions assigned to each search order.
+class assignment
+{
+public:
+    // Assigns each error distribution to the search order that starts at its leftmost block without errors and extends
+    // to the left first, or, mirrored, at its rightmost block without errors and extends to the right first.
+    assignment(std::vector<std::vector<uint8_t>> const & distributions,
+               std::vector<std::vector<uint8_t>> const & orders,
+               bool const leftmost,
+               cost_function const & cost,
+               std::vector<size_t> const & blocks_length) :
+        orders{&orders},
+        cost{&cost},
+        blocks_length{&blocks_length},
+        cumulative(orders.size()),
+        order_cost(orders.size())
+    {
+        uint8_t const blocks = orders.front().size();
+        for (std::vector<uint8_t> const & distribution : distributions)
+        {
+            uint8_t start{};
+            for (uint8_t block_id = 0; block_id < blocks; ++block_id)
+            {
+                if (distribution[leftmost ? block_id : blocks - 1 - block_id] == 0)
+                {
+                    start = leftmost ? block_id : blocks - 1 - block_id;
+                    break;
+                }
+            }
+
+            // The order extends to the preferred side first if there is a block on this side.
+            bool const to_left = leftmost ? start > 0u : start + 1u == blocks;
+            size_t const order_id = std::ranges::find_if(orders,
+                                                         [&](std::vector<uint8_t> const & order)
+                                                         {
+                                                             return order[0] == start
+                                                                 && (blocks == 1u || (order[1] < start) == to_left);
+                                                         })
+                                  - orders.begin();
+            cumulative[order_id].push_back(cumulative_errors(distribution, orders[order_id]));
+        }
+
+        for (size_t order_id = 0; order_id < orders.size(); ++order_id)
+            order_cost[order_id] = cost_of(order_id, cumulative[order_id]);
+    }
+
+    // Moves single error distributions to another search order as long as this decreases the costs.
+    void improve(std::vector<std::vector<uint8_t>> const & distributions)
+    {
+        for (bool improved = true; improved;)
+        {
+            improved = false;
+            for (std::vector<uint8_t> const & distribution : distributions)
+            {
+                size_t const from = order_of(distribution);
+                std::vector<std::vector<uint8_t>> from_cumulative{cumulative[from]};
+                std::erase(from_cumulative, cumulative_errors(distribution, (*orders)[from]));
+                double const from_cost = cost_of(from, from_cumulative);
+
+                for (size_t to = 0; to < orders->size(); ++to)
+                {
+                    if (to == from)
+                        continue;
+
+                    std::vector<std::vector<uint8_t>> to_cumulative{cumulative[to]};
+                    to_cumulative.push_back(cumulative_errors(distribution, (*orders)[to]));
+                    double const to_cost = cost_of(to, to_cumulative);
+
+                    // Only accept improvements beyond rounding errors.
+                    if (from_cost + to_cost < (order_cost[from] + order_cost[to]) * (1.0 - 1e-9))
+                    {
+                        cumulative[from] = std::move(from_cumulative);
+                        cumulative[to] = std::move(to_cumulative);
+                        order_cost[from] = from_cost;
+                        order_cost[to] = to_cost;
+                        improved = true;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    // Returns the expected costs.
+    double costs() const
+    {
+        return std::accumulate(order_cost.begin(), order_cost.end(), 0.0);
+    }
+
+    // Returns the search scheme.
+    search_scheme_dyn_type search_scheme() const
+    {
+        search_scheme_dyn_type searches{};
+        for (size_t order_id = 0; order_id < orders->size(); ++order_id)
+            cover(cumulative[order_id], (*orders)[order_id], searches);
+        return searches;
+    }
+
+private:
+    // Returns the search order the distribution is assigned to.
+    size_t order_of(std::vector<uint8_t> const & distribution) const
+    {
+        for (size_t order_id = 0; order_id < orders->size(); ++order_id)
+            if (std::ranges::find(cumulative[order_id], cumulative_errors(distribution, (*orders)[order_id]))
+                != cumulative[order_id].end())
+                return order_id;
+        return orders->size();
+    }
+
+    // Returns the costs of the searches covering the cumulative errors in the search order.
+    double cost_of(size_t const order_id, std::vector<std::vector<uint8_t>> const & order_cumulative) const
+    {
+        search_scheme_dyn_type searches{};
+        cover(order_cumulative, (*orders)[order_id], searches);
+        return (*cost)(searches, *blocks_length);
+    }
+
+    std::vector<std::vector<uint8_t>> const * orders;
+    cost_function const * cost;
+    std::vector<size_t> const * blocks_length;
+    std::vector<std::vector<std::vector<uint8_t>>> cumulative;
+    std::vector<double> order_cost;
+};
+
+} // namespace search_scheme_generation
+//!\endcond
+
+/*!\brief Returns the expected number of nodes that the searches of a search scheme visit.
+ * \ingroup search
+ * \param[in] search_scheme The search scheme.
+ * \param[in] blocks_length The length of each block from left to right.
+ * \param[in] cost_model The cost model.
+ * \sa seqan3::detail::search_scheme_cost_model
+ */
+inline double search_scheme_cost(search_scheme_dyn_type const & search_scheme,
+                                 std::vector<size_t> const & blocks_length,
+                                 search_scheme_cost_model const & cost_model)
+{
+    size_t const query_length = std::accumulate(blocks_length.begin(), blocks_length.end(), size_t{});
+    return search_scheme_generation::cost_function{cost_model, query_length}(search_scheme, blocks_length);
+}
+
+/*!\brief Generates a search scheme for any number of errors.
+ * \ingroup search
+ * \param[in] min_error The minimal number of errors.
+ * \param[in] max_error The maximal number of errors.
+ * \param[in] options The options of the generator.
+ * \returns A search scheme whose searches cover every error distribution with `min_error` to `max_error` errors
+ *          exactly once.
+ * \throws std::invalid_argument if `min_error` is greater than `max_error`, if `max_error` is greater than 253, or if
+ *                               the number of error distributions exceeds the `distribution_limit` of the options.
+ *
+ * \details
+ *
+ * The query is split into `max_error + 1` or `max_error + 2` blocks, hence every occurrence matches at least one block
+ * without errors. Each error distribution is assigned to the search that starts at its leftmost block without errors
+ * and extends to the left first, or, mirrored, at its rightmost block without errors and extends to the right first.
+ * The assigned distributions of each search are covered by error bounds, which splits a search if necessary.
+ * Within the seqan3::detail::search_scheme_generator_options::improvement_limit, single error distributions are then
+ * moved to other searches as long as this decreases the expected costs. For up to 3 errors, this finds search schemes
+ * that are as fast as the precomputed seqan3::detail::optimum_search_scheme according to the cost model.
+ * Of these candidates, the search scheme with the smallest expected number of visited nodes according to the
+ * seqan3::detail::search_scheme_cost_model is returned. If requested, the lengths of the blocks are then optimised by
+ * moving characters between blocks as long as this decreases the expected costs.
+ *
+ * The searches are sorted by their upper error bounds, s.t. easy to compute searches come first.
+ * This improves the running time of algorithms that abort after the first hit.
+ *
+ * ### Complexity
+ *
+ * Linear in the number of error distributions, i.e. \f$\binom{\mathrm{max\_error} + b}{b}\f$ for \f$b\f$ blocks,
+ * which is limited by seqan3::detail::search_scheme_generator_options::distribution_limit. The limit is checked before
+ * the error distributions are enumerated. Improving the searches is quadratic in the number of error distributions
+ * and limited by seqan3::detail::search_scheme_generator_options::improvement_limit.
+ */
+inline weighted_search_scheme generate_search_scheme(uint8_t const min_error,
+                                                     uint8_t const max_error,
+                                                     search_scheme_generator_options const & options = {})
+{
+    if (min_error > max_error)
+        throw std::invalid_argument{"The minimal number of errors must not exceed the maximal number of errors."};
+    if (max_error > std::numeric_limits<uint8_t>::max() - 2)
+        throw std::invalid_argument{"Search schemes can be generated for at most 253 errors."};
+
+    search_scheme_generation::cost_function const cost{options.cost_model, options.query_length};
+
+    weighted_search_scheme best{};
+    double best_cost = std::numeric_limits<double>::infinity();
+
+    for (uint8_t const blocks : {static_cast<uint8_t>(max_error + 1), static_cast<uint8_t>(max_error + 2)})
+    {
+        if (!search_scheme_generation::error_distributions_within(blocks, max_error, options.distribution_limit))
+            continue;
+
+        std::vector<std::vector<uint8_t>> const distributions =
+            search_scheme_generation::error_distributions(blocks, min_error, max_error);
+        std::vector<std::vector<uint8_t>> const orders = search_scheme_generation::search_orders(blocks);
+        std::vector<size_t> const blocks_length = search_scheme_blocks_length(blocks, options.query_length, {});
+        bool const improve = distributions.size() * orders.size() <= options.improvement_limit;
+
+        for (bool const leftmost : {true, false})
+        {
+            search_scheme_generation::assignment candidate{distributions, orders, leftmost, cost, blocks_length};
+            if (improve)
+                candidate.improve(distributions);
+
+            if (double const candidate_cost = candidate.costs(); candidate_cost < best_cost)
+            {
+                best_cost = candidate_cost;
+                best.searches = candidate.search_scheme();
+            }
+        }
+    }
+
+    if (best.searches.empty())
+        throw std::invalid_argument{"There are too many error distributions to generate a search scheme for "
+                                    + std::to_string(max_error) + " errors."};
+
+    std::ranges::stable_sort(best.searches,
+                             [](search_dyn const & lhs, search_dyn const & rhs)
+                             {
+                                 return std::tie(lhs.u, lhs.l) < std::tie(rhs.u, rhs.l);
+                             });
+
+    if (options.optimise_block_lengths)
+    {
+        uint8_t const blocks = best.searches.front().blocks();
+        std::vector<size_t> blocks_length = search_scheme_blocks_length(blocks, options.query_length, {});
+        size_t const min_length = options.query_length >= blocks ? 1u : 0u;
+
+        // Move characters from one block to another as long as this decreases the costs, halving the step size.
+        for (size_t step = std::max<size_t>(options.query_length / (2u * blocks), 1u); step > 0u; step /= 2u)
+        {
+            for (bool improved = true; improved;)
+            {
+                improved = false;
+                for (uint8_t from = 0; from < blocks; ++from)
+                {
+                    for (uint8_t to = 0; to < blocks; ++to)
+                    {
+                        if (from == to || blocks_length[from] < min_length + step)
+                            continue;
+
+                        blocks_length[from] -= step;
+                        blocks_length[to] += step;
+                        double const candidate_cost = cost(best.searches, blocks_length);
+                        if (candidate_cost < best_cost)
+                        {
+                            best_cost = candidate_cost;
+                            improved = true;
+                        }
+                        else
+                        {
+                            blocks_length[from] += step;
+                            blocks_length[to] -= step;
+                        }
+                    }
+                }
+            }
+        }
+
+        best.block_weights = std::move(blocks_length);
+    }
+
+    return best;
+}
+
+/*!\brief Writes a search scheme to a stream.
+ * \ingroup search
+ * \param[in, out] stream The stream to write to.
+ * \param[in] search_scheme The search scheme.
+ * \sa seqan3::detail::read_search_scheme
+ */
+inline void write_search_scheme(std::ostream & stream, weighted_search_scheme const & search_scheme)
+{
+    size_t const blocks = search_scheme.searches.empty() ? 0u : search_scheme.searches.front().blocks();
+    stream << "searches " << search_scheme.searches.size() << " blocks " << blocks << '\n';
+
+    stream << "block_weights " << search_scheme.block_weights.size();
+    for (size_t const weight : search_scheme.block_weights)
+        stream << ' ' << weight;
+    stream << '\n';
+
+    auto write_line = [&stream](std::vector<uint8_t> const & values)
+    {
+        for (size_t i = 0; i < values.size(); ++i)
+            stream << (i == 0u ? "" : " ") << static_cast<unsigned>(values[i]);
+        stream << '\n';
+    };
+
+    for (search_dyn const & search : search_scheme.searches)
+    {
+        write_line(search.pi);
+        write_line(search.l);
+        write_line(search.u);
+    }
+}
+
+/*!\brief Reads a search scheme written by seqan3::detail::write_search_scheme.
+ * \ingroup search
+ * \param[in, out] stream The stream to read from.
+ * \returns The search scheme.
+ * \throws std::runtime_error if the stream does not contain a valid search scheme.
+ *
+ * \details
+ *
+ * The order of the blocks of each search must be connected and the error bounds must be non-decreasing.
+ */
+inline weighted_search_scheme read_search_scheme(std::istream & stream)
+{
+    auto check = [](bool const condition, char const * message)
+    {
+        if (!condition)
+            throw std::runtime_error{std::string{"Invalid search scheme: "} + message};
+    };
+
+    auto read_keyword = [&](std::string const & expected)
+    {
+        std::string keyword{};
+        stream >> keyword;
+        check(static_cast<bool>(stream) && keyword == expected, "unexpected keyword.");
+    };
+
+    auto read_number = [&](size_t const max_value)
+    {
+        size_t number{};
+        stream >> number;
+        check(static_cast<bool>(stream) && number <= max_value, "invalid number.");
+        return number;
+    };
+
+    constexpr size_t max_uint8 = std::numeric_limits<uint8_t>::max();
+
+    read_keyword("searches");
+    size_t const searches = read_number(std::numeric_limits<size_t>::max());
+    read_keyword("blocks");
+    size_t const blocks = read_number(max_uint8);
+    check(searches > 0u && blocks > 0u, "a search scheme needs at least one search and one block.");
+
+    weighted_search_scheme search_scheme{};
+    read_keyword("block_weights");
+    search_scheme.block_weights.resize(read_number(blocks));
+    check(search_scheme.block_weights.empty() || search_scheme.block_weights.size() == blocks,
+          "there must be a weight for each block.");
+    for (size_t & weight : search_scheme.block_weights)
+        weight = read_number(std::numeric_limits<size_t>::max());
+
+    search_scheme.searches.resize(searches);
+    for (search_dyn & search : search_scheme.searches)
+    {
+        for (std::vector<uint8_t> * values : {&search.pi, &search.l, &search.u})
+        {
+            values->resize(blocks);
+            for (uint8_t & value : *values)
+                value = read_number(max_uint8);
+        }
+
+        size_t leftmost = search.pi[0];
+        size_t rightmost = search.pi[0];
+        check(leftmost >= 1u && leftmost <= blocks, "invalid block.");
+        check(search.l[0] <= search.u[0], "the lower error bound exceeds the upper error bound.");
+        for (size_t i = 1; i < blocks; ++i)
+        {
+            check(search.pi[i] + 1u == leftmost || search.pi[i] == rightmost + 1u, "the blocks are not connected.");
+            leftmost = std::min<size_t>(leftmost, search.pi[i]);
+            rightmost = std::max<size_t>(rightmost, search.pi[i]);
+            check(search.l[i] <= search.u[i], "the lower error bound exceeds the upper error bound.");
+            check(search.l[i - 1] <= search.l[i] && search.u[i - 1] <= search.u[i],
+                  "the error bounds are not cumulative.");
+        }
+        check(leftmost == 1u && rightmost == blocks, "invalid block.");
+    }
+
+    return search_scheme;
+}
+
+/*!\brief Caches generated search schemes in a directory.
+ * \ingroup search
+ *
+ * \details
+ *
+ * Generating a search scheme for many errors or with optimised block lengths may take a while. The cache stores each
+ * generated search scheme in a file, whose name is derived from the number of errors and the
+ * seqan3::detail::search_scheme_generator_options. The file also stores the numbers of errors and the options, and a
+ * search scheme is only read from a file if these match.
+ *
+ * Files are written to a temporary file first and then renamed, hence several processes can share the directory.
+ * If a file cannot be read, the search scheme is generated again. If it cannot be written, the generated search
+ * scheme is returned nonetheless.
+ */
+class search_scheme_cache
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    search_scheme_cache() = delete;                                         //!< Deleted.
+    search_scheme_cache(search_scheme_cache const &) = default;             //!< Defaulted.
+    search_scheme_cache(search_scheme_cache &&) = default;                  //!< Defaulted.
+    search_scheme_cache & operator=(search_scheme_cache const &) = default; //!< Defaulted.
+    search_scheme_cache & operator=(search_scheme_cache &&) = default;      //!< Defaulted.
+    ~search_scheme_cache() = default;                                       //!< Defaulted.
+
+    /*!\brief Constructs a cache that stores the search schemes in the given directory.
+     * \param[in] directory The directory; is created when the first search scheme is stored.
+     */
+    explicit search_scheme_cache(std::filesystem::path directory) : directory{std::move(directory)}
+    {}
+    //!\}
+
+    /*!\brief Returns the cached search scheme or generates and stores it.
+     * \param[in] min_error The minimal number of errors.
+     * \param[in] max_error The maximal number of errors.
+     * \param[in] options The options of the generator.
+     * \sa seqan3::detail::generate_search_scheme
+     */
+    weighted_search_scheme
+    get(uint8_t const min_error, uint8_t const max_error, search_scheme_generator_options const & options = {}) const
+    {
+        std::string const key = make_key(min_error, max_error, options);
+        std::filesystem::path const file = path(min_error, max_error, options);
+
+        if (std::ifstream stream{file}; stream)
+        {
+            std::string header{};
+            if (std::getline(stream, header) && header == key)
+            {
+                try
+                {
+                    return read_search_scheme(stream);
+                }
+                catch (std::runtime_error const &)
+                {
+                    // Generate the corrupted search scheme again.
+                }
+            }
+        }
+
+        weighted_search_scheme search_scheme = generate_search_scheme(min_error, max_error, options);
+        store(file, key, search_scheme);
+        return search_scheme;
+    }
+
+    /*!\brief Returns the file that stores the search scheme.
+     * \param[in] min_error The minimal number of errors.
+     * \param[in] max_error The maximal number of errors.
+     * \param[in] options The options of the generator.
+     */
+    std::filesystem::path
+    path(uint8_t const min_error, uint8_t const max_error, search_scheme_generator_options const & options = {}) const
+    {
+        // FNV-1a hash of the key, which is stable across platforms and runs.
+        uint64_t hash{0xcbf29ce484222325ULL};
+        for (char const character : make_key(min_error, max_error, options))
+        {
+            hash ^= static_cast<uint8_t>(character);
+            hash *= 0x100000001b3ULL;
+        }
+
+        std::ostringstream name{};
+        name << "search_scheme_" << static_cast<unsigned>(min_error) << '_' << static_cast<unsigned>(max_error) << '_'
+             << std::hex << hash << ".txt";
+        return directory / name.str();
+    }
+
+private:
+    //!\brief Returns the first line of a file, which identifies the stored search scheme.
+    static std::string
+    make_key(uint8_t const min_error, uint8_t const max_error, search_scheme_generator_options const & options)
+    {
+        return "seqan3_search_scheme 1 min_error " + std::to_string(min_error) + " max_error "
+             + std::to_string(max_error) + ' ' + options.description();
+    }
+
+    //!\brief Writes the search scheme to a temporary file and renames it.
+    void store(std::filesystem::path const & file,
+               std::string const & key,
+               weighted_search_scheme const & search_scheme) const
+    {
+        std::error_code error{};
+        std::filesystem::create_directories(directory, error);
+        if (error)
+            return;
+
+        std::filesystem::path temporary{file};
+        temporary += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()))
+                   + std::to_string(std::random_device{}());
+        {
+            std::ofstream stream{temporary};
+            stream << key << '\n';
+            write_search_scheme(stream, search_scheme);
+            if (!stream.flush())
+                error = std::make_error_code(std::errc::io_error);
+        }
+
+        if (!error)
+            std::filesystem::rename(temporary, file, error);
+        if (error)
+            std::filesystem::remove(temporary, error);
+    }
+
+    //!\brief The directory of the cached search schemes.
+    std::filesystem::path directory;
+};
+
+} // namespace seqan3::detail
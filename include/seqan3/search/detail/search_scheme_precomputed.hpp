@@ -148,4 +148,45 @@ inline constexpr search_scheme_type<4, 5> optimum_search_scheme<3, 3>{
 
 //!\endcond
 
+/*!\brief Search schemes generated by seqan3::detail::generate_search_scheme with the default options.
+ * \ingroup search
+ * \tparam min_error Lower bound of errors.
+ * \tparam max_error Upper bound of errors.
+ * \details Generating these search schemes takes up to a second, hence they are stored instead of being generated by
+ *          the first search of each process. Like in seqan3::detail::optimum_search_scheme, the searches are sorted
+ *          by their upper error bounds.
+ */
+template <uint8_t min_error, uint8_t max_error>
+inline constexpr int precomputed_search_scheme{0};
+
+//!\cond
+
+template <>
+inline constexpr search_scheme_type<7, 5> precomputed_search_scheme<0, 4>{
+    {{{1, 2, 3, 4, 5}, {0, 0, 0, 3, 4}, {0, 0, 2, 3, 4}},
+     {{1, 2, 3, 4, 5}, {0, 1, 2, 3, 4}, {0, 1, 2, 3, 4}},
+     {{2, 3, 4, 5, 1}, {0, 1, 2, 3, 3}, {0, 1, 2, 4, 4}},
+     {{3, 4, 5, 2, 1}, {0, 1, 2, 2, 2}, {0, 1, 4, 4, 4}},
+     {{3, 4, 5, 2, 1}, {0, 2, 3, 3, 3}, {0, 2, 4, 4, 4}},
+     {{5, 4, 3, 2, 1}, {0, 0, 0, 0, 0}, {0, 4, 4, 4, 4}},
+     {{4, 5, 3, 2, 1}, {0, 1, 1, 1, 1}, {0, 4, 4, 4, 4}}}};
+
+template <>
+inline constexpr search_scheme_type<13, 6> precomputed_search_scheme<0, 5>{
+    {{{3, 4, 5, 6, 2, 1}, {0, 0, 0, 0, 3, 5}, {0, 0, 0, 0, 5, 5}},
+     {{4, 5, 6, 3, 2, 1}, {0, 0, 0, 1, 4, 5}, {0, 0, 0, 3, 4, 5}},
+     {{5, 6, 4, 3, 2, 1}, {0, 0, 1, 2, 4, 5}, {0, 0, 1, 3, 4, 5}},
+     {{6, 5, 4, 3, 2, 1}, {0, 0, 2, 3, 4, 5}, {0, 1, 2, 3, 4, 5}},
+     {{5, 4, 3, 2, 1, 6}, {0, 1, 2, 3, 4, 4}, {0, 1, 2, 3, 5, 5}},
+     {{4, 3, 2, 1, 5, 6}, {0, 1, 2, 3, 3, 3}, {0, 1, 2, 5, 5, 5}},
+     {{4, 3, 2, 1, 5, 6}, {0, 1, 3, 4, 4, 4}, {0, 1, 3, 5, 5, 5}},
+     {{3, 2, 1, 4, 5, 6}, {0, 1, 2, 2, 2, 2}, {0, 1, 5, 5, 5, 5}},
+     {{4, 3, 2, 1, 5, 6}, {0, 2, 3, 4, 4, 4}, {0, 2, 3, 5, 5, 5}},
+     {{3, 2, 1, 4, 5, 6}, {0, 2, 3, 3, 3, 3}, {0, 2, 5, 5, 5, 5}},
+     {{3, 2, 1, 4, 5, 6}, {0, 3, 4, 4, 4, 4}, {0, 3, 4, 5, 5, 5}},
+     {{1, 2, 3, 4, 5, 6}, {0, 0, 0, 0, 0, 0}, {0, 4, 5, 5, 5, 5}},
+     {{2, 1, 3, 4, 5, 6}, {0, 1, 1, 1, 1, 1}, {0, 5, 5, 5, 5, 5}}}};
+
+//!\endcond
+
 } // namespace seqan3::detail
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/configuration/max_error.hpp>
 #include <seqan3/search/configuration/on_result.hpp>
@@ -88,6 +89,8 @@ struct search_traits
 
     //!\brief A flag indicating whether a user provided callback was given.
     static constexpr bool has_user_callback = search_configuration_t::template exists<search_cfg::on_result>();
+    //!\brief A flag indicating whether the queries are searched in batches.
+    static constexpr bool search_in_batches = search_configuration_t::template exists<search_cfg::batch>();
 };
 
 } // namespace seqan3::detail
@@ -0,0 +1,251 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::mapped_bit_vector.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string_view>
+
+#include <sdsl/bit_vectors.hpp>
+
+#include <seqan3/io/detail/memory_mapped_file.hpp>
+#include <seqan3/io/exception.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A read-only bitvector that is backed by a memory mapped file.
+ * \ingroup search_dream_index
+ *
+ * \details
+ *
+ * Offers the subset of the sdsl::bit_vector interface that is needed to query the seqan3::interleaved_bloom_filter
+ * and the seqan3::bloom_filter. Copies share the same mapping, which is unmapped when the last copy is destroyed.
+ *
+ * ### File layout
+ *
+ * The file starts with a header of #data_offset bytes, followed by the 64-bit words of the bitvector:
+ *
+ * | Bytes     | Content                                                                   |
+ * |-----------|---------------------------------------------------------------------------|
+ * | 0 - 7     | A magic string identifying the stored data structure.                     |
+ * | 8 - 15    | The #format_version.                                                      |
+ * | 16 - 23   | The size of the bitvector in bits.                                        |
+ * | 24 - 31   | The number `n` of metadata words.                                         |
+ * | 32 - ...  | `n` metadata words, e.g. the number of bins of an Interleaved Bloom Filter. |
+ * | 128 - ... | The words of the bitvector.                                               |
+ *
+ * All numbers are stored as 64-bit unsigned integers in the byte order of the host. A file written on a host with
+ * a different byte order is rejected, because its version does not match.
+ */
+class mapped_bit_vector
+{
+public:
+    //!\brief The size of the file header in bytes. The words of the bitvector start at this offset.
+    static constexpr size_t data_offset{128u};
+    //!\brief The version of the file layout.
+    static constexpr uint64_t format_version{1u};
+    //!\brief The maximal number of metadata words that fit into the header.
+    static constexpr size_t max_metadata_size{data_offset / sizeof(uint64_t) - 4u};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mapped_bit_vector() = default;                                      //!< Defaulted.
+    mapped_bit_vector(mapped_bit_vector const &) = default;             //!< Defaulted.
+    mapped_bit_vector & operator=(mapped_bit_vector const &) = default; //!< Defaulted.
+    mapped_bit_vector(mapped_bit_vector &&) = default;                  //!< Defaulted.
+    mapped_bit_vector & operator=(mapped_bit_vector &&) = default;      //!< Defaulted.
+    ~mapped_bit_vector() = default;                                     //!< Defaulted.
+
+    /*!\brief Construct from a mapped file.
+     * \param[in] file The mapped file.
+     * \param[in] size The size of the bitvector in bits.
+     * \attention The file must contain at least `data_offset + 8 * ceil(size / 64)` bytes.
+     */
+    mapped_bit_vector(std::shared_ptr<memory_mapped_file const> file, size_t const size) :
+        mapping{std::move(file)},
+        words{reinterpret_cast<uint64_t const *>(mapping->data() + data_offset)},
+        size_in_bits{size}
+    {
+        assert(mapping->size() >= data_offset + word_count() * sizeof(uint64_t));
+    }
+    //!\}
+
+    //!\brief Returns the number of bits.
+    size_t size() const noexcept
+    {
+        return size_in_bits;
+    }
+
+    //!\brief Returns a pointer to the first word of the bitvector.
+    uint64_t const * data() const noexcept
+    {
+        return words;
+    }
+
+    //!\brief Returns the i-th bit.
+    bool operator[](size_t const i) const noexcept
+    {
+        assert(i < size());
+        return (words[i >> 6] >> (i & 63u)) & 1u;
+    }
+
+    /*!\brief Returns `len` bits starting at bit position `idx`.
+     * \param[in] idx The position of the first bit.
+     * \param[in] len The number of bits. At most 64.
+     */
+    uint64_t get_int(size_t const idx, uint8_t const len = 64) const noexcept
+    {
+        assert(idx < size());
+        assert(len > 0u && len <= 64u);
+
+        size_t const word_idx = idx >> 6;
+        size_t const offset = idx & 63u;
+
+        uint64_t result = words[word_idx] >> offset;
+        if (offset + len > 64u && word_idx + 1 < word_count())
+            result |= words[word_idx + 1] << (64u - offset);
+
+        return (len == 64u) ? result : result & ((1ULL << len) - 1u);
+    }
+
+    //!\brief Test for equality.
+    friend bool operator==(mapped_bit_vector const & lhs, mapped_bit_vector const & rhs) noexcept
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+
+        if (lhs.size() == 0u || lhs.words == rhs.words)
+            return true;
+
+        size_t const full_words = lhs.size() >> 6;
+        if (!std::equal(lhs.words, lhs.words + full_words, rhs.words))
+            return false;
+
+        size_t const remaining_bits = lhs.size() & 63u;
+        return remaining_bits == 0u
+            || lhs.get_int(full_words << 6, remaining_bits) == rhs.get_int(full_words << 6, remaining_bits);
+    }
+
+private:
+    //!\brief Returns the number of 64-bit words needed to store the bitvector.
+    size_t word_count() const noexcept
+    {
+        return (size_in_bits + 63u) >> 6;
+    }
+
+    //!\brief Keeps the mapped file alive.
+    std::shared_ptr<memory_mapped_file const> mapping{};
+    //!\brief The first word of the bitvector.
+    uint64_t const * words{nullptr};
+    //!\brief The number of bits.
+    size_t size_in_bits{};
+};
+
+/*!\brief Writes a bitvector and its metadata in the layout of seqan3::detail::mapped_bit_vector.
+ * \ingroup search_dream_index
+ * \tparam metadata_size The number of metadata words.
+ * \tparam bit_vector_t The type of the bitvector, e.g. sdsl::bit_vector. Must provide `size()` and `data()`.
+ * \param[in] path The file to write.
+ * \param[in] magic A string of exactly 8 characters identifying the data structure.
+ * \param[in] metadata The metadata words.
+ * \param[in] bits The bitvector.
+ * \throws seqan3::file_open_error If the file cannot be opened.
+ * \throws seqan3::io_error If writing fails.
+ */
+template <size_t metadata_size, typename bit_vector_t>
+inline void write_mapped_bit_vector(std::filesystem::path const & path,
+                                    std::string_view const magic,
+                                    std::array<uint64_t, metadata_size> const & metadata,
+                                    bit_vector_t const & bits)
+{
+    static_assert(metadata_size <= mapped_bit_vector::max_metadata_size, "Too many metadata words.");
+    assert(magic.size() == 8u);
+
+    std::array<uint64_t, mapped_bit_vector::data_offset / sizeof(uint64_t)> header{};
+    std::memcpy(header.data(), magic.data(), 8u);
+    header[1] = mapped_bit_vector::format_version;
+    header[2] = bits.size();
+    header[3] = metadata_size;
+    std::ranges::copy(metadata, header.begin() + 4);
+
+    std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+
+    if (!stream.good())
+        throw file_open_error{"Could not open " + path.string() + " for writing."};
+
+    stream.write(reinterpret_cast<char const *>(header.data()), sizeof(header));
+    stream.write(reinterpret_cast<char const *>(bits.data()), ((bits.size() + 63u) >> 6) * sizeof(uint64_t));
+    stream.flush();
+
+    if (!stream.good())
+        throw io_error{"Could not write " + path.string() + "."};
+}
+
+/*!\brief Maps a file written by seqan3::detail::write_mapped_bit_vector.
+ * \ingroup search_dream_index
+ * \tparam metadata_size The number of metadata words.
+ * \param[in] path The file to map.
+ * \param[in] magic A string of exactly 8 characters identifying the data structure.
+ * \param[out] metadata The metadata words.
+ * \param[in] populate Whether to read the whole file into memory while mapping it.
+ * \param[in] will_need Whether to start reading the whole file into memory in the background.
+ * \returns The seqan3::detail::mapped_bit_vector.
+ * \throws seqan3::file_open_error If the file cannot be mapped.
+ * \throws seqan3::format_error If the file was not written by seqan3::detail::write_mapped_bit_vector with the
+ *                              same `magic` and `metadata_size`, or if it is truncated.
+ */
+template <size_t metadata_size>
+inline mapped_bit_vector read_mapped_bit_vector(std::filesystem::path const & path,
+                                                std::string_view const magic,
+                                                std::array<uint64_t, metadata_size> & metadata,
+                                                bool const populate = false,
+                                                bool const will_need = false)
+{
+    static_assert(metadata_size <= mapped_bit_vector::max_metadata_size, "Too many metadata words.");
+    assert(magic.size() == 8u);
+
+    auto file = std::make_shared<memory_mapped_file const>(path, memory_mapped_file::access_pattern::random, populate);
+
+    std::array<uint64_t, mapped_bit_vector::data_offset / sizeof(uint64_t)> header{};
+
+    if (file->size() < sizeof(header))
+        throw format_error{"The file " + path.string() + " is too small to contain a header."};
+
+    std::memcpy(header.data(), file->data(), sizeof(header));
+
+    if (std::string_view{file->data(), 8u} != magic)
+        throw format_error{"The file " + path.string() + " does not contain the expected data structure."};
+    if (header[1] != mapped_bit_vector::format_version)
+        throw format_error{"The file " + path.string() + " has an unsupported version or byte order."};
+    if (header[3] != metadata_size)
+        throw format_error{"The file " + path.string() + " contains an unexpected number of metadata entries."};
+
+    size_t const size_in_bits = header[2];
+    if (file->size() < mapped_bit_vector::data_offset + ((size_in_bits + 63u) >> 6) * sizeof(uint64_t))
+        throw format_error{"The file " + path.string() + " is truncated."};
+
+    std::ranges::copy_n(header.begin() + 4, metadata_size, metadata.begin());
+
+    if (will_need)
+        file->advise(memory_mapped_file::access_pattern::will_need);
+
+    return mapped_bit_vector{std::move(file), size_in_bits};
+}
+
+} // namespace seqan3::detail
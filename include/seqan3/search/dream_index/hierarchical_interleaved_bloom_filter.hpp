@@ -0,0 +1,626 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::hierarchical_interleaved_bloom_filter.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <queue>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The configuration of a seqan3::hierarchical_interleaved_bloom_filter.
+ * \ingroup search_dream_index
+ */
+struct hibf_config
+{
+    //!\brief The maximal number of technical bins of each Interleaved Bloom Filter. Must be a multiple of 64.
+    size_t tmax{64u};
+    //!\brief The false positive rate each technical bin is sized for. Must be in `(0, 1)`.
+    double maximum_false_positive_rate{0.05};
+    //!\brief The number of hash functions. At least 1, at most 5.
+    size_t number_of_hash_functions{2u};
+    //!\brief The number of threads used to insert the values.
+    size_t threads{1u};
+};
+
+/*!\brief The Hierarchical Interleaved Bloom Filter (HIBF).
+ * \ingroup search_dream_index
+ * \tparam data_layout_mode_ Indicates how the underlying Interleaved Bloom Filters are stored.
+ *                           Either seqan3::data_layout::uncompressed or seqan3::data_layout::compressed.
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * The seqan3::interleaved_bloom_filter stores `b` bins of equal size. If the bins have very different sizes, every
+ * bin is sized for the largest one. Furthermore, each query accesses `b / 64` words per hash function. For large
+ * numbers of bins of heterogeneous sizes, the HIBF needs considerably less memory and answers queries faster.
+ *
+ * The bins provided by the user are called *user bins*. The bins of the underlying Interleaved Bloom Filters are
+ * called *technical bins*. The HIBF consists of a tree of Interleaved Bloom Filters with at most
+ * seqan3::hibf_config::tmax technical bins each:
+ *
+ *   * A technical bin may store a single user bin.
+ *   * Large user bins are *split* into multiple technical bins, each storing a part of the values.
+ *   * Small user bins are *merged* into a single technical bin that stores the union of their values. The merged
+ *     user bins are stored in a lower-level Interleaved Bloom Filter.
+ *
+ * Each technical bin is sized for seqan3::hibf_config::maximum_false_positive_rate. Hence, technical bins of the same
+ * Interleaved Bloom Filter have a similar number of values.
+ *
+ * ### Querying
+ *
+ * To query the HIBF, call seqan3::hierarchical_interleaved_bloom_filter::membership_agent() and use the returned
+ * seqan3::hierarchical_interleaved_bloom_filter::membership_agent_type. A query only descends into a lower-level
+ * Interleaved Bloom Filter if the corresponding merged bin contains enough values.
+ *
+ * ### Compression
+ *
+ * A `seqan3::hierarchical_interleaved_bloom_filter<seqan3::data_layout::compressed>` can be constructed from an
+ * uncompressed one, in which case all Interleaved Bloom Filters are compressed.
+ *
+ * ### Thread safety
+ *
+ * The HIBF promises the basic thread-safety by the STL that all calls to `const` member functions are safe from
+ * multiple threads (as long as no thread calls a non-`const` member function at the same time).
+ */
+template <data_layout data_layout_mode_ = data_layout::uncompressed>
+class hierarchical_interleaved_bloom_filter
+{
+    static_assert(data_layout_mode_ != data_layout::mapped,
+                  "The hierarchical_interleaved_bloom_filter does not support the mapped layout.");
+
+private:
+    //!\cond
+    template <data_layout data_layout_mode>
+    friend class hierarchical_interleaved_bloom_filter;
+    //!\endcond
+
+    //!\brief The type of the underlying Interleaved Bloom Filters.
+    using ibf_t = interleaved_bloom_filter<data_layout_mode_>;
+
+    //!\brief The Interleaved Bloom Filters. The first one is the top-level Interleaved Bloom Filter.
+    std::vector<ibf_t> ibf_vector{};
+    /*!\brief Stores for each Interleaved Bloom Filter and each of its technical bins the index of the lower-level
+     *        Interleaved Bloom Filter. If the technical bin is not a merged bin, the own index is stored.
+     */
+    std::vector<std::vector<int64_t>> next_ibf_id{};
+    /*!\brief Stores for each Interleaved Bloom Filter and each of its technical bins the user bin it stores or `-1`
+     *        if the technical bin is a merged bin. The technical bins of a split user bin are consecutive.
+     */
+    std::vector<std::vector<int64_t>> ibf_bin_to_user_bin_id{};
+    //!\brief The number of user bins.
+    size_t number_of_user_bins{};
+
+    //!\brief Describes the content of a technical bin during construction.
+    struct technical_bin_layout
+    {
+        //!\brief The user bins stored in this technical bin. More than one user bin indicates a merged bin.
+        std::vector<size_t> user_bins{};
+        //!\brief The part of a split user bin stored in this technical bin.
+        size_t part{};
+        //!\brief The number of technical bins a split user bin is split into.
+        size_t parts{1u};
+        //!\brief The maximal number of values stored in this technical bin.
+        size_t size{};
+    };
+
+    /*!\brief Computes the number of bits of a technical bin.
+     * \param[in] technical_bin The technical bin.
+     * \param[in] config The seqan3::hibf_config.
+     *
+     * \details
+     *
+     * A query of a split user bin sums up the counts of all parts, i.e. the false positives of all parts add up.
+     * Each part is hence sized for the false positive rate `1 - (1 - fpr)^(1 / parts)`, such that the split user bin
+     * as a whole has the configured false positive rate.
+     */
+    static size_t bin_size_in_bits(technical_bin_layout const & technical_bin, hibf_config const & config)
+    {
+        double const hash_funs = static_cast<double>(config.number_of_hash_functions);
+        double const fpr =
+            1.0 - std::pow(1.0 - config.maximum_false_positive_rate, 1.0 / static_cast<double>(technical_bin.parts));
+        double const numerator = -static_cast<double>(std::max<size_t>(technical_bin.size, 1u)) * hash_funs;
+        double const denominator = std::log(1.0 - std::exp(std::log(fpr) / hash_funs));
+        return std::max<size_t>(std::ceil(numerator / denominator), 1u);
+    }
+
+    /*!\brief Distributes user bins onto at most `config.tmax` technical bins.
+     * \param[in] user_bins The user bins, sorted by decreasing size.
+     * \param[in] sizes The number of values of each user bin.
+     * \param[in] config The seqan3::hibf_config.
+     * \returns The layout of the technical bins.
+     *
+     * \details
+     *
+     * If all user bins fit, each user bin gets at least one technical bin and the remaining technical bins up to the
+     * next multiple of 64 are used to split the largest user bins. Otherwise, the smallest number of values per
+     * technical bin is determined such that user bins with more values can be split and the remaining user bins can
+     * be merged into at most `config.tmax` technical bins.
+     */
+    static std::vector<technical_bin_layout>
+    compute_layout(std::vector<size_t> const & user_bins, std::vector<size_t> const & sizes, hibf_config const & config)
+    {
+        std::vector<technical_bin_layout> layout{};
+
+        auto split_into = [&](size_t const user_bin, size_t const parts)
+        {
+            for (size_t part = 0; part < parts; ++part)
+                layout.push_back({{user_bin}, part, parts, (sizes[user_bin] + parts - 1u) / parts});
+        };
+
+        if (user_bins.size() <= config.tmax)
+        {
+            size_t const technical_bins = std::min(((user_bins.size() + 63u) >> 6) << 6, config.tmax);
+            std::vector<size_t> parts(user_bins.size(), 1u);
+
+            // Repeatedly split the user bin with the largest number of values per technical bin.
+            auto values_per_part = [&](size_t const i)
+            {
+                return static_cast<double>(sizes[user_bins[i]]) / parts[i];
+            };
+            auto compare = [&](size_t const lhs, size_t const rhs)
+            {
+                return values_per_part(lhs) < values_per_part(rhs);
+            };
+            std::priority_queue<size_t, std::vector<size_t>, decltype(compare)> queue{compare};
+            for (size_t i = 0; i < user_bins.size(); ++i)
+                queue.push(i);
+
+            for (size_t spare = technical_bins - user_bins.size(); spare > 0u && values_per_part(queue.top()) > 1.0;
+                 --spare)
+            {
+                size_t const i = queue.top();
+                queue.pop();
+                ++parts[i];
+                queue.push(i);
+            }
+
+            for (size_t i = 0; i < user_bins.size(); ++i)
+                split_into(user_bins[i], parts[i]);
+
+            return layout;
+        }
+
+        // Empty user bins are treated as storing one value. This guarantees that merged bins shrink.
+        auto size_of = [&](size_t const user_bin)
+        {
+            return std::max<size_t>(sizes[user_bin], 1u);
+        };
+
+        // Splits user bins larger than `target` and merges consecutive smaller ones up to `target` values. Since the
+        // user bins are sorted, merged bins contain user bins of similar size.
+        auto fill = [&](size_t const target, bool const count_only)
+        {
+            size_t technical_bins{};
+            size_t i = 0;
+
+            for (; i < user_bins.size() && size_of(user_bins[i]) > target; ++i)
+            {
+                size_t const parts = (size_of(user_bins[i]) + target - 1u) / target;
+                technical_bins += parts;
+                if (!count_only)
+                    split_into(user_bins[i], parts);
+            }
+
+            while (i < user_bins.size())
+            {
+                technical_bin_layout merged{};
+                size_t group_size{};
+
+                for (; i < user_bins.size() && group_size + size_of(user_bins[i]) <= target; ++i)
+                {
+                    group_size += size_of(user_bins[i]);
+                    merged.user_bins.push_back(user_bins[i]);
+                    merged.size += sizes[user_bins[i]];
+                }
+
+                ++technical_bins;
+                if (!count_only)
+                    layout.push_back(std::move(merged));
+            }
+
+            return technical_bins;
+        };
+
+        // Find the smallest target such that all user bins fit into tmax technical bins. A target of half the total
+        // number of values only needs a few technical bins and no technical bin contains all user bins.
+        size_t const total =
+            std::transform_reduce(user_bins.begin(), user_bins.end(), size_t{}, std::plus<>{}, size_of);
+        size_t lower = (total + config.tmax - 1u) / config.tmax;
+        size_t upper = (total + 1u) / 2u;
+
+        while (lower < upper)
+        {
+            size_t const middle = lower + (upper - lower) / 2u;
+            if (fill(middle, true) <= config.tmax)
+                upper = middle;
+            else
+                lower = middle + 1u;
+        }
+
+        // The number of technical bins is not strictly monotonic in the target.
+        while (fill(upper, true) > config.tmax)
+            ++upper;
+
+        fill(upper, false);
+
+        return layout;
+    }
+
+public:
+    //!\brief Indicates how the underlying Interleaved Bloom Filters are stored.
+    static constexpr data_layout data_layout_mode = data_layout_mode_;
+
+    class membership_agent_type; // documented upon definition below
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    hierarchical_interleaved_bloom_filter() = default; //!< Defaulted.
+    //!\brief Defaulted.
+    hierarchical_interleaved_bloom_filter(hierarchical_interleaved_bloom_filter const &) = default;
+    //!\brief Defaulted.
+    hierarchical_interleaved_bloom_filter & operator=(hierarchical_interleaved_bloom_filter const &) = default;
+    //!\brief Defaulted.
+    hierarchical_interleaved_bloom_filter(hierarchical_interleaved_bloom_filter &&) = default;
+    //!\brief Defaulted.
+    hierarchical_interleaved_bloom_filter & operator=(hierarchical_interleaved_bloom_filter &&) = default;
+    ~hierarchical_interleaved_bloom_filter() = default; //!< Defaulted.
+
+    /*!\brief Construct an uncompressed Hierarchical Interleaved Bloom Filter.
+     * \tparam user_bins_t The type of the range of user bins; must model std::ranges::random_access_range and
+     *                     std::ranges::sized_range. The reference type must be an lvalue reference to a
+     *                     std::ranges::forward_range over std::unsigned_integral values.
+     * \param[in] values_per_user_bin The `i`-th element contains the values of user bin `i`.
+     * \param[in] config The seqan3::hibf_config.
+     * \throws std::invalid_argument If the configuration is invalid or there are no user bins.
+     *
+     * \attention This constructor can only be used to construct **uncompressed** HIBFs.
+     *
+     * \details
+     *
+     * The values of each user bin are iterated once per level of the HIBF. The values of a user bin should be
+     * distinct, since the number of values determines the layout.
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/hierarchical_interleaved_bloom_filter.cpp
+     */
+    template <std::ranges::random_access_range user_bins_t>
+        requires (data_layout_mode == data_layout::uncompressed)
+    explicit hierarchical_interleaved_bloom_filter(user_bins_t && values_per_user_bin, hibf_config const & config = {})
+    {
+        using user_bin_t = std::ranges::range_reference_t<user_bins_t>;
+        static_assert(std::ranges::sized_range<user_bins_t>, "The range of user bins must model sized_range.");
+        static_assert(std::is_lvalue_reference_v<user_bin_t>, "The user bins must be accessed by lvalue reference.");
+        static_assert(std::ranges::forward_range<user_bin_t>, "The values of a user bin must model forward_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<user_bin_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        number_of_user_bins = std::ranges::size(values_per_user_bin);
+
+        if (number_of_user_bins == 0u)
+            throw std::invalid_argument{"There must be at least one user bin."};
+        if (config.tmax == 0u || config.tmax % 64u != 0u)
+            throw std::invalid_argument{"The maximal number of technical bins must be a positive multiple of 64."};
+        if (!(config.maximum_false_positive_rate > 0.0 && config.maximum_false_positive_rate < 1.0))
+            throw std::invalid_argument{"The false positive rate must be in (0, 1)."};
+        if (config.number_of_hash_functions == 0u || config.number_of_hash_functions > 5u)
+            throw std::invalid_argument{"The number of hash functions must be > 0 and <= 5."};
+        if (config.threads == 0u)
+            throw std::invalid_argument{"The number of threads must be > 0."};
+
+        std::vector<size_t> sizes(number_of_user_bins);
+        for (size_t user_bin = 0; user_bin < number_of_user_bins; ++user_bin)
+            sizes[user_bin] = std::ranges::distance(values_per_user_bin[user_bin]);
+
+        std::vector<size_t> user_bins(number_of_user_bins);
+        std::iota(user_bins.begin(), user_bins.end(), size_t{});
+        std::ranges::stable_sort(user_bins,
+                                 [&](size_t const lhs, size_t const rhs)
+                                 {
+                                     return sizes[lhs] > sizes[rhs];
+                                 });
+
+        using subrange_t = std::ranges::subrange<std::ranges::iterator_t<user_bin_t>>;
+
+        // Each Interleaved Bloom Filter is constructed and filled before its lower levels, breadth first.
+        std::vector<std::vector<size_t>> pending{std::move(user_bins)};
+        for (size_t ibf_idx = 0; ibf_idx < pending.size(); ++ibf_idx)
+        {
+            std::vector<technical_bin_layout> const layout = compute_layout(pending[ibf_idx], sizes, config);
+            pending[ibf_idx].clear();
+
+            size_t const max_bits = std::ranges::max(layout
+                                                     | std::views::transform(
+                                                         [&](technical_bin_layout const & technical_bin)
+                                                         {
+                                                             return bin_size_in_bits(technical_bin, config);
+                                                         }));
+
+            ibf_vector.emplace_back(bin_count{layout.size()},
+                                    bin_size{max_bits},
+                                    hash_function_count{config.number_of_hash_functions});
+            next_ibf_id.emplace_back(layout.size(), static_cast<int64_t>(ibf_idx));
+            ibf_bin_to_user_bin_id.emplace_back(layout.size(), -1);
+
+            // The values of a technical bin are the concatenation of the (parts of the) user bins it stores.
+            std::vector<std::vector<subrange_t>> bin_contents(layout.size());
+
+            for (size_t bin = 0; bin < layout.size(); ++bin)
+            {
+                technical_bin_layout const & technical_bin = layout[bin];
+
+                if (technical_bin.user_bins.size() > 1u)
+                {
+                    next_ibf_id[ibf_idx][bin] = pending.size();
+                    pending.push_back(technical_bin.user_bins);
+                }
+                else
+                {
+                    ibf_bin_to_user_bin_id[ibf_idx][bin] = technical_bin.user_bins[0];
+                }
+
+                for (size_t const user_bin : technical_bin.user_bins)
+                {
+                    auto && values = values_per_user_bin[user_bin];
+                    size_t const begin_pos = sizes[user_bin] * technical_bin.part / technical_bin.parts;
+                    size_t const end_pos = sizes[user_bin] * (technical_bin.part + 1u) / technical_bin.parts;
+                    auto begin = std::ranges::next(std::ranges::begin(values), begin_pos);
+                    bin_contents[bin].emplace_back(begin, std::ranges::next(begin, end_pos - begin_pos));
+                }
+            }
+
+            ibf_vector.back().emplace_parallel(bin_contents
+                                                   | std::views::transform(
+                                                       [](std::vector<subrange_t> & parts)
+                                                       {
+                                                           return parts | std::views::join;
+                                                       }),
+                                               config.threads);
+        }
+    }
+
+    /*!\brief Construct a compressed Hierarchical Interleaved Bloom Filter.
+     * \param[in] hibf The uncompressed seqan3::hierarchical_interleaved_bloom_filter.
+     *
+     * \attention This constructor can only be used to construct **compressed** HIBFs.
+     */
+    hierarchical_interleaved_bloom_filter(hierarchical_interleaved_bloom_filter<data_layout::uncompressed> const & hibf)
+        requires (data_layout_mode == data_layout::compressed)
+        :
+        ibf_vector(hibf.ibf_vector.begin(), hibf.ibf_vector.end()),
+        next_ibf_id{hibf.next_ibf_id},
+        ibf_bin_to_user_bin_id{hibf.ibf_bin_to_user_bin_id},
+        number_of_user_bins{hibf.number_of_user_bins}
+    {}
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Returns a seqan3::hierarchical_interleaved_bloom_filter::membership_agent_type to be used for lookup.
+     *
+     * \details
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/hierarchical_interleaved_bloom_filter.cpp
+     */
+    membership_agent_type membership_agent() const
+    {
+        return membership_agent_type{*this};
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of user bins.
+    size_t user_bin_count() const noexcept
+    {
+        return number_of_user_bins;
+    }
+
+    //!\brief Returns the number of underlying Interleaved Bloom Filters.
+    size_t ibf_count() const noexcept
+    {
+        return ibf_vector.size();
+    }
+
+    //!\brief Returns the total size of all underlying Interleaved Bloom Filters in bits.
+    size_t bit_size() const noexcept
+    {
+        return std::transform_reduce(ibf_vector.begin(),
+                                     ibf_vector.end(),
+                                     size_t{},
+                                     std::plus<>{},
+                                     [](ibf_t const & ibf)
+                                     {
+                                         return ibf.bit_size();
+                                     });
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    /*!\brief Test for equality.
+     * \param[in] lhs A `seqan3::hierarchical_interleaved_bloom_filter`.
+     * \param[in] rhs `seqan3::hierarchical_interleaved_bloom_filter` to compare to.
+     * \returns `true` if equal, `false` otherwise.
+     */
+    friend bool operator==(hierarchical_interleaved_bloom_filter const & lhs,
+                           hierarchical_interleaved_bloom_filter const & rhs) noexcept
+    {
+        return std::tie(lhs.number_of_user_bins, lhs.next_ibf_id, lhs.ibf_bin_to_user_bin_id, lhs.ibf_vector)
+            == std::tie(rhs.number_of_user_bins, rhs.next_ibf_id, rhs.ibf_bin_to_user_bin_id, rhs.ibf_vector);
+    }
+
+    /*!\brief Test for inequality.
+     * \param[in] lhs A `seqan3::hierarchical_interleaved_bloom_filter`.
+     * \param[in] rhs `seqan3::hierarchical_interleaved_bloom_filter` to compare to.
+     * \returns `true` if unequal, `false` otherwise.
+     */
+    friend bool operator!=(hierarchical_interleaved_bloom_filter const & lhs,
+                           hierarchical_interleaved_bloom_filter const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param[in] archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(number_of_user_bins);
+        archive(next_ibf_id);
+        archive(ibf_bin_to_user_bin_id);
+        archive(ibf_vector);
+    }
+    //!\endcond
+};
+
+/*!\brief Manages membership queries for the seqan3::hierarchical_interleaved_bloom_filter.
+ * \attention Calling seqan3::hierarchical_interleaved_bloom_filter::membership_agent_type::membership_for on a
+ * destroyed HIBF is undefined behaviour.
+ */
+template <data_layout data_layout_mode>
+class hierarchical_interleaved_bloom_filter<data_layout_mode>::membership_agent_type
+{
+private:
+    //!\brief The type of the augmented seqan3::hierarchical_interleaved_bloom_filter.
+    using hibf_t = hierarchical_interleaved_bloom_filter<data_layout_mode>;
+
+    //!\brief A pointer to the augmented seqan3::hierarchical_interleaved_bloom_filter.
+    hibf_t const * hibf_ptr{nullptr};
+    //!\brief One counting agent per Interleaved Bloom Filter.
+    std::vector<typename ibf_t::template counting_agent_type<uint32_t>> counting_agents{};
+    //!\brief Stores the result of membership_for().
+    std::vector<int64_t> result_buffer{};
+
+    /*!\brief Collects the user bins of Interleaved Bloom Filter `ibf_idx` that contain at least `threshold` values.
+     * \param[in] values The values to query.
+     * \param[in] threshold The minimal number of values.
+     * \param[in] ibf_idx The index of the Interleaved Bloom Filter to query.
+     */
+    template <typename value_range_t>
+    void membership_for_impl(value_range_t && values, size_t const threshold, size_t const ibf_idx)
+    {
+        auto const & counts = counting_agents[ibf_idx].bulk_count(values);
+        std::vector<int64_t> const & user_bin_ids = hibf_ptr->ibf_bin_to_user_bin_id[ibf_idx];
+        std::vector<int64_t> const & next_ids = hibf_ptr->next_ibf_id[ibf_idx];
+
+        for (size_t bin = 0; bin < counts.size();)
+        {
+            int64_t const user_bin = user_bin_ids[bin];
+
+            if (user_bin == -1) // Merged bin.
+            {
+                if (counts[bin] >= threshold)
+                    membership_for_impl(values, threshold, next_ids[bin]);
+                ++bin;
+                continue;
+            }
+
+            // The parts of a split user bin store disjoint values, hence their counts add up.
+            size_t sum{};
+            for (; bin < counts.size() && user_bin_ids[bin] == user_bin; ++bin)
+                sum += counts[bin];
+
+            if (sum >= threshold)
+                result_buffer.push_back(user_bin);
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    membership_agent_type() = default;                                          //!< Defaulted.
+    membership_agent_type(membership_agent_type const &) = default;             //!< Defaulted.
+    membership_agent_type & operator=(membership_agent_type const &) = default; //!< Defaulted.
+    membership_agent_type(membership_agent_type &&) = default;                  //!< Defaulted.
+    membership_agent_type & operator=(membership_agent_type &&) = default;      //!< Defaulted.
+    ~membership_agent_type() = default;                                         //!< Defaulted.
+
+    /*!\brief Construct a membership_agent_type for an existing seqan3::hierarchical_interleaved_bloom_filter.
+     * \private
+     * \param hibf The seqan3::hierarchical_interleaved_bloom_filter.
+     */
+    explicit membership_agent_type(hibf_t const & hibf) : hibf_ptr(std::addressof(hibf))
+    {
+        counting_agents.reserve(hibf.ibf_vector.size());
+        for (auto const & ibf : hibf.ibf_vector)
+            counting_agents.push_back(ibf.template counting_agent<uint32_t>());
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Determines the user bins that contain at least `threshold` many of the values.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::forward_range. The reference
+     *                       type must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     * \param[in] threshold The minimal number of values a user bin must contain.
+     * \returns The sorted ids of the user bins.
+     *
+     * \details
+     *
+     * The values are iterated once per queried Interleaved Bloom Filter.
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/hierarchical_interleaved_bloom_filter.cpp
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::hierarchical_interleaved_bloom_filter::membership_agent_type for each thread.
+     */
+    template <std::ranges::forward_range value_range_t>
+    [[nodiscard]] std::vector<int64_t> const & membership_for(value_range_t && values, size_t const threshold) &
+    {
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+        assert(hibf_ptr != nullptr);
+
+        result_buffer.clear();
+        membership_for_impl(values, threshold, 0u);
+        std::ranges::sort(result_buffer);
+
+        return result_buffer;
+    }
+
+    // `membership_for` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    template <std::ranges::forward_range value_range_t>
+    [[nodiscard]] std::vector<int64_t> const & membership_for(value_range_t && values,
+                                                              size_t const threshold) && = delete;
+    //!\}
+};
+
+} // namespace seqan3
@@ -13,21 +13,35 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <bit>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <sdsl/bit_vectors.hpp>
 
 #include <seqan3/core/concept/cereal.hpp>
 #include <seqan3/core/detail/strong_type.hpp>
+#include <seqan3/search/dream_index/detail/mapped_bit_vector.hpp>
+#include <seqan3/utility/detail/prefetch.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
 
 namespace seqan3
 {
-//!\brief Determines if the Interleaved Bloom Filter is compressed.
+//!\brief Determines how the Interleaved Bloom Filter stores its data.
 //!\ingroup search_dream_index
-enum data_layout : bool
+enum data_layout : uint8_t
 {
     uncompressed, //!< The Interleaved Bloom Filter is uncompressed.
-    compressed    //!< The Interleaved Bloom Filter is compressed.
+    compressed,   //!< The Interleaved Bloom Filter is compressed.
+    mapped        //!< The Interleaved Bloom Filter is uncompressed and read-only, the data is mapped from a file.
 };
 
 //!\brief A strong type that represents the number of bins for the seqan3::interleaved_bloom_filter.
@@ -58,9 +72,19 @@ struct bin_index : public detail::strong_type<size_t, bin_index, detail::strong_
     using detail::strong_type<size_t, bin_index, detail::strong_type_skill::convert>::strong_type;
 };
 
+//!\brief Options for memory mapping a seqan3::interleaved_bloom_filter or a seqan3::bloom_filter from a file.
+//!\ingroup search_dream_index
+struct mapping_options
+{
+    //!\brief Read the whole file while mapping it (`MAP_POPULATE`), such that no page faults occur when querying.
+    bool populate{false};
+    //!\brief Start reading the whole file in the background after mapping it (`madvise` with `MADV_WILLNEED`).
+    bool will_need{false};
+};
+
 /*!\brief The IBF binning directory. A data structure that efficiently answers set-membership queries for multiple bins.
  * \ingroup search_dream_index
- * \tparam data_layout_mode_ Indicates whether the underlying data type is compressed. See seqan3::data_layout.
+ * \tparam data_layout_mode_ Indicates how the underlying data is stored. See seqan3::data_layout.
  * \implements seqan3::cerealisable
  *
  * \details
@@ -112,6 +136,10 @@ struct bin_index : public detail::strong_type<size_t, bin_index, detail::strong_
  * seqan3::interleaved_bloom_filter::counting_agent() and use
  * the returned seqan3::interleaved_bloom_filter::counting_agent_type.
  *
+ * To determine the bins that contain at least a given number of values of a range, call
+ * seqan3::interleaved_bloom_filter::threshold_agent() and use the returned
+ * seqan3::interleaved_bloom_filter::threshold_agent_type.
+ *
  * ### Compression
  *
  * The Interleaved Bloom Filter can be compressed by passing `data_layout::compressed` as template argument.
@@ -119,12 +147,25 @@ struct bin_index : public detail::strong_type<size_t, bin_index, detail::strong_
  * `seqan3::interleaved_bloom_filter`, in which case the underlying bitvector is compressed.
  * The compressed Interleaved Bloom Filter is immutable, i.e. only querying is supported.
  *
+ * ### Memory mapping
+ *
+ * An uncompressed Interleaved Bloom Filter can be stored with seqan3::interleaved_bloom_filter::save_mapped.
+ * Constructing a `seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped>` from such a file maps the file into
+ * memory instead of reading it. Hence, the construction takes constant time and the data is only read from disk
+ * when it is accessed. Multiple processes mapping the same file share a single copy in the page cache.
+ * The mapped Interleaved Bloom Filter is immutable, i.e. only querying is supported. It can be converted into an
+ * uncompressed Interleaved Bloom Filter.
+ *
  * ### Thread safety
  *
  * The Interleaved Bloom Filter promises the basic thread-safety by the STL that all
  * calls to `const` member functions are safe from multiple threads (as long as no thread calls
  * a non-`const` member function at the same time).
  *
+ * The only exception is seqan3::interleaved_bloom_filter::emplace_concurrently, which may be called from multiple
+ * threads at the same time. seqan3::interleaved_bloom_filter::emplace_parallel uses multiple threads to construct
+ * the Interleaved Bloom Filter.
+ *
  * Additionally, concurrent calls to `emplace` are safe iff each thread handles a multiple of wordsize (=64) many bins.
  * For example, calls to `emplace` from multiple threads are safe if `thread_1` accesses bins 0-63, `thread_2` bins
  * 64-127, and so on.
@@ -139,8 +180,11 @@ private:
     //!\endcond
 
     //!\brief The underlying datatype to use.
-    using data_type =
-        std::conditional_t<data_layout_mode_ == data_layout::uncompressed, sdsl::bit_vector, sdsl::sd_vector<>>;
+    using data_type = std::conditional_t<data_layout_mode_ == data_layout::uncompressed,
+                                         sdsl::bit_vector,
+                                         std::conditional_t<data_layout_mode_ == data_layout::compressed,
+                                                            sdsl::sd_vector<>,
+                                                            detail::mapped_bit_vector>>;
 
     //!\brief The number of bins specified by the user.
     size_t bins{};
@@ -162,6 +206,8 @@ private:
                                                       10650232656628343401ULL, // 2**64 / sqrt(3)
                                                       16499269484942379435ULL, // 2**64 / (sqrt(5)/2)
                                                       4893150838803335377ULL}; // 2**64 / (3*pi/5)
+    //!\brief Identifies files written by seqan3::interleaved_bloom_filter::save_mapped.
+    static constexpr std::string_view mapped_magic{"SEQ3_IBF"};
 
     /*!\brief Perturbs a value and fits it into the vector.
      * \param h The value to process.
@@ -195,6 +241,9 @@ public:
     template <std::integral value_t>
     class counting_agent_type; // documented upon definition below
 
+    template <std::integral value_t>
+    class threshold_agent_type; // documented upon definition below
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -276,6 +325,52 @@ public:
 
         data = sdsl::sd_vector<>{ibf.data};
     }
+
+    /*!\brief Construct an uncompressed Interleaved Bloom Filter from a mapped one.
+     * \param[in] ibf The mapped seqan3::interleaved_bloom_filter.
+     *
+     * \details
+     *
+     * All data is copied into memory.
+     */
+    interleaved_bloom_filter(interleaved_bloom_filter<data_layout::mapped> const & ibf)
+        requires (data_layout_mode == data_layout::uncompressed)
+    {
+        std::tie(bins, technical_bins, bin_size_, hash_shift, bin_words, hash_funs) =
+            std::tie(ibf.bins, ibf.technical_bins, ibf.bin_size_, ibf.hash_shift, ibf.bin_words, ibf.hash_funs);
+
+        data = sdsl::bit_vector(ibf.data.size());
+        std::copy_n(ibf.data.data(), (ibf.data.size() + 63) >> 6, data.data());
+    }
+
+    /*!\brief Construct a mapped Interleaved Bloom Filter from a file written by
+     *        seqan3::interleaved_bloom_filter::save_mapped.
+     * \param[in] path The file to map.
+     * \param[in] options The seqan3::mapping_options.
+     * \throws seqan3::file_open_error If the file cannot be mapped.
+     * \throws seqan3::format_error If the file does not contain an Interleaved Bloom Filter.
+     *
+     * \attention This constructor can only be used to construct **mapped** Interleaved Bloom Filters.
+     *
+     * \details
+     *
+     * The file is mapped into memory and not read. The file must not be modified while it is mapped.
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/interleaved_bloom_filter_mapped.cpp
+     */
+    explicit interleaved_bloom_filter(std::filesystem::path const & path, mapping_options const options = {})
+        requires (data_layout_mode == data_layout::mapped)
+    {
+        std::array<uint64_t, 6> metadata;
+        data = detail::read_mapped_bit_vector(path, mapped_magic, metadata, options.populate, options.will_need);
+        std::tie(bins, technical_bins, bin_size_, hash_shift, bin_words, hash_funs) = std::tuple_cat(metadata);
+
+        if (data.size() != technical_bins * bin_size_ || bin_words << 6 != technical_bins || hash_funs == 0
+            || hash_funs > 5)
+            throw format_error{"The file " + path.string() + " does not contain a valid Interleaved Bloom Filter."};
+    }
     //!\}
 
     /*!\name Modifiers
@@ -306,6 +401,129 @@ public:
         };
     }
 
+    /*!\brief Inserts a value into a specific bin. Can be called concurrently from multiple threads.
+     * \param[in] value The raw numeric value to process.
+     * \param[in] bin The bin index to insert into.
+     *
+     * \attention This function is only available for **uncompressed** Interleaved Bloom Filters.
+     *
+     * \details
+     *
+     * Neighbouring bins share the same 64-bit words of the underlying bitvector. Hence, calling
+     * seqan3::interleaved_bloom_filter::emplace from multiple threads is a data race, even when inserting into
+     * different bins. This function sets the bits with an atomic `fetch_or` instead and can therefore be called
+     * concurrently for any bins. No other member function may be called concurrently.
+     *
+     * To insert the values of many bins in parallel, prefer seqan3::interleaved_bloom_filter::emplace_parallel.
+     */
+    void emplace_concurrently(size_t const value, bin_index const bin) noexcept
+        requires (data_layout_mode == data_layout::uncompressed)
+    {
+        assert(bin.get() < bins);
+        for (size_t i = 0; i < hash_funs; ++i)
+        {
+            size_t const idx = hash_and_fit(value, hash_seeds[i]) + bin.get();
+            assert(idx < data.size());
+            std::atomic_ref<uint64_t>{data.data()[idx >> 6]}.fetch_or(1ULL << (idx & 63u), std::memory_order_relaxed);
+        }
+    }
+
+    /*!\brief Inserts the values of multiple bins using multiple threads.
+     * \tparam bin_ranges_t The type of the range of bins; must model std::ranges::random_access_range and
+     *                      std::ranges::sized_range. The reference type must model std::ranges::input_range over
+     *                      std::unsigned_integral values.
+     * \param[in] values_per_bin The `i`-th element contains the values to insert into bin `i`.
+     * \param[in] thread_count The number of threads to use.
+     * \throws std::invalid_argument If `thread_count` is 0 or if there are more ranges than bins.
+     *
+     * \attention This function is only available for **uncompressed** Interleaved Bloom Filters.
+     *
+     * \details
+     *
+     * The bins are distributed dynamically among the threads. The values of one bin are always inserted by a single
+     * thread, i.e. each element of `values_per_bin` is only accessed by one thread.
+     *
+     * Bins `64 * j` to `64 * j + 63` share the `j`-th word of each row. If there are at least as many such groups of
+     * 64 bins as threads, each group is assigned to exactly one thread. Then no word is written by more than one
+     * thread and no synchronisation is needed. Otherwise, single bins are distributed and the bits are set via
+     * seqan3::interleaved_bloom_filter::emplace_concurrently.
+     *
+     * If inserting the values of a bin throws, the remaining bins are still processed and the first exception is
+     * rethrown afterwards.
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/interleaved_bloom_filter_emplace_parallel.cpp
+     */
+    template <std::ranges::random_access_range bin_ranges_t>
+        requires (data_layout_mode == data_layout::uncompressed)
+    void emplace_parallel(bin_ranges_t && values_per_bin, size_t const thread_count)
+    {
+        static_assert(std::ranges::sized_range<bin_ranges_t>, "The range of bins must model sized_range.");
+        static_assert(std::ranges::input_range<std::ranges::range_reference_t<bin_ranges_t>>,
+                      "The values of a bin must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<std::ranges::range_reference_t<bin_ranges_t>>>,
+                      "An individual value must be an unsigned integral.");
+
+        size_t const bin_count = std::ranges::size(values_per_bin);
+
+        if (thread_count == 0u)
+            throw std::invalid_argument{"The number of threads must be > 0."};
+        if (bin_count > bins)
+            throw std::invalid_argument{"There are more ranges of values than bins in the Interleaved Bloom Filter."};
+
+        bool const exclusive_words = ((bin_count + 63u) >> 6) >= thread_count;
+        size_t const bins_per_task = exclusive_words ? 64u : 1u;
+        size_t const task_count = (bin_count + bins_per_task - 1u) / bins_per_task;
+
+        std::atomic<size_t> next_task{0u};
+        std::vector<std::exception_ptr> exceptions(thread_count);
+
+        auto worker = [&](size_t const thread_id)
+        {
+            for (size_t task = next_task++; task < task_count; task = next_task++)
+            {
+                size_t const bin_end = std::min((task + 1u) * bins_per_task, bin_count);
+
+                for (size_t bin = task * bins_per_task; bin < bin_end; ++bin)
+                {
+                    try
+                    {
+                        if (exclusive_words)
+                        {
+                            for (auto && value : values_per_bin[bin])
+                                emplace(value, bin_index{bin});
+                        }
+                        else
+                        {
+                            for (auto && value : values_per_bin[bin])
+                                emplace_concurrently(value, bin_index{bin});
+                        }
+                    }
+                    catch (...)
+                    {
+                        if (!exceptions[thread_id])
+                            exceptions[thread_id] = std::current_exception();
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> threads{};
+        threads.reserve(thread_count - 1u);
+        for (size_t thread_id = 1u; thread_id < thread_count; ++thread_id)
+            threads.emplace_back(worker, thread_id);
+
+        worker(0u);
+
+        for (auto & thread : threads)
+            thread.join();
+
+        for (auto & exception : exceptions)
+            if (exception)
+                std::rethrow_exception(exception);
+    }
+
     /*!\brief Clears a specific bin.
      * \param[in] bin The bin index to clear.
      *
@@ -355,6 +573,36 @@ public:
                 data[bin.get() + offset] = 0;
     }
 
+    /*!\brief Stores the Interleaved Bloom Filter such that it can be memory mapped.
+     * \param[in] path The file to write.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     * \throws seqan3::io_error If writing fails.
+     *
+     * \attention This function is only available for **uncompressed** Interleaved Bloom Filters.
+     *
+     * \details
+     *
+     * The file can be mapped by constructing a `seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped>`.
+     * The layout stores the raw bitvector and depends on the byte order of the host.
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/interleaved_bloom_filter_mapped.cpp
+     */
+    void save_mapped(std::filesystem::path const & path) const
+        requires (data_layout_mode == data_layout::uncompressed)
+    {
+        detail::write_mapped_bit_vector(path,
+                                        mapped_magic,
+                                        std::array<uint64_t, 6>{bins,
+                                                                technical_bins,
+                                                                bin_size_,
+                                                                hash_shift,
+                                                                bin_words,
+                                                                hash_funs},
+                                        data);
+    }
+
     /*!\brief Increases the number of bins stored in the Interleaved Bloom Filter.
      * \param[in] new_bins_ The new number of bins.
      * \throws std::invalid_argument If passed number of bins is smaller than current number of bins.
@@ -454,6 +702,23 @@ public:
     {
         return counting_agent_type<value_t>{*this};
     }
+
+    /*!\brief Returns a seqan3::interleaved_bloom_filter::threshold_agent_type to be used for thresholding.
+     * \attention Calling seqan3::interleaved_bloom_filter::increase_bin_number_to invalidates all
+     * `seqan3::interleaved_bloom_filter::threshold_agent_type`s constructed for this Interleaved Bloom Filter.
+     *
+     * \details
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/threshold_agent.cpp
+     * \sa seqan3::interleaved_bloom_filter::threshold_agent_type::bulk_threshold
+     */
+    template <typename value_t = uint16_t>
+    threshold_agent_type<value_t> threshold_agent() const
+    {
+        return threshold_agent_type<value_t>{*this};
+    }
     //!\}
 
     /*!\name Capacity
@@ -559,6 +824,7 @@ public:
      * \attention These functions are never called directly, see \ref serialisation for more details.
      */
     template <cereal_archive archive_t>
+        requires (data_layout_mode != data_layout::mapped)
     void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
     {
         archive(bins);
@@ -641,32 +907,223 @@ public:
         assert(ibf_ptr != nullptr);
         assert(result_buffer.size() == ibf_ptr->bin_count());
 
+        bulk_contains_impl(hash_indices(value), result_buffer);
+
+        return result_buffer;
+    }
+
+    // `bulk_contains` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    [[nodiscard]] binning_bitvector const & bulk_contains(size_t const value) && noexcept = delete;
+
+    /*!\brief Determines set membership of each value in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::input_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     * \returns A std::vector containing the seqan3::interleaved_bloom_filter::membership_agent_type::binning_bitvector
+     *          for each value, in the order of `values`.
+     *
+     * \attention The result of this function must always be bound via reference, e.g. `auto &`, to prevent copying.
+     * \attention Sequential calls to this function invalidate the previously returned reference.
+     *
+     * \details
+     *
+     * The result is the same as calling `bulk_contains` for each value. However, the values are processed in blocks
+     * of `prefetch_block_size` many values: The hash functions of all values in a block are computed first and the
+     * rows they address are prefetched, before the rows are combined. This way, the memory accesses of multiple values
+     * overlap instead of stalling on each value one after another.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::interleaved_bloom_filter::membership_agent_type for each thread.
+     */
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<binning_bitvector> const & bulk_contains(value_range_t && values) &
+    {
+        assert(ibf_ptr != nullptr);
+
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        size_t result_count{};
+        for_each_hashed_value(std::forward<value_range_t>(values),
+                              [&](std::array<size_t, 5> const & bloom_filter_indices)
+                              {
+                                  if (result_count == results_buffer.size())
+                                      results_buffer.emplace_back(ibf_ptr->bin_count());
+
+                                  bulk_contains_impl(bloom_filter_indices, results_buffer[result_count++]);
+                              });
+        results_buffer.resize(result_count);
+
+        return results_buffer;
+    }
+
+    // `bulk_contains` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<binning_bitvector> const & bulk_contains(value_range_t && values) && = delete;
+    //!\}
+
+    //!\brief The number of values whose rows are prefetched together by the range overload of `bulk_contains`.
+    static constexpr size_t prefetch_block_size{16};
+
+private:
+    //!\cond
+    template <std::integral value_t>
+    friend class interleaved_bloom_filter<data_layout_mode>::counting_agent_type;
+
+    template <std::integral value_t>
+    friend class interleaved_bloom_filter<data_layout_mode>::threshold_agent_type;
+    //!\endcond
+
+    //!\brief The simd type used to AND multiple 64-bit words of the interleaved rows at once.
+    using simd_t = simd::simd_type_t<uint64_t>;
+
+    //!\brief Stores the result of the range overload of bulk_contains().
+    std::vector<binning_bitvector> results_buffer;
+
+    //!\brief Returns the bit positions of the rows addressed by `value`; only the first `hash_funs` entries are used.
+    std::array<size_t, 5> hash_indices(size_t const value) const noexcept
+    {
         std::array<size_t, 5> bloom_filter_indices;
         std::memcpy(&bloom_filter_indices, &ibf_ptr->hash_seeds, sizeof(size_t) * ibf_ptr->hash_funs);
 
         for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
             bloom_filter_indices[i] = ibf_ptr->hash_and_fit(value, bloom_filter_indices[i]);
 
-        for (size_t batch = 0; batch < ibf_ptr->bin_words; ++batch)
+        return bloom_filter_indices;
+    }
+
+    /*!\brief Prefetches the beginning of the rows starting at the given bit positions.
+     * \param[in] bloom_filter_indices The bit positions of the rows; only the first `hash_funs` entries are used.
+     *
+     * \details
+     *
+     * Only the first cache line of each row is prefetched. Longer rows are read sequentially and hence picked up by
+     * the hardware prefetcher. This is a no-op for the compressed Interleaved Bloom Filter.
+     */
+    void prefetch_rows([[maybe_unused]] std::array<size_t, 5> const & bloom_filter_indices) const noexcept
+    {
+        if constexpr (data_layout_mode != data_layout::compressed)
         {
-            size_t tmp{-1ULL};
             for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
+                detail::prefetch_for_read(ibf_ptr->data.data() + (bloom_filter_indices[i] >> 6));
+        }
+    }
+
+    /*!\brief ANDs the rows starting at the given bit positions into `result`.
+     * \param[in] bloom_filter_indices The bit positions of the rows; only the first `hash_funs` entries are used.
+     * \param[out] result The seqan3::interleaved_bloom_filter::membership_agent_type::binning_bitvector to write to.
+     *
+     * \details
+     *
+     * For the uncompressed and the mapped Interleaved Bloom Filter, every row starts at a multiple of
+     * `technical_bins` and hence at a word boundary of the underlying bitvector. This allows to process
+     * `simd_traits<simd_t>::length` many words at once, e.g. 256 bits for AVX2 and 512 bits for AVX512. The remaining
+     * words (and all words if no simd support is available) are processed one by one.
+     */
+    void bulk_contains_impl(std::array<size_t, 5> bloom_filter_indices, binning_bitvector & result_bitvector) const
+        noexcept
+    {
+        size_t const hash_funs = ibf_ptr->hash_funs;
+        size_t const bin_words = ibf_ptr->bin_words;
+
+        if constexpr (data_layout_mode != data_layout::compressed)
+        {
+            std::array<uint64_t const *, 5> rows;
+            for (size_t i = 0; i < hash_funs; ++i)
             {
+                assert(bloom_filter_indices[i] % 64 == 0);
                 assert(bloom_filter_indices[i] < ibf_ptr->data.size());
-                tmp &= ibf_ptr->data.get_int(bloom_filter_indices[i]);
-                bloom_filter_indices[i] += 64;
+                rows[i] = ibf_ptr->data.data() + (bloom_filter_indices[i] >> 6);
             }
 
-            result_buffer.data.set_int(batch << 6, tmp);
-        }
+            uint64_t * result = result_bitvector.data.data();
+            size_t batch = 0;
 
-        return result_buffer;
+            if constexpr (constexpr size_t simd_words = simd_traits<simd_t>::length; simd_words > 1)
+            {
+                for (; batch + simd_words <= bin_words; batch += simd_words)
+                {
+                    simd_t tmp = simd::load<simd_t>(rows[0] + batch);
+                    for (size_t i = 1; i < hash_funs; ++i)
+                        tmp &= simd::load<simd_t>(rows[i] + batch);
+
+                    simd::store(result + batch, tmp);
+                }
+            }
+
+            for (; batch < bin_words; ++batch)
+            {
+                uint64_t tmp = rows[0][batch];
+                for (size_t i = 1; i < hash_funs; ++i)
+                    tmp &= rows[i][batch];
+
+                result[batch] = tmp;
+            }
+        }
+        else
+        {
+            for (size_t batch = 0; batch < bin_words; ++batch)
+            {
+                size_t tmp{-1ULL};
+                for (size_t i = 0; i < hash_funs; ++i)
+                {
+                    assert(bloom_filter_indices[i] < ibf_ptr->data.size());
+                    tmp &= ibf_ptr->data.get_int(bloom_filter_indices[i]);
+                    bloom_filter_indices[i] += 64;
+                }
+
+                result_bitvector.data.set_int(batch << 6, tmp);
+            }
+        }
     }
 
-    // `bulk_contains` cannot be called on a temporary, since the object the returned reference points to
-    // is immediately destroyed.
-    [[nodiscard]] binning_bitvector const & bulk_contains(size_t const value) && noexcept = delete;
-    //!\}
+    /*!\brief Calls `on_hash_fn` with the bit positions of the rows addressed by each value in `values`.
+     * \tparam value_range_t The type of the range of values.
+     * \tparam on_hash_fn_t The type of the callback; must be invocable with a `std::array<size_t, 5> const &`.
+     * \param[in] values The range of values to process.
+     * \param[in] on_hash_fn The callback. If it returns `bool`, returning `false` stops the traversal.
+     *
+     * \details
+     *
+     * The values are hashed and their rows are prefetched in blocks of `prefetch_block_size` values before
+     * `on_hash_fn` is called for each value of the block, in the order of `values`.
+     */
+    template <typename value_range_t, typename on_hash_fn_t>
+    void for_each_hashed_value(value_range_t && values, on_hash_fn_t && on_hash_fn) const
+    {
+        std::array<std::array<size_t, 5>, prefetch_block_size> block_indices;
+
+        auto it = std::ranges::begin(values);
+        auto end = std::ranges::end(values);
+
+        while (it != end)
+        {
+            size_t block_size{};
+            for (; block_size < prefetch_block_size && it != end; ++block_size, ++it)
+            {
+                block_indices[block_size] = hash_indices(*it);
+                prefetch_rows(block_indices[block_size]);
+            }
+
+            for (size_t i = 0; i < block_size; ++i)
+            {
+                if constexpr (std::same_as<std::invoke_result_t<on_hash_fn_t, std::array<size_t, 5> const &>, bool>)
+                {
+                    if (!on_hash_fn(std::as_const(block_indices[i])))
+                        return;
+                }
+                else
+                {
+                    on_hash_fn(std::as_const(block_indices[i]));
+                }
+            }
+        }
+    }
 };
 
 //!\brief A bitvector representing the result of a call to `bulk_contains` of the seqan3::interleaved_bloom_filter.
@@ -820,7 +1277,9 @@ private:
         std::same_as<binning_bitvector_t,
                      interleaved_bloom_filter<data_layout::uncompressed>::membership_agent_type::binning_bitvector>
         || std::same_as<binning_bitvector_t,
-                        interleaved_bloom_filter<data_layout::compressed>::membership_agent_type::binning_bitvector>;
+                        interleaved_bloom_filter<data_layout::compressed>::membership_agent_type::binning_bitvector>
+        || std::same_as<binning_bitvector_t,
+                        interleaved_bloom_filter<data_layout::mapped>::membership_agent_type::binning_bitvector>;
 
 public:
     /*!\name Constructors, destructor and assignment
@@ -852,11 +1311,18 @@ public:
         requires is_binning_bitvector<binning_bitvector_t>
     counting_vector & operator+=(binning_bitvector_t const & binning_bitvector)
     {
-        for_each_set_bin(binning_bitvector,
-                         [this](size_t const bin)
-                         {
-                             ++(*this)[bin];
-                         });
+        if constexpr (std::same_as<value_t, bool>)
+        {
+            for_each_set_bin(binning_bitvector,
+                             [this](size_t const bin)
+                             {
+                                 ++(*this)[bin];
+                             });
+        }
+        else
+        {
+            add_set_bins(binning_bitvector);
+        }
         return *this;
     }
 
@@ -921,6 +1387,64 @@ public:
     }
 
 private:
+    //!\brief The unsigned counterpart of `value_t`. Adding 0 or 1 yields the same bits for signed and unsigned counts.
+    using unsigned_value_t = std::make_unsigned_t<std::conditional_t<std::same_as<value_t, bool>, uint8_t, value_t>>;
+    //!\brief The simd type used to add the bits of one byte of a binning bitvector at once.
+    using byte_simd_t = simd::simd_type_t<unsigned_value_t, 8>;
+
+    /*!\brief Adds the bits of a seqan3::interleaved_bloom_filter::membership_agent_type::binning_bitvector.
+     * \details
+     *
+     * Each non-zero byte of the binning bitvector is expanded to eight counts of `0` or `1` and added with a single
+     * simd addition. The last, incomplete byte is added bit by bit, such that no counts beyond
+     * `binning_bitvector.size()` are accessed.
+     */
+    template <typename binning_bitvector_t>
+    void add_set_bins(binning_bitvector_t const & binning_bitvector)
+    {
+        assert(this->size() >= binning_bitvector.size()); // The counting vector may be bigger than what we need.
+
+        // `byte_simd_t` may be wider than the native simd registers (e.g. 8 x uint64_t). Passing such vectors to or
+        // from functions, e.g. simd::fill, changes the ABI and is hence avoided.
+        // Lane `i` selects bit `i` of the byte and shifts it to the lowest position, i.e. it yields a count of 0 or 1.
+        constexpr byte_simd_t lane_bits{1, 2, 4, 8, 16, 32, 64, 128};
+        constexpr byte_simd_t lane_shifts{0, 1, 2, 3, 4, 5, 6, 7};
+
+        size_t const full_bytes_end = binning_bitvector.size() & ~size_t{7u};
+        value_t * counts = this->data();
+
+        for (size_t bit_pos = 0; bit_pos < binning_bitvector.size(); bit_pos += 64)
+        {
+            // get 64 bits starting at position `bit_pos`
+            size_t bit_sequence = binning_bitvector.raw_data().get_int(bit_pos);
+
+            for (size_t bin = bit_pos; bit_sequence != 0u; bin += 8, bit_sequence >>= 8)
+            {
+                // Jump to the next byte with a 1.
+                size_t const skipped_bytes = std::countr_zero(bit_sequence) >> 3;
+                bin += skipped_bytes << 3;
+                bit_sequence >>= skipped_bytes << 3;
+
+                uint8_t const byte = static_cast<uint8_t>(bit_sequence & 0xFFu);
+
+                if (bin < full_bytes_end)
+                {
+                    // memcpy instead of simd::load/simd::store, because `byte_simd_t` may not be a native type.
+                    byte_simd_t tmp;
+                    std::memcpy(&tmp, counts + bin, sizeof(byte_simd_t));
+                    tmp += (lane_bits & static_cast<unsigned_value_t>(byte)) >> lane_shifts;
+                    std::memcpy(counts + bin, &tmp, sizeof(byte_simd_t));
+                }
+                else // The last byte may extend beyond the counting vector.
+                {
+                    for (size_t bit = 0; bit < 8u; ++bit)
+                        if ((byte >> bit) & 1u)
+                            ++counts[bin + bit];
+                }
+            }
+        }
+    }
+
     //!\brief Enumerates all bins of a seqan3::interleaved_bloom_filter::membership_agent_type::binning_bitvector.
     template <typename binning_bitvector_t, typename on_bin_fn_t>
     void for_each_set_bin(binning_bitvector_t && binning_bitvector, on_bin_fn_t && on_bin_fn)
@@ -1014,6 +1538,9 @@ public:
      *
      * \details
      *
+     * The values are processed in blocks, see the range overload of
+     * seqan3::interleaved_bloom_filter::membership_agent_type::bulk_contains.
+     *
      * ### Example
      *
      * \include test/snippet/search/dream_index/counting_agent.cpp
@@ -1035,8 +1562,14 @@ public:
 
         std::ranges::fill(result_buffer, 0);
 
-        for (auto && value : values)
-            result_buffer += membership_agent.bulk_contains(value);
+        auto & binning_bitvector = membership_agent.result_buffer;
+        membership_agent.for_each_hashed_value(std::forward<value_range_t>(values),
+                                               [&](std::array<size_t, 5> const & bloom_filter_indices)
+                                               {
+                                                   membership_agent.bulk_contains_impl(bloom_filter_indices,
+                                                                                       binning_bitvector);
+                                                   result_buffer += binning_bitvector;
+                                               });
 
         return result_buffer;
     }
@@ -1048,4 +1581,164 @@ public:
     //!\}
 };
 
+/*!\brief Determines the bins that contain at least a given number of values of a query.
+ * \tparam value_t The type of the internal counts. Must model std::integral.
+ * \attention Calling seqan3::interleaved_bloom_filter::increase_bin_number_to invalidates the threshold_agent_type.
+ *
+ * \details
+ *
+ * This agent answers the same question as comparing the result of
+ * seqan3::interleaved_bloom_filter::counting_agent_type::bulk_count against a threshold, but stops processing the
+ * values as soon as no bin can reach the threshold anymore.
+ *
+ * The `value_t` template parameter should be chosen in a way that no overflow occurs if all values of a query are
+ * contained in a bin, see seqan3::counting_vector.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/dream_index/threshold_agent.cpp
+ */
+template <data_layout data_layout_mode>
+template <std::integral value_t>
+class interleaved_bloom_filter<data_layout_mode>::threshold_agent_type
+{
+private:
+    //!\brief The type of the augmented seqan3::interleaved_bloom_filter.
+    using ibf_t = interleaved_bloom_filter<data_layout_mode>;
+
+    //!\brief A pointer to the augmented seqan3::interleaved_bloom_filter.
+    ibf_t const * ibf_ptr{nullptr};
+
+    //!\brief Store a seqan3::interleaved_bloom_filter::membership_agent to call `bulk_contains`.
+    membership_agent_type membership_agent;
+
+    //!\brief Stores the counts of the current query.
+    counting_vector<value_t> counts;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    threshold_agent_type() = default;                                         //!< Defaulted.
+    threshold_agent_type(threshold_agent_type const &) = default;             //!< Defaulted.
+    threshold_agent_type & operator=(threshold_agent_type const &) = default; //!< Defaulted.
+    threshold_agent_type(threshold_agent_type &&) = default;                  //!< Defaulted.
+    threshold_agent_type & operator=(threshold_agent_type &&) = default;      //!< Defaulted.
+    ~threshold_agent_type() = default;                                        //!< Defaulted.
+
+    /*!\brief Construct a threshold_agent_type for an existing seqan3::interleaved_bloom_filter.
+     * \private
+     * \param ibf The seqan3::interleaved_bloom_filter.
+     */
+    explicit threshold_agent_type(ibf_t const & ibf) :
+        ibf_ptr(std::addressof(ibf)),
+        membership_agent(ibf),
+        counts(ibf.bin_count())
+    {}
+    //!\}
+
+    //!\brief Stores the result of bulk_threshold().
+    std::vector<size_t> result_buffer;
+
+    /*!\name Thresholding
+     * \{
+     */
+    /*!\brief Determines all bins that contain at least `threshold` many of the values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::forward_range. The reference
+     *                       type must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     * \param[in] threshold The minimum number of values a bin must contain.
+     * \returns The indices of all bins that contain at least `threshold` many values, in ascending order.
+     *
+     * \attention The result of this function must always be bound via reference, e.g. `auto &`, to prevent copying.
+     * \attention Sequential calls to this function invalidate the previously returned reference.
+     *
+     * \details
+     *
+     * The values are processed in the same way as by seqan3::interleaved_bloom_filter::counting_agent_type::bulk_count.
+     * Since each value adds at most one to the count of a bin, processing stops as soon as the highest count plus the
+     * number of remaining values is less than `threshold`. In this case, the result is empty.
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/threshold_agent.cpp
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::interleaved_bloom_filter::threshold_agent_type for each thread.
+     */
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<size_t> const & bulk_threshold(value_range_t && values, size_t const threshold) &
+    {
+        assert(ibf_ptr != nullptr);
+        assert(counts.size() == ibf_ptr->bin_count());
+
+        static_assert(std::ranges::forward_range<value_range_t>, "The values must model forward_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        result_buffer.clear();
+        size_t remaining = std::ranges::distance(values);
+
+        if (threshold > remaining) // No bin can reach the threshold.
+            return result_buffer;
+
+        std::ranges::fill(counts, 0);
+
+        if (threshold > 0u)
+        {
+            // An upper bound for the highest count. It only increases if a value is contained in any bin.
+            size_t max_count_bound{};
+            auto & binning_bitvector = membership_agent.result_buffer;
+            auto const & binning_bits = binning_bitvector.raw_data();
+
+            membership_agent.for_each_hashed_value(
+                values,
+                [&](std::array<size_t, 5> const & bloom_filter_indices)
+                {
+                    membership_agent.bulk_contains_impl(bloom_filter_indices, binning_bitvector);
+                    --remaining;
+
+                    bool any_hit{false};
+                    for (size_t bit_pos = 0; !any_hit && bit_pos < binning_bits.size(); bit_pos += 64)
+                        any_hit = binning_bits.get_int(bit_pos) != 0u;
+
+                    if (any_hit)
+                    {
+                        counts += binning_bitvector;
+                        ++max_count_bound;
+                    }
+
+                    // Early exit is only possible once fewer values remain than the threshold. If the bound is too
+                    // weak, it is tightened to the actual highest count once per prefetch block.
+                    if (remaining >= threshold)
+                        return true;
+
+                    if (max_count_bound + remaining >= threshold
+                        && remaining % membership_agent_type::prefetch_block_size == 0u)
+                        max_count_bound = static_cast<size_t>(std::ranges::max(counts));
+
+                    return max_count_bound + remaining >= threshold;
+                });
+
+            if (max_count_bound + remaining < threshold)
+                return result_buffer;
+        }
+
+        for (size_t bin = 0; bin < counts.size(); ++bin)
+            if (static_cast<size_t>(counts[bin]) >= threshold)
+                result_buffer.push_back(bin);
+
+        return result_buffer;
+    }
+
+    // `bulk_threshold` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<size_t> const & bulk_threshold(value_range_t && values, size_t const threshold) && =
+        delete;
+    //!\}
+};
+
 } // namespace seqan3
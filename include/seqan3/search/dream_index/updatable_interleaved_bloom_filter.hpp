@@ -0,0 +1,575 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::updatable_interleaved_bloom_filter.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A compressed Interleaved Bloom Filter that supports inserting values and clearing bins.
+ * \ingroup search_dream_index
+ *
+ * \details
+ *
+ * The `seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>` is immutable. Updating it requires to
+ * decompress, modify and recompress the whole Interleaved Bloom Filter. The updatable Interleaved Bloom Filter
+ * instead consists of
+ *
+ *   * a compressed *base* Interleaved Bloom Filter,
+ *   * an uncompressed *delta* Interleaved Bloom Filter with the same dimensions, which stores all values inserted
+ *     since the last merge, and
+ *   * a mask of the bins of the base that have been cleared since the last merge.
+ *
+ * Queries combine the base and the delta. Inserting a value only modifies the delta. Clearing a bin clears it in
+ * the delta and masks it in the base.
+ *
+ * A value is reported for a bin if it is contained in the base or in the delta. Since the bits of a false positive
+ * may be spread over both components, there may be fewer false positives before merging than there are in the
+ * merged Interleaved Bloom Filter. There are never false negatives.
+ *
+ * Once the number of values inserted into the delta reaches the merge threshold, the delta is merged into a new
+ * base in a background thread. Meanwhile, the old base and the delta that is being merged keep answering queries and
+ * newly inserted values are stored in a new delta. The new base is installed by the next modifying member
+ * function call once the merge has finished, or explicitly by calling
+ * seqan3::updatable_interleaved_bloom_filter::wait_for_merge.
+ *
+ * Querying works like for the seqan3::interleaved_bloom_filter, via
+ * seqan3::updatable_interleaved_bloom_filter::membership_agent_type and
+ * seqan3::updatable_interleaved_bloom_filter::counting_agent_type.
+ *
+ * ### Thread safety
+ *
+ * The updatable Interleaved Bloom Filter promises the basic thread-safety by the STL that all
+ * calls to `const` member functions are safe from multiple threads (as long as no thread calls
+ * a non-`const` member function at the same time).
+ */
+class updatable_interleaved_bloom_filter
+{
+private:
+    //!\brief The type of the compressed base.
+    using base_t = interleaved_bloom_filter<data_layout::compressed>;
+    //!\brief The type of the uncompressed delta.
+    using delta_t = interleaved_bloom_filter<data_layout::uncompressed>;
+
+    //!\brief The compressed base. Never modified, hence it can be shared with a running merge.
+    std::shared_ptr<base_t const> base{std::make_shared<base_t const>()};
+    //!\brief The values inserted since the last merge was started.
+    delta_t delta{};
+    //!\brief Bit `i` is 0 if bin `i` of the base has been cleared.
+    sdsl::bit_vector base_mask{};
+    //!\brief The delta that is merged in the background. Never modified, hence it can be shared with the merge.
+    std::shared_ptr<delta_t const> merging_delta{};
+    //!\brief Bit `i` is 0 if bin `i` has been cleared since the running merge was started.
+    sdsl::bit_vector merging_mask{};
+    //!\brief The result of the running merge.
+    std::shared_future<std::shared_ptr<base_t const>> pending_merge{};
+    //!\brief The number of values inserted into the delta.
+    size_t delta_values{};
+    //!\brief The number of values in the delta that triggers a merge.
+    size_t threshold{default_merge_threshold};
+
+    /*!\brief Computes a new base from an old base, a mask and a delta.
+     * \param[in] old_base The old base.
+     * \param[in] mask Bit `i` is 0 if bin `i` of `old_base` shall be cleared.
+     * \param[in] delta The delta to merge.
+     */
+    static std::shared_ptr<base_t const>
+    merge_impl(base_t const & old_base, sdsl::bit_vector const & mask, delta_t const & delta)
+    {
+        delta_t merged{old_base};
+
+        std::vector<bin_index> cleared_bins{};
+        for (size_t bin = 0; bin < mask.size(); ++bin)
+            if (!mask[bin])
+                cleared_bins.emplace_back(bin);
+
+        merged.clear(cleared_bins);
+
+        // The base and the delta have the same dimensions, hence the same layout.
+        uint64_t * const merged_words = merged.raw_data().data();
+        uint64_t const * const delta_words = delta.raw_data().data();
+        for (size_t i = 0, words = (merged.raw_data().size() + 63u) >> 6; i < words; ++i)
+            merged_words[i] |= delta_words[i];
+
+        return std::make_shared<base_t const>(merged);
+    }
+
+    //!\brief Returns whether a bin of the base has been cleared since the last merge.
+    bool has_cleared_bins() const noexcept
+    {
+        uint64_t const * const mask_words = base_mask.data();
+        size_t const full_words = base_mask.size() >> 6;
+
+        for (size_t i = 0; i < full_words; ++i)
+            if (mask_words[i] != std::numeric_limits<uint64_t>::max())
+                return true;
+
+        // The bits of the last word beyond the size of the mask are not bins.
+        size_t const remaining_bits = base_mask.size() & 63u;
+        uint64_t const remaining_mask = (uint64_t{1} << remaining_bits) - 1u;
+
+        return remaining_bits != 0u && (mask_words[full_words] & remaining_mask) != remaining_mask;
+    }
+
+    //!\brief Creates an empty delta with the dimensions of the base.
+    delta_t empty_delta() const
+    {
+        return delta_t{seqan3::bin_count{base->bin_count()},
+                       seqan3::bin_size{base->bin_size()},
+                       seqan3::hash_function_count{base->hash_function_count()}};
+    }
+
+    //!\brief Installs the result of the running merge if it has finished. Waits for it if `wait` is `true`.
+    void install_merge(bool const wait)
+    {
+        if (!pending_merge.valid())
+            return;
+
+        if (!wait && pending_merge.wait_for(std::chrono::seconds{0}) != std::future_status::ready)
+            return;
+
+        base = pending_merge.get();
+        base_mask = std::move(merging_mask);
+        merging_mask = sdsl::bit_vector{};
+        merging_delta.reset();
+        pending_merge = {};
+    }
+
+    //!\brief Starts merging the delta into the base in a background thread.
+    void start_merge()
+    {
+        install_merge(true);
+
+        merging_delta = std::make_shared<delta_t const>(std::exchange(delta, empty_delta()));
+        merging_mask = sdsl::bit_vector(base->bin_count(), 1);
+        delta_values = 0u;
+
+        pending_merge = std::async(std::launch::async,
+                                   [old_base = base, mask = base_mask, new_delta = merging_delta]()
+                                   {
+                                       return merge_impl(*old_base, mask, *new_delta);
+                                   })
+                            .share();
+    }
+
+public:
+    //!\brief The merge threshold that is used if none is given, including by the default constructor.
+    static constexpr size_t default_merge_threshold{1'000'000u};
+
+    class membership_agent_type; // documented upon definition below
+
+    template <std::integral value_t>
+    class counting_agent_type; // documented upon definition below
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    updatable_interleaved_bloom_filter() = default; //!< Defaulted.
+    //!\brief Defaulted.
+    updatable_interleaved_bloom_filter(updatable_interleaved_bloom_filter const &) = default;
+    //!\brief Defaulted.
+    updatable_interleaved_bloom_filter & operator=(updatable_interleaved_bloom_filter const &) = default;
+    //!\brief Defaulted.
+    updatable_interleaved_bloom_filter(updatable_interleaved_bloom_filter &&) = default;
+    //!\brief Defaulted.
+    updatable_interleaved_bloom_filter & operator=(updatable_interleaved_bloom_filter &&) = default;
+
+    //!\brief Waits for a running merge.
+    ~updatable_interleaved_bloom_filter()
+    {
+        if (pending_merge.valid())
+            pending_merge.wait();
+    }
+
+    /*!\brief Construct from a compressed Interleaved Bloom Filter.
+     * \param[in] ibf The compressed seqan3::interleaved_bloom_filter.
+     * \param[in] merge_threshold The number of inserted values that triggers a merge; `0` and `1` merge after every
+     *                            insertion. Default: `default_merge_threshold`.
+     *
+     * \details
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/updatable_interleaved_bloom_filter.cpp
+     */
+    explicit updatable_interleaved_bloom_filter(interleaved_bloom_filter<data_layout::compressed> ibf,
+                                                size_t const merge_threshold = default_merge_threshold) :
+        base{std::make_shared<base_t const>(std::move(ibf))},
+        delta{empty_delta()},
+        base_mask(base->bin_count(), 1),
+        threshold{merge_threshold}
+    {}
+
+    /*!\brief Construct from an uncompressed Interleaved Bloom Filter, which is compressed.
+     * \param[in] ibf The uncompressed seqan3::interleaved_bloom_filter.
+     * \param[in] merge_threshold The number of inserted values that triggers a merge; `0` and `1` merge after every
+     *                            insertion. Default: `default_merge_threshold`.
+     */
+    explicit updatable_interleaved_bloom_filter(interleaved_bloom_filter<data_layout::uncompressed> const & ibf,
+                                                size_t const merge_threshold = default_merge_threshold) :
+        updatable_interleaved_bloom_filter{base_t{ibf}, merge_threshold}
+    {}
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    /*!\brief Inserts a value into a specific bin.
+     * \param[in] value The raw numeric value to process.
+     * \param[in] bin The bin index to insert into.
+     *
+     * \details
+     *
+     * Starts a merge in the background if the number of values inserted since the last merge reaches the merge
+     * threshold. If a previous merge is still running, waits for it first.
+     */
+    void emplace(size_t const value, bin_index const bin)
+    {
+        install_merge(false);
+        delta.emplace(value, bin);
+
+        if (++delta_values >= threshold)
+            start_merge();
+    }
+
+    /*!\brief Clears a specific bin.
+     * \param[in] bin The bin index to clear.
+     *
+     * \details
+     *
+     * The bin is cleared in the delta and masked in the base. The bits of the base are cleared by the next merge.
+     */
+    void clear(bin_index const bin)
+    {
+        assert(bin.get() < bin_count());
+
+        install_merge(false);
+        delta.clear(bin);
+        base_mask[bin.get()] = 0;
+
+        if (merging_delta)
+            merging_mask[bin.get()] = 0;
+    }
+
+    /*!\brief Increases the number of bins.
+     * \param[in] new_bins The new number of bins.
+     * \throws std::invalid_argument If passed number of bins is smaller than current number of bins.
+     *
+     * \details
+     *
+     * Merges the delta and resizes the base. This takes time linear in the size of the Interleaved Bloom Filter.
+     * See seqan3::interleaved_bloom_filter::increase_bin_number_to.
+     */
+    void increase_bin_number_to(seqan3::bin_count const new_bins)
+    {
+        if (new_bins.get() < bin_count())
+            throw std::invalid_argument{"The number of new bins must be >= the current number of bins."};
+
+        merge();
+
+        delta_t resized{*base};
+        resized.increase_bin_number_to(new_bins);
+        base = std::make_shared<base_t const>(resized);
+        delta = empty_delta();
+        base_mask = sdsl::bit_vector(new_bins.get(), 1);
+    }
+
+    /*!\brief Merges the delta into the base and waits for the merge to finish.
+     *
+     * \details
+     *
+     * Afterwards, the delta is empty and seqan3::updatable_interleaved_bloom_filter::compressed_ibf contains all
+     * values.
+     */
+    void merge()
+    {
+        install_merge(true);
+
+        if (delta_values > 0u || has_cleared_bins())
+            start_merge();
+
+        install_merge(true);
+    }
+
+    //!\brief Waits for a running merge to finish and installs its result.
+    void wait_for_merge()
+    {
+        install_merge(true);
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Returns a seqan3::updatable_interleaved_bloom_filter::membership_agent_type to be used for lookup.
+     * \attention Calling any modifying member function invalidates all agents.
+     */
+    membership_agent_type membership_agent() const;
+
+    /*!\brief Returns a seqan3::updatable_interleaved_bloom_filter::counting_agent_type to be used for counting.
+     * \attention Calling any modifying member function invalidates all agents.
+     */
+    template <typename value_t = uint16_t>
+    counting_agent_type<value_t> counting_agent() const;
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of bins that the Interleaved Bloom Filter manages.
+    size_t bin_count() const noexcept
+    {
+        return base->bin_count();
+    }
+
+    //!\brief Returns the size of a single bin that the Interleaved Bloom Filter manages.
+    size_t bin_size() const noexcept
+    {
+        return base->bin_size();
+    }
+
+    //!\brief Returns the number of hash functions used in the Interleaved Bloom Filter.
+    size_t hash_function_count() const noexcept
+    {
+        return base->hash_function_count();
+    }
+
+    //!\brief Returns the number of values inserted since the last merge was started.
+    size_t delta_size() const noexcept
+    {
+        return delta_values;
+    }
+
+    //!\brief Returns the number of inserted values that triggers a merge.
+    size_t merge_threshold() const noexcept
+    {
+        return threshold;
+    }
+
+    //!\brief Returns whether a merge is running in the background or has finished but was not installed yet.
+    bool merge_pending() const noexcept
+    {
+        return pending_merge.valid();
+    }
+    //!\}
+
+    /*!\name Access
+     * \{
+     */
+    /*!\brief Returns the compressed base.
+     *
+     * \details
+     *
+     * Call seqan3::updatable_interleaved_bloom_filter::merge before to include all modifications, e.g. to serialise
+     * the compressed Interleaved Bloom Filter.
+     */
+    interleaved_bloom_filter<data_layout::compressed> const & compressed_ibf() const noexcept
+    {
+        return *base;
+    }
+    //!\}
+};
+
+/*!\brief Manages membership queries for the seqan3::updatable_interleaved_bloom_filter.
+ * \details
+ *
+ * Combines the results of the base, the delta and a delta that is being merged.
+ */
+class updatable_interleaved_bloom_filter::membership_agent_type
+{
+public:
+    //!\brief The type of the result.
+    using binning_bitvector = delta_t::membership_agent_type::binning_bitvector;
+
+private:
+    //!\brief The agent of the base.
+    base_t::membership_agent_type base_agent{};
+    //!\brief The agent of the delta.
+    delta_t::membership_agent_type delta_agent{};
+    //!\brief The agent of the delta that is being merged.
+    std::optional<delta_t::membership_agent_type> merging_delta_agent{};
+    //!\brief A pointer to the augmented seqan3::updatable_interleaved_bloom_filter.
+    updatable_interleaved_bloom_filter const * uibf_ptr{nullptr};
+    //!\brief Stores the result of bulk_contains().
+    binning_bitvector result_buffer{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    membership_agent_type() = default;                                          //!< Defaulted.
+    membership_agent_type(membership_agent_type const &) = default;             //!< Defaulted.
+    membership_agent_type & operator=(membership_agent_type const &) = default; //!< Defaulted.
+    membership_agent_type(membership_agent_type &&) = default;                  //!< Defaulted.
+    membership_agent_type & operator=(membership_agent_type &&) = default;      //!< Defaulted.
+    ~membership_agent_type() = default;                                         //!< Defaulted.
+
+    /*!\brief Construct a membership_agent_type for an existing seqan3::updatable_interleaved_bloom_filter.
+     * \private
+     * \param uibf The seqan3::updatable_interleaved_bloom_filter.
+     */
+    explicit membership_agent_type(updatable_interleaved_bloom_filter const & uibf) :
+        base_agent{uibf.base->membership_agent()},
+        delta_agent{uibf.delta.membership_agent()},
+        uibf_ptr{std::addressof(uibf)},
+        result_buffer(uibf.bin_count())
+    {
+        if (uibf.merging_delta)
+            merging_delta_agent = uibf.merging_delta->membership_agent();
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Determines set membership of a given value.
+     * \param[in] value The raw value to process.
+     * \returns A seqan3::updatable_interleaved_bloom_filter::membership_agent_type::binning_bitvector.
+     *
+     * \details
+     *
+     * See seqan3::interleaved_bloom_filter::membership_agent_type::bulk_contains.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::updatable_interleaved_bloom_filter::membership_agent_type for each thread.
+     */
+    [[nodiscard]] binning_bitvector const & bulk_contains(size_t const value) & noexcept
+    {
+        assert(uibf_ptr != nullptr);
+
+        uint64_t * const result = result_buffer.raw_data().data();
+        uint64_t const * const delta_words = delta_agent.bulk_contains(value).raw_data().data();
+        uint64_t const * const base_words = base_agent.bulk_contains(value).raw_data().data();
+        uint64_t const * const mask_words = uibf_ptr->base_mask.data();
+        size_t const words = (result_buffer.size() + 63u) >> 6;
+
+        for (size_t i = 0; i < words; ++i)
+            result[i] = delta_words[i] | (base_words[i] & mask_words[i]);
+
+        if (merging_delta_agent)
+        {
+            uint64_t const * const merging_words = merging_delta_agent->bulk_contains(value).raw_data().data();
+            uint64_t const * const merging_mask_words = uibf_ptr->merging_mask.data();
+
+            for (size_t i = 0; i < words; ++i)
+                result[i] |= merging_words[i] & merging_mask_words[i];
+        }
+
+        return result_buffer;
+    }
+
+    // `bulk_contains` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    [[nodiscard]] binning_bitvector const & bulk_contains(size_t const value) && noexcept = delete;
+    //!\}
+};
+
+/*!\brief Manages counting ranges of values for the seqan3::updatable_interleaved_bloom_filter.
+ * \tparam value_t The type of the counts.
+ */
+template <std::integral value_t>
+class updatable_interleaved_bloom_filter::counting_agent_type
+{
+private:
+    //!\brief Determines the membership of each value.
+    membership_agent_type membership_agent{};
+    //!\brief Stores the result of bulk_count().
+    counting_vector<value_t> result_buffer{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    counting_agent_type() = default;                                        //!< Defaulted.
+    counting_agent_type(counting_agent_type const &) = default;             //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type const &) = default; //!< Defaulted.
+    counting_agent_type(counting_agent_type &&) = default;                  //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type &&) = default;      //!< Defaulted.
+    ~counting_agent_type() = default;                                       //!< Defaulted.
+
+    /*!\brief Construct a counting_agent_type for an existing seqan3::updatable_interleaved_bloom_filter.
+     * \private
+     * \param uibf The seqan3::updatable_interleaved_bloom_filter.
+     */
+    explicit counting_agent_type(updatable_interleaved_bloom_filter const & uibf) :
+        membership_agent{uibf},
+        result_buffer(uibf.bin_count())
+    {}
+    //!\}
+
+    /*!\name Counting
+     * \{
+     */
+    /*!\brief Counts the occurrences in each bin for all values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::input_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     *
+     * \details
+     *
+     * See seqan3::interleaved_bloom_filter::counting_agent_type::bulk_count.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::updatable_interleaved_bloom_filter::counting_agent_type for each thread.
+     */
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] counting_vector<value_t> const & bulk_count(value_range_t && values) & noexcept
+    {
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        std::ranges::fill(result_buffer, 0);
+
+        for (auto && value : values)
+            result_buffer += membership_agent.bulk_contains(value);
+
+        return result_buffer;
+    }
+
+    // `bulk_count` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] counting_vector<value_t> const & bulk_count(value_range_t && values) && noexcept = delete;
+    //!\}
+};
+
+//!\cond
+inline updatable_interleaved_bloom_filter::membership_agent_type
+updatable_interleaved_bloom_filter::membership_agent() const
+{
+    return membership_agent_type{*this};
+}
+
+template <typename value_t>
+inline updatable_interleaved_bloom_filter::counting_agent_type<value_t>
+updatable_interleaved_bloom_filter::counting_agent() const
+{
+    return counting_agent_type<value_t>{*this};
+}
+//!\endcond
+
+} // namespace seqan3
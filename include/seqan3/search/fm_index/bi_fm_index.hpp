@@ -20,6 +20,40 @@
 #include <seqan3/search/fm_index/bi_fm_index_cursor.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
 
+namespace seqan3::detail
+{
+
+/*!\brief The type of the SDSL index for the reversed text of a seqan3::bi_fm_index.
+ * \ingroup search_fm_index
+ * \tparam sdsl_index_t The type of the SDSL index for the original text.
+ *
+ * \details
+ *
+ * The suffix array of the reversed text is never accessed and hence not sampled. By default, a wavelet tree based
+ * index is used. For a seqan3::sdsl_epr_index_type, the reversed text is indexed with the same rank dictionary.
+ */
+template <typename sdsl_index_t>
+struct reverse_sdsl_index
+{
+    //!\brief The type of the SDSL index for the reversed text.
+    using type = sdsl::csa_wt<sdsl_wt_index_type::wavelet_tree_type, // Wavelet tree type
+                              10'000'000,                            // Sampling rate of the suffix array
+                              10'000'000,                            // Sampling rate of the inverse suffix array
+                              sdsl::sa_order_sa_sampling<>,          // Text or SA based sampling for SA
+                              sdsl::isa_sampling<>,                  // Text or ISA based sampling for ISA
+                              sdsl_wt_index_type::alphabet_type>;    // How to represent the alphabet
+};
+
+//!\cond
+template <uint8_t bits_per_symbol, uint32_t sa_sampling_rate>
+struct reverse_sdsl_index<csa_epr<bits_per_symbol, sa_sampling_rate>>
+{
+    using type = csa_epr<bits_per_symbol, 10'000'000>;
+};
+//!\endcond
+
+} // namespace seqan3::detail
+
 namespace seqan3
 {
 
@@ -67,12 +101,7 @@ private:
     using sdsl_index_type = sdsl_index_type_;
 
     //!\brief The type of the underlying SDSL index for the reversed text.
-    using rev_sdsl_index_type = sdsl::csa_wt<sdsl_wt_index_type::wavelet_tree_type, // Wavelet tree type
-                                             10'000'000,                            // Sampling rate of the suffix array
-                                             10'000'000,                   // Sampling rate of the inverse suffix array
-                                             sdsl::sa_order_sa_sampling<>, // Text or SA based sampling for SA
-                                             sdsl::isa_sampling<>,         // Text or ISA based sampling for ISA
-                                             sdsl_wt_index_type::alphabet_type>; // How to represent the alphabet
+    using rev_sdsl_index_type = typename detail::reverse_sdsl_index<sdsl_index_type>::type;
 
     /*!\brief The type of the reduced alphabet type. (The reduced alphabet might be smaller than the original alphabet
      *        in case not all possible characters occur in the indexed text.)
@@ -99,8 +128,13 @@ private:
      *        The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
      * \param[in] text The text to construct from.
+     * \param[in] options The seqan3::fm_index_construction_options.
      *
      * \details
+     *
+     * The forward and the reverse index are constructed one after another, each using all threads. This keeps the
+     * peak memory consumption at that of a single seqan3::fm_index construction.
+     *
      * \if DEV
      * \todo This has to be better implemented with regard to the memory peak due to not matching interfaces
      *       with the SDSL.
@@ -115,12 +149,12 @@ private:
      * No guarantee. \if DEV \todo Ensure strong exception guarantee. \endif
      */
     template <std::ranges::range text_t>
-    void construct(text_t && text)
+    void construct(text_t && text, fm_index_construction_options const & options = {})
     {
         detail::fm_index_validator::validate<alphabet_t, text_layout_mode_>(text);
 
-        fwd_fm = fm_index_type{text};
-        rev_fm = rev_fm_index_type{text};
+        fwd_fm = fm_index_type{text, options};
+        rev_fm = rev_fm_index_type{text, options};
     }
 
 public:
@@ -172,6 +206,22 @@ public:
     {
         construct(std::forward<text_t>(text));
     }
+
+    /*!\brief Constructor that immediately constructs the index given a range and construction options.
+     * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
+     * \param[in] text The text to construct from.
+     * \param[in] options The seqan3::fm_index_construction_options.
+     * \throws std::invalid_argument If `options.threads` is 0 or `options.tmp_directory` does not exist.
+     *
+     * ### Complexity
+     *
+     * \if DEV \todo \endif At least linear.
+     */
+    template <std::ranges::range text_t>
+    bi_fm_index(text_t && text, fm_index_construction_options const & options)
+    {
+        construct(std::forward<text_t>(text), options);
+    }
     //!\}
 
     /*!\brief Returns the length of the indexed text including sentinel characters.
@@ -296,6 +346,11 @@ public:
 //!\brief Deduces the dimensions of the text.
 template <std::ranges::range text_t>
 bi_fm_index(text_t &&) -> bi_fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
+
+//!\brief Deduces the dimensions of the text.
+template <std::ranges::range text_t>
+bi_fm_index(text_t &&, fm_index_construction_options const &)
+    -> bi_fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
 //!\}
 
 } // namespace seqan3
@@ -73,6 +73,12 @@ public:
                                                 typename index_type::sdsl_index_type>>;
     //!\}
 
+    /*!\brief Whether locate() resolves all occurrences together, i.e. the SDSL index models
+     *        seqan3::detail::sdsl_index_with_interval_locate.
+     * \noapi{Used by seqan3::search to choose between locate() and lazy_locate().}
+     */
+    static constexpr bool locates_interval = detail::sdsl_index_with_interval_locate<typename index_t::sdsl_index_type>;
+
 private:
     //!\brief Type of the representation of characters in the underlying SDSL index.
     using sdsl_char_type = typename index_type::sdsl_char_type;
@@ -244,6 +250,60 @@ private:
         return false;
     }
 
+    /*!\brief Bidirectional search of the smallest character `c' >= c` that occurs in the interval
+     *        `[l_parent, r_parent]`.
+     * \tparam cycle Whether the search replaces the last character (cycle_back(), cycle_front()) or extends the query
+     *               (extend_right(), extend_left()).
+     * \returns `c'`, or `sigma` if there is no such character. If `c'` is found, the intervals are set to its
+     *          intervals.
+     *
+     * \details
+     *
+     * Used instead of calling bidirectional_search() or bidirectional_search_cycle() for every character if the SDSL
+     * index models seqan3::detail::sdsl_index_with_rank_all. The ranks of all characters are computed with two
+     * queries.
+     */
+    template <bool cycle, typename csa_t>
+        requires (std::same_as<csa_t, typename index_type::sdsl_index_type>
+                  || std::same_as<csa_t, typename index_type::rev_sdsl_index_type>)
+    sdsl_char_type bidirectional_search_all(csa_t const & csa,
+                                            sdsl_char_type c,
+                                            size_type const l_parent,
+                                            size_type const r_parent,
+                                            size_type & l_fwd,
+                                            size_type & r_fwd,
+                                            size_type & l_bwd,
+                                            size_type & r_bwd) const noexcept
+    {
+        assert((l_parent <= r_parent) && (r_parent < csa.size()));
+
+        auto const ranks_l = csa.bwt.rank_all(l_parent);
+        auto const ranks_r = csa.bwt.rank_all(r_parent + 1);
+
+        // The backward interval of the next character starts after the current one (cycle) or after the intervals of
+        // all smaller characters (extend).
+        size_type new_l_bwd = r_bwd + 1;
+        if constexpr (!cycle)
+        {
+            new_l_bwd = l_bwd;
+            for (sdsl_char_type smaller = 0; smaller < c; ++smaller)
+                new_l_bwd += ranks_r[smaller] - ranks_l[smaller];
+        }
+
+        for (; c < sigma; ++c)
+        {
+            if (size_type const count = ranks_r[c] - ranks_l[c]; count > 0)
+            {
+                l_fwd = csa.C[c] + ranks_l[c];
+                r_fwd = l_fwd + count - 1;
+                l_bwd = new_l_bwd;
+                r_bwd = new_l_bwd + count - 1;
+                break;
+            }
+        }
+        return c;
+    }
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -339,15 +399,22 @@ public:
         size_type new_parent_lb = fwd_lb, new_parent_rb = fwd_rb;
 
         sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
-        while (c < sigma
-               && !bidirectional_search(index->fwd_fm.index,
-                                        index->fwd_fm.index.comp2char[c],
-                                        fwd_lb,
-                                        fwd_rb,
-                                        rev_lb,
-                                        rev_rb))
+        if constexpr (detail::sdsl_index_with_rank_all<typename index_type::sdsl_index_type>)
         {
-            ++c;
+            c = bidirectional_search_all<false>(index->fwd_fm.index, c, fwd_lb, fwd_rb, fwd_lb, fwd_rb, rev_lb, rev_rb);
+        }
+        else
+        {
+            while (c < sigma
+                   && !bidirectional_search(index->fwd_fm.index,
+                                            index->fwd_fm.index.comp2char[c],
+                                            fwd_lb,
+                                            fwd_rb,
+                                            rev_lb,
+                                            rev_rb))
+            {
+                ++c;
+            }
         }
 
         if (c != sigma)
@@ -391,15 +458,22 @@ public:
         size_type new_parent_lb = rev_lb, new_parent_rb = rev_rb;
 
         sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
-        while (c < sigma
-               && !bidirectional_search(index->rev_fm.index,
-                                        index->rev_fm.index.comp2char[c],
-                                        rev_lb,
-                                        rev_rb,
-                                        fwd_lb,
-                                        fwd_rb))
+        if constexpr (detail::sdsl_index_with_rank_all<typename index_type::rev_sdsl_index_type>)
         {
-            ++c;
+            c = bidirectional_search_all<false>(index->rev_fm.index, c, rev_lb, rev_rb, rev_lb, rev_rb, fwd_lb, fwd_rb);
+        }
+        else
+        {
+            while (c < sigma
+                   && !bidirectional_search(index->rev_fm.index,
+                                            index->rev_fm.index.comp2char[c],
+                                            rev_lb,
+                                            rev_rb,
+                                            fwd_lb,
+                                            fwd_rb))
+            {
+                ++c;
+            }
         }
 
         if (c != sigma)
@@ -653,6 +727,21 @@ public:
         return true;
     }
 
+    /*!\cond DEV
+     * \brief Prefetches the memory that the next extension to the right accesses.
+     *
+     * \details
+     *
+     * Does not change the cursor. Used to overlap the cache misses of multiple cursors, see
+     * seqan3::detail::prefetch_backward_search.
+     */
+    void prefetch_extend_right() const noexcept
+    {
+        assert(index != nullptr);
+        detail::prefetch_backward_search(index->fwd_fm.index, fwd_lb, fwd_rb);
+    }
+    //!\endcond
+
     /*!\brief Tries to replace the rightmost character of the query by the next lexicographically larger character such
      *        that the query is found in the text.
      *        \if DEV
@@ -690,17 +779,31 @@ public:
 
         sdsl_char_type c = _last_char + 1;
 
-        while (c < sigma
-               && !bidirectional_search_cycle(index->fwd_fm.index,
-                                              index->fwd_fm.index.comp2char[c],
-                                              parent_lb,
-                                              parent_rb,
-                                              fwd_lb,
-                                              fwd_rb,
-                                              rev_lb,
-                                              rev_rb))
+        if constexpr (detail::sdsl_index_with_rank_all<typename index_type::sdsl_index_type>)
         {
-            ++c;
+            c = bidirectional_search_all<true>(index->fwd_fm.index,
+                                               c,
+                                               parent_lb,
+                                               parent_rb,
+                                               fwd_lb,
+                                               fwd_rb,
+                                               rev_lb,
+                                               rev_rb);
+        }
+        else
+        {
+            while (c < sigma
+                   && !bidirectional_search_cycle(index->fwd_fm.index,
+                                                  index->fwd_fm.index.comp2char[c],
+                                                  parent_lb,
+                                                  parent_rb,
+                                                  fwd_lb,
+                                                  fwd_rb,
+                                                  rev_lb,
+                                                  rev_rb))
+            {
+                ++c;
+            }
         }
 
         if (c != sigma)
@@ -748,17 +851,31 @@ public:
         assert(index != nullptr && query_length() > 0);
 
         sdsl_char_type c = _last_char + 1;
-        while (c < sigma
-               && !bidirectional_search_cycle(index->rev_fm.index,
-                                              index->rev_fm.index.comp2char[c],
-                                              parent_lb,
-                                              parent_rb,
-                                              rev_lb,
-                                              rev_rb,
-                                              fwd_lb,
-                                              fwd_rb))
+        if constexpr (detail::sdsl_index_with_rank_all<typename index_type::rev_sdsl_index_type>)
+        {
+            c = bidirectional_search_all<true>(index->rev_fm.index,
+                                               c,
+                                               parent_lb,
+                                               parent_rb,
+                                               rev_lb,
+                                               rev_rb,
+                                               fwd_lb,
+                                               fwd_rb);
+        }
+        else
         {
-            ++c;
+            while (c < sigma
+                   && !bidirectional_search_cycle(index->rev_fm.index,
+                                                  index->rev_fm.index.comp2char[c],
+                                                  parent_lb,
+                                                  parent_rb,
+                                                  rev_lb,
+                                                  rev_rb,
+                                                  fwd_lb,
+                                                  fwd_rb))
+            {
+                ++c;
+            }
         }
 
         if (c != sigma)
@@ -786,7 +903,7 @@ public:
      *
      * No-throw guarantee.
      */
-    size_type last_rank() noexcept
+    size_type last_rank() const noexcept
     {
         assert(index != nullptr && query_length() > 0);
 
@@ -938,6 +1055,10 @@ public:
      *
      * \f$count() * O(T_{BACKWARD\_SEARCH} * SAMPLING\_RATE)\f$
      *
+     * If the underlying SDSL index can locate an interval of the suffix array at once (e.g.
+     * seqan3::sdsl_epr_index_type), all occurrences are resolved together and the LF mapping steps are computed once
+     * per interval instead of once per occurrence.
+     *
      * ### Exceptions
      *
      * Strong exception guarantee (no data is modified in case an exception is thrown).
@@ -949,10 +1070,13 @@ public:
 
         locate_result_type occ{};
         occ.reserve(count());
-        for (size_type i = 0; i < count(); ++i)
-        {
-            occ.emplace_back(0, offset() - index->fwd_fm.index[fwd_lb + i]);
-        }
+        detail::for_each_suffix_array_entry(index->fwd_fm.index,
+                                            fwd_lb,
+                                            count(),
+                                            [&occ, _offset = offset()](size_type const entry)
+                                            {
+                                                occ.emplace_back(0, _offset - entry);
+                                            });
         return occ;
     }
 
@@ -964,13 +1088,17 @@ public:
 
         std::vector<std::pair<size_type, size_type>> occ;
         occ.reserve(count());
-        for (size_type i = 0; i < count(); ++i)
-        {
-            size_type loc = offset() - index->fwd_fm.index[fwd_lb + i];
-            size_type sequence_rank = index->fwd_fm.text_begin_rs.rank(loc + 1);
-            size_type sequence_position = loc - index->fwd_fm.text_begin_ss.select(sequence_rank);
-            occ.emplace_back(sequence_rank - 1, sequence_position);
-        }
+        detail::for_each_suffix_array_entry(index->fwd_fm.index,
+                                            fwd_lb,
+                                            count(),
+                                            [this, &occ, _offset = offset()](size_type const entry)
+                                            {
+                                                size_type loc = _offset - entry;
+                                                size_type sequence_rank = index->fwd_fm.text_begin_rs.rank(loc + 1);
+                                                size_type sequence_position =
+                                                    loc - index->fwd_fm.text_begin_ss.select(sequence_rank);
+                                                occ.emplace_back(sequence_rank - 1, sequence_position);
+                                            });
         return occ;
     }
 
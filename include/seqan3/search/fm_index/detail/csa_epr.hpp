@@ -0,0 +1,389 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::csa_epr.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <sdsl/suffix_trees.hpp>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/search/fm_index/detail/epr_dictionary.hpp>
+
+#if SEQAN3_WITH_CEREAL
+#    include <cereal/types/array.hpp>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief A compressed suffix array of the SDSL interface that stores the Burrows-Wheeler transform in a
+ *        seqan3::detail::epr_dictionary.
+ * \ingroup search_fm_index
+ * \tparam bits_per_symbol  The number of bits per symbol of the seqan3::detail::epr_dictionary; must be 2 or 3.
+ * \tparam sa_sampling_rate Every `sa_sampling_rate`-th entry of the suffix array is sampled.
+ * \implements seqan3::detail::sdsl_index
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * Provides the members of the `sdsl::csa_wt` that are used by the seqan3::fm_index and its cursors: `bwt.rank`,
+ * `wavelet_tree.lex_count`, `C`, `sigma`, `comp2char`, `char2comp` and the access to the suffix array.
+ * Both `bwt` and `wavelet_tree` refer to the same dictionary, which additionally provides `rank_all` for the
+ * cursors.
+ *
+ * The index is constructed by the SDSL (`sdsl::construct` and `sdsl::construct_im`): the SDSL computes the suffix
+ * array and the Burrows-Wheeler transform and passes them via its cache to the constructor of this class.
+ * The characters are not mapped to a contiguous range, i.e. `comp2char` and `char2comp` are the identity.
+ */
+template <uint8_t bits_per_symbol, uint32_t sa_sampling_rate>
+class csa_epr
+{
+    static_assert(sa_sampling_rate > 0u, "The sampling rate of the suffix array must be greater than 0.");
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The SDSL index category.
+    using index_category = sdsl::csa_tag;
+    //!\brief The SDSL alphabet category.
+    using alphabet_category = sdsl::byte_alphabet_tag;
+    //!\brief The alphabet strategy; characters are not remapped.
+    using alphabet_type = sdsl::plain_byte_alphabet;
+    //!\brief The type of sizes and positions.
+    using size_type = uint64_t;
+    //!\brief The type of the suffix array entries.
+    using value_type = uint64_t;
+    //!\brief The character type.
+    using char_type = uint8_t;
+    //!\brief The type of the rank dictionary over the Burrows-Wheeler transform.
+    using dictionary_type = epr_dictionary<bits_per_symbol>;
+    //!\}
+
+private:
+    //!\brief Maps every character to itself. Used for `comp2char` and `char2comp`.
+    struct identity_map
+    {
+        //!\brief Returns `chr`.
+        uint8_t operator[](size_type const chr) const noexcept
+        {
+            return chr;
+        }
+    };
+
+    //!\brief The Burrows-Wheeler transform.
+    dictionary_type m_bwt{};
+    //!\brief The sampled suffix array entries.
+    sdsl::int_vector<> m_samples{};
+    //!\brief The number of characters smaller than each character.
+    std::array<size_type, 257> m_C{};
+    //!\brief The largest character plus one.
+    uint16_t m_sigma{};
+
+public:
+    //!\brief The Burrows-Wheeler transform.
+    dictionary_type const & bwt = m_bwt;
+    //!\brief The Burrows-Wheeler transform; named like the wavelet tree of the `sdsl::csa_wt`.
+    dictionary_type const & wavelet_tree = m_bwt;
+    //!\brief The number of characters smaller than each character.
+    std::array<size_type, 257> const & C = m_C;
+    //!\brief The largest character plus one.
+    uint16_t const & sigma = m_sigma;
+    //!\brief Maps the compact characters to characters; the identity.
+    identity_map const comp2char{};
+    //!\brief Maps the characters to compact characters; the identity.
+    identity_map const char2comp{};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    csa_epr() = default; //!< Defaulted.
+
+    //!\brief Copy constructor. The references refer to the members of the copy.
+    csa_epr(csa_epr const & other) :
+        m_bwt{other.m_bwt},
+        m_samples{other.m_samples},
+        m_C{other.m_C},
+        m_sigma{other.m_sigma}
+    {}
+
+    //!\brief Move constructor. The references refer to the members of the moved-to object.
+    csa_epr(csa_epr && other) noexcept :
+        m_bwt{std::move(other.m_bwt)},
+        m_samples{std::move(other.m_samples)},
+        m_C{other.m_C},
+        m_sigma{other.m_sigma}
+    {}
+
+    //!\brief Copy assignment.
+    csa_epr & operator=(csa_epr const & other)
+    {
+        csa_epr tmp{other};
+        swap(tmp);
+        return *this;
+    }
+
+    //!\brief Move assignment.
+    csa_epr & operator=(csa_epr && other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~csa_epr() = default; //!< Defaulted.
+
+    /*!\brief Constructs the index from the Burrows-Wheeler transform and the suffix array in the cache of the SDSL.
+     * \param[in] config The SDSL cache configuration; must contain `sdsl::conf::KEY_BWT` and `sdsl::conf::KEY_SA`.
+     * \throws std::invalid_argument If the text contains characters greater than `2^bits_per_symbol`.
+     *
+     * \details
+     *
+     * This constructor is called by the SDSL construction (`sdsl::construct`).
+     */
+    explicit csa_epr(sdsl::cache_config & config)
+    {
+        {
+            sdsl::int_vector_buffer<8> bwt_buffer(sdsl::cache_file_name(sdsl::conf::KEY_BWT, config));
+            m_bwt = dictionary_type{bwt_buffer};
+        }
+
+        size_type const text_size = m_bwt.size();
+        auto const occurrences = m_bwt.rank_all(text_size);
+
+        for (size_t chr = 0; chr < occurrences.size(); ++chr)
+        {
+            if (occurrences[chr] > 0u)
+                m_sigma = chr + 1u;
+        }
+
+        for (size_t chr = 0; chr < 256u; ++chr)
+            m_C[chr + 1u] = m_C[chr] + (chr < occurrences.size() ? occurrences[chr] : 0u);
+
+        sdsl::int_vector_buffer<> suffix_array(sdsl::cache_file_name(sdsl::conf::KEY_SA, config));
+        m_samples = sdsl::int_vector<>((text_size + sa_sampling_rate - 1u) / sa_sampling_rate,
+                                       0u,
+                                       sdsl::bits::hi(text_size) + 1u);
+
+        for (size_type i = 0; i < text_size; i += sa_sampling_rate)
+            m_samples[i / sa_sampling_rate] = suffix_array[i];
+    }
+    //!\}
+
+    //!\brief Swaps the content with `other`. Used by the SDSL construction.
+    void swap(csa_epr & other) noexcept
+    {
+        std::swap(m_bwt, other.m_bwt);
+        std::swap(m_samples, other.m_samples);
+        std::swap(m_C, other.m_C);
+        std::swap(m_sigma, other.m_sigma);
+    }
+
+    //!\brief Returns the length of the indexed text including the sentinel.
+    size_type size() const noexcept
+    {
+        return m_bwt.size();
+    }
+
+    /*!\brief Returns the `i`-th entry of the suffix array.
+     * \param[in] i The position in the suffix array; must be smaller than size().
+     *
+     * \details
+     *
+     * Applies the LF mapping until a sampled entry or the beginning of the text is reached, i.e. at most
+     * `sa_sampling_rate - 1` times.
+     */
+    value_type operator[](size_type i) const noexcept
+    {
+        assert(i < size());
+
+        value_type offset{};
+        while (i % sa_sampling_rate != 0u)
+        {
+            auto const [rank, chr] = m_bwt.inverse_select(i);
+            if (chr == 0u) // The suffix starts at the beginning of the text.
+                return offset;
+
+            i = m_C[chr] + rank;
+            ++offset;
+        }
+        return m_samples[i / sa_sampling_rate] + offset;
+    }
+
+    /*!\brief Writes the entries `[lb, lb + entries.size())` of the suffix array to `entries`.
+     * \param[in] lb The first position in the suffix array.
+     * \param[out] entries The suffix array entries; `lb + entries.size()` must not be greater than size().
+     *
+     * \details
+     *
+     * Resolves all entries of the interval together instead of applying the LF mapping to every entry on its own.
+     * The LF mapping maps the entries of an interval with the same character in the Burrows-Wheeler transform to an
+     * interval again. Hence, each step scans the intervals sequentially and computes the ranks only once per interval,
+     * instead of once per entry at a random position. The intervals are split by character and shrink as their
+     * entries are resolved. An entry is resolved once it is sampled or reaches the beginning of the text. The entries
+     * of an interval that is left with a single entry are resolved together at the end; the LF mapping is applied to all
+     * of them in lock-step to hide the latency of the memory accesses.
+     */
+    void locate(size_type const lb, std::span<value_type> const entries) const
+    {
+        assert(lb + entries.size() <= size());
+
+        constexpr size_t char_count = dictionary_type::max_char + 1u;
+        constexpr size_type resolved = std::numeric_limits<size_type>::max();
+
+        // The entry at position `sa_begin + j` belongs to `entries[slots[slot_begin + j]]` or is already resolved.
+        struct interval_type
+        {
+            size_type sa_begin;
+            size_type slot_begin;
+            size_type length;
+        };
+
+        // An entry that is not resolved in the current step and its position after the LF mapping.
+        struct pending_type
+        {
+            size_type position;
+            size_type slot;
+            char_type chr;
+        };
+
+        // A single entry that is resolved on its own.
+        struct walker_type
+        {
+            size_type position;
+            size_type slot;
+            value_type offset;
+        };
+
+        std::vector<size_type> slots(entries.size());
+        std::iota(slots.begin(), slots.end(), size_type{});
+        std::vector<interval_type> intervals{{lb, 0u, entries.size()}};
+
+        std::vector<size_type> next_slots{};
+        std::vector<interval_type> next_intervals{};
+        std::vector<pending_type> pending{};
+        std::vector<walker_type> walkers{};
+
+        for (value_type offset = 0; !intervals.empty(); ++offset)
+        {
+            next_slots.clear();
+            next_intervals.clear();
+
+            for (interval_type const & interval : intervals)
+            {
+                std::array<size_type, char_count> ranks = m_bwt.rank_all(interval.sa_begin);
+                std::array<size_type, char_count> first{};
+                std::array<size_type, char_count> last{};
+                first.fill(resolved);
+                pending.clear();
+
+                for (size_type j = 0; j < interval.length; ++j)
+                {
+                    size_type const i = interval.sa_begin + j;
+                    char_type const chr = m_bwt[i];
+                    size_type const position = m_C[chr] + ranks[chr]++;
+                    size_type const slot = slots[interval.slot_begin + j];
+
+                    if (slot == resolved)
+                        continue;
+
+                    if (i % sa_sampling_rate == 0u)
+                        entries[slot] = m_samples[i / sa_sampling_rate] + offset;
+                    else if (chr == 0u) // The suffix starts at the beginning of the text.
+                        entries[slot] = offset;
+                    else
+                    {
+                        first[chr] = std::min(first[chr], position);
+                        last[chr] = position;
+                        pending.push_back({position, slot, chr});
+                    }
+                }
+
+                // One interval per character from the first to the last pending entry. A single entry does not share
+                // any LF steps with other entries and is resolved on its own.
+                std::array<size_type, char_count> slot_begin{};
+                for (size_t chr = 0; chr < char_count; ++chr)
+                {
+                    if (first[chr] == resolved || first[chr] == last[chr])
+                        continue;
+
+                    size_type const length = last[chr] - first[chr] + 1u;
+                    slot_begin[chr] = next_slots.size();
+                    next_intervals.push_back({first[chr], slot_begin[chr], length});
+                    next_slots.resize(next_slots.size() + length, resolved);
+                }
+
+                for (pending_type const & entry : pending)
+                {
+                    if (first[entry.chr] == last[entry.chr])
+                        walkers.push_back({entry.position, entry.slot, offset + 1u});
+                    else
+                        next_slots[slot_begin[entry.chr] + entry.position - first[entry.chr]] = entry.slot;
+                }
+            }
+
+            std::swap(slots, next_slots);
+            std::swap(intervals, next_intervals);
+        }
+
+        // The single entries apply the LF mapping in lock-step, such that the memory accesses of the next step are
+        // prefetched while the other entries are processed.
+        while (!walkers.empty())
+        {
+            size_t active{};
+            for (walker_type walker : walkers)
+            {
+                if (walker.position % sa_sampling_rate == 0u)
+                {
+                    entries[walker.slot] = m_samples[walker.position / sa_sampling_rate] + walker.offset;
+                    continue;
+                }
+
+                auto const [rank, chr] = m_bwt.inverse_select(walker.position);
+                if (chr == 0u) // The suffix starts at the beginning of the text.
+                {
+                    entries[walker.slot] = walker.offset;
+                    continue;
+                }
+
+                walker.position = m_C[chr] + rank;
+                ++walker.offset;
+                m_bwt.prefetch_rank(walker.position);
+                walkers[active++] = walker;
+            }
+            walkers.resize(active);
+        }
+    }
+
+    //!\brief Compares two indices.
+    bool operator==(csa_epr const & rhs) const noexcept
+    {
+        return std::tie(m_bwt, m_samples, m_C, m_sigma) == std::tie(rhs.m_bwt, rhs.m_samples, rhs.m_C, rhs.m_sigma);
+    }
+
+    //!\cond
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(m_bwt, m_samples, m_C, m_sigma);
+    }
+    //!\endcond
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,328 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::epr_dictionary.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/utility/detail/prefetch.hpp>
+
+#if SEQAN3_WITH_CEREAL
+#    include <cereal/types/array.hpp>
+#    include <cereal/types/vector.hpp>
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief An interleaved rank dictionary for the Burrows-Wheeler transform over a small alphabet.
+ * \ingroup search_fm_index
+ * \tparam bits_per_symbol The number of bits used to store a symbol; must be 2 or 3.
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * Stores a sequence over the characters `[0, 2^bits_per_symbol]`, where `0` is the sentinel of the SDSL and may
+ * occur at most once. The characters `c > 0` are stored as `c - 1` using `bits_per_symbol` bit planes; the position
+ * of the sentinel is stored separately.
+ *
+ * The sequence is split into blocks of one cache line each (EPR dictionary). A block stores the number of
+ * occurrences of every character before the block, followed by the bit planes of its symbols. A rank query hence
+ * accesses exactly one cache line and computes the rank within the block with a few popcounts. The block counts are
+ * stored in 16 bits relative to superblocks of 256 blocks, which store the absolute counts.
+ *
+ * | bits_per_symbol | characters | symbols per block | bits per symbol including counts |
+ * |:---------------:|:----------:|:-----------------:|:--------------------------------:|
+ * | 2               | 1 to 4     | 192               | 2.67                             |
+ * | 3               | 1 to 8     | 128               | 4                                |
+ */
+template <uint8_t bits_per_symbol>
+class epr_dictionary
+{
+    static_assert(bits_per_symbol == 2u || bits_per_symbol == 3u, "The EPR dictionary stores 2 or 3 bits per symbol.");
+
+public:
+    //!\brief The type of sizes and ranks.
+    using size_type = uint64_t;
+    //!\brief The type of the stored characters.
+    using value_type = uint8_t;
+
+    //!\brief The largest character that can be stored. The characters `[1, max_char]` are stored in the bit planes.
+    static constexpr size_t max_char = size_t{1u} << bits_per_symbol;
+
+private:
+    //!\brief The number of 64 bit words per bit plane in a block such that a block fits into a cache line.
+    static constexpr size_t words_per_plane = (64u - max_char * sizeof(uint16_t)) / (8u * bits_per_symbol);
+    //!\brief The number of symbols per block.
+    static constexpr size_t block_size = 64u * words_per_plane;
+    //!\brief The number of blocks per superblock, such that the counts of a block fit into 16 bits.
+    static constexpr size_t blocks_per_superblock = std::bit_floor(std::numeric_limits<uint16_t>::max() / block_size);
+
+    static_assert(words_per_plane > 0u);
+
+    //!\brief A block of the dictionary occupying one cache line.
+    struct alignas(64) block_type
+    {
+        //!\brief The occurrences of every stored value before this block, relative to the superblock.
+        std::array<uint16_t, max_char> counts{};
+        //!\brief The bit planes. The `b`-th bit of the `w`-th word of the symbols is stored in `planes[w * bits + b]`.
+        std::array<uint64_t, words_per_plane * bits_per_symbol> planes{};
+
+        //!\brief Compares two blocks.
+        bool operator==(block_type const &) const = default;
+
+        //!\cond
+        template <cereal_archive archive_t>
+        void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+        {
+            archive(counts, planes);
+        }
+        //!\endcond
+    };
+
+    static_assert(sizeof(block_type) == 64u);
+
+    //!\brief The number of stored symbols.
+    size_type text_size{};
+    //!\brief The position of the sentinel; `text_size` if there is none.
+    size_type sentinel_position{};
+    //!\brief The blocks. There is one more block than needed to store the symbols, such that `rank(size())` is valid.
+    std::vector<block_type> blocks{};
+    //!\brief The occurrences of every stored value before each superblock.
+    std::vector<std::array<size_type, max_char>> superblocks{};
+
+    //!\brief Returns a mask with the bits set for all symbols in `word` of `block` that are equal to `value`.
+    static uint64_t match(block_type const & block, size_t const word, size_t const value) noexcept
+    {
+        uint64_t mask = ~uint64_t{};
+        for (size_t bit = 0; bit < bits_per_symbol; ++bit)
+        {
+            uint64_t const plane = block.planes[word * bits_per_symbol + bit];
+            mask &= ((value >> bit) & 1u) ? plane : ~plane;
+        }
+        return mask;
+    }
+
+    //!\brief Returns the occurrences of the stored `value` in `[0, i)`, counting the sentinel as `0`.
+    size_type rank_value(size_type const i, size_t const value) const noexcept
+    {
+        size_type const block_index = i / block_size;
+        block_type const & block = blocks[block_index];
+        size_type count = superblocks[block_index / blocks_per_superblock][value] + block.counts[value];
+
+        size_t const offset = i % block_size;
+        size_t const full_words = offset / 64u;
+        for (size_t word = 0; word < full_words; ++word)
+            count += std::popcount(match(block, word, value));
+
+        return count + std::popcount(match(block, full_words, value) & ((uint64_t{1u} << (offset % 64u)) - 1u));
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    epr_dictionary() = default;                                   //!< Defaulted.
+    epr_dictionary(epr_dictionary const &) = default;             //!< Defaulted.
+    epr_dictionary & operator=(epr_dictionary const &) = default; //!< Defaulted.
+    epr_dictionary(epr_dictionary &&) = default;                  //!< Defaulted.
+    epr_dictionary & operator=(epr_dictionary &&) = default;      //!< Defaulted.
+    ~epr_dictionary() = default;                                  //!< Defaulted.
+
+    /*!\brief Constructs the dictionary from a sequence of characters.
+     * \tparam sequence_t The type of the sequence; must provide `size()` and `operator[]`, e.g. a
+     *                    `sdsl::int_vector_buffer<8>`.
+     * \param[in] sequence The characters to store.
+     * \throws std::invalid_argument If a character is greater than seqan3::detail::epr_dictionary::max_char or if
+     *                               the sentinel `0` occurs more than once.
+     */
+    template <typename sequence_t>
+        requires (!std::same_as<std::remove_cvref_t<sequence_t>, epr_dictionary>)
+    explicit epr_dictionary(sequence_t && sequence) : text_size{sequence.size()}, sentinel_position{text_size}
+    {
+        size_type const block_count = text_size / block_size + 1u;
+        blocks.resize(block_count);
+        superblocks.resize((block_count + blocks_per_superblock - 1u) / blocks_per_superblock);
+
+        std::array<size_type, max_char> totals{};
+
+        for (size_type block_index = 0; block_index < block_count; ++block_index)
+        {
+            std::array<size_type, max_char> & superblock = superblocks[block_index / blocks_per_superblock];
+            if (block_index % blocks_per_superblock == 0u)
+                superblock = totals;
+
+            block_type & block = blocks[block_index];
+            for (size_t value = 0; value < max_char; ++value)
+                block.counts[value] = totals[value] - superblock[value];
+
+            size_type const block_end = std::min<size_type>(text_size, (block_index + 1u) * block_size);
+            for (size_type i = block_index * block_size; i < block_end; ++i)
+            {
+                size_t const chr = sequence[i];
+
+                if (chr > max_char)
+                    throw std::invalid_argument{"The character " + std::to_string(chr)
+                                                + " cannot be stored in an EPR dictionary with "
+                                                + std::to_string(bits_per_symbol) + " bits per symbol."};
+
+                if (chr == 0u)
+                {
+                    if (sentinel_position != text_size)
+                        throw std::invalid_argument{"The sentinel may occur at most once in an EPR dictionary."};
+                    sentinel_position = i;
+                }
+
+                size_t const value = chr == 0u ? 0u : chr - 1u;
+                size_t const offset = i % block_size;
+                ++totals[value];
+
+                for (size_t bit = 0; bit < bits_per_symbol; ++bit)
+                    block.planes[offset / 64u * bits_per_symbol + bit] |= uint64_t{(value >> bit) & 1u} << offset % 64u;
+            }
+        }
+    }
+    //!\}
+
+    //!\brief Returns the number of stored characters.
+    size_type size() const noexcept
+    {
+        return text_size;
+    }
+
+    /*!\brief Returns the character at position `i`.
+     * \param[in] i The position; must be smaller than size().
+     */
+    value_type operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+
+        if (i == sentinel_position)
+            return 0u;
+
+        block_type const & block = blocks[i / block_size];
+        size_t const offset = i % block_size;
+        size_t value{};
+        for (size_t bit = 0; bit < bits_per_symbol; ++bit)
+            value |= ((block.planes[offset / 64u * bits_per_symbol + bit] >> (offset % 64u)) & 1u) << bit;
+
+        return value + 1u;
+    }
+
+    /*!\brief Returns the number of occurrences of `chr` in `[0, i)`.
+     * \param[in] i The end of the prefix; must not be greater than size().
+     * \param[in] chr The character.
+     */
+    size_type rank(size_type const i, value_type const chr) const noexcept
+    {
+        assert(i <= size());
+
+        bool const sentinel_before = i > sentinel_position;
+
+        if (chr == 0u)
+            return sentinel_before;
+        if (chr > max_char)
+            return 0u;
+
+        return rank_value(i, chr - 1u) - (chr == 1u && sentinel_before);
+    }
+
+    /*!\brief Returns the number of occurrences of all characters `[0, max_char]` in `[0, i)`.
+     * \param[in] i The end of the prefix; must not be greater than size().
+     *
+     * \details
+     *
+     * Accesses the same cache line as a single rank() query.
+     */
+    std::array<size_type, max_char + 1u> rank_all(size_type const i) const noexcept
+    {
+        assert(i <= size());
+
+        std::array<size_type, max_char + 1u> ranks{};
+        for (size_t value = 0; value < max_char; ++value)
+            ranks[value + 1u] = rank_value(i, value);
+
+        ranks[0] = i > sentinel_position;
+        ranks[1] -= ranks[0];
+        return ranks;
+    }
+
+    /*!\brief Returns the character at position `i` and its rank.
+     * \param[in] i The position; must be smaller than size().
+     * \returns A pair of `rank(i, c)` and `c`, where `c` is the character at position `i`.
+     */
+    std::pair<size_type, value_type> inverse_select(size_type const i) const noexcept
+    {
+        value_type const chr = (*this)[i];
+        return {rank(i, chr), chr};
+    }
+
+    /*!\brief Counts the characters in `[i, j)` that are smaller and greater than `chr`.
+     * \param[in] i The begin of the interval.
+     * \param[in] j The end of the interval; must not be greater than size().
+     * \param[in] chr The character.
+     * \returns A tuple of `rank(i, chr)`, the number of smaller and the number of greater characters in `[i, j)`.
+     *
+     * \details
+     *
+     * This is the same interface as the `lex_count` of the wavelet trees of the SDSL.
+     */
+    std::tuple<size_type, size_type, size_type>
+    lex_count(size_type const i, size_type const j, value_type const chr) const noexcept
+    {
+        assert(i <= j && j <= size());
+
+        if (chr > max_char)
+            return {0u, j - i, 0u};
+
+        std::array<size_type, max_char + 1u> const ranks_i = rank_all(i);
+        std::array<size_type, max_char + 1u> const ranks_j = rank_all(j);
+
+        size_type smaller{};
+        for (size_t c = 0; c < chr; ++c)
+            smaller += ranks_j[c] - ranks_i[c];
+
+        return {ranks_i[chr], smaller, j - i - smaller - (ranks_j[chr] - ranks_i[chr])};
+    }
+
+    /*!\brief Hints the processor to load the cache line that is accessed by `rank(i, c)` and `rank_all(i)`.
+     * \param[in] i The end of the prefix; must not be greater than size().
+     */
+    void prefetch_rank(size_type const i) const noexcept
+    {
+        prefetch_for_read(blocks.data() + i / block_size);
+    }
+
+    //!\brief Compares two dictionaries.
+    bool operator==(epr_dictionary const &) const = default;
+
+    //!\cond
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(text_size, sentinel_position, blocks, superblocks);
+    }
+    //!\endcond
+};
+
+} // namespace seqan3::detail
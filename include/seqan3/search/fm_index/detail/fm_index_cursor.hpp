@@ -7,15 +7,20 @@
 
 /*!\file
  * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
- * \brief Provides the internal representation of a node of the seqan3::fm_index_cursor.
+ * \brief Provides the internal representation of a node of the seqan3::fm_index_cursor and
+ *        seqan3::detail::prefetch_backward_search.
  */
 
 #pragma once
 
+#include <concepts>
+#include <span>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/utility/detail/prefetch.hpp>
 
 namespace seqan3::detail
 {
@@ -77,4 +82,111 @@ struct fm_index_cursor_node
     //!\endcond
 };
 
+/*!\interface seqan3::detail::sdsl_index_with_rank_all <>
+ * \ingroup search_fm_index
+ * \brief An SDSL index whose Burrows-Wheeler transform can count all characters of a prefix with one query.
+ *
+ * \details
+ *
+ * `bwt.rank_all(i)` returns an array with the ranks of all characters `[0, sigma)` at position `i`, e.g. the
+ * seqan3::detail::csa_epr. The cursors use it to compute the intervals of all children of a node with two queries.
+ * The characters must not be remapped, i.e. `comp2char` and `char2comp` must be the identity.
+ */
+//!\cond
+template <typename t>
+concept sdsl_index_with_rank_all = requires (t const & index, typename t::size_type const i) {
+                                       {
+                                           index.bwt.rank_all(i)[0]
+                                           } -> std::convertible_to<typename t::size_type>;
+                                   };
+//!\endcond
+
+/*!\interface seqan3::detail::sdsl_index_with_interval_locate <>
+ * \ingroup search_fm_index
+ * \brief An SDSL index that can locate an interval of the suffix array at once.
+ *
+ * \details
+ *
+ * `index.locate(lb, entries)` writes the suffix array entries `[lb, lb + entries.size())` to `entries`, e.g.
+ * seqan3::detail::csa_epr::locate.
+ */
+//!\cond
+template <typename t>
+concept sdsl_index_with_interval_locate =
+    requires (t const & index, size_t const lb, std::span<typename t::value_type> const entries) {
+        index.locate(lb, entries);
+    };
+//!\endcond
+
+/*!\brief Prefetches the memory accessed by a backward search step on the suffix array interval `[lb, rb]`.
+ * \ingroup search_fm_index
+ * \tparam sdsl_index_t The type of the SDSL index.
+ * \param[in] index The SDSL index.
+ * \param[in] lb The left bound of the suffix array interval.
+ * \param[in] rb The right bound of the suffix array interval.
+ *
+ * \details
+ *
+ * A backward search step computes the rank of a character at the positions `lb` and `rb + 1` of the
+ * Burrows-Wheeler transform. The rank queries of the wavelet tree start at these positions of the bit vector of the
+ * root node, which is stored first. Only this level can be prefetched, since the positions in the lower levels depend
+ * on the ranks in the upper levels. For a seqan3::detail::epr_dictionary, the two cache lines answering the rank
+ * queries are prefetched.
+ *
+ * This is a no-op if the wavelet tree of the SDSL index does not expose its bit vector.
+ */
+template <typename sdsl_index_t>
+inline void prefetch_backward_search([[maybe_unused]] sdsl_index_t const & index,
+                                     [[maybe_unused]] size_t const lb,
+                                     [[maybe_unused]] size_t const rb) noexcept
+{
+    if constexpr (requires { index.bwt.prefetch_rank(lb); })
+    {
+        index.bwt.prefetch_rank(lb);
+        index.bwt.prefetch_rank(rb + 1);
+    }
+    else if constexpr (requires { index.wavelet_tree.bv.data(); })
+    {
+        auto const * const data = index.wavelet_tree.bv.data();
+        prefetch_for_read(data + (lb >> 6));
+        prefetch_for_read(data + ((rb + 1) >> 6));
+    }
+}
+
+/*!\brief Invokes `callback` on the suffix array entries `[lb, lb + count)` in order.
+ * \ingroup search_fm_index
+ * \tparam sdsl_index_t The type of the SDSL index.
+ * \tparam callback_t The type of the callback; must be invocable with `typename sdsl_index_t::value_type`.
+ * \param[in] index The SDSL index.
+ * \param[in] lb The first position in the suffix array.
+ * \param[in] count The number of entries.
+ * \param[in] callback The callback to invoke for every entry.
+ *
+ * \details
+ *
+ * If the SDSL index can locate an interval of the suffix array at once, e.g. seqan3::detail::csa_epr::locate, all
+ * entries are resolved together. Otherwise, every entry is resolved on its own.
+ */
+template <typename sdsl_index_t, typename callback_t>
+inline void for_each_suffix_array_entry(sdsl_index_t const & index,
+                                        size_t const lb,
+                                        size_t const count,
+                                        callback_t && callback)
+{
+    using value_t = typename sdsl_index_t::value_type;
+
+    if constexpr (sdsl_index_with_interval_locate<sdsl_index_t>)
+    {
+        std::vector<value_t> entries(count);
+        index.locate(lb, std::span<value_t>{entries});
+        for (value_t const entry : entries)
+            callback(entry);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+            callback(index[lb + i]);
+    }
+}
+
 } // namespace seqan3::detail
@@ -0,0 +1,707 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::blockwise_suffix_sorter.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Calls `task(i)` for all `i` in `[0, task_count)` using `thread_count` threads.
+ * \ingroup search_fm_index
+ * \param[in] task_count The number of tasks.
+ * \param[in] thread_count The number of threads to use. The calling thread is one of them.
+ * \param[in] task The function to invoke for every task.
+ *
+ * \details
+ *
+ * The tasks are distributed dynamically. If a task throws, no further tasks are started and the first exception is
+ * rethrown after all threads have finished.
+ */
+template <typename task_t>
+void parallel_for(size_t const task_count, size_t const thread_count, task_t && task)
+{
+    size_t const worker_count = std::clamp<size_t>(thread_count, 1u, std::max<size_t>(task_count, 1u));
+
+    if (worker_count == 1u)
+    {
+        for (size_t i = 0; i < task_count; ++i)
+            task(i);
+        return;
+    }
+
+    std::atomic<size_t> next_task{0u};
+    std::vector<std::exception_ptr> exceptions(worker_count);
+
+    auto worker = [&](size_t const thread_id)
+    {
+        try
+        {
+            for (size_t i = next_task++; i < task_count; i = next_task++)
+                task(i);
+        }
+        catch (...)
+        {
+            exceptions[thread_id] = std::current_exception();
+            next_task = task_count;
+        }
+    };
+
+    std::vector<std::thread> threads{};
+    threads.reserve(worker_count - 1u);
+    for (size_t thread_id = 1u; thread_id < worker_count; ++thread_id)
+        threads.emplace_back(worker, thread_id);
+
+    worker(0u);
+
+    for (auto & thread : threads)
+        thread.join();
+
+    for (auto & exception : exceptions)
+        if (exception)
+            std::rethrow_exception(exception);
+}
+
+/*!\brief Sorts a random access range using multiple threads.
+ * \ingroup search_fm_index
+ * \param[in] first Iterator to the first element.
+ * \param[in] last Iterator behind the last element.
+ * \param[in] comp The comparison function.
+ * \param[in] thread_count The number of threads to use.
+ *
+ * \details
+ *
+ * The range is divided into `thread_count` chunks which are sorted concurrently. The sorted chunks are then merged
+ * pairwise, where all merges of one round are done concurrently.
+ */
+template <std::random_access_iterator iterator_t, typename compare_t>
+void parallel_sort(iterator_t const first, iterator_t const last, compare_t const & comp, size_t const thread_count)
+{
+    size_t const size = std::ranges::distance(first, last);
+    // Chunks should not be tiny, otherwise the overhead of the threads dominates.
+    size_t const chunk_count = std::clamp<size_t>(size / 4096u, 1u, std::max<size_t>(thread_count, 1u));
+
+    if (chunk_count == 1u)
+    {
+        std::sort(first, last, comp);
+        return;
+    }
+
+    std::vector<size_t> bounds(chunk_count + 1u);
+    for (size_t i = 0; i <= chunk_count; ++i)
+        bounds[i] = size * i / chunk_count;
+
+    parallel_for(chunk_count,
+                 thread_count,
+                 [&](size_t const i)
+                 {
+                     std::sort(first + bounds[i], first + bounds[i + 1u], comp);
+                 });
+
+    for (size_t width = 1u; width < chunk_count; width *= 2u)
+    {
+        parallel_for((chunk_count + 2u * width - 1u) / (2u * width),
+                     thread_count,
+                     [&](size_t const i)
+                     {
+                         size_t const left = 2u * width * i;
+                         size_t const middle = std::min(left + width, chunk_count);
+                         size_t const right = std::min(left + 2u * width, chunk_count);
+                         if (middle < right)
+                         {
+                             std::inplace_merge(first + bounds[left],
+                                                first + bounds[middle],
+                                                first + bounds[right],
+                                                comp);
+                         }
+                     });
+    }
+}
+
+/*!\brief The difference cover `{0, ..., 31} ∪ {32, 64, ..., 992}` modulo 1024.
+ * \ingroup search_fm_index
+ *
+ * \details
+ *
+ * A difference cover `D` modulo `v` is a set of integers in `[0, v)` such that every integer in `[0, v)` is the
+ * difference (modulo `v`) of two elements of `D`. The cover `{0, ..., r - 1} ∪ {r, 2r, ..., (r - 1)r}` with `v = r^2`
+ * has `2r - 1` elements.
+ */
+struct difference_cover
+{
+    //!\brief The square root of the modulus.
+    static constexpr size_t root{32u};
+    //!\brief The modulus `v`.
+    static constexpr size_t modulus{root * root};
+    //!\brief The number of elements in the difference cover.
+    static constexpr size_t size{2u * root - 1u};
+    //!\brief Marks elements in `[0, v)` that are not in the difference cover.
+    static constexpr uint16_t not_in_cover{std::numeric_limits<uint16_t>::max()};
+
+    //!\brief The index of an element of `[0, v)` within the difference cover, or `not_in_cover`.
+    std::array<uint16_t, modulus> index{};
+    //!\brief An element `a` of the difference cover with `(a + d) mod v` in the difference cover, for all `d`.
+    std::array<uint16_t, modulus> offset{};
+
+    //!\brief Computes the tables.
+    constexpr difference_cover() noexcept
+    {
+        std::array<uint16_t, size> cover{};
+        for (size_t i = 0; i < root; ++i)
+            cover[i] = i;
+        for (size_t i = 1; i < root; ++i)
+            cover[root - 1u + i] = i * root;
+
+        std::ranges::fill(index, not_in_cover);
+        for (size_t i = 0; i < size; ++i)
+            index[cover[i]] = i;
+
+        // For d = q * root + c, a = (root - q) * root mod v and (a + d) mod v = c are both in the cover.
+        for (size_t d = 0; d < modulus; ++d)
+            offset[d] = (root - d / root) % root * root;
+    }
+};
+
+/*!\brief Sorts the suffixes of a text in blocks of bounded size using multiple threads.
+ * \ingroup search_fm_index
+ *
+ * \details
+ *
+ * This is a blockwise suffix sorter based on a difference cover sample, see
+ * [Kärkkäinen (2007)](https://doi.org/10.1016/j.tcs.2006.12.022).
+ *
+ * ### Difference cover sample
+ *
+ * For a difference cover `D` modulo `v` (see seqan3::detail::difference_cover) and any two text positions `i` and
+ * `j`, there is a `delta < v` such that `(i + delta) mod v` and `(j + delta) mod v` are both in `D`.
+ * If all suffixes that start at positions `p` with `p mod v` in `D` are sorted, two suffixes `i` and `j` can be
+ * compared by comparing their first `delta` characters and, if they are equal, the ranks of the sampled suffixes
+ * `i + delta` and `j + delta`. This bounds the cost of comparing two suffixes by `v` character comparisons,
+ * independent of the length of the longest repeat in the text.
+ *
+ * Here, `v` is 1024 and `D` has 63 elements, i.e. about 6% of all suffixes are sampled.
+ * The sampled suffixes are sorted by prefix doubling.
+ *
+ * ### Blocks
+ *
+ * To bound the memory consumption, the suffix array is computed in blocks: Splitter suffixes are drawn at random and
+ * for each pair of consecutive splitters, all suffixes in between are collected, sorted and passed to a callback.
+ * Each block needs one scan of the text. The suffixes of a block are collected and sorted using multiple threads.
+ *
+ * The text must end with a unique smallest character, e.g. a `0`, that does not occur anywhere else in the text.
+ * The text must outlive the sorter.
+ */
+class blockwise_suffix_sorter
+{
+private:
+    //!\brief The modulus of the difference cover.
+    static constexpr size_t cover_modulus{difference_cover::modulus};
+    //!\brief The number of elements in the difference cover.
+    static constexpr size_t cover_size{difference_cover::size};
+    //!\brief The difference cover tables.
+    static constexpr difference_cover cover{};
+
+    //!\brief The text.
+    std::span<uint8_t const> text{};
+    //!\brief The number of threads to use.
+    size_t thread_count{1u};
+    //!\brief The ranks of the sampled suffixes. Indexed by seqan3::detail::blockwise_suffix_sorter::sample_index.
+    std::vector<size_t> sample_ranks{};
+
+    //!\brief Returns the index of the sampled suffix starting at `position` within `sample_ranks`.
+    static size_t sample_index(size_t const position) noexcept
+    {
+        assert(cover.index[position % cover_modulus] != difference_cover::not_in_cover);
+        return position / cover_modulus * cover_size + cover.index[position % cover_modulus];
+    }
+
+    /*!\brief Compares the first `length` characters of the suffixes starting at `i` and `j`.
+     * \returns A negative value, zero or a positive value, like `std::memcmp`.
+     *
+     * \details
+     *
+     * If one of the suffixes is shorter than `length`, only as many characters as the shorter suffix has are
+     * compared. Because the last character is unique, the result is never zero in this case.
+     */
+    int compare_prefix(size_t const i, size_t const j, size_t const length) const noexcept
+    {
+        size_t const bounded_length = std::min(length, text.size() - std::max(i, j));
+        int const result = std::memcmp(text.data() + i, text.data() + j, bounded_length);
+        assert(result != 0 || bounded_length == length || i == j);
+        return result;
+    }
+
+    //!\brief Sorts the sampled suffixes and stores their ranks in `sample_ranks`.
+    void rank_sample()
+    {
+        std::vector<size_t> positions{};
+        for (size_t position = 0; position < text.size(); ++position)
+            if (cover.index[position % cover_modulus] != difference_cover::not_in_cover)
+                positions.push_back(position);
+
+        sample_ranks.resize((text.size() + cover_modulus - 1u) / cover_modulus * cover_size);
+
+        auto prefix_less = [this](size_t const i, size_t const j)
+        {
+            return compare_prefix(i, j, cover_modulus) < 0;
+        };
+
+        parallel_sort(positions.begin(), positions.end(), prefix_less, thread_count);
+
+        // The rank of a suffix is the index of the first suffix in `positions` that has the same prefix.
+        // Groups of suffixes with the same prefix are stored as [begin, end) in `ties`.
+        std::vector<std::pair<size_t, size_t>> ties{};
+        for (size_t begin = 0, end = 1; begin < positions.size(); begin = end++)
+        {
+            while (end < positions.size() && !prefix_less(positions[begin], positions[end]))
+                ++end;
+
+            for (size_t i = begin; i < end; ++i)
+                sample_ranks[sample_index(positions[i])] = begin;
+
+            if (end - begin > 1u)
+                ties.emplace_back(begin, end);
+        }
+
+        // Prefix doubling: Suffixes with the same prefix of length `h` are sorted by the rank of the suffix `h`
+        // positions later. Since `h` is a multiple of `v`, this suffix is also sampled. Suffixes that share a prefix
+        // of length `h` cannot contain the last character within this prefix, hence, `i + h` is a valid position.
+        std::vector<size_t> keys(positions.size());
+
+        for (size_t h = cover_modulus; !ties.empty(); h *= 2u)
+        {
+            // Separate reading and writing of the ranks, such that the groups can be processed concurrently.
+            parallel_for(ties.size(),
+                         thread_count,
+                         [&](size_t const t)
+                         {
+                             for (size_t i = ties[t].first; i < ties[t].second; ++i)
+                                 keys[i] = sample_ranks[sample_index(positions[i] + h)];
+                         });
+
+            std::vector<std::vector<std::pair<size_t, size_t>>> new_ties(ties.size());
+
+            auto refine = [&](size_t const t, size_t const sort_threads)
+            {
+                auto const [begin, end] = ties[t];
+                std::vector<std::pair<size_t, size_t>> group(end - begin);
+                for (size_t i = begin; i < end; ++i)
+                    group[i - begin] = {keys[i], positions[i]};
+
+                parallel_sort(group.begin(), group.end(), std::less<>{}, sort_threads);
+
+                for (size_t sub_begin = 0, sub_end = 1; sub_begin < group.size(); sub_begin = sub_end++)
+                {
+                    while (sub_end < group.size() && group[sub_end].first == group[sub_begin].first)
+                        ++sub_end;
+
+                    for (size_t i = sub_begin; i < sub_end; ++i)
+                    {
+                        positions[begin + i] = group[i].second;
+                        sample_ranks[sample_index(group[i].second)] = begin + sub_begin;
+                    }
+
+                    if (sub_end - sub_begin > 1u)
+                        new_ties[t].emplace_back(begin + sub_begin, begin + sub_end);
+                }
+            };
+
+            // Large groups, e.g. in highly repetitive texts, are sorted with all threads, one after the other.
+            // Small groups are sorted concurrently.
+            size_t const large_group_size = std::max<size_t>(positions.size() / thread_count, 4096u);
+            std::vector<size_t> small_groups{};
+            for (size_t t = 0; t < ties.size(); ++t)
+            {
+                if (ties[t].second - ties[t].first >= large_group_size)
+                    refine(t, thread_count);
+                else
+                    small_groups.push_back(t);
+            }
+
+            parallel_for(small_groups.size(),
+                         thread_count,
+                         [&](size_t const i)
+                         {
+                             refine(small_groups[i], 1u);
+                         });
+
+            ties.clear();
+            for (auto & group_ties : new_ties)
+                ties.insert(ties.end(), group_ties.begin(), group_ties.end());
+        }
+    }
+
+    /*!\brief Sorts a group of suffixes that share their first `depth` characters by the next 8 characters.
+     * \param[in,out] suffixes The start positions of the suffixes of the group.
+     * \param[in] depth The number of characters that the suffixes share.
+     * \param[in] threads The number of threads to use.
+     * \returns The groups of suffixes that also share the next 8 characters, as `[begin, end)` relative to `suffixes`.
+     *
+     * \details
+     *
+     * The characters are packed into an integer. Sorting these keys avoids accessing the text at random positions
+     * for every comparison.
+     */
+    std::vector<std::pair<size_t, size_t>>
+    sort_by_key(std::span<size_t> const suffixes, size_t const depth, size_t const threads) const
+    {
+        constexpr size_t chunk_size{65536u};
+        std::vector<std::pair<uint64_t, size_t>> keyed_suffixes(suffixes.size());
+
+        parallel_for((suffixes.size() + chunk_size - 1u) / chunk_size,
+                     threads,
+                     [&](size_t const chunk)
+                     {
+                         size_t const end = std::min(suffixes.size(), (chunk + 1u) * chunk_size);
+                         for (size_t i = chunk * chunk_size; i < end; ++i)
+                         {
+                             // Characters behind the end of the text are 0. Only the unique last character is also 0.
+                             uint64_t key{};
+                             for (size_t j = suffixes[i] + depth; j < suffixes[i] + depth + 8u; ++j)
+                                 key = (key << 8) | (j < text.size() ? text[j] : 0u);
+                             keyed_suffixes[i] = {key, suffixes[i]};
+                         }
+                     });
+
+        parallel_sort(keyed_suffixes.begin(), keyed_suffixes.end(), std::less<>{}, threads);
+
+        std::vector<std::pair<size_t, size_t>> ties{};
+        for (size_t begin = 0, end = 1; begin < suffixes.size(); begin = end++)
+        {
+            while (end < suffixes.size() && keyed_suffixes[end].first == keyed_suffixes[begin].first)
+                ++end;
+
+            for (size_t i = begin; i < end; ++i)
+                suffixes[i] = keyed_suffixes[i].second;
+
+            if (end - begin > 1u)
+                ties.emplace_back(begin, end);
+        }
+
+        return ties;
+    }
+
+    /*!\brief Sorts suffixes.
+     * \param[in,out] suffixes The start positions of the suffixes to sort.
+     *
+     * \details
+     *
+     * The suffixes are sorted by their first 8, 16, ..., 64 characters (multikey radix sort with 8 characters per
+     * key), see seqan3::detail::blockwise_suffix_sorter::sort_by_key. Groups of suffixes that share 64 characters,
+     * small groups and groups for which 8 more characters hardly refine the group are sorted with the difference
+     * cover comparison.
+     *
+     * Small groups are sorted concurrently. Large groups, e.g. in highly repetitive texts, are sorted with all
+     * threads, one after the other.
+     */
+    void sort_suffixes(std::vector<size_t> & suffixes) const
+    {
+        constexpr size_t max_key_depth{64u};
+        size_t const large_group_size = std::max<size_t>(suffixes.size() / thread_count, 4096u);
+
+        // Groups of suffixes with the same first `depth` characters, as [begin, end) within `suffixes`.
+        std::vector<std::pair<size_t, size_t>> groups{{0u, suffixes.size()}};
+        std::vector<std::pair<size_t, size_t>> unrefined_groups{};
+
+        for (size_t depth = 0; depth < max_key_depth && !groups.empty(); depth += 8u)
+        {
+            std::vector<std::vector<std::pair<size_t, size_t>>> ties(groups.size());
+
+            auto refine = [&](size_t const g, size_t const threads)
+            {
+                auto const [begin, end] = groups[g];
+                std::span<size_t> const group{suffixes.begin() + begin, suffixes.begin() + end};
+                for (auto [tie_begin, tie_end] : sort_by_key(group, depth, threads))
+                    ties[g].emplace_back(begin + tie_begin, begin + tie_end);
+            };
+
+            std::vector<size_t> small_groups{};
+            for (size_t g = 0; g < groups.size(); ++g)
+            {
+                if (groups[g].second - groups[g].first >= large_group_size)
+                    refine(g, thread_count);
+                else
+                    small_groups.push_back(g);
+            }
+
+            parallel_for(small_groups.size(),
+                         thread_count,
+                         [&](size_t const i)
+                         {
+                             refine(small_groups[i], 1u);
+                         });
+
+            std::vector<std::pair<size_t, size_t>> next_groups{};
+            for (size_t g = 0; g < groups.size(); ++g)
+            {
+                size_t const group_size = groups[g].second - groups[g].first;
+                for (auto const & tie : ties[g])
+                {
+                    // Keys are not worth it for few suffixes or if most suffixes are still tied.
+                    if (tie.second - tie.first < 8u || 10u * (tie.second - tie.first) > 9u * group_size)
+                        unrefined_groups.push_back(tie);
+                    else
+                        next_groups.push_back(tie);
+                }
+            }
+            groups = std::move(next_groups);
+        }
+
+        groups.insert(groups.end(), unrefined_groups.begin(), unrefined_groups.end());
+
+        auto const suffix_less = [this](size_t const i, size_t const j)
+        {
+            return (*this)(i, j);
+        };
+
+        std::vector<size_t> small_groups{};
+        for (size_t g = 0; g < groups.size(); ++g)
+        {
+            if (groups[g].second - groups[g].first >= large_group_size)
+                parallel_sort(suffixes.begin() + groups[g].first,
+                              suffixes.begin() + groups[g].second,
+                              suffix_less,
+                              thread_count);
+            else
+                small_groups.push_back(g);
+        }
+
+        parallel_for(small_groups.size(),
+                     thread_count,
+                     [&](size_t const i)
+                     {
+                         std::sort(suffixes.begin() + groups[small_groups[i]].first,
+                                   suffixes.begin() + groups[small_groups[i]].second,
+                                   suffix_less);
+                     });
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    blockwise_suffix_sorter() = default;                                           //!< Defaulted.
+    blockwise_suffix_sorter(blockwise_suffix_sorter const &) = default;             //!< Defaulted.
+    blockwise_suffix_sorter & operator=(blockwise_suffix_sorter const &) = default; //!< Defaulted.
+    blockwise_suffix_sorter(blockwise_suffix_sorter &&) = default;                  //!< Defaulted.
+    blockwise_suffix_sorter & operator=(blockwise_suffix_sorter &&) = default;      //!< Defaulted.
+    ~blockwise_suffix_sorter() = default;                                           //!< Defaulted.
+
+    /*!\brief Sorts the difference cover sample of the text.
+     * \param[in] text The text. The last character must be unique and smaller than all other characters.
+     * \param[in] thread_count The number of threads to use.
+     * \throws std::invalid_argument If `text` is empty or `thread_count` is 0.
+     */
+    blockwise_suffix_sorter(std::span<uint8_t const> const text, size_t const thread_count) :
+        text{text},
+        thread_count{thread_count}
+    {
+        if (text.empty())
+            throw std::invalid_argument{"The text must not be empty."};
+        if (thread_count == 0u)
+            throw std::invalid_argument{"The number of threads must be > 0."};
+
+        assert(std::ranges::find(text.first(text.size() - 1u), text.back()) == text.end() - 1);
+        assert(std::ranges::min(text) == text.back());
+
+        rank_sample();
+    }
+    //!\}
+
+    /*!\brief Checks whether the suffix starting at `i` is lexicographically smaller than the one starting at `j`.
+     * \param[in] i The first suffix.
+     * \param[in] j The second suffix.
+     *
+     * \details
+     *
+     * At most `v` characters are compared.
+     */
+    bool operator()(size_t const i, size_t const j) const noexcept
+    {
+        if (i == j)
+            return false;
+
+        size_t const i_mod = i % cover_modulus;
+        size_t const a = cover.offset[(j + cover_modulus - i_mod) % cover_modulus];
+        size_t const delta = (a + cover_modulus - i_mod) % cover_modulus;
+
+        if (int const result = compare_prefix(i, j, delta); result != 0)
+            return result < 0;
+
+        return sample_ranks[sample_index(i + delta)] < sample_ranks[sample_index(j + delta)];
+    }
+
+    /*!\brief Computes the suffix array in blocks of about `block_size` suffixes.
+     * \param[in] block_size The approximate number of suffixes per block.
+     * \param[in] sink A callable that is called with a `std::span<size_t const>` for each block, in suffix array order.
+     *
+     * \details
+     *
+     * The number of blocks is `ceil(text.size() / block_size)`. Blocks may be larger than `block_size` because the
+     * splitters are drawn at random.
+     */
+    template <typename sink_t>
+    void sort(size_t const block_size, sink_t && sink) const
+    {
+        // std::sort copies the comparison function, which must hence not copy the sorter.
+        auto const suffix_less = [this](size_t const i, size_t const j)
+        {
+            return (*this)(i, j);
+        };
+
+        size_t const text_size = text.size();
+        size_t const suffixes_per_block = std::max<size_t>(block_size, 1u);
+        size_t const block_count = (text_size + suffixes_per_block - 1u) / suffixes_per_block;
+
+        if (block_count <= 1u)
+        {
+            std::vector<size_t> suffixes(text_size);
+            std::iota(suffixes.begin(), suffixes.end(), 0u);
+            sort_suffixes(suffixes);
+            sink(std::span<size_t const>{suffixes});
+            return;
+        }
+
+        // Choose the splitters from a random sample of suffixes.
+        constexpr size_t oversampling{64u};
+        std::mt19937_64 engine{0x5eed5a};
+        std::uniform_int_distribution<size_t> distribution{0u, text_size - 1u};
+        std::vector<size_t> candidates(std::min(text_size, block_count * oversampling));
+        std::ranges::generate(candidates,
+                              [&]()
+                              {
+                                  return distribution(engine);
+                              });
+        parallel_sort(candidates.begin(), candidates.end(), suffix_less, thread_count);
+        auto const [unique_end, candidates_end] = std::ranges::unique(candidates);
+        candidates.erase(unique_end, candidates_end);
+
+        std::vector<size_t> splitters{};
+        for (size_t i = 1u; i < block_count; ++i)
+            splitters.push_back(candidates[i * candidates.size() / block_count]);
+        auto const [splitters_end, end] = std::ranges::unique(splitters);
+        splitters.erase(splitters_end, end);
+
+        // Collect and sort the suffixes of each block.
+        size_t const chunk_count = std::min<size_t>(text_size, 4u * thread_count);
+        std::vector<std::vector<size_t>> chunk_suffixes(chunk_count);
+
+        for (size_t block = 0; block <= splitters.size(); ++block)
+        {
+            bool const has_lower = block > 0u;
+            bool const has_upper = block < splitters.size();
+            size_t const lower = has_lower ? splitters[block - 1u] : 0u;
+            size_t const upper = has_upper ? splitters[block] : 0u;
+
+            parallel_for(chunk_count,
+                         thread_count,
+                         [&](size_t const chunk)
+                         {
+                             std::vector<size_t> & suffixes = chunk_suffixes[chunk];
+                             suffixes.clear();
+                             size_t const chunk_end = text_size * (chunk + 1u) / chunk_count;
+                             for (size_t i = text_size * chunk / chunk_count; i < chunk_end; ++i)
+                             {
+                                 if ((!has_lower || !suffix_less(i, lower)) && (!has_upper || suffix_less(i, upper)))
+                                     suffixes.push_back(i);
+                             }
+                         });
+
+            std::vector<size_t> suffixes{};
+            size_t total_size{};
+            for (auto const & chunk : chunk_suffixes)
+                total_size += chunk.size();
+            suffixes.reserve(total_size);
+            for (auto & chunk : chunk_suffixes)
+            {
+                suffixes.insert(suffixes.end(), chunk.begin(), chunk.end());
+                std::vector<size_t>{}.swap(chunk);
+            }
+
+            sort_suffixes(suffixes);
+            sink(std::span<size_t const>{suffixes});
+        }
+    }
+
+    /*!\brief Returns the memory needed for the ranks of the sampled suffixes of a text of the given size.
+     * \param[in] text_size The length of the text.
+     * \returns The number of bytes.
+     *
+     * \details
+     *
+     * The ranks are kept while the blocks are sorted. While ranking the sample, the positions and the doubling keys
+     * of the sampled suffixes are stored additionally, which triples the memory consumption.
+     */
+    static constexpr size_t sample_memory(size_t const text_size) noexcept
+    {
+        return (text_size + cover_modulus - 1u) / cover_modulus * cover_size * sizeof(size_t);
+    }
+
+    /*!\brief The memory needed per suffix of a block in bytes.
+     *
+     * \details
+     *
+     * The suffixes are collected per thread and concatenated. For sorting, each suffix is stored with its first 8
+     * characters, and merging may use a buffer of the same size.
+     */
+    static constexpr size_t memory_per_block_suffix{6u * sizeof(size_t)};
+};
+
+/*!\brief Computes the suffix array of a text, using multiple threads and a bounded amount of memory.
+ * \ingroup search_fm_index
+ * \param[in] text The text. The last character must be unique and smaller than all other characters.
+ * \param[in] thread_count The number of threads to use.
+ * \param[in] memory_budget The approximate number of bytes to use in addition to the text. `0` means unlimited.
+ * \param[in] sink A callable that is called with a `std::span<size_t const>` for each block of the suffix array, in
+ *                 order.
+ * \throws std::invalid_argument If `text` is empty or `thread_count` is 0.
+ *
+ * \details
+ *
+ * See seqan3::detail::blockwise_suffix_sorter. The block size is chosen such that a block fits into the memory that
+ * remains after sorting the difference cover sample. The memory budget cannot be lower than what is needed for the
+ * sample; in this case, blocks of 2^16 suffixes are used.
+ */
+template <typename sink_t>
+void construct_suffix_array(std::span<uint8_t const> const text,
+                            size_t const thread_count,
+                            size_t const memory_budget,
+                            sink_t && sink)
+{
+    blockwise_suffix_sorter const sorter{text, thread_count};
+
+    size_t block_size{text.size()};
+    if (memory_budget != 0u)
+    {
+        size_t const sample_memory = blockwise_suffix_sorter::sample_memory(text.size());
+        size_t const block_memory = memory_budget > sample_memory ? memory_budget - sample_memory : 0u;
+        block_size = std::max<size_t>(block_memory / blockwise_suffix_sorter::memory_per_block_suffix, 1u << 16);
+    }
+
+    sorter.sort(block_size, std::forward<sink_t>(sink));
+}
+
+} // namespace seqan3::detail
@@ -15,13 +15,17 @@
 #include <algorithm>
 #include <filesystem>
 #include <ranges>
+#include <span>
+#include <string>
 
 #include <sdsl/suffix_trees.hpp>
 
 #include <seqan3/alphabet/views/to_rank.hpp>
 #include <seqan3/core/range/type_traits.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/search/fm_index/detail/csa_epr.hpp>
 #include <seqan3/search/fm_index/detail/fm_index_cursor.hpp>
+#include <seqan3/search/fm_index/detail/suffix_array_construction.hpp>
 #include <seqan3/search/fm_index/fm_index_cursor.hpp>
 
 namespace seqan3::detail
@@ -137,6 +141,47 @@ using sdsl_wt_index_type =
                  sdsl::isa_sampling<>,         // How to sample positons in the inverse suffix array
                  sdsl::plain_byte_alphabet>;   // How to represent the alphabet
 
+/*!\brief The FM Index Configuration using an EPR dictionary for small alphabets.
+ * \ingroup search_fm_index
+ * \tparam bits_per_symbol  The number of bits per character in the Burrows-Wheeler transform; must be 2 or 3.
+ * \tparam sa_sampling_rate The sampling rate of the suffix array.
+ *
+ * \details
+ *
+ * Stores the Burrows-Wheeler transform in an interleaved rank dictionary (EPR dictionary) instead of a wavelet tree.
+ * A rank query accesses a single cache line instead of one per level of the wavelet tree, and the cursors compute
+ * the intervals of all children of a node at once. This speeds up the search, in particular the approximate search
+ * that enumerates all children.
+ *
+ * The text may only contain characters whose rank plus one, after adding the delimiter for text collections, fits into
+ * `bits_per_symbol` bits:
+ *
+ * | bits_per_symbol | single text        | text collection    | Example                                |
+ * |:---------------:|:------------------:|:------------------:|:--------------------------------------:|
+ * | 2               | alphabet size <= 4 | alphabet size <= 3 | seqan3::dna4 (single text)             |
+ * | 3               | alphabet size <= 8 | alphabet size <= 7 | seqan3::dna4 (collection), seqan3::dna5 |
+ *
+ * The construction throws std::invalid_argument if the text contains other characters.
+ *
+ * ### Running time / Space consumption
+ *
+ * \f$T_{BACKWARD\_SEARCH}: O(1)\f$
+ *
+ * The Burrows-Wheeler transform needs 2.67 bits per character for `bits_per_symbol = 2` and 4 bits per character for
+ * `bits_per_symbol = 3`.
+ *
+ * The sampled suffix array needs \f$\lceil \log_2 (n + 1) \rceil / sa\_sampling\_rate\f$ bits per character. Locating
+ * an occurrence applies the LF mapping at most `sa_sampling_rate - 1` times. The cursors locate all occurrences of a
+ * node together, which shares the LF mapping steps of neighbouring occurrences. Lower sampling rates, e.g. 4 or 8,
+ * speed up queries with many occurrences at the cost of space.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/fm_index_epr.cpp
+ */
+template <uint8_t bits_per_symbol = 2u, uint32_t sa_sampling_rate = 16u>
+using sdsl_epr_index_type = detail::csa_epr<bits_per_symbol, sa_sampling_rate>;
+
 /*!\brief The default FM Index Configuration.
  * \ingroup search_fm_index
  * \attention The default might be changed in a future release. If you rely on a stable API and on-disk-format,
@@ -144,6 +189,33 @@ using sdsl_wt_index_type =
  */
 using default_sdsl_index_type = sdsl_wt_index_type;
 
+/*!\brief Options for the construction of the seqan3::fm_index and seqan3::bi_fm_index.
+ * \ingroup search_fm_index
+ *
+ * \details
+ *
+ * By default, the index is constructed in memory by the SDSL using a single thread. If more than one thread or a
+ * memory budget is given, the suffix array is computed by a parallel, blockwise suffix sorter instead. The suffix
+ * array is written to a temporary file block by block and the SDSL computes the Burrows-Wheeler transform and the
+ * rank data structures by streaming this file.
+ *
+ * The memory budget limits the memory used by the suffix sorter in addition to the text. If it is 0, the suffix array
+ * is sorted as a single block and all temporary files are kept in memory. Otherwise, the suffix array is sorted in
+ * blocks that fit into the budget and the temporary files are stored in the temporary directory. The budget is
+ * approximate: the suffix sorter always needs about 1.5 bytes per character of the text.
+ *
+ * The constructed index is identical to the one constructed with the default options.
+ */
+struct fm_index_construction_options
+{
+    //!\brief The number of threads used to compute the suffix array. Must be at least 1.
+    size_t threads{1u};
+    //!\brief The memory in bytes the suffix array construction may use in addition to the text. 0 means unbounded.
+    size_t memory_budget{0u};
+    //!\brief The directory for temporary files. If empty, std::filesystem::temp_directory_path() is used.
+    std::filesystem::path tmp_directory{};
+};
+
 /*!\brief The SeqAn FM Index.
  * \ingroup search_fm_index
  * \tparam alphabet_t        The alphabet type; must model seqan3::semialphabet.
@@ -181,6 +253,8 @@ using default_sdsl_index_type = sdsl_wt_index_type;
  * \todo Link to SDSL documentation or write our own once SDSL3 documentation is available somewhere....
  *
  * \endif
+ *
+ * For small alphabets like seqan3::dna4, seqan3::sdsl_epr_index_type provides a faster search.
  */
 template <semialphabet alphabet_t,
           text_layout text_layout_mode_,
@@ -246,6 +320,7 @@ private:
               The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
      * \param[in] text The text to construct from.
+     * \param[in] options The seqan3::fm_index_construction_options.
      *
      * \details
      * \if DEV
@@ -263,13 +338,13 @@ private:
      */
     template <std::ranges::range text_t>
         requires (text_layout_mode_ == text_layout::single)
-    void construct(text_t && text)
+    void construct(text_t && text, fm_index_construction_options const & options = {})
     {
         detail::fm_index_validator::validate<alphabet_t, text_layout_mode_>(text);
+        validate_options(options);
 
         // TODO:
         // * check what happens in sdsl when constructed twice!
-        // * choose between in-memory/external and construction algorithms
         // * sdsl construction currently only works for int_vector, std::string and char *, not ranges in general
         // uint8_t largest_char = 0;
         sdsl::int_vector<8> tmp_text(std::ranges::distance(text));
@@ -277,7 +352,7 @@ private:
         // copy ranks into tmp_text
         copy_sequence_ranks_shifted_by_one(std::ranges::begin(tmp_text), text | std::views::reverse);
 
-        sdsl::construct_im(index, tmp_text, 0);
+        construct_sdsl_index(tmp_text, options);
 
         // TODO: would be nice but doesn't work since it's private and the public member references are const
         // index.m_C.resize(largest_char);
@@ -288,9 +363,10 @@ private:
     //!\overload
     template <std::ranges::range text_t>
         requires (text_layout_mode_ == text_layout::collection)
-    void construct(text_t && text, bool reverse = false)
+    void construct(text_t && text, fm_index_construction_options const & options = {}, bool reverse = false)
     {
         detail::fm_index_validator::validate<alphabet_t, text_layout_mode_>(text);
+        validate_options(options);
 
         std::vector<size_t> text_sizes;
 
@@ -374,7 +450,89 @@ private:
             }
         }
 
-        sdsl::construct_im(index, tmp_text, 0);
+        construct_sdsl_index(tmp_text, options);
+    }
+
+    /*!\brief Checks the seqan3::fm_index_construction_options.
+     * \param[in] options The options to check.
+     * \throws std::invalid_argument If the number of threads is 0 or the temporary directory does not exist.
+     */
+    static void validate_options(fm_index_construction_options const & options)
+    {
+        if (options.threads == 0u)
+            throw std::invalid_argument{"The number of threads must be at least 1."};
+
+        if (!options.tmp_directory.empty() && !std::filesystem::is_directory(options.tmp_directory))
+            throw std::invalid_argument{"The temporary directory " + options.tmp_directory.string()
+                                        + " does not exist."};
+    }
+
+    /*!\brief Constructs the SDSL index from the transformed text.
+     * \param[in,out] tmp_text The ranks of the text shifted by one. The text is released during construction.
+     * \param[in] options The seqan3::fm_index_construction_options.
+     *
+     * \details
+     *
+     * With the default options, the SDSL constructs the index in memory. Otherwise, the text and the suffix array
+     * computed by seqan3::detail::construct_suffix_array are put into the cache of the SDSL. The SDSL then only
+     * computes the Burrows-Wheeler transform and the index by streaming the cached files.
+     * If no memory budget is given, the cache is kept in the RAM file system of the SDSL.
+     */
+    void construct_sdsl_index(sdsl::int_vector<8> & tmp_text, fm_index_construction_options const & options)
+    {
+        if (options.threads == 1u && options.memory_budget == 0u)
+        {
+            sdsl::construct_im(index, tmp_text, 0);
+            return;
+        }
+
+        std::string directory{"@"};
+        if (options.memory_budget != 0u)
+        {
+            directory = options.tmp_directory.empty() ? std::filesystem::temp_directory_path().string()
+                                                      : options.tmp_directory.string();
+        }
+
+        // sdsl::util::id() is not thread-safe. The address of the index is unique among all indices of this process.
+        std::string const id = sdsl::util::to_string(sdsl::util::pid()) + "_"
+                             + sdsl::util::to_string(reinterpret_cast<uintptr_t>(this));
+        sdsl::cache_config config{true, directory, id};
+        std::string const suffix_array_file = sdsl::cache_file_name(sdsl::conf::KEY_SA, config);
+
+        try
+        {
+            // The SDSL expects the text to end with a 0 sentinel.
+            tmp_text.resize(tmp_text.size() + 1u);
+            tmp_text[tmp_text.size() - 1u] = 0u;
+            sdsl::store_to_cache(tmp_text, sdsl::conf::KEY_TEXT, config);
+
+            {
+                uint8_t const width = sdsl::bits::hi(tmp_text.size()) + 1u;
+                sdsl::int_vector_buffer<> suffix_array{suffix_array_file, std::ios::out, 1u << 20, width};
+
+                detail::construct_suffix_array(
+                    std::span<uint8_t const>{reinterpret_cast<uint8_t const *>(tmp_text.data()), tmp_text.size()},
+                    options.threads,
+                    options.memory_budget,
+                    [&suffix_array](std::span<size_t const> const block)
+                    {
+                        for (size_t const suffix : block)
+                            suffix_array.push_back(suffix);
+                    });
+            }
+            sdsl::register_cache_file(sdsl::conf::KEY_SA, config);
+
+            // The SDSL reads the text from the cache.
+            sdsl::int_vector<8>{}.swap(tmp_text);
+
+            sdsl::construct(index, "", config, 1);
+        }
+        catch (...)
+        {
+            sdsl::util::delete_all_files(config.file_map);
+            sdsl::remove(suffix_array_file);
+            throw;
+        }
     }
 
 public:
@@ -457,6 +615,26 @@ public:
     {
         construct(std::forward<text_t>(text));
     }
+
+    /*!\brief Constructor that immediately constructs the index given a range and construction options.
+     * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
+     * \param[in] text The text to construct from.
+     * \param[in] options The seqan3::fm_index_construction_options.
+     * \throws std::invalid_argument If `options.threads` is 0 or `options.tmp_directory` does not exist.
+     *
+     * \details
+     *
+     * \include test/snippet/search/fm_index_construction_options.cpp
+     *
+     * ### Complexity
+     *
+     * \if DEV \todo \endif At least linear.
+     */
+    template <std::ranges::bidirectional_range text_t>
+    fm_index(text_t && text, fm_index_construction_options const & options)
+    {
+        construct(std::forward<text_t>(text), options);
+    }
     //!\}
 
     /*!\brief Returns the length of the indexed text including sentinel characters.
@@ -588,6 +766,11 @@ public:
 //!\brief Deduces the alphabet and dimensions of the text.
 template <std::ranges::range text_t>
 fm_index(text_t &&) -> fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
+
+//!\brief Deduces the alphabet and dimensions of the text.
+template <std::ranges::range text_t>
+fm_index(text_t &&, fm_index_construction_options const &)
+    -> fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
 //!\}
 } // namespace seqan3
 
@@ -615,17 +798,17 @@ class reverse_fm_index : public fm_index<alphabet_t, text_layout_mode, sdsl_inde
 private:
     //!\copydoc seqan3::fm_index::construct()
     template <std::ranges::range text_t>
-    void construct_(text_t && text)
+    void construct_(text_t && text, fm_index_construction_options const & options = {})
     {
         if constexpr (text_layout_mode == text_layout::single)
         {
             auto reverse_text = text | std::views::reverse;
-            this->construct(reverse_text);
+            this->construct(reverse_text, options);
         }
         else
         {
             auto reverse_text = text | views::deep{std::views::reverse} | std::views::reverse;
-            this->construct(reverse_text, true);
+            this->construct(reverse_text, options, true);
         }
     }
 
@@ -638,6 +821,13 @@ public:
     {
         construct_(std::forward<text_t>(text));
     }
+
+    //!\copydoc seqan3::fm_index::fm_index(text_t && text, fm_index_construction_options const & options)
+    template <std::ranges::bidirectional_range text_t>
+    reverse_fm_index(text_t && text, fm_index_construction_options const & options)
+    {
+        construct_(std::forward<text_t>(text), options);
+    }
 };
 
 } // namespace seqan3::detail
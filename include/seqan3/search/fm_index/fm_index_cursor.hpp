@@ -95,6 +95,12 @@ public:
     using size_type = typename index_type::size_type;
     //!\}
 
+    /*!\brief Whether locate() resolves all occurrences together, i.e. the SDSL index models
+     *        seqan3::detail::sdsl_index_with_interval_locate.
+     * \noapi{Used by seqan3::search to choose between locate() and lazy_locate().}
+     */
+    static constexpr bool locates_interval = detail::sdsl_index_with_interval_locate<typename index_t::sdsl_index_type>;
+
 private:
     /*!\name Member types
      * \{
@@ -175,6 +181,34 @@ private:
         return false;
     }
 
+    /*!\brief Backward search of the smallest character `c' >= c` that occurs in the interval `[l, r]`.
+     * \returns `c'`, or `sigma` if there is no such character. If `c'` is found, `l` and `r` are set to its interval.
+     *
+     * \details
+     *
+     * Used instead of calling backward_search() for every character if the SDSL index models
+     * seqan3::detail::sdsl_index_with_rank_all. The ranks of all characters are computed with two queries.
+     */
+    sdsl_char_type
+    backward_search_all(sdsl_index_type const & csa, sdsl_char_type c, size_type & l, size_type & r) const noexcept
+    {
+        assert(l <= r && r < csa.size());
+
+        auto const ranks_l = csa.bwt.rank_all(l);
+        auto const ranks_r = csa.bwt.rank_all(r + 1);
+
+        for (; c < sigma; ++c)
+        {
+            if (ranks_r[c] > ranks_l[c])
+            {
+                l = csa.C[c] + ranks_l[c];
+                r = csa.C[c] + ranks_r[c] - 1;
+                break;
+            }
+        }
+        return c;
+    }
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -259,15 +293,20 @@ public:
      */
     bool extend_right() noexcept
     {
-        // TODO: specialize extend_right() and cycle_back() for EPR-dictionaries
-        // store all cursors at once in a private std::array of cursors
         assert(index != nullptr);
 
         sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
         size_type _lb = node.lb, _rb = node.rb;
-        while (c < sigma && !backward_search(index->index, index->index.comp2char[c], _lb, _rb))
+        if constexpr (detail::sdsl_index_with_rank_all<sdsl_index_type>)
         {
-            ++c;
+            c = backward_search_all(index->index, c, _lb, _rb);
+        }
+        else
+        {
+            while (c < sigma && !backward_search(index->index, index->index.comp2char[c], _lb, _rb))
+            {
+                ++c;
+            }
         }
 
         if (c != sigma)
@@ -377,6 +416,21 @@ public:
         return true;
     }
 
+    /*!\cond DEV
+     * \brief Prefetches the memory that the next extension to the right accesses.
+     *
+     * \details
+     *
+     * Does not change the cursor. Used to overlap the cache misses of multiple cursors, see
+     * seqan3::detail::prefetch_backward_search.
+     */
+    void prefetch_extend_right() const noexcept
+    {
+        assert(index != nullptr);
+        detail::prefetch_backward_search(index->index, node.lb, node.rb);
+    }
+    //!\endcond
+
     /*!\brief Tries to replace the rightmost character of the query by the next lexicographically larger character such
      *        that the query is found in the text.
      *        \if DEV
@@ -412,9 +466,16 @@ public:
         sdsl_char_type c = node.last_char + 1;
         size_type _lb = parent_lb, _rb = parent_rb;
 
-        while (c < sigma && !backward_search(index->index, index->index.comp2char[c], _lb, _rb))
+        if constexpr (detail::sdsl_index_with_rank_all<sdsl_index_type>)
         {
-            ++c;
+            c = backward_search_all(index->index, c, _lb, _rb);
+        }
+        else
+        {
+            while (c < sigma && !backward_search(index->index, index->index.comp2char[c], _lb, _rb))
+            {
+                ++c;
+            }
         }
 
         if (c != sigma) // Collection has additional sentinel as delimiter
@@ -581,6 +642,10 @@ public:
      *
      * \f$count() * O(T_{BACKWARD\_SEARCH} * SAMPLING\_RATE)\f$
      *
+     * If the underlying SDSL index can locate an interval of the suffix array at once (e.g.
+     * seqan3::sdsl_epr_index_type), all occurrences are resolved together and the LF mapping steps are computed once
+     * per interval instead of once per occurrence.
+     *
      * ### Exceptions
      *
      * Strong exception guarantee (no data is modified in case an exception is thrown).
@@ -592,10 +657,13 @@ public:
 
         locate_result_type occ{};
         occ.reserve(count());
-        for (size_type i = 0; i < count(); ++i)
-        {
-            occ.emplace_back(0, offset() - index->index[node.lb + i]);
-        }
+        detail::for_each_suffix_array_entry(index->index,
+                                            node.lb,
+                                            count(),
+                                            [&occ, _offset = offset()](size_type const entry)
+                                            {
+                                                occ.emplace_back(0, _offset - entry);
+                                            });
 
         return occ;
     }
@@ -608,13 +676,17 @@ public:
 
         locate_result_type occ;
         occ.reserve(count());
-        for (size_type i = 0; i < count(); ++i)
-        {
-            size_type loc = offset() - index->index[node.lb + i];
-            size_type sequence_rank = index->text_begin_rs.rank(loc + 1);
-            size_type sequence_position = loc - index->text_begin_ss.select(sequence_rank);
-            occ.emplace_back(sequence_rank - 1, sequence_position);
-        }
+        detail::for_each_suffix_array_entry(index->index,
+                                            node.lb,
+                                            count(),
+                                            [this, &occ, _offset = offset()](size_type const entry)
+                                            {
+                                                size_type loc = _offset - entry;
+                                                size_type sequence_rank = index->text_begin_rs.rank(loc + 1);
+                                                size_type sequence_position =
+                                                    loc - index->text_begin_ss.select(sequence_rank);
+                                                occ.emplace_back(sequence_rank - 1, sequence_position);
+                                            });
         return occ;
     }
 
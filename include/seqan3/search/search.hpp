@@ -19,11 +19,14 @@
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/detail/all_view.hpp>
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/default_configuration.hpp>
+#include <seqan3/search/configuration/executor.hpp>
 #include <seqan3/search/configuration/on_result.hpp>
 #include <seqan3/search/configuration/parallel.hpp>
 #include <seqan3/search/detail/search_configurator.hpp>
 #include <seqan3/search/detail/search_traits.hpp>
+#include <seqan3/utility/views/chunk.hpp>
 #include <seqan3/utility/views/convert.hpp>
 #include <seqan3/utility/views/deep.hpp>
 #include <seqan3/utility/views/zip.hpp>
@@ -112,7 +115,24 @@ search(queries_t && queries, index_t const & index, configuration_t const & cfg
     detail::search_configuration_validator::validate_query_type<queries_t>();
 
     size_t queries_size = std::ranges::distance(queries);
-    auto indexed_queries = views::zip(std::views::iota(size_t{0}, queries_size), std::forward<queries_t>(queries));
+    auto zipped_queries = views::zip(std::views::iota(size_t{0}, queries_size), std::forward<queries_t>(queries));
+
+    // If the queries are searched in batches, the algorithm is invoked with chunks of the indexed queries.
+    auto indexed_queries = [&]()
+    {
+        if constexpr (detail::search_traits<decltype(updated_cfg)>::search_in_batches)
+        {
+            size_t const batch_size = get<search_cfg::batch>(updated_cfg).size;
+            if (batch_size == 0u)
+                throw std::invalid_argument{"The batch size in seqan3::search_cfg::batch must be greater than 0."};
+
+            return std::move(zipped_queries) | views::chunk(batch_size);
+        }
+        else
+        {
+            return std::move(zipped_queries);
+        }
+    }();
 
     using indexed_queries_t = decltype(indexed_queries);
 
@@ -122,15 +142,26 @@ search(queries_t && queries, index_t const & index, configuration_t const & cfg
     using complete_configuration_t = decltype(complete_config);
     using traits_t = detail::search_traits<complete_configuration_t>;
     using algorithm_result_t = typename traits_t::search_result_type;
-    using execution_handler_t = std::conditional_t<complete_configuration_t::template exists<search_cfg::parallel>(),
-                                                   detail::execution_handler_parallel,
-                                                   detail::execution_handler_sequential>;
+    using execution_handler_t =
+        std::conditional_t<complete_configuration_t::template exists<search_cfg::parallel>()
+                               || complete_configuration_t::template exists<search_cfg::executor>(),
+                           detail::execution_handler_parallel,
+                           detail::execution_handler_sequential>;
 
     // Select the execution handler for the search configuration.
-    auto select_execution_handler = [parallel = complete_config.get_or(search_cfg::parallel{})]()
+    auto select_execution_handler = [parallel = complete_config.get_or(search_cfg::parallel{}),
+                                     executor = complete_config.get_or(search_cfg::executor{})]()
     {
         if constexpr (std::same_as<execution_handler_t, detail::execution_handler_parallel>)
         {
+            if constexpr (complete_configuration_t::template exists<search_cfg::executor>())
+            {
+                if (executor.pool == nullptr)
+                    throw std::runtime_error{"You must configure the thread pool in seqan3::search_cfg::executor."};
+
+                return execution_handler_t{executor.pool->scheduler()};
+            }
+
             auto thread_count = parallel.thread_count;
             if (!thread_count)
                 throw std::runtime_error{"You must configure the number of threads in seqan3::search_cfg::parallel."};
@@ -10,10 +10,11 @@
  * \brief Meta-header for the Bloom Filter.
  *
  * \defgroup utility_bloom_filter Bloom Filter
- * \brief Provides seqan3:bloom_filter.
+ * \brief Provides seqan3::bloom_filter and seqan3::blocked_bloom_filter.
  * \ingroup utility
  */
 
 #pragma once
 
+#include <seqan3/utility/bloom_filter/blocked_bloom_filter.hpp>
 #include <seqan3/utility/bloom_filter/bloom_filter.hpp>
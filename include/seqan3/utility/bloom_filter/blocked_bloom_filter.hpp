@@ -0,0 +1,487 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::blocked_bloom_filter.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstring>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/utility/bloom_filter/detail/aligned_bit_vector.hpp>
+#include <seqan3/utility/detail/prefetch.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A Bloom Filter that stores all bits of a value in a single block of 512 bits.
+ * \tparam data_layout_mode_ Indicates whether the underlying data type is compressed or mapped. See seqan3::data_layout.
+ * \implements seqan3::cerealisable
+ * \ingroup utility_bloom_filter
+ *
+ * \details
+ *
+ * ### Blocked Bloom Filter
+ *
+ * The seqan3::bloom_filter sets `h` bits anywhere in its bitvector when inserting a value. Hence, a query accesses
+ * up to `h` different cache lines, which usually means `h` cache misses for large Bloom Filters.
+ * The blocked Bloom Filter divides its bitvector into blocks of 512 bits, i.e. 64 bytes, the size of a cache line.
+ * A value is first hashed to a block and all its `h` bits are set within this block. The blocks of the uncompressed
+ * and the mapped layout are aligned to a cache line, hence a query accesses exactly one cache line.
+ *
+ * In exchange for fewer memory accesses, the blocked Bloom Filter has a slightly higher false positive rate than a
+ * seqan3::bloom_filter of the same size, because the number of values per block varies.
+ *
+ * The blocked Bloom Filter provides the same interface as the seqan3::bloom_filter and can be used as a drop-in
+ * replacement. The size of the bitvector is rounded up to a multiple of 512 bits.
+ *
+ * ### Querying
+ *
+ * To query the blocked Bloom Filter for a value, call `seqan3::blocked_bloom_filter::contains`.
+ * To query the blocked Bloom Filter for a range of values, call `seqan3::blocked_bloom_filter::count`, which returns
+ * the number of values that are (probably) contained in the blocked Bloom Filter. The blocks of consecutive values
+ * are prefetched, such that the memory accesses of multiple values overlap.
+ *
+ * ### Compression
+ *
+ * The blocked Bloom Filter can be compressed by passing `seqan3::data_layout::compressed` as template argument.
+ * The compressed `seqan3::blocked_bloom_filter<seqan3::data_layout::compressed>` can only be constructed from a
+ * `seqan3::blocked_bloom_filter`, in which case the underlying bitvector is compressed.
+ * The compressed blocked Bloom Filter is immutable, i.e. only querying is supported.
+ *
+ * ### Memory mapping
+ *
+ * An uncompressed blocked Bloom Filter can be stored with seqan3::blocked_bloom_filter::save_mapped.
+ * Constructing a `seqan3::blocked_bloom_filter<seqan3::data_layout::mapped>` from such a file maps the file into
+ * memory instead of reading it. The mapped blocked Bloom Filter is immutable, i.e. only querying is supported.
+ *
+ * ### Thread safety
+ *
+ * The blocked Bloom Filter promises the basic thread-safety by the STL that all
+ * calls to `const` member functions are safe from multiple threads (as long as no thread calls
+ * a non-`const` member function at the same time).
+ *
+ * \sa seqan3::bloom_filter
+ */
+template <data_layout data_layout_mode_ = data_layout::uncompressed>
+class blocked_bloom_filter
+{
+private:
+    //!\cond
+    template <data_layout data_layout_mode>
+    friend class blocked_bloom_filter;
+    //!\endcond
+
+    //!\brief The underlying datatype to use.
+    using data_type = std::conditional_t<data_layout_mode_ == data_layout::uncompressed,
+                                         detail::aligned_bit_vector,
+                                         std::conditional_t<data_layout_mode_ == data_layout::compressed,
+                                                            sdsl::sd_vector<>,
+                                                            detail::mapped_bit_vector>>;
+
+    //!\brief The number of bits in a block.
+    static constexpr size_t block_bits{512u};
+    //!\brief The number of 64-bit words in a block.
+    static constexpr size_t block_words{block_bits / 64u};
+    //!\brief The number of values whose blocks are prefetched together by seqan3::blocked_bloom_filter::count.
+    static constexpr size_t prefetch_block_size{16u};
+    //!\brief The simd type that holds a block.
+    using block_simd_t = simd::simd_type_t<uint64_t, block_words>;
+
+    //!\brief The size of the underlying bit vector in bits.
+    size_t size_in_bits{};
+    //!\brief The number of bits to shift the hash value before doing multiplicative hashing.
+    size_t hash_shift{};
+    //!\brief The number of hash functions.
+    size_t hash_funs{};
+    //!\brief The bitvector.
+    data_type data{};
+    //!\brief Precalculated seeds for multiplicative hashing. We use large irrational numbers for a uniform hashing.
+    static constexpr std::array<size_t, 2> hash_seeds{13572355802537770549ULL,  // 2**64 / (e/2)
+                                                      13043817825332782213ULL}; // 2**64 / sqrt(2)
+    //!\brief Identifies files written by seqan3::blocked_bloom_filter::save_mapped.
+    static constexpr std::string_view mapped_magic{"SEQ3_BBF"};
+
+    /*!\brief Hashes a value to its block.
+     * \param value The value to process.
+     * \returns The index of the first word of the block and a hash value that encodes the positions of the bits
+     *          within the block, see seqan3::blocked_bloom_filter::bit_in_block.
+     * \sa https://probablydance.com/2018/06/16/
+     * \sa https://lemire.me/blog/2016/06/27
+     */
+    std::pair<size_t, size_t> hash_and_fit(size_t const value) const noexcept
+    {
+        size_t h = value * hash_seeds[0];
+        h ^= h >> hash_shift;         // XOR and shift higher bits into lower bits
+        h *= 11400714819323198485ULL; // = 2^64 / golden_ration, to expand h to 64 bit range
+
+        size_t const block_count = size_in_bits / block_bits;
+#ifdef __SIZEOF_INT128__
+        size_t const block = static_cast<uint64_t>((static_cast<__uint128_t>(h) * block_count) >> 64);
+#else
+        size_t const block = h % block_count;
+#endif
+        assert(block < block_count);
+
+        return {block * block_words, h * hash_seeds[1]};
+    }
+
+    /*!\brief Returns the position of the bit of the i-th hash function within the block.
+     * \param bit_positions The second value returned by seqan3::blocked_bloom_filter::hash_and_fit.
+     * \param i The index of the hash function.
+     *
+     * \details
+     *
+     * Each hash function uses 9 bits of `bit_positions`. The highest bits are used, because they are the best mixed
+     * ones of a multiplicative hash.
+     */
+    static constexpr size_t bit_in_block(size_t const bit_positions, size_t const i) noexcept
+    {
+        return (bit_positions >> (55u - 9u * i)) & (block_bits - 1u);
+    }
+
+    /*!\brief Checks whether all bits of a value are set in its block.
+     * \param word_idx The index of the first word of the block.
+     * \param bit_positions The positions of the bits within the block, see seqan3::blocked_bloom_filter::bit_in_block.
+     *
+     * \details
+     *
+     * The bits of the value are set in a mask of the size of a block, which is compared with the block at once.
+     * The compressed layout does not store the words of the block, hence its bits are checked one by one.
+     */
+    bool block_contains(size_t const word_idx, size_t const bit_positions) const noexcept
+    {
+        assert((word_idx + block_words) * 64u <= data.size());
+
+        if constexpr (data_layout_mode_ == data_layout::compressed)
+        {
+            for (size_t i = 0; i < hash_funs; ++i)
+                if (!data[word_idx * 64u + bit_in_block(bit_positions, i)])
+                    return false;
+
+            return true;
+        }
+        else
+        {
+            std::array<uint64_t, block_words> mask_words{};
+            for (size_t i = 0; i < hash_funs; ++i)
+            {
+                size_t const bit = bit_in_block(bit_positions, i);
+                mask_words[bit >> 6] |= uint64_t{1} << (bit & 63u);
+            }
+
+            // memcpy instead of simd::load, because `block_simd_t` may not be a native type.
+            block_simd_t block;
+            block_simd_t mask;
+            std::memcpy(&block, data.data() + word_idx, sizeof(block_simd_t));
+            std::memcpy(&mask, mask_words.data(), sizeof(block_simd_t));
+
+            std::array<uint64_t, block_words> missing{};
+            block_simd_t const missing_simd = mask & ~block;
+            std::memcpy(missing.data(), &missing_simd, sizeof(block_simd_t));
+
+            uint64_t any_missing{};
+            for (uint64_t const word : missing)
+                any_missing |= word;
+
+            return any_missing == 0u;
+        }
+    }
+
+public:
+    //!\brief Indicates whether the blocked Bloom Filter is compressed.
+    static constexpr data_layout data_layout_mode = data_layout_mode_;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    blocked_bloom_filter() = default;                                         //!< Defaulted.
+    blocked_bloom_filter(blocked_bloom_filter const &) = default;             //!< Defaulted.
+    blocked_bloom_filter & operator=(blocked_bloom_filter const &) = default; //!< Defaulted.
+    blocked_bloom_filter(blocked_bloom_filter &&) = default;                  //!< Defaulted.
+    blocked_bloom_filter & operator=(blocked_bloom_filter &&) = default;      //!< Defaulted.
+    ~blocked_bloom_filter() = default;                                        //!< Defaulted.
+
+    /*!\brief Construct an uncompressed blocked Bloom Filter.
+     * \param size The bit vector size (in bits). Rounded up to a multiple of 512.
+     * \param funs The number of hash functions. Default 2. At least 1, at most 5.
+     *
+     * \attention This constructor can only be used to construct **uncompressed** blocked Bloom Filters.
+     *
+     * \details
+     *
+     * ### Example
+     *
+     * \include test/snippet/utility/bloom_filter/blocked_bloom_filter.cpp
+     */
+    blocked_bloom_filter(seqan3::bin_size size, seqan3::hash_function_count funs = seqan3::hash_function_count{2u})
+        requires (data_layout_mode == data_layout::uncompressed)
+    {
+        size_in_bits = size.get();
+        hash_funs = funs.get();
+
+        if (hash_funs == 0 || hash_funs > 5)
+            throw std::logic_error{"The number of hash functions must be > 0 and <= 5."};
+        if (size_in_bits == 0)
+            throw std::logic_error{"The size of a bloom filter must be > 0."};
+
+        size_in_bits = (size_in_bits + block_bits - 1u) / block_bits * block_bits;
+        hash_shift = std::countl_zero(size_in_bits);
+        data = data_type(size_in_bits);
+    }
+
+    /*!\brief Construct a compressed blocked Bloom Filter.
+     * \param[in] bf The uncompressed seqan3::blocked_bloom_filter.
+     *
+     * \attention This constructor can only be used to construct **compressed** blocked Bloom Filters.
+     */
+    blocked_bloom_filter(blocked_bloom_filter<data_layout::uncompressed> const & bf)
+        requires (data_layout_mode == data_layout::compressed)
+    {
+        std::tie(size_in_bits, hash_shift, hash_funs) = std::tie(bf.size_in_bits, bf.hash_shift, bf.hash_funs);
+
+        data = sdsl::sd_vector<>{bf.data.to_sdsl()};
+    }
+
+    /*!\brief Construct a mapped blocked Bloom Filter from a file written by seqan3::blocked_bloom_filter::save_mapped.
+     * \param[in] path The file to map.
+     * \param[in] options The seqan3::mapping_options.
+     * \throws seqan3::file_open_error If the file cannot be mapped.
+     * \throws seqan3::format_error If the file does not contain a blocked Bloom Filter.
+     *
+     * \attention This constructor can only be used to construct **mapped** blocked Bloom Filters.
+     *
+     * \details
+     *
+     * The file is mapped into memory and not read. The file must not be modified while it is mapped.
+     */
+    explicit blocked_bloom_filter(std::filesystem::path const & path, mapping_options const options = {})
+        requires (data_layout_mode == data_layout::mapped)
+    {
+        std::array<uint64_t, 3> metadata;
+        data = detail::read_mapped_bit_vector(path, mapped_magic, metadata, options.populate, options.will_need);
+        std::tie(size_in_bits, hash_shift, hash_funs) = std::tuple_cat(metadata);
+
+        if (data.size() != size_in_bits || size_in_bits == 0 || size_in_bits % block_bits != 0 || hash_funs == 0
+            || hash_funs > 5)
+            throw format_error{"The file " + path.string() + " does not contain a valid blocked Bloom Filter."};
+    }
+    //!\}
+
+    /*!\brief Stores the blocked Bloom Filter such that it can be memory mapped.
+     * \param[in] path The file to write.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     * \throws seqan3::io_error If writing fails.
+     *
+     * \attention This function is only available for **uncompressed** blocked Bloom Filters.
+     *
+     * \details
+     *
+     * The file can be mapped by constructing a `seqan3::blocked_bloom_filter<seqan3::data_layout::mapped>`.
+     * The layout stores the raw bitvector and depends on the byte order of the host.
+     */
+    void save_mapped(std::filesystem::path const & path) const
+        requires (data_layout_mode == data_layout::uncompressed)
+    {
+        detail::write_mapped_bit_vector(path,
+                                        mapped_magic,
+                                        std::array<uint64_t, 3>{size_in_bits, hash_shift, hash_funs},
+                                        data);
+    }
+
+    /*!\name Modifiers
+     * \{
+     */
+    /*!\brief Inserts a value into the blocked Bloom Filter.
+     * \param[in] value The raw numeric value to process.
+     *
+     * \attention This function is only available for **uncompressed** blocked Bloom Filters.
+     */
+    void emplace(size_t const value) noexcept
+        requires (data_layout_mode == data_layout::uncompressed)
+    {
+        auto const [word_idx, bit_positions] = hash_and_fit(value);
+        assert((word_idx + block_words) * 64u <= data.size());
+
+        for (size_t i = 0; i < hash_funs; ++i)
+            data.set(word_idx * 64u + bit_in_block(bit_positions, i));
+    }
+
+    /*!\brief Remove all values from the blocked Bloom Filter by setting all bits to 0.
+     *
+     * \attention This function is only available for **uncompressed** blocked Bloom Filters.
+     *
+     * \details
+     *
+     * While all values are removed from the vector, the size of the blocked Bloom Filter is not changed.
+     */
+    void reset() noexcept
+        requires (data_layout_mode == data_layout::uncompressed)
+    {
+        data.reset();
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Check whether a value is present in the blocked Bloom Filter.
+     * \param[in] value The raw numeric value to process.
+     *
+     * \details
+     *
+     * ### Example
+     *
+     * \include test/snippet/utility/bloom_filter/blocked_bloom_filter.cpp
+     */
+    bool contains(size_t const value) const noexcept
+    {
+        auto const [word_idx, bit_positions] = hash_and_fit(value);
+        return block_contains(word_idx, bit_positions);
+    }
+    //!\}
+
+    /*!\name Counting
+     * \{
+     */
+    /*!\brief Counts the occurrences for all values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::input_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     *
+     * \details
+     *
+     * The values are hashed and their blocks are prefetched in batches of 16 values before the blocks are compared
+     * with the bit masks of the values.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are thread safe.
+     */
+    template <std::ranges::range value_range_t>
+    size_t count(value_range_t && values) const noexcept
+    {
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        std::array<std::pair<size_t, size_t>, prefetch_block_size> batch;
+        size_t result = 0;
+
+        auto it = std::ranges::begin(values);
+        auto const end = std::ranges::end(values);
+
+        while (it != end)
+        {
+            size_t batch_size{};
+            for (; batch_size < prefetch_block_size && it != end; ++batch_size, ++it)
+            {
+                batch[batch_size] = hash_and_fit(*it);
+
+                if constexpr (data_layout_mode != data_layout::compressed)
+                    detail::prefetch_for_read(data.data() + batch[batch_size].first);
+            }
+
+            for (size_t i = 0; i < batch_size; ++i)
+                result += block_contains(batch[i].first, batch[i].second);
+        }
+
+        return result;
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    /*!\brief Returns the number of hash functions used in the blocked Bloom Filter.
+     * \returns The number of hash functions.
+     */
+    size_t hash_function_count() const noexcept
+    {
+        return hash_funs;
+    }
+
+    /*!\brief Returns the size of the underlying bitvector.
+     * \returns The size in bits of the underlying bitvector. This is always a multiple of 512.
+     */
+    size_t bit_size() const noexcept
+    {
+        return size_in_bits;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    /*!\brief Test for equality.
+     * \param[in] lhs A `seqan3::blocked_bloom_filter`.
+     * \param[in] rhs `seqan3::blocked_bloom_filter` to compare to.
+     * \returns `true` if equal, `false` otherwise.
+     */
+    friend bool operator==(blocked_bloom_filter const & lhs, blocked_bloom_filter const & rhs) noexcept
+    {
+        return std::tie(lhs.size_in_bits, lhs.hash_shift, lhs.hash_funs, lhs.data)
+            == std::tie(rhs.size_in_bits, rhs.hash_shift, rhs.hash_funs, rhs.data);
+    }
+
+    /*!\brief Test for inequality.
+     * \param[in] lhs A `seqan3::blocked_bloom_filter`.
+     * \param[in] rhs `seqan3::blocked_bloom_filter` to compare to.
+     * \returns `true` if unequal, `false` otherwise.
+     */
+    friend bool operator!=(blocked_bloom_filter const & lhs, blocked_bloom_filter const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    /*!\name Access
+     * \{
+     */
+    /*!\brief Provides direct, unsafe access to the underlying data structure.
+     * \returns A reference to the bitvector, e.g. an SDSL bitvector for the compressed layout.
+     *
+     * \details
+     *
+     * \noapi{The exact representation of the data is implementation defined.}
+     */
+    constexpr data_type & raw_data() noexcept
+    {
+        return data;
+    }
+
+    //!\copydoc raw_data()
+    constexpr data_type const & raw_data() const noexcept
+    {
+        return data;
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param[in] archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+        requires (data_layout_mode != data_layout::mapped)
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(size_in_bits);
+        archive(hash_shift);
+        archive(hash_funs);
+        archive(data);
+    }
+    //!\endcond
+};
+
+} // namespace seqan3
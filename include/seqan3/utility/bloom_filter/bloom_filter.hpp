@@ -18,7 +18,7 @@ namespace seqan3
 {
 
 /*!\brief The Bloom Filter. A data structure that efficiently answers set-membership queries.
- * \tparam data_layout_mode_ Indicates whether the underlying data type is compressed. See seqan3::data_layout.
+ * \tparam data_layout_mode_ Indicates whether the underlying data type is compressed or mapped. See seqan3::data_layout.
  * \implements seqan3::cerealisable
  * \ingroup utility_bloom_filter
  *
@@ -71,6 +71,12 @@ namespace seqan3
  * `seqan3::bloom_filter`, in which case the underlying bitvector is compressed.
  * The compressed Bloom Filter is immutable, i.e. only querying is supported.
  *
+ * ### Memory mapping
+ *
+ * An uncompressed Bloom Filter can be stored with seqan3::bloom_filter::save_mapped.
+ * Constructing a `seqan3::bloom_filter<seqan3::data_layout::mapped>` from such a file maps the file into memory
+ * instead of reading it. The mapped Bloom Filter is immutable, i.e. only querying is supported.
+ *
  * ### Thread safety
  *
  * The Bloom Filter promises the basic thread-safety by the STL that all
@@ -90,8 +96,11 @@ private:
     //!\endcond
 
     //!\brief The underlying datatype to use.
-    using data_type =
-        std::conditional_t<data_layout_mode_ == data_layout::uncompressed, sdsl::bit_vector, sdsl::sd_vector<>>;
+    using data_type = std::conditional_t<data_layout_mode_ == data_layout::uncompressed,
+                                         sdsl::bit_vector,
+                                         std::conditional_t<data_layout_mode_ == data_layout::compressed,
+                                                            sdsl::sd_vector<>,
+                                                            detail::mapped_bit_vector>>;
 
     //!\brief The size of the underlying bit vector in bits.
     size_t size_in_bits{};
@@ -107,6 +116,8 @@ private:
                                                       10650232656628343401ULL, // 2**64 / sqrt(3)
                                                       16499269484942379435ULL, // 2**64 / (sqrt(5)/2)
                                                       4893150838803335377ULL}; // 2**64 / (3*pi/5)
+    //!\brief Identifies files written by seqan3::bloom_filter::save_mapped.
+    static constexpr std::string_view mapped_magic{"SEQ3__BF"};
 
     /*!\brief Perturbs a value and fits it into the vector.
      * \param h The value to process.
@@ -188,8 +199,52 @@ public:
 
         data = sdsl::sd_vector<>{bf.data};
     }
+
+    /*!\brief Construct a mapped Bloom Filter from a file written by seqan3::bloom_filter::save_mapped.
+     * \param[in] path The file to map.
+     * \param[in] options The seqan3::mapping_options.
+     * \throws seqan3::file_open_error If the file cannot be mapped.
+     * \throws seqan3::format_error If the file does not contain a Bloom Filter.
+     *
+     * \attention This constructor can only be used to construct **mapped** Bloom Filters.
+     *
+     * \details
+     *
+     * The file is mapped into memory and not read. The file must not be modified while it is mapped.
+     */
+    explicit bloom_filter(std::filesystem::path const & path, mapping_options const options = {})
+        requires (data_layout_mode == data_layout::mapped)
+    {
+        std::array<uint64_t, 3> metadata;
+        data = detail::read_mapped_bit_vector(path, mapped_magic, metadata, options.populate, options.will_need);
+        std::tie(size_in_bits, hash_shift, hash_funs) = std::tuple_cat(metadata);
+
+        if (data.size() != size_in_bits || size_in_bits == 0 || hash_funs == 0 || hash_funs > 5)
+            throw format_error{"The file " + path.string() + " does not contain a valid Bloom Filter."};
+    }
     //!\}
 
+    /*!\brief Stores the Bloom Filter such that it can be memory mapped.
+     * \param[in] path The file to write.
+     * \throws seqan3::file_open_error If the file cannot be opened.
+     * \throws seqan3::io_error If writing fails.
+     *
+     * \attention This function is only available for **uncompressed** Bloom Filters.
+     *
+     * \details
+     *
+     * The file can be mapped by constructing a `seqan3::bloom_filter<seqan3::data_layout::mapped>`.
+     * The layout stores the raw bitvector and depends on the byte order of the host.
+     */
+    void save_mapped(std::filesystem::path const & path) const
+        requires (data_layout_mode == data_layout::uncompressed)
+    {
+        detail::write_mapped_bit_vector(path,
+                                        mapped_magic,
+                                        std::array<uint64_t, 3>{size_in_bits, hash_shift, hash_funs},
+                                        data);
+    }
+
     /*!\name Modifiers
      * \{
      */
@@ -370,6 +425,7 @@ public:
      * \attention These functions are never called directly, see \ref serialisation for more details.
      */
     template <cereal_archive archive_t>
+        requires (data_layout_mode != data_layout::mapped)
     void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
     {
         archive(size_in_bits);
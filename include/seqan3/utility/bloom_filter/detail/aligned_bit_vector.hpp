@@ -0,0 +1,176 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::aligned_bit_vector.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+#include <sdsl/bit_vectors.hpp>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/utility/container/aligned_allocator.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A bitvector whose words are aligned to a cache line.
+ * \ingroup utility_bloom_filter
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * Offers the subset of the sdsl::bit_vector interface that is needed by the seqan3::blocked_bloom_filter. Every
+ * 512-bit block of the bitvector, i.e. every 8th word, starts at a cache line boundary.
+ *
+ * The bitvector is serialised as a sdsl::bit_vector, i.e. archives are compatible with an sdsl::bit_vector of the
+ * same bits.
+ */
+class aligned_bit_vector
+{
+public:
+    //!\brief The alignment of the words in bytes.
+    static constexpr size_t alignment{64u};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    aligned_bit_vector() = default;                                       //!< Defaulted.
+    aligned_bit_vector(aligned_bit_vector const &) = default;             //!< Defaulted.
+    aligned_bit_vector & operator=(aligned_bit_vector const &) = default; //!< Defaulted.
+    aligned_bit_vector(aligned_bit_vector &&) = default;                  //!< Defaulted.
+    aligned_bit_vector & operator=(aligned_bit_vector &&) = default;      //!< Defaulted.
+    ~aligned_bit_vector() = default;                                      //!< Defaulted.
+
+    /*!\brief Construct a bitvector of `size` bits that are all 0.
+     * \param[in] size The number of bits.
+     */
+    explicit aligned_bit_vector(size_t const size) : words((size + 63u) >> 6), size_in_bits{size}
+    {}
+
+    /*!\brief Construct from the bits of a sdsl::bit_vector.
+     * \param[in] bits The bits.
+     */
+    explicit aligned_bit_vector(sdsl::bit_vector const & bits) : aligned_bit_vector{bits.size()}
+    {
+        std::memcpy(words.data(), bits.data(), words.size() * sizeof(uint64_t));
+    }
+    //!\}
+
+    //!\brief Returns a sdsl::bit_vector with the same bits.
+    sdsl::bit_vector to_sdsl() const
+    {
+        sdsl::bit_vector bits(size_in_bits);
+        std::memcpy(bits.data(), words.data(), words.size() * sizeof(uint64_t));
+        return bits;
+    }
+
+    //!\brief Returns the number of bits.
+    size_t size() const noexcept
+    {
+        return size_in_bits;
+    }
+
+    //!\brief Returns a pointer to the first word of the bitvector.
+    uint64_t * data() noexcept
+    {
+        return words.data();
+    }
+
+    //!\copydoc data()
+    uint64_t const * data() const noexcept
+    {
+        return words.data();
+    }
+
+    //!\brief Returns the i-th bit.
+    bool operator[](size_t const i) const noexcept
+    {
+        assert(i < size());
+        return (words[i >> 6] >> (i & 63u)) & 1u;
+    }
+
+    //!\brief Sets the i-th bit to 1.
+    void set(size_t const i) noexcept
+    {
+        assert(i < size());
+        words[i >> 6] |= uint64_t{1} << (i & 63u);
+    }
+
+    //!\brief Sets all bits to 0.
+    void reset() noexcept
+    {
+        std::ranges::fill(words, 0u);
+    }
+
+    /*!\brief Returns `len` bits starting at bit position `idx`.
+     * \param[in] idx The position of the first bit.
+     * \param[in] len The number of bits. At most 64.
+     */
+    uint64_t get_int(size_t const idx, uint8_t const len = 64) const noexcept
+    {
+        assert(idx < size());
+        assert(len > 0u && len <= 64u);
+
+        size_t const word_idx = idx >> 6;
+        size_t const offset = idx & 63u;
+
+        uint64_t result = words[word_idx] >> offset;
+        if (offset + len > 64u && word_idx + 1 < words.size())
+            result |= words[word_idx + 1] << (64u - offset);
+
+        return (len == 64u) ? result : result & ((1ULL << len) - 1u);
+    }
+
+    //!\brief Test for equality. The bits beyond the size are always 0.
+    friend bool operator==(aligned_bit_vector const & lhs, aligned_bit_vector const & rhs) noexcept
+    {
+        return lhs.size_in_bits == rhs.size_in_bits && std::ranges::equal(lhs.words, rhs.words);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_output_archive.
+     * \param[in] archive The archive being serialised to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_output_archive archive_t>
+    void CEREAL_SAVE_FUNCTION_NAME(archive_t & archive) const
+    {
+        archive(to_sdsl());
+    }
+
+    /*!\brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_input_archive.
+     * \param[in] archive The archive being serialised from.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_input_archive archive_t>
+    void CEREAL_LOAD_FUNCTION_NAME(archive_t & archive)
+    {
+        sdsl::bit_vector bits{};
+        archive(bits);
+        *this = aligned_bit_vector{bits};
+    }
+    //!\endcond
+
+private:
+    //!\brief The words of the bitvector.
+    std::vector<uint64_t, aligned_allocator<uint64_t, alignment>> words{};
+    //!\brief The number of bits.
+    size_t size_in_bits{};
+};
+
+} // namespace seqan3::detail
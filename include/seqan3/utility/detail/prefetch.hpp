@@ -0,0 +1,55 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::prefetch_for_read and seqan3::detail::prefetch_for_write.
+ */
+
+#pragma once
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Hints the processor to load the cache line containing `address` for a subsequent read.
+ * \ingroup utility
+ * \tparam locality The temporal locality of the access, from `0` (no locality) to `3` (high locality).
+ * \param[in] address The address to prefetch. It does not need to be dereferenceable, e.g. a past-the-end pointer.
+ *
+ * \details
+ *
+ * This is a no-op if the compiler does not provide `__builtin_prefetch`.
+ */
+template <int locality = 3>
+inline void prefetch_for_read([[maybe_unused]] void const * address) noexcept
+{
+    static_assert(locality >= 0 && locality <= 3, "The locality must be in the range [0, 3].");
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, locality);
+#endif
+}
+
+/*!\brief Hints the processor to load the cache line containing `address` for a subsequent write.
+ * \ingroup utility
+ * \tparam locality The temporal locality of the access, from `0` (no locality) to `3` (high locality).
+ * \param[in] address The address to prefetch. It does not need to be dereferenceable, e.g. a past-the-end pointer.
+ *
+ * \details
+ *
+ * This is a no-op if the compiler does not provide `__builtin_prefetch`.
+ */
+template <int locality = 3>
+inline void prefetch_for_write([[maybe_unused]] void const * address) noexcept
+{
+    static_assert(locality >= 0 && locality <= 3, "The locality must be in the range [0, 3].");
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 1, locality);
+#endif
+}
+
+} // namespace seqan3::detail
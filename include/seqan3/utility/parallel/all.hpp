@@ -6,12 +6,10 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Meta-header for the \cond DEV \link utility_parallel Utility / Parallel submodule \endlink \endcond.
+ * \brief Meta-header for the \link utility_parallel Utility / Parallel submodule \endlink.
  * \author Rene Rahn <rene.rahn AT fu-berlin.de>
  */
 
-//!\cond DEV
-
 /*!\defgroup utility_parallel Parallel
  * \brief This module contains types and utilities for concurrent execution of algorithms in SeqAn.
  * \ingroup utility
@@ -19,16 +17,16 @@
  *
  * \details
  *
- * ### Execution policies
+ * ### Thread pools
  *
- * Here are currently only implementations which are part of detail and therefore not of interest for the common user.
+ * seqan3::thread_pool is a pool of threads that can be reused by several calls of the parallel algorithms.
  *
  * ### Concurrency support
  *
  * This module contains helper classes to synchronise threads in concurrent environments.
  */
-//!\endcond
 
 #pragma once
 
 #include <seqan3/core/platform.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
@@ -14,4 +14,6 @@
 
 #include <seqan3/utility/parallel/detail/latch.hpp>
 #include <seqan3/utility/parallel/detail/reader_writer_manager.hpp>
+#include <seqan3/utility/parallel/detail/small_buffer_task.hpp>
 #include <seqan3/utility/parallel/detail/spin_delay.hpp>
+#include <seqan3/utility/parallel/detail/work_stealing_scheduler.hpp>
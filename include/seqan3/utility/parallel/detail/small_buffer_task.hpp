@@ -0,0 +1,185 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::small_buffer_task.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace seqan3::detail
+{
+
+/*!\brief A move-only, type-erased task that stores small callables without allocating memory.
+ * \ingroup utility_parallel
+ *
+ * \details
+ *
+ * Stores a callable that is invocable without arguments and returns nothing, like a `std::function<void()>`.
+ * Callables that fit into seqan3::detail::small_buffer_task::buffer_size bytes and are nothrow move constructible are
+ * stored inside the task, larger callables are allocated on the heap. A task is 64 bytes large, i.e. as large as a
+ * typical cache line, but it is only aligned for `std::max_align_t` and may hence span two cache lines.
+ *
+ * In contrast to `std::function`, the callable does not need to be copyable and moving a task never throws.
+ */
+class small_buffer_task
+{
+public:
+    //!\brief The number of bytes that can be stored without allocating memory.
+    static constexpr size_t buffer_size{64u - sizeof(void *)};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    small_buffer_task() noexcept = default;                            //!< Defaulted.
+    small_buffer_task(small_buffer_task const &) = delete;             //!< Deleted.
+    small_buffer_task & operator=(small_buffer_task const &) = delete; //!< Deleted.
+
+    //!\brief Move constructor; the moved-from task is empty.
+    small_buffer_task(small_buffer_task && other) noexcept
+    {
+        move_from(other);
+    }
+
+    //!\brief Move assignment; the moved-from task is empty.
+    small_buffer_task & operator=(small_buffer_task && other) noexcept
+    {
+        if (this != std::addressof(other))
+        {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    //!\brief Destroys the stored callable.
+    ~small_buffer_task()
+    {
+        reset();
+    }
+
+    /*!\brief Stores the given callable.
+     * \tparam task_t The type of the callable; must be invocable without arguments and move constructible.
+     * \param[in] task The callable.
+     */
+    template <typename task_t>
+        requires (!std::same_as<std::remove_cvref_t<task_t>, small_buffer_task>)
+              && std::invocable<std::decay_t<task_t> &> && std::move_constructible<std::decay_t<task_t>>
+    small_buffer_task(task_t && task) : operations{std::addressof(operations_for<std::decay_t<task_t>>)}
+    {
+        using stored_t = std::decay_t<task_t>;
+
+        if constexpr (is_stored_inline<stored_t>)
+            ::new (static_cast<void *>(buffer)) stored_t(std::forward<task_t>(task));
+        else
+            ::new (static_cast<void *>(buffer)) stored_t *(new stored_t(std::forward<task_t>(task)));
+    }
+    //!\}
+
+    /*!\brief Invokes the stored callable.
+     * \attention The task must not be empty.
+     */
+    void operator()()
+    {
+        assert(operations != nullptr);
+        operations->invoke(buffer);
+    }
+
+    //!\brief Whether a callable is stored.
+    explicit operator bool() const noexcept
+    {
+        return operations != nullptr;
+    }
+
+    //!\brief Whether callables of the given type are stored without allocating memory.
+    template <typename task_t>
+    static constexpr bool is_stored_inline = sizeof(task_t) <= buffer_size
+                                          && alignof(task_t) <= alignof(std::max_align_t)
+                                          && std::is_nothrow_move_constructible_v<task_t>;
+
+private:
+    //!\brief The type-specific operations on the buffer.
+    struct operations_type
+    {
+        //!\brief Invokes the callable.
+        void (*invoke)(std::byte *);
+        //!\brief Move constructs the callable into the first buffer and destroys the callable in the second buffer.
+        void (*relocate)(std::byte *, std::byte *) noexcept;
+        //!\brief Destroys the callable.
+        void (*destroy)(std::byte *) noexcept;
+    };
+
+    //!\brief Returns the callable of the given type stored in the buffer.
+    template <typename task_t>
+    static task_t & stored(std::byte * buffer) noexcept
+    {
+        if constexpr (is_stored_inline<task_t>)
+            return *std::launder(reinterpret_cast<task_t *>(buffer));
+        else
+            return **std::launder(reinterpret_cast<task_t **>(buffer));
+    }
+
+    //!\brief The operations on a callable of the given type.
+    template <typename task_t>
+    static constexpr operations_type operations_for{
+        [](std::byte * buffer)
+        {
+            stored<task_t>(buffer)();
+        },
+        [](std::byte * target, std::byte * source) noexcept
+        {
+            if constexpr (is_stored_inline<task_t>)
+            {
+                task_t & task = stored<task_t>(source);
+                ::new (static_cast<void *>(target)) task_t(std::move(task));
+                task.~task_t();
+            }
+            else
+            {
+                ::new (static_cast<void *>(target)) task_t *(std::addressof(stored<task_t>(source)));
+            }
+        },
+        [](std::byte * buffer) noexcept
+        {
+            if constexpr (is_stored_inline<task_t>)
+                stored<task_t>(buffer).~task_t();
+            else
+                delete std::addressof(stored<task_t>(buffer));
+        }};
+
+    //!\brief Takes over the callable of another task.
+    void move_from(small_buffer_task & other) noexcept
+    {
+        if (other.operations != nullptr)
+        {
+            other.operations->relocate(buffer, other.buffer);
+            operations = std::exchange(other.operations, nullptr);
+        }
+    }
+
+    //!\brief Destroys the stored callable.
+    void reset() noexcept
+    {
+        if (operations != nullptr)
+            std::exchange(operations, nullptr)->destroy(buffer);
+    }
+
+    //!\brief Stores the callable or a pointer to the callable.
+    alignas(std::max_align_t) std::byte buffer[buffer_size];
+    //!\brief The operations on the stored callable or `nullptr` if no callable is stored.
+    operations_type const * operations{nullptr};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,478 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::work_stealing_scheduler and seqan3::detail::task_group.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <seqan3/std/new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#    include <pthread.h>
+#    include <sched.h>
+#endif
+
+#include <seqan3/utility/parallel/detail/small_buffer_task.hpp>
+#include <seqan3/utility/parallel/detail/spin_delay.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A thread pool that balances the tasks between its threads by work stealing.
+ * \ingroup utility_parallel
+ *
+ * \details
+ *
+ * Every thread owns a double-ended queue of tasks. A task submitted by a thread of the pool is pushed to the back of
+ * the queue of this thread, other tasks are distributed round-robin over all queues. A thread takes the tasks from the
+ * back of its own queue, i.e. it processes the most recently submitted tasks first. If its own queue is empty, it
+ * steals the oldest task from the front of the queue of another thread. This way, the tasks that split a large task
+ * into smaller ones are processed by idle threads while the submitting thread continues to work on its own tasks.
+ *
+ * Tasks may submit further tasks and wait for them via seqan3::detail::task_group.
+ *
+ * The tasks are stored as seqan3::detail::small_buffer_task, i.e. submitting a small task does not allocate memory.
+ * Idle threads sleep and are only woken up if a task is submitted while they sleep.
+ * seqan3::detail::work_stealing_scheduler::shared returns a process-wide scheduler that is shared by all parallel
+ * algorithms with the same number of threads, such that the threads are not spawned anew for every call.
+ *
+ * On Linux, the threads can be pinned to given CPUs, e.g. the CPUs of one NUMA node. On other platforms, the CPUs are
+ * ignored.
+ *
+ * \note Instances of this class are neither copyable nor movable.
+ *
+ * ### Thread safety
+ *
+ * All member functions are thread-safe.
+ */
+class work_stealing_scheduler
+{
+public:
+    //!\brief The type erased task type.
+    using task_type = small_buffer_task;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    work_stealing_scheduler() = delete;                                             //!< Deleted.
+    work_stealing_scheduler(work_stealing_scheduler const &) = delete;             //!< Deleted.
+    work_stealing_scheduler(work_stealing_scheduler &&) = delete;                  //!< Deleted.
+    work_stealing_scheduler & operator=(work_stealing_scheduler const &) = delete; //!< Deleted.
+    work_stealing_scheduler & operator=(work_stealing_scheduler &&) = delete;      //!< Deleted.
+
+    /*!\brief Spawns `thread_count` many threads.
+     * \param thread_count The number of threads to spawn.
+     * \param cpus The CPUs to pin the threads to; thread `i` runs on CPU `cpus[i % cpus.size()]`. If empty, the threads
+     *             are not pinned.
+     * \throws std::invalid_argument if `thread_count` is 0 or a CPU id is not supported by the platform.
+     */
+    explicit work_stealing_scheduler(size_t const thread_count, std::vector<size_t> const & cpus = {}) :
+        queues(thread_count)
+    {
+        if (thread_count == 0u)
+            throw std::invalid_argument{"The work_stealing_scheduler needs at least one thread."};
+
+#if defined(__linux__)
+        for (size_t const cpu : cpus)
+            if (cpu >= CPU_SETSIZE)
+                throw std::invalid_argument{"The CPU " + std::to_string(cpu) + " is not supported."};
+#endif
+
+        threads.reserve(thread_count);
+        for (size_t id = 0; id < thread_count; ++id)
+        {
+            threads.emplace_back(
+                [this, id]()
+                {
+                    worker_loop(id);
+                });
+
+            if (!cpus.empty())
+                pin(threads.back(), cpus[id % cpus.size()]);
+        }
+    }
+
+    //!\brief Processes all remaining tasks and joins the threads.
+    ~work_stealing_scheduler()
+    {
+        {
+            std::lock_guard lock{sleep_mutex};
+            stop = true;
+        }
+        sleep_cv.notify_all();
+
+        for (auto & thread : threads)
+            thread.join();
+    }
+    //!\}
+
+    /*!\brief Submits a task.
+     * \param[in] task The task to execute.
+     *
+     * \details
+     *
+     * If the calling thread belongs to this scheduler, the task is pushed to the back of its own queue.
+     */
+    void submit(task_type task)
+    {
+        size_t const id = is_worker_thread() ? current_worker().id : next_queue++ % queues.size();
+        {
+            std::lock_guard lock{queues[id].mutex};
+            queues[id].tasks.push_back(std::move(task));
+        }
+        ++queued;
+
+        // A thread that goes to sleep afterwards sees the task. Otherwise, synchronise with the sleeping threads, such
+        // that the notification is not lost.
+        if (sleeping.load() > 0u)
+        {
+            {
+                std::lock_guard lock{sleep_mutex};
+            }
+            sleep_cv.notify_one();
+        }
+    }
+
+    /*!\brief Executes one pending task if there is any.
+     * \returns `true` if a task was executed, `false` otherwise.
+     *
+     * \details
+     *
+     * A thread of the scheduler first takes the most recent task of its own queue, any thread steals the oldest task
+     * of the other queues otherwise.
+     */
+    bool run_pending_task()
+    {
+        task_type task = take_task();
+        if (!task)
+            return false;
+
+        task();
+        return true;
+    }
+
+    //!\brief Returns the number of threads.
+    size_t thread_count() const noexcept
+    {
+        return threads.size();
+    }
+
+    //!\brief Whether the calling thread belongs to this scheduler.
+    bool is_worker_thread() const noexcept
+    {
+        return current_worker().scheduler == this;
+    }
+
+    //!\brief Returns the scheduler the calling thread belongs to or `nullptr` if it does not belong to a scheduler.
+    static work_stealing_scheduler * current() noexcept
+    {
+        return current_worker().scheduler;
+    }
+
+    /*!\brief Returns the process-wide scheduler with the given number of threads.
+     * \param thread_count The number of threads.
+     * \returns A reference-counted pointer to the scheduler; the scheduler must only be used while it is held.
+     * \throws std::invalid_argument if `thread_count` is 0.
+     *
+     * \details
+     *
+     * The scheduler is constructed if no scheduler with this number of threads is in use and destructed when the
+     * last pointer to it is released. Additionally, the most recently requested scheduler is kept until a scheduler
+     * with another number of threads is requested, such that consecutive calls with the same number of threads reuse
+     * the threads. Hence, at most one scheduler is kept alive without being used. Its threads sleep while there are
+     * no tasks.
+     *
+     * The last pointer to a scheduler must not be released by one of its threads.
+     *
+     * ### Thread safety
+     *
+     * Thread-safe.
+     */
+    static std::shared_ptr<work_stealing_scheduler> shared(size_t const thread_count)
+    {
+        static std::mutex mutex{};
+        static std::map<size_t, std::weak_ptr<work_stealing_scheduler>> schedulers{};
+        static std::shared_ptr<work_stealing_scheduler> retained{};
+
+        // A replaced scheduler that is not in use anymore joins its threads after the lock is released.
+        std::shared_ptr<work_stealing_scheduler> replaced{};
+        std::lock_guard lock{mutex};
+
+        std::shared_ptr<work_stealing_scheduler> scheduler = schedulers[thread_count].lock();
+        if (scheduler == nullptr)
+        {
+            std::erase_if(schedulers,
+                          [thread_count](auto const & entry)
+                          {
+                              return entry.first != thread_count && entry.second.expired();
+                          });
+
+            try
+            {
+                scheduler = std::make_shared<work_stealing_scheduler>(thread_count);
+            }
+            catch (...)
+            {
+                schedulers.erase(thread_count);
+                throw;
+            }
+            schedulers[thread_count] = scheduler;
+        }
+
+        replaced = std::exchange(retained, scheduler);
+        return scheduler;
+    }
+
+private:
+    //!\brief The queue of a thread.
+    struct alignas(std::hardware_destructive_interference_size) worker_queue
+    {
+        //!\brief Protects the tasks.
+        std::mutex mutex{};
+        //!\brief The tasks.
+        std::deque<task_type> tasks{};
+    };
+
+    //!\brief Identifies the scheduler and the queue of a thread.
+    struct worker_info
+    {
+        //!\brief The scheduler the thread belongs to.
+        work_stealing_scheduler * scheduler{};
+        //!\brief The id of the queue owned by the thread.
+        size_t id{};
+    };
+
+    //!\brief Returns the seqan3::detail::work_stealing_scheduler::worker_info of the calling thread.
+    static worker_info & current_worker() noexcept
+    {
+        static thread_local worker_info info{};
+        return info;
+    }
+
+    //!\brief Restricts the thread to the given CPU; does nothing if this is not supported by the platform.
+    static void pin([[maybe_unused]] std::thread & thread, [[maybe_unused]] size_t const cpu) noexcept
+    {
+#if defined(__linux__)
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpu, &cpu_set);
+        // Pinning is only a hint for the operating system, e.g. the CPU might not be available to this process.
+        pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpu_set);
+#endif
+    }
+
+    //!\brief Takes a task from the own queue or steals one from another queue.
+    task_type take_task()
+    {
+        if (queued.load(std::memory_order_acquire) == 0u)
+            return {};
+
+        bool const is_worker = is_worker_thread();
+        size_t const own_id = is_worker ? current_worker().id : 0u;
+
+        if (is_worker)
+        {
+            worker_queue & queue = queues[own_id];
+            std::lock_guard lock{queue.mutex};
+            if (!queue.tasks.empty())
+            {
+                task_type task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                --queued;
+                return task;
+            }
+        }
+
+        for (size_t i = is_worker; i < queues.size(); ++i)
+        {
+            worker_queue & queue = queues[(own_id + i) % queues.size()];
+            std::lock_guard lock{queue.mutex};
+            if (!queue.tasks.empty())
+            {
+                task_type task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                --queued;
+                return task;
+            }
+        }
+
+        return {};
+    }
+
+    //!\brief Processes tasks until the scheduler is destructed.
+    void worker_loop(size_t const id)
+    {
+        current_worker() = worker_info{this, id};
+
+        for (;;)
+        {
+            if (run_pending_task())
+                continue;
+
+            std::unique_lock lock{sleep_mutex};
+            ++sleeping;
+            sleep_cv.wait(lock,
+                          [this]()
+                          {
+                              return stop || queued.load() > 0u;
+                          });
+            --sleeping;
+
+            if (stop && queued.load() == 0u)
+                return;
+        }
+    }
+
+    //!\brief The queues of the threads.
+    std::vector<worker_queue> queues;
+    //!\brief The threads.
+    std::vector<std::thread> threads{};
+    //!\brief The number of tasks in all queues.
+    alignas(std::hardware_destructive_interference_size) std::atomic<size_t> queued{};
+    //!\brief The queue that receives the next task submitted by a thread that does not belong to the scheduler.
+    alignas(std::hardware_destructive_interference_size) std::atomic<size_t> next_queue{};
+    //!\brief The number of threads that sleep or are about to sleep.
+    std::atomic<size_t> sleeping{};
+    //!\brief Protects seqan3::detail::work_stealing_scheduler::stop and lets idle threads sleep.
+    std::mutex sleep_mutex{};
+    //!\brief Notifies idle threads about new tasks.
+    std::condition_variable sleep_cv{};
+    //!\brief Whether the scheduler is destructed.
+    bool stop{false};
+};
+
+/*!\brief Submits tasks to a seqan3::detail::work_stealing_scheduler and waits for their completion.
+ * \ingroup utility_parallel
+ *
+ * \details
+ *
+ * A thread of the scheduler that waits for the task group executes pending tasks in the meantime, such that tasks can
+ * wait for the tasks they submitted without blocking a thread of the scheduler. Any other thread sleeps until all tasks
+ * are completed.
+ *
+ * If a task throws an exception, the first exception is rethrown by seqan3::detail::task_group::wait.
+ *
+ * \note Instances of this class are neither copyable nor movable. The destructor waits for all tasks.
+ *
+ * ### Thread safety
+ *
+ * seqan3::detail::task_group::run is thread-safe.
+ */
+class task_group
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    task_group() = delete;                               //!< Deleted.
+    task_group(task_group const &) = delete;             //!< Deleted.
+    task_group(task_group &&) = delete;                  //!< Deleted.
+    task_group & operator=(task_group const &) = delete; //!< Deleted.
+    task_group & operator=(task_group &&) = delete;      //!< Deleted.
+
+    //!\brief Constructs a task group for the given scheduler.
+    explicit task_group(work_stealing_scheduler & scheduler) noexcept : scheduler{std::addressof(scheduler)}
+    {}
+
+    //!\brief Waits for all tasks; exceptions are discarded.
+    ~task_group()
+    {
+        wait_for_tasks();
+    }
+    //!\}
+
+    /*!\brief Submits a task.
+     * \tparam task_t The type of the task; must be invocable without arguments.
+     * \param[in] task The task to execute.
+     */
+    template <typename task_t>
+        requires std::invocable<task_t &>
+    void run(task_t task)
+    {
+        ++pending;
+        scheduler->submit(
+            [this, task = std::move(task)]() mutable
+            {
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                    std::lock_guard lock{mutex};
+                    if (!exception)
+                        exception = std::current_exception();
+                }
+
+                // The task group might be destructed as soon as the mutex is released.
+                std::lock_guard lock{mutex};
+                if (pending.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+                    completed_cv.notify_all();
+            });
+    }
+
+    /*!\brief Waits for all submitted tasks.
+     * \throws The first exception thrown by a task.
+     */
+    void wait()
+    {
+        wait_for_tasks();
+
+        std::lock_guard lock{mutex};
+        if (exception)
+            std::rethrow_exception(std::exchange(exception, nullptr));
+    }
+
+private:
+    //!\brief Waits for all submitted tasks and executes pending tasks in the meantime if possible.
+    void wait_for_tasks()
+    {
+        if (scheduler->is_worker_thread())
+        {
+            spin_delay delay{};
+            while (pending.load(std::memory_order_acquire) > 0u)
+            {
+                if (!scheduler->run_pending_task())
+                    delay.wait();
+            }
+        }
+
+        std::unique_lock lock{mutex};
+        completed_cv.wait(lock,
+                          [this]()
+                          {
+                              return pending.load(std::memory_order_acquire) == 0u;
+                          });
+    }
+
+    //!\brief The scheduler.
+    work_stealing_scheduler * scheduler;
+    //!\brief The number of submitted tasks that are not completed.
+    std::atomic<size_t> pending{};
+    //!\brief Protects seqan3::detail::task_group::exception and the completion of a task.
+    std::mutex mutex{};
+    //!\brief Notifies the waiting thread about the completion of all tasks.
+    std::condition_variable completed_cv{};
+    //!\brief The first exception thrown by a task.
+    std::exception_ptr exception{};
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,136 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::thread_pool.
+ */
+
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/utility/parallel/detail/work_stealing_scheduler.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A pool of threads that can be passed to several parallel algorithm calls.
+ * \ingroup utility_parallel
+ *
+ * \details
+ *
+ * The threads are spawned on construction and joined on destruction. In between, they execute the tasks of all
+ * algorithms that are configured with this pool, e.g. via seqan3::align_cfg::executor or seqan3::search_cfg::executor.
+ * Idle threads sleep. Hence, a long-running application can construct the pool once and does not pay for spawning
+ * threads in every call of seqan3::align_pairwise or seqan3::search.
+ *
+ * The threads can be pinned to CPUs, for example, to all CPUs of one NUMA node
+ * (see seqan3::thread_pool::numa_node_cpus). Pinning is only supported on Linux and ignored on other platforms.
+ *
+ * The pool must outlive all algorithm calls and result ranges that use it.
+ *
+ * \note Instances of this class are neither copyable nor movable.
+ *
+ * ### Example
+ *
+ * \include test/snippet/utility/parallel/thread_pool.cpp
+ *
+ * ### Thread safety
+ *
+ * All member functions are thread-safe. Multiple threads may use the same pool at the same time.
+ */
+class thread_pool
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    thread_pool() = delete;                                 //!< Deleted.
+    thread_pool(thread_pool const &) = delete;             //!< Deleted.
+    thread_pool(thread_pool &&) = delete;                  //!< Deleted.
+    thread_pool & operator=(thread_pool const &) = delete; //!< Deleted.
+    thread_pool & operator=(thread_pool &&) = delete;      //!< Deleted.
+    ~thread_pool() = default;                              //!< Processes all remaining tasks and joins the threads.
+
+    /*!\brief Spawns `thread_count` many threads.
+     * \param thread_count The number of threads to spawn; must be greater than `0`.
+     * \throws std::invalid_argument if `thread_count` is 0.
+     */
+    explicit thread_pool(size_t const thread_count) : threads{thread_count}
+    {}
+
+    /*!\brief Spawns `thread_count` many threads that are pinned to the given CPUs.
+     * \param thread_count The number of threads to spawn; must be greater than `0`.
+     * \param cpus The ids of the CPUs; thread `i` is pinned to CPU `cpus[i % cpus.size()]`. If empty, the threads are
+     *             not pinned.
+     * \throws std::invalid_argument if `thread_count` is 0 or a CPU id is not supported by the platform.
+     */
+    thread_pool(size_t const thread_count, std::vector<size_t> const & cpus) : threads{thread_count, cpus}
+    {}
+    //!\}
+
+    //!\brief Returns the number of threads.
+    size_t thread_count() const noexcept
+    {
+        return threads.thread_count();
+    }
+
+    /*!\brief Returns the ids of the CPUs that belong to the given NUMA node.
+     * \param node The id of the NUMA node.
+     * \returns The CPU ids in increasing order or an empty vector if the node does not exist or the information is not
+     *          available on this platform.
+     *
+     * \details
+     *
+     * On Linux, the CPUs are read from `/sys/devices/system/node/node<node>/cpulist`.
+     */
+    static std::vector<size_t> numa_node_cpus(size_t const node)
+    {
+        std::vector<size_t> cpus{};
+        std::ifstream cpu_list{"/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"};
+        std::string line{};
+        if (!std::getline(cpu_list, line))
+            return cpus;
+
+        // The list has the format "0-3,8,10-11".
+        std::istringstream ranges{line};
+        std::string range{};
+        while (std::getline(ranges, range, ','))
+        {
+            size_t const separator = range.find('-');
+            try
+            {
+                size_t const first = std::stoul(range.substr(0, separator));
+                size_t const last = separator == std::string::npos ? first : std::stoul(range.substr(separator + 1));
+                for (size_t cpu = first; cpu <= last; ++cpu)
+                    cpus.push_back(cpu);
+            }
+            catch (std::logic_error const &) // Malformed entry.
+            {
+                return {};
+            }
+        }
+        return cpus;
+    }
+
+    //!\cond DEV
+    //!\brief Returns the scheduler that executes the tasks.
+    detail::work_stealing_scheduler & scheduler() noexcept
+    {
+        return threads;
+    }
+    //!\endcond
+
+private:
+    //!\brief The threads.
+    detail::work_stealing_scheduler threads;
+};
+
+} // namespace seqan3
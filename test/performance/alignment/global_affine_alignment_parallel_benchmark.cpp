@@ -88,12 +88,12 @@ void seqan3_affine_dna4_parallel(benchmark::State & state)
 
     auto data = seqan3::views::zip(vec1, vec2) | seqan3::ranges::to<std::vector>();
 
+    // The number of threads is the benchmark argument.
+    uint32_t const thread_count = state.range(0);
     int64_t total = 0;
     for (auto _ : state)
     {
-        for (auto && res :
-             align_pairwise(data,
-                            affine_cfg | result_t{} | seqan3::align_cfg::parallel{std::thread::hardware_concurrency()}))
+        for (auto && res : align_pairwise(data, affine_cfg | result_t{} | seqan3::align_cfg::parallel{thread_count}))
         {
             total += res.score();
         }
@@ -104,8 +104,14 @@ void seqan3_affine_dna4_parallel(benchmark::State & state)
     state.counters["total"] = total;
 }
 
-BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel, score)->UseRealTime();
-BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel, trace)->UseRealTime();
+// Scales from 1 to all available threads.
+static void thread_counts(benchmark::internal::Benchmark * benchmark)
+{
+    benchmark->DenseRange(1, std::max<int>(std::thread::hardware_concurrency(), 1))->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel, score)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(seqan3_affine_dna4_parallel, trace)->Apply(thread_counts);
 
 #if defined(_OPENMP)
 template <typename result_t>
@@ -0,0 +1,67 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <seqan3/search/dream_index/hierarchical_interleaved_bloom_filter.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// User bins of heterogeneous sizes: every 16th user bin is 100 times larger than the others.
+static std::vector<std::vector<size_t>> generate_user_bins(size_t const number_of_user_bins)
+{
+    std::vector<std::vector<size_t>> user_bins(number_of_user_bins);
+
+    for (size_t user_bin = 0; user_bin < number_of_user_bins; ++user_bin)
+        user_bins[user_bin] = seqan3::test::generate_numeric_sequence<size_t>((user_bin % 16u == 0u) ? 10'000u : 100u,
+                                                                              std::numeric_limits<size_t>::lowest(),
+                                                                              std::numeric_limits<size_t>::max(),
+                                                                              user_bin);
+
+    return user_bins;
+}
+
+static void arguments(benchmark::internal::Benchmark * b)
+{
+    for (int32_t user_bins : {256, 1024, 4096})
+        b->Args({user_bins});
+}
+
+void hibf_query_benchmark(::benchmark::State & state)
+{
+    auto user_bins = generate_user_bins(state.range(0));
+    seqan3::hierarchical_interleaved_bloom_filter hibf{user_bins, {.tmax = 64u}};
+    auto agent = hibf.membership_agent();
+    auto const & query = user_bins[1];
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(agent.membership_for(query, query.size() * 0.9));
+
+    state.counters["bits"] = hibf.bit_size();
+}
+
+void ibf_query_benchmark(::benchmark::State & state)
+{
+    auto user_bins = generate_user_bins(state.range(0));
+
+    // Every bin is sized for the largest user bin with the same false positive rate as the HIBF.
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{user_bins.size()}, seqan3::bin_size{79'022u}};
+    ibf.emplace_parallel(user_bins, 1u);
+    auto agent = ibf.counting_agent();
+    auto const & query = user_bins[1];
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(agent.bulk_count(query));
+
+    state.counters["bits"] = ibf.bit_size();
+}
+
+BENCHMARK(hibf_query_benchmark)->Apply(arguments);
+BENCHMARK(ibf_query_benchmark)->Apply(arguments);
+
+BENCHMARK_MAIN();
@@ -37,6 +37,13 @@ static void arguments(benchmark::internal::Benchmark * b)
     }
 }
 
+static void bin_scaling_arguments(benchmark::internal::Benchmark * b)
+{
+    // The bits per bin stay constant, such that only the number of words per row grows with the number of bins.
+    for (int32_t bins : {64, 256, 1024, 8192, 16384, 65536})
+        b->Args({bins, 1LL << 12, 2, 1'000});
+}
+
 template <typename ibf_type>
 auto set_up(size_t bins, size_t bits, size_t hash_num, size_t sequence_length)
 {
@@ -132,6 +139,22 @@ void bulk_contains_benchmark(::benchmark::State & state)
     state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
 }
 
+template <typename ibf_type>
+void bulk_contains_range_benchmark(::benchmark::State & state)
+{
+    auto && [bin_indices, hash_values, ibf] =
+        set_up<ibf_type>(state.range(0), state.range(1), state.range(2), state.range(3));
+    (void)bin_indices;
+
+    auto agent = ibf.membership_agent();
+    for (auto _ : state)
+    {
+        [[maybe_unused]] auto & res = agent.bulk_contains(hash_values);
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
 template <typename ibf_type>
 void bulk_count_benchmark(::benchmark::State & state)
 {
@@ -148,6 +171,25 @@ void bulk_count_benchmark(::benchmark::State & state)
     state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
 }
 
+template <typename ibf_type>
+void bulk_threshold_benchmark(::benchmark::State & state)
+{
+    auto && [bin_indices, hash_values, ibf] =
+        set_up<ibf_type>(state.range(0), state.range(1), state.range(2), state.range(3));
+    (void)bin_indices;
+
+    // Half of the values must be contained in a bin.
+    size_t const threshold = std::ranges::size(hash_values) / 2;
+
+    auto agent = ibf.threshold_agent();
+    for (auto _ : state)
+    {
+        [[maybe_unused]] auto & res = agent.bulk_threshold(hash_values, threshold);
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
 BENCHMARK_TEMPLATE(emplace_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
     ->Apply(arguments);
 BENCHMARK_TEMPLATE(clear_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
@@ -159,10 +201,25 @@ BENCHMARK_TEMPLATE(bulk_contains_benchmark, seqan3::interleaved_bloom_filter<seq
     ->Apply(arguments);
 BENCHMARK_TEMPLATE(bulk_contains_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)
     ->Apply(arguments);
+BENCHMARK_TEMPLATE(bulk_contains_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(bin_scaling_arguments);
+BENCHMARK_TEMPLATE(bulk_contains_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)
+    ->Apply(bin_scaling_arguments);
+
+BENCHMARK_TEMPLATE(bulk_contains_range_benchmark,
+                   seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(bin_scaling_arguments);
+BENCHMARK_TEMPLATE(bulk_contains_range_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)
+    ->Apply(bin_scaling_arguments);
 
 BENCHMARK_TEMPLATE(bulk_count_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
     ->Apply(arguments);
 BENCHMARK_TEMPLATE(bulk_count_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)
     ->Apply(arguments);
 
+BENCHMARK_TEMPLATE(bulk_threshold_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(arguments);
+BENCHMARK_TEMPLATE(bulk_threshold_benchmark, seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)
+    ->Apply(arguments);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+inline benchmark::Counter hashes_per_second(size_t const count)
+{
+    return benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+}
+
+// 32 bins only occupy a single word per row and hence require atomic operations.
+static constexpr std::array<int64_t, 3> bin_counts{32, 1024, 8192};
+
+static void sequential_arguments(benchmark::internal::Benchmark * b)
+{
+    for (int64_t bins : bin_counts)
+        b->Args({bins, 1LL << 16, 2, 10'000});
+}
+
+static void parallel_arguments(benchmark::internal::Benchmark * b)
+{
+    size_t const max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1u);
+
+    for (int64_t bins : bin_counts)
+    {
+        for (size_t threads = 1u; threads <= max_threads; threads *= 2u)
+            b->Args({bins, 1LL << 16, 2, 10'000, static_cast<int64_t>(threads)});
+    }
+}
+
+auto set_up(size_t const bins, size_t const values_per_bin)
+{
+    std::vector<std::vector<size_t>> values(bins);
+
+    for (size_t bin = 0; bin < bins; ++bin)
+        values[bin] = seqan3::test::generate_numeric_sequence<size_t>(values_per_bin,
+                                                                      std::numeric_limits<size_t>::lowest(),
+                                                                      std::numeric_limits<size_t>::max(),
+                                                                      bin);
+
+    return values;
+}
+
+void emplace_sequential_benchmark(::benchmark::State & state)
+{
+    size_t const bins = state.range(0);
+    auto values = set_up(bins, state.range(3));
+
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bins},
+                                         seqan3::bin_size{static_cast<size_t>(state.range(1))},
+                                         seqan3::hash_function_count{static_cast<size_t>(state.range(2))}};
+
+    for (auto _ : state)
+    {
+        for (size_t bin = 0; bin < bins; ++bin)
+            for (size_t value : values[bin])
+                ibf.emplace(value, seqan3::bin_index{bin});
+
+        benchmark::DoNotOptimize(ibf.raw_data().data());
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(bins * state.range(3));
+}
+
+void emplace_parallel_benchmark(::benchmark::State & state)
+{
+    size_t const bins = state.range(0);
+    auto values = set_up(bins, state.range(3));
+
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bins},
+                                         seqan3::bin_size{static_cast<size_t>(state.range(1))},
+                                         seqan3::hash_function_count{static_cast<size_t>(state.range(2))}};
+
+    for (auto _ : state)
+    {
+        ibf.emplace_parallel(values, state.range(4));
+        benchmark::DoNotOptimize(ibf.raw_data().data());
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(bins * state.range(3));
+}
+
+BENCHMARK(emplace_sequential_benchmark)->Apply(sequential_arguments)->UseRealTime();
+BENCHMARK(emplace_parallel_benchmark)->Apply(parallel_arguments)->UseRealTime();
+
+BENCHMARK_MAIN();
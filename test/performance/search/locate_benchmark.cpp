@@ -0,0 +1,91 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Locates all occurrences of short queries, i.e. many occurrences per query, with different sampling rates of the
+// suffix array. The located occurrences per second are compared to the space of the sampled suffix array.
+
+#ifndef NDEBUG
+static constexpr size_t text_length{10'000};
+#else
+// The index does not fit into the caches.
+static constexpr size_t text_length{16'000'000};
+#endif // NDEBUG
+static constexpr size_t query_length{6};
+static constexpr size_t query_count{100};
+static constexpr size_t seed{0x6126f};
+
+enum class locate_mode
+{
+    bulk,
+    lazy
+};
+
+template <uint32_t sa_sampling_rate>
+using index_t = seqan3::bi_fm_index<seqan3::dna4,
+                                    seqan3::text_layout::single,
+                                    seqan3::sdsl_epr_index_type<2, sa_sampling_rate>>;
+
+template <uint32_t sa_sampling_rate, locate_mode mode>
+void locate_benchmark(benchmark::State & state)
+{
+    std::vector<seqan3::dna4> const text = seqan3::test::generate_sequence<seqan3::dna4>(text_length, 0, seed);
+    std::vector<std::vector<seqan3::dna4>> queries{};
+    for (size_t i = 0; i < query_count; ++i)
+        queries.push_back(seqan3::test::generate_sequence<seqan3::dna4>(query_length, 0, seed + i + 1));
+    index_t<sa_sampling_rate> const index{text};
+
+    size_t occurrences{};
+    for (auto _ : state)
+    {
+        for (auto const & query : queries)
+        {
+            auto cursor = index.cursor();
+            if (!cursor.extend_right(query))
+                continue;
+
+            if constexpr (mode == locate_mode::bulk)
+            {
+                auto const positions = cursor.locate();
+                benchmark::DoNotOptimize(positions.data());
+                occurrences += positions.size();
+            }
+            else
+            {
+                for (auto && position : cursor.lazy_locate())
+                {
+                    benchmark::DoNotOptimize(position);
+                    ++occurrences;
+                }
+            }
+        }
+    }
+
+    // The sampled suffix array stores every sa_sampling_rate-th entry with bits::hi(n) + 1 bits.
+    double const sample_bits = sdsl::bits::hi(text_length + 1) + 1;
+    state.counters["occurrences"] = benchmark::Counter(occurrences, benchmark::Counter::kIsRate);
+    state.counters["sa_bits_per_char"] = sample_bits / sa_sampling_rate;
+    state.counters["sa_MiB"] = sample_bits * (text_length + 1) / sa_sampling_rate / 8 / 1024 / 1024;
+}
+
+BENCHMARK_TEMPLATE(locate_benchmark, 4, locate_mode::bulk);
+BENCHMARK_TEMPLATE(locate_benchmark, 4, locate_mode::lazy);
+BENCHMARK_TEMPLATE(locate_benchmark, 8, locate_mode::bulk);
+BENCHMARK_TEMPLATE(locate_benchmark, 8, locate_mode::lazy);
+BENCHMARK_TEMPLATE(locate_benchmark, 16, locate_mode::bulk);
+BENCHMARK_TEMPLATE(locate_benchmark, 16, locate_mode::lazy);
+BENCHMARK_TEMPLATE(locate_benchmark, 32, locate_mode::bulk);
+BENCHMARK_TEMPLATE(locate_benchmark, 32, locate_mode::lazy);
+BENCHMARK_TEMPLATE(locate_benchmark, 64, locate_mode::bulk);
+BENCHMARK_TEMPLATE(locate_benchmark, 64, locate_mode::lazy);
+
+BENCHMARK_MAIN();
@@ -9,6 +9,8 @@
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/core/detail/all_view.hpp>
+#include <seqan3/search/configuration/batch.hpp>
+#include <seqan3/search/configuration/parallel.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
 #include <seqan3/search/search.hpp>
@@ -307,6 +309,144 @@ void bidirectional_search_stratified(benchmark::State & state, options && o)
     benchmark::DoNotOptimize(sum);
 }
 
+//============================================================================
+//  undirectional and bidirectional; batched search, single, dna4, all-mapping
+//============================================================================
+
+// Many short reads, e.g. seeds. A batch size of 0 runs the search without seqan3::search_cfg::batch.
+template <typename index_t>
+void search_batch(benchmark::State & state, options && o, size_t const batch_size)
+{
+    std::vector<seqan3::dna4> ref = seqan3::test::generate_sequence<seqan3::dna4>(o.sequence_length, 0, 0);
+
+    index_t index{ref};
+    std::vector<std::vector<seqan3::dna4>> reads = generate_reads(ref,
+                                                                  o.number_of_reads,
+                                                                  o.read_length,
+                                                                  o.simulated_errors,
+                                                                  o.prob_insertion,
+                                                                  o.prob_deletion,
+                                                                  o.stddev);
+    seqan3::configuration cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{o.searched_errors}};
+
+    auto run = [&](auto const & search_cfg)
+    {
+        size_t sum{};
+        for (auto _ : state)
+        {
+            auto results = search(reads, index, search_cfg);
+            sum += std::ranges::distance(results);
+        }
+        benchmark::DoNotOptimize(sum);
+    };
+
+    if (batch_size == 0u)
+        run(cfg);
+    else
+        run(cfg | seqan3::search_cfg::batch{batch_size});
+
+    state.counters["reads/s"] = benchmark::Counter(o.number_of_reads, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void unidirectional_search_batch(benchmark::State & state, options && o, size_t const batch_size)
+{
+    search_batch<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single>>(state, std::move(o), batch_size);
+}
+
+void bidirectional_search_batch(benchmark::State & state, options && o, size_t const batch_size)
+{
+    search_batch<seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single>>(state, std::move(o), batch_size);
+}
+
+//============================================================================
+//  undirectional and bidirectional; wavelet tree vs EPR dictionary, single, dna4, all-mapping
+//============================================================================
+
+template <typename index_t>
+void search_sdsl_index(benchmark::State & state, options && o)
+{
+    std::vector<seqan3::dna4> ref = seqan3::test::generate_sequence<seqan3::dna4>(o.sequence_length, 0, 0);
+
+    index_t index{ref};
+    std::vector<std::vector<seqan3::dna4>> reads = generate_reads(ref,
+                                                                  o.number_of_reads,
+                                                                  o.read_length,
+                                                                  o.simulated_errors,
+                                                                  o.prob_insertion,
+                                                                  o.prob_deletion,
+                                                                  o.stddev);
+    seqan3::configuration cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{o.searched_errors}};
+
+    size_t sum{};
+    for (auto _ : state)
+    {
+        auto results = search(reads, index, cfg);
+        sum += std::ranges::distance(results);
+    }
+    benchmark::DoNotOptimize(sum);
+
+    state.counters["reads/s"] = benchmark::Counter(o.number_of_reads, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void unidirectional_search_wavelet_tree(benchmark::State & state, options && o)
+{
+    search_sdsl_index<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single>>(state, std::move(o));
+}
+
+void unidirectional_search_epr(benchmark::State & state, options && o)
+{
+    using index_t = seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, seqan3::sdsl_epr_index_type<2>>;
+    search_sdsl_index<index_t>(state, std::move(o));
+}
+
+void bidirectional_search_wavelet_tree(benchmark::State & state, options && o)
+{
+    search_sdsl_index<seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single>>(state, std::move(o));
+}
+
+void bidirectional_search_epr(benchmark::State & state, options && o)
+{
+    using index_t = seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single, seqan3::sdsl_epr_index_type<2>>;
+    search_sdsl_index<index_t>(state, std::move(o));
+}
+
+//============================================================================
+//  bidirectional; parallel search, all-mapping
+//============================================================================
+
+// The number of threads is the benchmark argument.
+void bidirectional_search_parallel(benchmark::State & state, options && o)
+{
+    std::vector<seqan3::dna4> ref = seqan3::test::generate_sequence<seqan3::dna4>(o.sequence_length, 0, 0);
+    seqan3::bi_fm_index index{ref};
+    std::vector<std::vector<seqan3::dna4>> reads = generate_reads(ref,
+                                                                  o.number_of_reads,
+                                                                  o.read_length,
+                                                                  o.simulated_errors,
+                                                                  o.prob_insertion,
+                                                                  o.prob_deletion,
+                                                                  o.stddev);
+    seqan3::configuration const cfg =
+        seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{o.searched_errors}}
+        | seqan3::search_cfg::parallel{static_cast<uint32_t>(state.range(0))};
+
+    size_t sum{};
+    for (auto _ : state)
+    {
+        auto results = search(reads, index, cfg);
+        sum += std::ranges::distance(results);
+    }
+    benchmark::DoNotOptimize(sum);
+
+    state.counters["reads/s"] = benchmark::Counter(o.number_of_reads, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Scales from 1 to all available threads.
+static void thread_counts(benchmark::internal::Benchmark * benchmark)
+{
+    benchmark->DenseRange(1, std::max<int>(std::thread::hardware_concurrency(), 1))->UseRealTime();
+}
+
 #ifndef NDEBUG
 inline constexpr size_t small_size = 1'000;
 inline constexpr size_t medium_size = 5'000;
@@ -436,6 +576,80 @@ BENCHMARK_CAPTURE(bidirectional_search_stratified,
                   highErrorReadsSearch3Strata2RepLong,
                   options{big_size, true, 50, 50, 0.30, 0.30, 0, 3, 2, 1.75});
 
+BENCHMARK_CAPTURE(unidirectional_search_batch,
+                  exactSearchNoBatch,
+                  options{big_size, false, 1000, 20, 0, 0, 0, 0, 0},
+                  0);
+BENCHMARK_CAPTURE(unidirectional_search_batch,
+                  exactSearchBatch16,
+                  options{big_size, false, 1000, 20, 0, 0, 0, 0, 0},
+                  16);
+BENCHMARK_CAPTURE(unidirectional_search_batch,
+                  exactSearchBatch64,
+                  options{big_size, false, 1000, 20, 0, 0, 0, 0, 0},
+                  64);
+BENCHMARK_CAPTURE(unidirectional_search_batch,
+                  exactSearchBatch256,
+                  options{big_size, false, 1000, 20, 0, 0, 0, 0, 0},
+                  256);
+BENCHMARK_CAPTURE(unidirectional_search_batch,
+                  lowErrorReadsSearch1NoBatch,
+                  options{big_size, false, 1000, 20, 0.18, 0.18, 1, 1, 0},
+                  0);
+BENCHMARK_CAPTURE(unidirectional_search_batch,
+                  lowErrorReadsSearch1Batch64,
+                  options{big_size, false, 1000, 20, 0.18, 0.18, 1, 1, 0},
+                  64);
+
+BENCHMARK_CAPTURE(bidirectional_search_batch, exactSearchNoBatch, options{big_size, false, 1000, 20, 0, 0, 0, 0, 0}, 0);
+BENCHMARK_CAPTURE(bidirectional_search_batch,
+                  exactSearchBatch64,
+                  options{big_size, false, 1000, 20, 0, 0, 0, 0, 0},
+                  64);
+BENCHMARK_CAPTURE(bidirectional_search_batch,
+                  lowErrorReadsSearch1NoBatch,
+                  options{big_size, false, 1000, 20, 0.18, 0.18, 1, 1, 0},
+                  0);
+BENCHMARK_CAPTURE(bidirectional_search_batch,
+                  lowErrorReadsSearch1Batch64,
+                  options{big_size, false, 1000, 20, 0.18, 0.18, 1, 1, 0},
+                  64);
+
+BENCHMARK_CAPTURE(unidirectional_search_wavelet_tree, exactSearch, options{big_size, false, 1000, 20, 0, 0, 0, 0, 0});
+BENCHMARK_CAPTURE(unidirectional_search_wavelet_tree,
+                  lowErrorReadsSearch1,
+                  options{big_size, false, 1000, 20, 0.18, 0.18, 1, 1, 0});
+
+BENCHMARK_CAPTURE(unidirectional_search_epr, exactSearch, options{big_size, false, 1000, 20, 0, 0, 0, 0, 0});
+BENCHMARK_CAPTURE(unidirectional_search_epr,
+                  lowErrorReadsSearch1,
+                  options{big_size, false, 1000, 20, 0.18, 0.18, 1, 1, 0});
+
+BENCHMARK_CAPTURE(bidirectional_search_wavelet_tree, exactSearch, options{big_size, false, 1000, 20, 0, 0, 0, 0, 0});
+BENCHMARK_CAPTURE(bidirectional_search_wavelet_tree,
+                  lowErrorReadsSearch1,
+                  options{big_size, false, 1000, 20, 0.18, 0.18, 1, 1, 0});
+BENCHMARK_CAPTURE(bidirectional_search_wavelet_tree,
+                  lowErrorReadsSearch2,
+                  options{big_size, false, 1000, 50, 0.18, 0.18, 2, 2, 0});
+
+BENCHMARK_CAPTURE(bidirectional_search_epr, exactSearch, options{big_size, false, 1000, 20, 0, 0, 0, 0, 0});
+BENCHMARK_CAPTURE(bidirectional_search_epr,
+                  lowErrorReadsSearch1,
+                  options{big_size, false, 1000, 20, 0.18, 0.18, 1, 1, 0});
+BENCHMARK_CAPTURE(bidirectional_search_epr,
+                  lowErrorReadsSearch2,
+                  options{big_size, false, 1000, 50, 0.18, 0.18, 2, 2, 0});
+
+BENCHMARK_CAPTURE(bidirectional_search_parallel,
+                  lowErrorReadsSearch2,
+                  options{big_size, false, 10000, 50, 0.18, 0.18, 2, 2, 0})
+    ->Apply(thread_counts);
+BENCHMARK_CAPTURE(bidirectional_search_parallel,
+                  highErrorReadsSearch3,
+                  options{big_size, false, 1000, 50, 0.18, 0.18, 3, 3, 0})
+    ->Apply(thread_counts);
+
 // ============================================================================
 //  instantiate tests
 // ============================================================================
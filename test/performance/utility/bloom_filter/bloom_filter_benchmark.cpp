@@ -8,6 +8,7 @@
 #include <benchmark/benchmark.h>
 
 #include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/bloom_filter/blocked_bloom_filter.hpp>
 #include <seqan3/utility/bloom_filter/bloom_filter.hpp>
 
 inline benchmark::Counter hashes_per_second(size_t const count)
@@ -18,7 +19,7 @@ inline benchmark::Counter hashes_per_second(size_t const count)
 static void arguments(benchmark::internal::Benchmark * b)
 {
     // Size of the IBF will be 2^bits bits
-    for (int32_t bits = 15; bits <= 20; bits += 5)
+    for (int32_t bits = 15; bits <= 30; bits += 5)
     {
         // The bits must fit in an int32_t
         if (bits < 32)
@@ -31,11 +32,19 @@ static void arguments(benchmark::internal::Benchmark * b)
     }
 }
 
+// The uncompressed (blocked) Bloom Filter to construct a `bf_type` from.
+template <seqan3::data_layout data_layout_mode>
+seqan3::bloom_filter<> uncompressed_type(seqan3::bloom_filter<data_layout_mode> const &);
+template <seqan3::data_layout data_layout_mode>
+seqan3::blocked_bloom_filter<> uncompressed_type(seqan3::blocked_bloom_filter<data_layout_mode> const &);
+
 template <typename bf_type>
 auto set_up(size_t bits, size_t hash_num, size_t sequence_length)
 {
+    using uncompressed_bf_type = decltype(uncompressed_type(std::declval<bf_type>()));
+
     auto hash_values = seqan3::test::generate_numeric_sequence<size_t>(sequence_length);
-    seqan3::bloom_filter tmp_bf(seqan3::bin_size{bits}, seqan3::hash_function_count{hash_num});
+    uncompressed_bf_type tmp_bf(seqan3::bin_size{bits}, seqan3::hash_function_count{hash_num});
 
     bf_type bf{std::move(tmp_bf)};
 
@@ -108,4 +117,15 @@ BENCHMARK_TEMPLATE(contains_benchmark, seqan3::bloom_filter<seqan3::data_layout:
 BENCHMARK_TEMPLATE(count_benchmark, seqan3::bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 BENCHMARK_TEMPLATE(count_benchmark, seqan3::bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
 
+BENCHMARK_TEMPLATE(emplace_benchmark, seqan3::blocked_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(arguments);
+BENCHMARK_TEMPLATE(contains_benchmark, seqan3::blocked_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(arguments);
+BENCHMARK_TEMPLATE(contains_benchmark, seqan3::blocked_bloom_filter<seqan3::data_layout::compressed>)
+    ->Apply(arguments);
+BENCHMARK_TEMPLATE(count_benchmark, seqan3::blocked_bloom_filter<seqan3::data_layout::uncompressed>)
+    ->Apply(arguments);
+BENCHMARK_TEMPLATE(count_benchmark, seqan3::blocked_bloom_filter<seqan3::data_layout::compressed>)
+    ->Apply(arguments);
+
 BENCHMARK_MAIN();
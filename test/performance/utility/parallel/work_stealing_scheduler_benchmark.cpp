@@ -0,0 +1,222 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/utility/parallel/detail/spin_delay.hpp>
+#include <seqan3/utility/parallel/detail/work_stealing_scheduler.hpp>
+
+// Measures the throughput of small tasks for 1 to N threads. The baseline is a thread pool with a single queue of
+// std::function objects that all threads contend on.
+
+#ifndef NDEBUG
+static constexpr size_t task_count{1'000};
+#else
+static constexpr size_t task_count{200'000};
+#endif // NDEBUG
+
+// Some work of a small task.
+inline size_t small_work(size_t const seed)
+{
+    size_t value{seed};
+    for (size_t i = 0; i < 64u; ++i)
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+    return value;
+}
+
+// A thread pool with a single, bounded queue.
+class fixed_queue_pool
+{
+public:
+    explicit fixed_queue_pool(size_t const thread_count) : queue{10'000}
+    {
+        for (size_t i = 0; i < thread_count; ++i)
+            threads.emplace_back(
+                [this]()
+                {
+                    for (;;)
+                    {
+                        std::function<void()> task{};
+                        if (queue.wait_pop(task) == seqan3::contrib::queue_op_status::closed)
+                            return;
+                        task();
+                    }
+                });
+    }
+
+    ~fixed_queue_pool()
+    {
+        queue.close();
+        for (auto & thread : threads)
+            thread.join();
+    }
+
+    void submit(std::function<void()> task)
+    {
+        ++pending;
+        queue.wait_push(
+            [this, task = std::move(task)]()
+            {
+                task();
+                --pending;
+            });
+    }
+
+    void wait()
+    {
+        seqan3::detail::spin_delay delay{};
+        while (pending.load() > 0u)
+            delay.wait();
+    }
+
+private:
+    seqan3::contrib::fixed_buffer_queue<std::function<void()>> queue;
+    std::vector<std::thread> threads{};
+    std::atomic<size_t> pending{};
+};
+
+// ============================================================================
+//  independent tasks
+// ============================================================================
+
+void fixed_queue_tasks(benchmark::State & state)
+{
+    fixed_queue_pool pool{static_cast<size_t>(state.range(0))};
+    std::atomic<size_t> result{};
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < task_count; ++i)
+            pool.submit(
+                [&result, i]()
+                {
+                    result.fetch_add(small_work(i), std::memory_order_relaxed);
+                });
+        pool.wait();
+    }
+
+    benchmark::DoNotOptimize(result.load());
+    state.counters["tasks/s"] = benchmark::Counter(task_count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void work_stealing_tasks(benchmark::State & state)
+{
+    std::shared_ptr<seqan3::detail::work_stealing_scheduler> scheduler =
+        seqan3::detail::work_stealing_scheduler::shared(state.range(0));
+    std::atomic<size_t> result{};
+
+    for (auto _ : state)
+    {
+        seqan3::detail::task_group tasks{*scheduler};
+        for (size_t i = 0; i < task_count; ++i)
+            tasks.run(
+                [&result, i]()
+                {
+                    result.fetch_add(small_work(i), std::memory_order_relaxed);
+                });
+        tasks.wait();
+    }
+
+    benchmark::DoNotOptimize(result.load());
+    state.counters["tasks/s"] = benchmark::Counter(task_count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// ============================================================================
+//  nested tasks
+// ============================================================================
+
+// Every task splits its range into two tasks and waits for them.
+size_t parallel_sum(seqan3::detail::work_stealing_scheduler & scheduler, size_t const begin, size_t const end)
+{
+    if (end - begin <= 1u)
+        return small_work(begin);
+
+    size_t const middle = begin + (end - begin) / 2u;
+    size_t left{};
+    size_t right{};
+    seqan3::detail::task_group tasks{scheduler};
+    tasks.run(
+        [&]()
+        {
+            left = parallel_sum(scheduler, begin, middle);
+        });
+    right = parallel_sum(scheduler, middle, end);
+    tasks.wait();
+    return left + right;
+}
+
+void work_stealing_nested_tasks(benchmark::State & state)
+{
+    std::shared_ptr<seqan3::detail::work_stealing_scheduler> scheduler =
+        seqan3::detail::work_stealing_scheduler::shared(state.range(0));
+
+    size_t result{};
+    for (auto _ : state)
+    {
+        seqan3::detail::task_group tasks{*scheduler};
+        tasks.run(
+            [&]()
+            {
+                result += parallel_sum(*scheduler, 0u, task_count);
+            });
+        tasks.wait();
+    }
+
+    benchmark::DoNotOptimize(result);
+    state.counters["tasks/s"] = benchmark::Counter(task_count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// ============================================================================
+//  many short calls, e.g. align_pairwise on small batches
+// ============================================================================
+
+template <bool shared>
+void work_stealing_short_calls(benchmark::State & state)
+{
+    size_t const thread_count = state.range(0);
+    std::atomic<size_t> result{};
+
+    for (auto _ : state)
+    {
+        std::shared_ptr<seqan3::detail::work_stealing_scheduler> scheduler =
+            shared ? seqan3::detail::work_stealing_scheduler::shared(thread_count)
+                   : std::make_shared<seqan3::detail::work_stealing_scheduler>(thread_count);
+
+        seqan3::detail::task_group tasks{*scheduler};
+        for (size_t i = 0; i < 100u; ++i)
+            tasks.run(
+                [&result, i]()
+                {
+                    result.fetch_add(small_work(i), std::memory_order_relaxed);
+                });
+        tasks.wait();
+    }
+
+    benchmark::DoNotOptimize(result.load());
+    state.counters["calls/s"] = benchmark::Counter(1, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+static void thread_counts(benchmark::internal::Benchmark * benchmark)
+{
+    benchmark->DenseRange(1, std::max<int>(std::thread::hardware_concurrency(), 1))->UseRealTime();
+}
+
+BENCHMARK(fixed_queue_tasks)->Apply(thread_counts);
+BENCHMARK(work_stealing_tasks)->Apply(thread_counts);
+BENCHMARK(work_stealing_nested_tasks)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(work_stealing_short_calls, false)->Apply(thread_counts);
+BENCHMARK_TEMPLATE(work_stealing_short_calls, true)->Apply(thread_counts);
+
+BENCHMARK_MAIN();
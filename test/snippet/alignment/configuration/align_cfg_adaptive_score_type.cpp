@@ -0,0 +1,26 @@
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> sequences{
+        {"ACGTGAACTGACT"_dna4, "ACGAAGACCGAT"_dna4},
+        {"AACCGGTT"_dna4, "ACGT"_dna4}};
+
+    // Compute the scores with int8_t and recompute only the overflowing alignments with wider score types.
+    auto config = seqan3::align_cfg::method_global{}
+                | seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                      seqan3::mismatch_score{-5}}}
+                | seqan3::align_cfg::output_score{} | seqan3::align_cfg::vectorised{}
+                | seqan3::align_cfg::adaptive_score_type{};
+
+    for (auto const & result : seqan3::align_pairwise(sequences, config))
+        seqan3::debug_stream << result.score() << '\n';
+}
@@ -0,0 +1,11 @@
+#include <seqan3/alignment/configuration/align_config_executor.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
+
+int main()
+{
+    // The pool is constructed once and can be used by many calls of seqan3::align_pairwise.
+    seqan3::thread_pool pool{4};
+
+    // Enables parallel computation on the threads of the pool.
+    seqan3::align_cfg::executor cfg{pool};
+}
@@ -0,0 +1,12 @@
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_unordered.hpp>
+
+int main()
+{
+    // Returns the alignments computed by two threads as soon as they are available.
+    // The sequence ids identify the sequence pair of an alignment.
+    seqan3::configuration cfg = seqan3::align_cfg::parallel{2} | seqan3::align_cfg::unordered{}
+                              | seqan3::align_cfg::output_sequence1_id{} | seqan3::align_cfg::output_sequence2_id{}
+                              | seqan3::align_cfg::output_score{};
+}
@@ -0,0 +1,25 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/search/search.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    seqan3::dna4_vector text{"CGCTGTCTGAAGGATGAGTGTCAGCCAGTGTAACCCGATGAGCTACCCAGTAGTCGAACTGGGCCAGACAACCCGGCGCT"_dna4};
+    std::vector<seqan3::dna4_vector> queries{"GCT"_dna4, "ACCC"_dna4, "GATGAG"_dna4, "TTTT"_dna4};
+
+    seqan3::fm_index index{text};
+
+    // Search the queries in batches of 2 queries, allowing 1 substitution.
+    seqan3::configuration const cfg =
+        seqan3::search_cfg::batch{2}
+        | seqan3::search_cfg::max_error_substitution{seqan3::search_cfg::error_count{1}}
+        | seqan3::search_cfg::hit_all_best{};
+
+    for (auto && result : search(queries, index, cfg))
+        seqan3::debug_stream << result << '\n';
+}
@@ -0,0 +1,16 @@
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/search/configuration/executor.hpp>
+#include <seqan3/search/configuration/max_error.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
+
+int main()
+{
+    // The pool is constructed once and can be used by many calls of seqan3::search.
+    seqan3::thread_pool pool{8};
+
+    // Execute the search algorithm on the threads of the pool (and allow 1 error of any type).
+    seqan3::configuration cfg =
+        seqan3::search_cfg::executor{pool} | seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}};
+
+    return 0;
+}
@@ -0,0 +1,26 @@
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/hierarchical_interleaved_bloom_filter.hpp>
+
+int main()
+{
+    // The i-th element contains the values of user bin i. User bins may have very different sizes.
+    std::vector<std::vector<size_t>> user_bins(200);
+    for (size_t user_bin = 0; user_bin < user_bins.size(); ++user_bin)
+    {
+        size_t const size = (user_bin % 10 == 0) ? 1000 : 10;
+        for (size_t value = 0; value < size; ++value)
+            user_bins[user_bin].push_back(user_bin * 10'000 + value);
+    }
+
+    // Each Interleaved Bloom Filter has at most 64 technical bins, hence the HIBF has multiple levels.
+    seqan3::hierarchical_interleaved_bloom_filter hibf{user_bins, {.tmax = 64, .maximum_false_positive_rate = 0.01}};
+
+    auto agent = hibf.membership_agent();
+
+    // Which user bins contain at least 9 of the 10 values?
+    std::vector<size_t> const query{1'230'000, 1'230'001, 1'230'002, 1'230'003, 1'230'004,
+                                    1'230'005, 1'230'006, 1'230'007, 1'230'008, 1'230'009};
+    seqan3::debug_stream << agent.membership_for(query, 9) << '\n'; // [123]
+}
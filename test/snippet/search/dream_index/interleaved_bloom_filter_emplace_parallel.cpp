@@ -0,0 +1,17 @@
+#include <vector>
+
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+int main()
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{12u}, seqan3::bin_size{8192u}};
+
+    // The i-th element contains the values of bin i.
+    std::vector<std::vector<size_t>> values_per_bin(12);
+    values_per_bin[0] = {126, 712};
+    values_per_bin[3] = {712};
+    values_per_bin[9] = {237, 126, 8};
+
+    // Insert the values into the Interleaved Bloom Filter using 4 threads.
+    ibf.emplace_parallel(values_per_bin, 4u);
+}
@@ -0,0 +1,29 @@
+#include <filesystem>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/detail/safe_filesystem_entry.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+int main()
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{12u}, seqan3::bin_size{8192u}};
+    ibf.emplace(126, seqan3::bin_index{0u});
+    ibf.emplace(126, seqan3::bin_index{3u});
+    ibf.emplace(712, seqan3::bin_index{3u});
+
+    std::filesystem::path ibf_file = std::filesystem::temp_directory_path() / "ibf.mapped";
+    seqan3::detail::safe_filesystem_entry file_guard{ibf_file}; // Removes the file when leaving the scope.
+
+    // Store the Interleaved Bloom Filter such that it can be memory mapped.
+    ibf.save_mapped(ibf_file);
+
+    // Map the file. No data is read until the Interleaved Bloom Filter is queried.
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped> ibf_mapped{ibf_file};
+
+    // The whole file can also be read into memory in advance.
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped> ibf_populated{ibf_file, {.populate = true}};
+
+    auto agent = ibf_mapped.membership_agent();
+    seqan3::debug_stream << agent.bulk_contains(126) << '\n'; // [1,0,0,1,0,0,0,0,0,0,0,0]
+    seqan3::debug_stream << agent.bulk_contains(712) << '\n'; // [0,0,0,1,0,0,0,0,0,0,0,0]
+}
@@ -0,0 +1,25 @@
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/updatable_interleaved_bloom_filter.hpp>
+
+int main()
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{8u}, seqan3::bin_size{8192u}};
+    ibf.emplace(126, seqan3::bin_index{0u});
+    ibf.emplace(712, seqan3::bin_index{3u});
+
+    // The updatable Interleaved Bloom Filter stores a compressed copy of `ibf`.
+    // After 1000 inserted values, the new values are merged into the compressed Interleaved Bloom Filter.
+    seqan3::updatable_interleaved_bloom_filter uibf{ibf, 1000u};
+
+    // Inserting values and clearing bins does not require to decompress the Interleaved Bloom Filter.
+    uibf.emplace(712, seqan3::bin_index{5u});
+    uibf.clear(seqan3::bin_index{3u});
+
+    auto agent = uibf.membership_agent();
+    seqan3::debug_stream << agent.bulk_contains(712) << '\n'; // prints [0,0,0,0,0,1,0,0]
+
+    // Merge all changes into the compressed Interleaved Bloom Filter.
+    uibf.merge();
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed> const & compressed = uibf.compressed_ibf();
+    seqan3::debug_stream << compressed.bin_count() << '\n'; // prints 8
+}
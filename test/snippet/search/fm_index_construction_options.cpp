@@ -0,0 +1,21 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+
+    // Compute the suffix array with 4 threads, using at most about 1 GiB of memory in addition to the text.
+    // Temporary files are written to std::filesystem::temp_directory_path().
+    seqan3::fm_index index{genome, {.threads = 4u, .memory_budget = 1ULL << 30}};
+
+    auto cur = index.cursor();
+    cur.extend_right("AAGG"_dna4);
+    seqan3::debug_stream << "Number of hits: " << cur.count() << '\n'; // outputs: 2
+    return 0;
+}
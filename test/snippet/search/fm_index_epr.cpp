@@ -0,0 +1,20 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+
+    // A single text over seqan3::dna4 fits into 2 bits per character.
+    seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single, seqan3::sdsl_epr_index_type<2>> index{genome};
+
+    auto cur = index.cursor();
+    cur.extend_right("AAGG"_dna4);
+    seqan3::debug_stream << "Number of hits: " << cur.count() << '\n'; // outputs: 2
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/utility/bloom_filter/blocked_bloom_filter.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    // The blocked Bloom Filter has the same interface as the seqan3::bloom_filter.
+    // The size is rounded up to a multiple of 512 bits, i.e. one cache line.
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{8000u}, seqan3::hash_function_count{2u}};
+    seqan3::debug_stream << bf.bit_size() << '\n'; // 8192
+
+    auto const sequence1 = "ACTGACTGACTGATC"_dna4;
+    auto const sequence2 = "GTGACTGACTGACTCG"_dna4;
+    auto kmers = seqan3::views::kmer_hash(seqan3::ungapped{5u});
+
+    // Insert all 5-mers of sequence1
+    for (auto && value : sequence1 | kmers)
+        bf.emplace(value);
+
+    // Each query accesses a single cache line.
+    seqan3::debug_stream << bf.contains(120u) << '\n'; // 1 (120 is the hash value of ACTGA)
+
+    // Count all 5-mers of sequence2
+    seqan3::debug_stream << bf.count(sequence2 | kmers) << '\n'; // 9
+}
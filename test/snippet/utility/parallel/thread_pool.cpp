@@ -0,0 +1,14 @@
+#include <vector>
+
+#include <seqan3/utility/parallel/thread_pool.hpp>
+
+int main()
+{
+    // A pool with 4 threads.
+    seqan3::thread_pool pool{4};
+
+    // A pool with 4 threads that are pinned to the CPUs of the first NUMA node.
+    // If the CPUs are not known, the vector is empty and the threads are not pinned.
+    std::vector<size_t> cpus = seqan3::thread_pool::numa_node_cpus(0);
+    seqan3::thread_pool pinned_pool{4, cpus};
+}
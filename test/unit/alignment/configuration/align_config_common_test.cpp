@@ -11,6 +11,7 @@
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
+#include <seqan3/alignment/configuration/align_config_executor.hpp>
 #include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_min_score.hpp>
@@ -20,6 +21,7 @@
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
 #include <seqan3/alignment/configuration/align_config_score_type.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_unordered.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorised.hpp>
 #include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
 #include <seqan3/utility/type_list/traits.hpp>
@@ -56,11 +58,15 @@ using align_config_and_taboo_types = seqan3::type_list<
     std::pair<cfg::gap_cost_affine, seqan3::type_list<cfg::gap_cost_affine>>,
     std::pair<cfg::min_score, seqan3::type_list<cfg::min_score, cfg::method_local>>,
     std::pair<cfg::on_result<callback_t>, seqan3::type_list<cfg::on_result<callback_t>>>,
-    std::pair<cfg::parallel, seqan3::type_list<cfg::parallel>>,
+    std::pair<cfg::executor, seqan3::type_list<cfg::executor, cfg::parallel>>,
+    std::pair<cfg::parallel, seqan3::type_list<cfg::parallel, cfg::executor>>,
     std::pair<cfg::detail::result_type<alignment_result_t>,
               seqan3::type_list<cfg::detail::result_type<alignment_result_t>>>,
-    std::pair<cfg::score_type<int32_t>, seqan3::type_list<cfg::score_type<int32_t>>>,
+    std::pair<cfg::detail::score_overflow_detection, seqan3::type_list<cfg::detail::score_overflow_detection>>,
+    std::pair<cfg::score_type<int32_t>, seqan3::type_list<cfg::score_type<int32_t>, cfg::adaptive_score_type>>,
+    std::pair<cfg::adaptive_score_type, seqan3::type_list<cfg::adaptive_score_type, cfg::score_type<int32_t>>>,
     std::pair<cfg::scoring_scheme<nt_scheme>, seqan3::type_list<cfg::scoring_scheme<nt_scheme>>>,
+    std::pair<cfg::unordered, seqan3::type_list<cfg::unordered>>,
     std::pair<cfg::vectorised, seqan3::type_list<cfg::vectorised>>>;
 
 // The pure list of configuration elements to instantiate the typed test case with.
@@ -85,7 +91,7 @@ public:
     // NOTE: You must update this number if you add a new entity to seqan3::detail::align_config_id.
     // config_count is used to check that the config size is correct.
     // And don't forget to add the new config into the above test fixture (via align_config_and_taboo_types).
-    static constexpr int8_t config_count = 18;
+    static constexpr int8_t config_count = 21;
 };
 
 // Configuration element type list as gtest suitable testing::Types
@@ -0,0 +1,48 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_executor.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+// ---------------------------------------------------------------------------------------------------------------------
+// individual tests
+// ---------------------------------------------------------------------------------------------------------------------
+
+TEST(align_config_executor, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::executor>));
+}
+
+TEST(align_config_executor, configuration)
+{
+    seqan3::thread_pool pool{2};
+
+    { // from lvalue.
+        seqan3::align_cfg::executor elem{pool};
+        seqan3::configuration cfg{elem};
+        auto cfg_value = std::get<seqan3::align_cfg::executor>(cfg).pool;
+
+        EXPECT_TRUE((std::is_same_v<decltype(cfg_value), seqan3::thread_pool *>));
+        EXPECT_EQ(cfg_value, &pool);
+    }
+
+    { // from rvalue.
+        seqan3::configuration cfg{seqan3::align_cfg::executor{pool}};
+        auto cfg_value = std::get<seqan3::align_cfg::executor>(cfg).pool;
+
+        EXPECT_TRUE((std::is_same_v<decltype(cfg_value), seqan3::thread_pool *>));
+        EXPECT_EQ(cfg_value, &pool);
+    }
+
+    { // default construction.
+        EXPECT_EQ(seqan3::align_cfg::executor{}.pool, nullptr);
+    }
+}
@@ -7,11 +7,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <ranges>
 #include <stdexcept>
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
 #include <seqan3/alphabet/gap/gapped.hpp>
@@ -19,6 +22,7 @@
 #include <seqan3/alphabet/views/to_char.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
 #include <seqan3/test/expect_same_type.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
 
 using seqan3::operator""_dna4;
@@ -33,7 +37,7 @@ struct align_pairwise_test : ::testing::Test
     static constexpr bool is_vectorised = config_t::template exists<seqan3::align_cfg::vectorised>();
 };
 
-using testing_types = ::testing::Types<void, seqan3::align_cfg::parallel>;
+using testing_types = ::testing::Types<void, seqan3::align_cfg::parallel, seqan3::align_cfg::executor>;
 
 TYPED_TEST_SUITE(align_pairwise_test, testing_types, );
 
@@ -49,6 +53,13 @@ auto call_alignment(seq_t && seq, cfg_t && cfg)
         auto && config = cfg | seqan3::align_cfg::parallel{4};
         return seqan3::align_pairwise(std::forward<seq_t>(seq), std::forward<decltype(config)>(config));
     }
+    else if constexpr (std::same_as<type_param_t, seqan3::align_cfg::executor>)
+    {
+        // The pool must outlive the returned range.
+        static seqan3::thread_pool pool{4};
+        auto && config = cfg | seqan3::align_cfg::executor{pool};
+        return seqan3::align_pairwise(std::forward<seq_t>(seq), std::forward<decltype(config)>(config));
+    }
 }
 
 TYPED_TEST(align_pairwise_test, single_pair)
@@ -266,6 +277,26 @@ TYPED_TEST(align_pairwise_test, collection_with_double_score_type)
     }
 }
 
+TYPED_TEST(align_pairwise_test, collection_in_input_order)
+{
+    // The sequences have different lengths, s.t. the alignments take different time to compute.
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> vec{};
+    for (size_t i = 0; i < 1000u; ++i)
+        vec.emplace_back(seqan3::dna4_vector(i % 97, 'A'_dna4), seqan3::dna4_vector(i % 89, 'A'_dna4));
+
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                              | seqan3::align_cfg::output_sequence1_id{} | seqan3::align_cfg::output_score{};
+
+    size_t expected_id = 0;
+    for (auto && res : call_alignment<TypeParam>(vec, cfg))
+    {
+        EXPECT_EQ(res.sequence1_id(), expected_id);
+        EXPECT_EQ(res.score(), -std::abs(static_cast<int>(expected_id % 97) - static_cast<int>(expected_id % 89)));
+        ++expected_id;
+    }
+    EXPECT_EQ(expected_id, vec.size());
+}
+
 TYPED_TEST(align_pairwise_test, bug_1598)
 {
     // https://github.com/seqan/seqan3/issues/1598
@@ -292,3 +323,36 @@ TEST(align_pairwise_test, parallel_without_parameter)
 
     EXPECT_THROW(seqan3::align_pairwise(std::tie(seq1, seq2), cfg), std::runtime_error);
 }
+
+TEST(align_pairwise_test, executor_without_pool)
+{
+    auto seq1 = "ACGTGATG"_dna4;
+    auto seq2 = "AGTGATACT"_dna4;
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                              | seqan3::align_cfg::output_score{} | seqan3::align_cfg::executor{};
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(seq1, seq2), cfg), std::runtime_error);
+}
+
+TEST(align_pairwise_test, parallel_unordered)
+{
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> vec{};
+    for (size_t i = 0; i < 1000u; ++i)
+        vec.emplace_back(seqan3::dna4_vector(i % 97, 'A'_dna4), seqan3::dna4_vector(i % 89, 'A'_dna4));
+
+    seqan3::configuration cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                              | seqan3::align_cfg::output_sequence1_id{} | seqan3::align_cfg::output_score{}
+                              | seqan3::align_cfg::parallel{4} | seqan3::align_cfg::unordered{};
+
+    std::vector<size_t> ids{};
+    for (auto && res : seqan3::align_pairwise(vec, cfg))
+    {
+        size_t const id = res.sequence1_id();
+        EXPECT_EQ(res.score(), -std::abs(static_cast<int>(id % 97) - static_cast<int>(id % 89)));
+        ids.push_back(id);
+    }
+
+    // Every alignment is returned exactly once.
+    std::ranges::sort(ids);
+    EXPECT_TRUE(std::ranges::equal(ids, std::views::iota(size_t{0}, vec.size())));
+}
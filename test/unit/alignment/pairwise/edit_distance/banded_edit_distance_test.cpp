@@ -0,0 +1,222 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+using seqan3::operator""_dna4;
+
+struct banded_edit_distance_test : public ::testing::Test
+{
+    static constexpr auto global = seqan3::align_cfg::method_global{};
+    static constexpr auto semi_global =
+        seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                         seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+    // The edit distance scaled by two; the banded DP algorithm is used because it is not an edit scheme.
+    static constexpr auto scaled_edit_scheme =
+        seqan3::align_cfg::scoring_scheme{
+            seqan3::nucleotide_scoring_scheme{seqan3::match_score{0}, seqan3::mismatch_score{-2}}}
+        | seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0}, seqan3::align_cfg::extension_score{-2}};
+
+    static auto band(int32_t const lower, int32_t const upper)
+    {
+        return seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{lower},
+                                                  seqan3::align_cfg::upper_diagonal{upper}};
+    }
+
+    std::vector<seqan3::dna4> random_sequence(size_t const size)
+    {
+        std::uniform_int_distribution<size_t> rank_distribution{0u, 3u};
+        std::vector<seqan3::dna4> sequence(size);
+        for (auto & symbol : sequence)
+            symbol.assign_rank(rank_distribution(generator));
+
+        return sequence;
+    }
+
+    // Returns the number of errors of the alignment and checks that it is covered by the band.
+    template <typename alignment_t>
+    int32_t errors_within_band(alignment_t const & alignment,
+                               size_t const begin1,
+                               size_t const begin2,
+                               int32_t const lower,
+                               int32_t const upper)
+    {
+        auto const & [gapped1, gapped2] = alignment;
+        EXPECT_EQ(std::ranges::size(gapped1), std::ranges::size(gapped2));
+
+        int32_t errors = 0;
+        int64_t column = begin1;
+        int64_t row = begin2;
+        for (size_t i = 0; i < std::ranges::size(gapped1); ++i)
+        {
+            bool const is_gap1 = gapped1[i] == seqan3::gap{};
+            bool const is_gap2 = gapped2[i] == seqan3::gap{};
+
+            errors += is_gap1 || is_gap2 || gapped1[i] != gapped2[i];
+            column += !is_gap1;
+            row += !is_gap2;
+
+            EXPECT_GE(column - row, lower);
+            EXPECT_LE(column - row, upper);
+        }
+
+        return errors;
+    }
+
+    template <typename method_t>
+    void compare_with_banded_dp(method_t const & method, size_t const max_size)
+    {
+        auto const outputs = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_begin_position{}
+                           | seqan3::align_cfg::output_end_position{} | seqan3::align_cfg::output_alignment{};
+        bool const is_semi_global = method.free_end_gaps_sequence1_leading;
+        std::uniform_int_distribution<size_t> size_distribution{0u, max_size};
+
+        for (size_t i = 0; i < 200u; ++i)
+        {
+            auto database = random_sequence(size_distribution(generator));
+            auto query = random_sequence(size_distribution(generator));
+            int32_t const size_difference = std::ranges::ssize(database) - std::ranges::ssize(query);
+
+            // Choose a band that covers the begin and the end of the alignment.
+            std::uniform_int_distribution<int32_t> offset_distribution{0, static_cast<int32_t>(max_size / 2u)};
+            int32_t const lower = std::min(0, size_difference) - offset_distribution(generator);
+            int32_t const upper = is_semi_global ? offset_distribution(generator)
+                                                 : std::max(0, size_difference) + offset_distribution(generator);
+
+            auto edit_config = method | seqan3::align_cfg::edit_scheme | band(lower, upper);
+            auto dp_config = method | scaled_edit_scheme | band(lower, upper) | seqan3::align_cfg::output_score{};
+
+            auto edit_result = align(std::tie(database, query), edit_config | outputs);
+            auto dp_result = align(std::tie(database, query), dp_config);
+
+            SCOPED_TRACE("|database| = " + std::to_string(database.size()) + ", |query| = "
+                         + std::to_string(query.size()) + ", band = [" + std::to_string(lower) + ":"
+                         + std::to_string(upper) + "]");
+
+            EXPECT_EQ(edit_result.score() * 2, dp_result.score());
+            EXPECT_EQ(edit_result.sequence2_end_position(), query.size());
+            if (!is_semi_global)
+            {
+                EXPECT_EQ(edit_result.sequence1_end_position(), database.size());
+                EXPECT_EQ(edit_result.sequence1_begin_position(), 0u);
+            }
+            EXPECT_EQ(edit_result.sequence2_begin_position(), 0u);
+
+            int32_t const errors = errors_within_band(edit_result.alignment(),
+                                                      edit_result.sequence1_begin_position(),
+                                                      edit_result.sequence2_begin_position(),
+                                                      lower,
+                                                      upper);
+            EXPECT_EQ(-errors, edit_result.score());
+
+            // The score only computation must not differ from the computation with alignment.
+            auto score_result = align(std::tie(database, query), edit_config | seqan3::align_cfg::output_score{});
+            EXPECT_EQ(score_result.score(), edit_result.score());
+        }
+    }
+
+    // Returns the result of the first and only sequence pair.
+    template <typename sequences_t, typename config_t>
+    static auto align(sequences_t && sequences, config_t const & config)
+    {
+        auto results = seqan3::align_pairwise(std::forward<sequences_t>(sequences), config);
+        return *results.begin();
+    }
+
+    std::mt19937 generator{42u};
+};
+
+TEST_F(banded_edit_distance_test, global)
+{
+    for (size_t const max_size : {10u, 70u, 200u})
+        compare_with_banded_dp(global, max_size);
+}
+
+TEST_F(banded_edit_distance_test, semi_global)
+{
+    for (size_t const max_size : {10u, 70u, 200u})
+        compare_with_banded_dp(semi_global, max_size);
+}
+
+TEST_F(banded_edit_distance_test, band_restricts_alignment)
+{
+    auto database = "AAAACCCCGGGG"_dna4;
+    auto query = "CCCCGGGG"_dna4;
+    auto const outputs = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    // The As are deleted at the begin of the alignment; the band needs to cover the diagonals 0 to 4.
+    auto config = global | seqan3::align_cfg::edit_scheme | outputs;
+    EXPECT_EQ(align(std::tie(database, query), config).score(), -4);
+    EXPECT_EQ(align(std::tie(database, query), config | band(-2, 4)).score(), -4);
+    EXPECT_EQ(align(std::tie(database, query), config | band(0, 4)).score(), -4);
+
+    // The query can start behind the As in a semi-global alignment.
+    auto semi_config = semi_global | seqan3::align_cfg::edit_scheme | outputs;
+    auto result = align(std::tie(database, query), semi_config | band(0, 4));
+    EXPECT_EQ(result.score(), 0);
+    EXPECT_EQ(result.sequence1_end_position(), 12u);
+
+    // The query must start within the As, i.e. "AACCCCGG" vs "CCCCGGGG" or with gaps.
+    result = align(std::tie(database, query), semi_config | band(0, 2));
+    EXPECT_LT(result.score(), 0);
+    EXPECT_GE(result.score(), -4);
+}
+
+TEST_F(banded_edit_distance_test, max_errors)
+{
+    auto database = random_sequence(150u);
+    auto query = random_sequence(120u);
+    auto config = global | seqan3::align_cfg::edit_scheme | band(-10, 40) | seqan3::align_cfg::output_score{};
+
+    int32_t const score = align(std::tie(database, query), config).score();
+    auto with_max_errors = [&](int32_t const max_errors)
+    {
+        return align(std::tie(database, query), config | seqan3::align_cfg::min_score{-max_errors}).score();
+    };
+
+    EXPECT_EQ(with_max_errors(-score), score);
+    EXPECT_EQ(with_max_errors(-score + 5), score);
+    EXPECT_NE(with_max_errors(-score - 1), score); // no valid alignment
+}
+
+TEST_F(banded_edit_distance_test, invalid_band)
+{
+    auto database = "ACGTACGT"_dna4;
+    auto query = "ACGT"_dna4;
+    auto config = global | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::output_score{};
+    auto semi_config = semi_global | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::output_score{};
+
+    auto compute = [&](auto const & cfg)
+    {
+        return align(std::tie(database, query), cfg).score();
+    };
+
+    EXPECT_THROW(compute(config | band(2, 1)), seqan3::invalid_alignment_configuration);  // upper < lower
+    EXPECT_THROW(compute(config | band(1, 5)), seqan3::invalid_alignment_configuration);  // does not start in (0, 0)
+    EXPECT_THROW(compute(config | band(-3, -1)), seqan3::invalid_alignment_configuration); // does not start in (0, 0)
+    EXPECT_THROW(compute(config | band(-2, 3)), seqan3::invalid_alignment_configuration);  // does not end in (4, 8)
+    EXPECT_THROW(compute(semi_config | band(5, 6)), seqan3::invalid_alignment_configuration); // misses the last row
+    EXPECT_EQ(compute(semi_config | band(1, 4)), 0);
+}
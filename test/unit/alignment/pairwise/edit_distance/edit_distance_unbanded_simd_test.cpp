@@ -0,0 +1,204 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_min_score.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/rna4.hpp>
+
+// Generates sequence pairs of varying length where the second sequence is a mutated copy of a part of the first one.
+template <typename alphabet_t>
+std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>>
+generate_sequence_pairs(size_t const count, size_t const max_size)
+{
+    std::mt19937 generator{42u};
+    std::uniform_int_distribution<size_t> size_distribution{0u, max_size};
+    std::uniform_int_distribution<size_t> rank_distribution{0u, seqan3::alphabet_size<alphabet_t> - 1u};
+    std::uniform_int_distribution<size_t> percent_distribution{0u, 99u};
+
+    auto random_symbol = [&]()
+    {
+        return seqan3::assign_rank_to(rank_distribution(generator), alphabet_t{});
+    };
+
+    std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> sequence_pairs{};
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::vector<alphabet_t> first(size_distribution(generator));
+        std::ranges::generate(first, random_symbol);
+
+        size_t const begin = first.empty() ? 0u : size_distribution(generator) % first.size();
+        size_t const end = first.empty() ? 0u : begin + size_distribution(generator) % (first.size() - begin + 1u);
+
+        std::vector<alphabet_t> second{};
+        for (size_t j = begin; j < end; ++j)
+        {
+            size_t const mutation = percent_distribution(generator);
+            if (mutation < 5u) // substitution
+                second.push_back(random_symbol());
+            else if (mutation < 10u) // insertion
+                second.insert(second.end(), {random_symbol(), first[j]});
+            else if (mutation >= 15u) // match, otherwise deletion
+                second.push_back(first[j]);
+        }
+
+        // Unrelated sequences.
+        if (i % 7u == 0u)
+            std::ranges::generate(second, random_symbol);
+
+        sequence_pairs.emplace_back(std::move(first), std::move(second));
+    }
+
+    return sequence_pairs;
+}
+
+template <typename alphabet_t>
+struct edit_distance_unbanded_simd_test : public ::testing::Test
+{
+    static constexpr auto global = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme;
+    static constexpr auto outputs = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{}
+                                  | seqan3::align_cfg::output_sequence1_id{}
+                                  | seqan3::align_cfg::output_sequence2_id{};
+
+    template <typename config_t>
+    void compare_with_scalar(config_t const & config)
+    {
+        for (size_t const max_size : {20u, 70u, 150u})
+        {
+            auto sequence_pairs = generate_sequence_pairs<alphabet_t>(203u, max_size);
+
+            auto scalar_results = seqan3::align_pairwise(sequence_pairs, config);
+            auto simd_results = seqan3::align_pairwise(sequence_pairs, config | seqan3::align_cfg::vectorised{});
+
+            auto simd_it = simd_results.begin();
+            size_t count = 0u;
+            for (auto && scalar_result : scalar_results)
+            {
+                ASSERT_NE(simd_it, simd_results.end());
+                auto && simd_result = *simd_it;
+
+                EXPECT_EQ(simd_result.sequence1_id(), scalar_result.sequence1_id());
+                EXPECT_EQ(simd_result.sequence2_id(), scalar_result.sequence2_id());
+                EXPECT_EQ(simd_result.score(), scalar_result.score()) << "pair " << scalar_result.sequence1_id();
+                EXPECT_EQ(simd_result.sequence1_end_position(), scalar_result.sequence1_end_position())
+                    << "pair " << scalar_result.sequence1_id();
+                EXPECT_EQ(simd_result.sequence2_end_position(), scalar_result.sequence2_end_position())
+                    << "pair " << scalar_result.sequence1_id();
+
+                ++simd_it;
+                ++count;
+            }
+
+            EXPECT_EQ(simd_it, simd_results.end());
+            EXPECT_EQ(count, sequence_pairs.size());
+        }
+    }
+};
+
+using alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna15>;
+TYPED_TEST_SUITE(edit_distance_unbanded_simd_test, alphabet_types, );
+
+TYPED_TEST(edit_distance_unbanded_simd_test, global)
+{
+    this->compare_with_scalar(this->global | this->outputs);
+}
+
+TYPED_TEST(edit_distance_unbanded_simd_test, semi_global)
+{
+    auto config = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+                | seqan3::align_cfg::edit_scheme | this->outputs;
+
+    this->compare_with_scalar(config);
+}
+
+TYPED_TEST(edit_distance_unbanded_simd_test, global_max_errors)
+{
+    for (int32_t const max_errors : {0, 3, 10, 40})
+        this->compare_with_scalar(this->global | seqan3::align_cfg::min_score{-max_errors} | this->outputs);
+}
+
+TYPED_TEST(edit_distance_unbanded_simd_test, semi_global_max_errors)
+{
+    auto config = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}}
+                | seqan3::align_cfg::edit_scheme | this->outputs;
+
+    for (int32_t const max_errors : {0, 3, 10, 40})
+        this->compare_with_scalar(config | seqan3::align_cfg::min_score{-max_errors});
+}
+
+TYPED_TEST(edit_distance_unbanded_simd_test, score_only)
+{
+    auto config = this->global | seqan3::align_cfg::output_score{};
+    auto sequence_pairs = generate_sequence_pairs<TypeParam>(37u, 50u);
+
+    auto scalar_results = seqan3::align_pairwise(sequence_pairs, config);
+    auto simd_results = seqan3::align_pairwise(sequence_pairs, config | seqan3::align_cfg::vectorised{});
+
+    std::vector<int> scalar_scores{};
+    for (auto && result : scalar_results)
+        scalar_scores.push_back(result.score());
+
+    std::vector<int> simd_scores{};
+    for (auto && result : simd_results)
+        simd_scores.push_back(result.score());
+
+    EXPECT_EQ(simd_scores, scalar_scores);
+}
+
+TYPED_TEST(edit_distance_unbanded_simd_test, begin_position_falls_back_to_scalar)
+{
+    auto config = this->global | seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_begin_position{}
+                | seqan3::align_cfg::output_end_position{};
+    auto sequence_pairs = generate_sequence_pairs<TypeParam>(11u, 40u);
+
+    auto scalar_results = seqan3::align_pairwise(sequence_pairs, config);
+    auto simd_results = seqan3::align_pairwise(sequence_pairs, config | seqan3::align_cfg::vectorised{});
+
+    auto simd_it = simd_results.begin();
+    for (auto && scalar_result : scalar_results)
+    {
+        EXPECT_EQ((*simd_it).score(), scalar_result.score());
+        EXPECT_EQ((*simd_it).sequence1_begin_position(), scalar_result.sequence1_begin_position());
+        EXPECT_EQ((*simd_it).sequence2_begin_position(), scalar_result.sequence2_begin_position());
+        ++simd_it;
+    }
+}
+
+TEST(edit_distance_unbanded_simd, different_alphabets_fall_back_to_scalar)
+{
+    using namespace seqan3::literals;
+
+    auto config = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme
+                | seqan3::align_cfg::output_score{} | seqan3::align_cfg::vectorised{};
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::rna4>>> sequence_pairs{
+        {"ACGTACGT"_dna4, "ACGUACGU"_rna4},
+        {"ACGTACGT"_dna4, "ACGUUCGU"_rna4},
+        {"AAAA"_dna4, "ACGU"_rna4}};
+
+    std::vector<int> scores{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+        scores.push_back(result.score());
+
+    EXPECT_EQ(scores, (std::vector<int>{0, -1, -3}));
+}
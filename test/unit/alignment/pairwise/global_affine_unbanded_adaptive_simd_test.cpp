@@ -0,0 +1,212 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_edit.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_on_result.hpp>
+#include <seqan3/alignment/configuration/align_config_output.hpp>
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+// Generates sequence pairs of varying length where the second sequence is a mutated copy of the first one.
+template <typename alphabet_t>
+std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>>
+generate_sequence_pairs(size_t const count, size_t const max_size)
+{
+    std::mt19937 generator{42u};
+    std::uniform_int_distribution<size_t> size_distribution{0u, max_size};
+    std::uniform_int_distribution<size_t> rank_distribution{0u, seqan3::alphabet_size<alphabet_t> - 1u};
+    std::uniform_int_distribution<size_t> percent_distribution{0u, 99u};
+
+    auto random_symbol = [&]()
+    {
+        return seqan3::assign_rank_to(rank_distribution(generator), alphabet_t{});
+    };
+
+    std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> sequence_pairs{};
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::vector<alphabet_t> first(size_distribution(generator));
+        std::ranges::generate(first, random_symbol);
+
+        std::vector<alphabet_t> second{};
+        for (alphabet_t const symbol : first)
+        {
+            size_t const mutation = percent_distribution(generator);
+            if (mutation < 3u) // substitution
+                second.push_back(random_symbol());
+            else if (mutation < 5u) // insertion
+                second.insert(second.end(), {random_symbol(), symbol});
+            else if (mutation >= 7u) // match, otherwise deletion
+                second.push_back(symbol);
+        }
+
+        // Unrelated sequences.
+        if (i % 5u == 0u)
+            std::ranges::generate(second, random_symbol);
+
+        sequence_pairs.emplace_back(std::move(first), std::move(second));
+    }
+
+    return sequence_pairs;
+}
+
+struct global_affine_unbanded_adaptive_simd_test : public ::testing::Test
+{
+    static constexpr auto outputs = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_sequence1_id{}
+                                  | seqan3::align_cfg::output_sequence2_id{};
+    static constexpr auto gap_cost =
+        seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10}, seqan3::align_cfg::extension_score{-1}};
+    static constexpr auto dna_scheme =
+        seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                            seqan3::mismatch_score{-5}}};
+
+    // Compares the adaptive score type with the vectorised alignment using int32_t scores.
+    template <typename sequence_pairs_t, typename config_t>
+    void compare_with_int32(sequence_pairs_t & sequence_pairs, config_t const & config)
+    {
+        auto expected_results = seqan3::align_pairwise(sequence_pairs, config | seqan3::align_cfg::vectorised{});
+        auto adaptive_results = seqan3::align_pairwise(sequence_pairs,
+                                                       config | seqan3::align_cfg::vectorised{}
+                                                           | seqan3::align_cfg::adaptive_score_type{});
+
+        auto adaptive_it = adaptive_results.begin();
+        size_t count = 0u;
+        for (auto && expected : expected_results)
+        {
+            ASSERT_NE(adaptive_it, adaptive_results.end());
+            auto && adaptive = *adaptive_it;
+
+            EXPECT_EQ(adaptive.sequence1_id(), expected.sequence1_id());
+            EXPECT_EQ(adaptive.sequence2_id(), expected.sequence2_id());
+            EXPECT_EQ(adaptive.score(), expected.score()) << "pair " << expected.sequence1_id();
+
+            ++adaptive_it;
+            ++count;
+        }
+
+        EXPECT_EQ(adaptive_it, adaptive_results.end());
+        EXPECT_EQ(count, sequence_pairs.size());
+    }
+};
+
+TEST_F(global_affine_unbanded_adaptive_simd_test, short_sequences)
+{
+    // The scores of most alignments fit into int8_t.
+    auto sequence_pairs = generate_sequence_pairs<seqan3::dna4>(301u, 20u);
+    compare_with_int32(sequence_pairs, seqan3::align_cfg::method_global{} | dna_scheme | gap_cost | outputs);
+}
+
+TEST_F(global_affine_unbanded_adaptive_simd_test, overflowing_scores)
+{
+    // The scores of most alignments overflow int8_t and some of them overflow int16_t.
+    for (size_t const max_size : {100u, 300u, 1000u})
+    {
+        auto sequence_pairs = generate_sequence_pairs<seqan3::dna4>(131u, max_size);
+        compare_with_int32(sequence_pairs, seqan3::align_cfg::method_global{} | dna_scheme | gap_cost | outputs);
+    }
+
+    auto large_scheme = seqan3::align_cfg::scoring_scheme{
+        seqan3::nucleotide_scoring_scheme{seqan3::match_score{20}, seqan3::mismatch_score{-20}}};
+
+    std::vector<seqan3::dna4> long_sequence(2000u, seqan3::assign_rank_to(0u, seqan3::dna4{}));
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{};
+    sequence_pairs.emplace_back(long_sequence, long_sequence);                      // 40000 overflows int16_t.
+    sequence_pairs.emplace_back(long_sequence, std::vector<seqan3::dna4>(10u));      // -2008 fits int16_t.
+    sequence_pairs.emplace_back(std::vector<seqan3::dna4>(3u), std::vector<seqan3::dna4>(3u)); // fits int8_t.
+
+    compare_with_int32(sequence_pairs, seqan3::align_cfg::method_global{} | large_scheme | gap_cost | outputs);
+}
+
+TEST_F(global_affine_unbanded_adaptive_simd_test, free_end_gaps)
+{
+    auto method = seqan3::align_cfg::method_global{seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_leading{true},
+                                                   seqan3::align_cfg::free_end_gaps_sequence1_trailing{false},
+                                                   seqan3::align_cfg::free_end_gaps_sequence2_trailing{true}};
+
+    auto sequence_pairs = generate_sequence_pairs<seqan3::dna4>(97u, 150u);
+    compare_with_int32(sequence_pairs, method | dna_scheme | gap_cost | outputs);
+}
+
+TEST_F(global_affine_unbanded_adaptive_simd_test, large_scores_skip_int8)
+{
+    // The gap costs leave no room for int8_t scores.
+    auto large_gap_cost = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-40},
+                                                             seqan3::align_cfg::extension_score{-3}};
+
+    auto sequence_pairs = generate_sequence_pairs<seqan3::dna4>(67u, 60u);
+    compare_with_int32(sequence_pairs, seqan3::align_cfg::method_global{} | dna_scheme | large_gap_cost | outputs);
+}
+
+TEST_F(global_affine_unbanded_adaptive_simd_test, aminoacid)
+{
+    auto scheme = seqan3::align_cfg::scoring_scheme{
+        seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}};
+
+    auto sequence_pairs = generate_sequence_pairs<seqan3::aa27>(75u, 200u);
+    compare_with_int32(sequence_pairs, seqan3::align_cfg::method_global{} | scheme | gap_cost | outputs);
+}
+
+TEST_F(global_affine_unbanded_adaptive_simd_test, edit_distance)
+{
+    auto sequence_pairs = generate_sequence_pairs<seqan3::dna4>(53u, 300u);
+    compare_with_int32(sequence_pairs, seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | outputs);
+}
+
+TEST_F(global_affine_unbanded_adaptive_simd_test, end_positions_use_int32)
+{
+    // The adaptive score type is not used if more than the score is computed.
+    auto sequence_pairs = generate_sequence_pairs<seqan3::dna4>(41u, 300u);
+    auto config = seqan3::align_cfg::method_global{} | dna_scheme | gap_cost | seqan3::align_cfg::output_score{}
+                | seqan3::align_cfg::output_end_position{} | seqan3::align_cfg::vectorised{};
+
+    auto expected_results = seqan3::align_pairwise(sequence_pairs, config);
+    auto adaptive_results = seqan3::align_pairwise(sequence_pairs, config | seqan3::align_cfg::adaptive_score_type{});
+
+    auto adaptive_it = adaptive_results.begin();
+    for (auto && expected : expected_results)
+    {
+        EXPECT_EQ((*adaptive_it).score(), expected.score());
+        EXPECT_EQ((*adaptive_it).sequence1_end_position(), expected.sequence1_end_position());
+        EXPECT_EQ((*adaptive_it).sequence2_end_position(), expected.sequence2_end_position());
+        ++adaptive_it;
+    }
+}
+
+TEST_F(global_affine_unbanded_adaptive_simd_test, on_result)
+{
+    auto sequence_pairs = generate_sequence_pairs<seqan3::dna4>(89u, 100u);
+    auto config = seqan3::align_cfg::method_global{} | dna_scheme | gap_cost | outputs;
+
+    std::vector<int32_t> expected_scores{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+        expected_scores.push_back(result.score());
+
+    std::vector<int32_t> adaptive_scores(sequence_pairs.size());
+    auto on_result = seqan3::align_cfg::on_result{[&](auto && result)
+                                                  {
+                                                      adaptive_scores[result.sequence1_id()] = result.score();
+                                                  }};
+    seqan3::align_pairwise(sequence_pairs,
+                           config | seqan3::align_cfg::vectorised{} | seqan3::align_cfg::adaptive_score_type{}
+                               | on_result);
+
+    EXPECT_EQ(adaptive_scores, expected_scores);
+}
@@ -0,0 +1,234 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <seqan3/core/algorithm/detail/algorithm_executor_streaming.hpp>
+#include <seqan3/core/debug_stream/range.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using callback_t = std::function<void(size_t)>;
+using algorithm_t = std::function<void(size_t, callback_t)>;
+using executor_t = seqan3::detail::algorithm_executor_streaming<std::vector<size_t> &, algorithm_t, size_t>;
+
+// Returns the input twice; later inputs are computed faster to provoke out-of-order completion.
+struct delayed_algorithm
+{
+    size_t count{};
+
+    void operator()(size_t const input, callback_t callback) const
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds{(count - input) % 7});
+        callback(input);
+        callback(input);
+    }
+};
+
+struct algorithm_executor_streaming_test : public ::testing::Test
+{
+    std::vector<size_t> inputs = std::vector<size_t>(1000u);
+
+    void SetUp() override
+    {
+        std::iota(inputs.begin(), inputs.end(), 0u);
+    }
+
+    std::vector<size_t> expected() const
+    {
+        std::vector<size_t> results{};
+        for (size_t input : inputs)
+            results.insert(results.end(), 2u, input);
+        return results;
+    }
+
+    static seqan3::detail::execution_handler_parallel execution_handler()
+    {
+        return seqan3::detail::execution_handler_parallel{4u};
+    }
+};
+
+std::vector<size_t> consume(executor_t & exec)
+{
+    std::vector<size_t> results{};
+    for (std::optional<size_t> result = exec.next_result(); result.has_value(); result = exec.next_result())
+        results.push_back(*result);
+    return results;
+}
+
+TEST_F(algorithm_executor_streaming_test, construction)
+{
+    EXPECT_FALSE(std::is_default_constructible_v<executor_t>);
+    EXPECT_FALSE(std::is_copy_constructible_v<executor_t>);
+    EXPECT_TRUE(std::is_move_constructible_v<executor_t>);
+    EXPECT_FALSE(std::is_copy_assignable_v<executor_t>);
+    EXPECT_TRUE(std::is_move_assignable_v<executor_t>);
+}
+
+TEST_F(algorithm_executor_streaming_test, type_deduction)
+{
+    seqan3::detail::algorithm_executor_streaming exec{inputs,
+                                                      algorithm_t{delayed_algorithm{inputs.size()}},
+                                                      size_t{},
+                                                      execution_handler()};
+    EXPECT_TRUE((std::same_as<decltype(exec), executor_t>));
+    EXPECT_FALSE(exec.is_eof());
+}
+
+TEST_F(algorithm_executor_streaming_test, ordered)
+{
+    executor_t exec{inputs, algorithm_t{delayed_algorithm{inputs.size()}}, 0u, execution_handler()};
+    EXPECT_EQ(consume(exec), expected());
+    EXPECT_TRUE(exec.is_eof());
+    EXPECT_FALSE(exec.next_result().has_value());
+}
+
+TEST_F(algorithm_executor_streaming_test, unordered)
+{
+    executor_t exec{inputs, algorithm_t{delayed_algorithm{inputs.size()}}, 0u, execution_handler(), false};
+    std::vector<size_t> results = consume(exec);
+
+    // The results of one invocation are returned together.
+    for (size_t i = 0; i < results.size(); i += 2)
+        EXPECT_EQ(results[i], results[i + 1]);
+
+    std::ranges::sort(results);
+    EXPECT_EQ(results, expected());
+}
+
+TEST_F(algorithm_executor_streaming_test, empty_resource)
+{
+    inputs.clear();
+    executor_t exec{inputs, algorithm_t{delayed_algorithm{}}, 0u, execution_handler()};
+    EXPECT_TRUE(exec.is_eof());
+    EXPECT_FALSE(exec.next_result().has_value());
+}
+
+TEST_F(algorithm_executor_streaming_test, empty_result_bucket)
+{
+    algorithm_t algorithm = [](size_t const input, callback_t callback)
+    {
+        if (input % 3 != 0)
+            callback(input);
+    };
+
+    executor_t exec{inputs, algorithm, 0u, execution_handler()};
+    std::vector<size_t> results = consume(exec);
+
+    EXPECT_EQ(results.size(), 666u);
+    EXPECT_TRUE(std::ranges::is_sorted(results));
+}
+
+TEST_F(algorithm_executor_streaming_test, bounded_buffer)
+{
+    std::atomic<size_t> started{};
+    algorithm_t algorithm = [&](size_t const input, callback_t callback)
+    {
+        ++started;
+        callback(input);
+    };
+
+    static constexpr size_t buffer_size = 8u;
+    executor_t exec{inputs, algorithm, 0u, execution_handler(), true, buffer_size};
+
+    for (size_t consumed = 0; consumed < inputs.size(); ++consumed)
+    {
+        EXPECT_EQ(exec.next_result().value(), consumed);
+        // The current invocation and at most buffer_size - 1 further invocations have been started.
+        EXPECT_LE(started.load(), consumed + buffer_size);
+    }
+    EXPECT_FALSE(exec.next_result().has_value());
+    EXPECT_EQ(started.load(), inputs.size());
+}
+
+TEST_F(algorithm_executor_streaming_test, exception)
+{
+    algorithm_t algorithm = [](size_t const input, callback_t callback)
+    {
+        if (input == 500u)
+            throw std::runtime_error{"invocation failed"};
+        callback(input);
+    };
+
+    executor_t exec{inputs, algorithm, 0u, execution_handler()};
+    for (size_t i = 0; i < 500u; ++i)
+        EXPECT_EQ(exec.next_result().value(), i);
+
+    EXPECT_THROW(exec.next_result(), std::runtime_error);
+    EXPECT_EQ(exec.next_result().value(), 501u);
+}
+
+TEST_F(algorithm_executor_streaming_test, move)
+{
+    executor_t exec{inputs, algorithm_t{delayed_algorithm{inputs.size()}}, 0u, execution_handler()};
+    EXPECT_EQ(exec.next_result().value(), 0u);
+
+    // Moving the executor does not affect the invocations in flight.
+    executor_t exec_move_constructed{std::move(exec)};
+    EXPECT_EQ(exec_move_constructed.next_result().value(), 0u);
+
+    executor_t exec_move_assigned{inputs, algorithm_t{delayed_algorithm{inputs.size()}}, 0u, execution_handler()};
+    exec_move_assigned = std::move(exec_move_constructed);
+
+    std::vector<size_t> results = consume(exec_move_assigned);
+    results.insert(results.begin(), 2u, 0u);
+    EXPECT_EQ(results, expected());
+}
+
+TEST_F(algorithm_executor_streaming_test, destruction_with_invocations_in_flight)
+{
+    std::atomic<size_t> completed{};
+    algorithm_t algorithm = [&](size_t const input, callback_t callback)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds{10});
+        callback(input);
+        ++completed;
+    };
+
+    {
+        executor_t exec{inputs, algorithm, 0u, execution_handler()};
+        EXPECT_EQ(exec.next_result().value(), 0u);
+    }
+
+    // The destructor waits for all submitted invocations, but does not submit further ones.
+    EXPECT_LE(completed.load(), 4u * executor_t::buckets_per_thread);
+}
+
+TEST_F(algorithm_executor_streaming_test, nested_in_scheduler_tasks)
+{
+    // Every thread of the scheduler waits for an executor on the same scheduler; waiting must execute pending tasks.
+    std::shared_ptr<seqan3::detail::work_stealing_scheduler> scheduler =
+        seqan3::detail::work_stealing_scheduler::shared(2u);
+    std::vector<std::vector<size_t>> results(4u);
+    {
+        seqan3::detail::task_group tasks{*scheduler};
+        for (std::vector<size_t> & result : results)
+            tasks.run(
+                [&]()
+                {
+                    executor_t exec{inputs,
+                                    delayed_algorithm{inputs.size()},
+                                    0u,
+                                    seqan3::detail::execution_handler_parallel{2u}};
+                    result = consume(exec);
+                });
+        tasks.wait();
+    }
+
+    for (std::vector<size_t> const & result : results)
+        EXPECT_EQ(result, expected());
+}
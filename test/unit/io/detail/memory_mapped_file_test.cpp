@@ -0,0 +1,68 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string_view>
+
+#include <seqan3/io/detail/memory_mapped_file.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+using seqan3::detail::memory_mapped_file;
+
+TEST(memory_mapped_file, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<memory_mapped_file>);
+    EXPECT_FALSE(std::is_copy_constructible_v<memory_mapped_file>);
+    EXPECT_TRUE(std::is_nothrow_move_constructible_v<memory_mapped_file>);
+    EXPECT_FALSE(std::is_copy_assignable_v<memory_mapped_file>);
+    EXPECT_TRUE(std::is_nothrow_move_assignable_v<memory_mapped_file>);
+    EXPECT_TRUE(std::is_destructible_v<memory_mapped_file>);
+}
+
+TEST(memory_mapped_file, map)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "file.txt";
+
+    {
+        std::ofstream stream{filename};
+        stream << "ACGTACGT\nTTTT";
+    }
+
+    memory_mapped_file file{filename, memory_mapped_file::access_pattern::sequential, true};
+    EXPECT_EQ(file.size(), 13u);
+    EXPECT_EQ((std::string_view{file.data(), file.size()}), "ACGTACGT\nTTTT");
+
+    file.advise(memory_mapped_file::access_pattern::will_need);
+
+    memory_mapped_file moved{std::move(file)};
+    EXPECT_EQ(file.data(), nullptr);
+    EXPECT_EQ(file.size(), 0u);
+    EXPECT_EQ((std::string_view{moved.data(), moved.size()}), "ACGTACGT\nTTTT");
+
+    file = std::move(moved);
+    EXPECT_EQ((std::string_view{file.data(), file.size()}), "ACGTACGT\nTTTT");
+}
+
+TEST(memory_mapped_file, empty_file)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "empty.txt";
+    std::ofstream{filename}.close();
+
+    memory_mapped_file file{filename};
+    EXPECT_EQ(file.data(), nullptr);
+    EXPECT_EQ(file.size(), 0u);
+}
+
+TEST(memory_mapped_file, missing_file)
+{
+    seqan3::test::tmp_directory tmp{};
+    EXPECT_THROW(memory_mapped_file{tmp.path() / "missing.txt"}, seqan3::file_open_error);
+}
@@ -0,0 +1,103 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <seqan3/io/detail/memory_mapped_istream.hpp>
+#include <seqan3/io/stream/detail/fast_istreambuf_iterator.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+using seqan3::detail::memory_mapped_istream;
+
+struct memory_mapped_istream_test : public ::testing::Test
+{
+    void SetUp() override
+    {
+        std::ofstream stream{filename};
+        stream << "ACGTACGT\nTTTT";
+    }
+
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename{tmp.path() / "file.txt"};
+};
+
+TEST_F(memory_mapped_istream_test, read)
+{
+    memory_mapped_istream stream{filename};
+    std::string line{};
+
+    EXPECT_TRUE(std::getline(stream, line));
+    EXPECT_EQ(line, "ACGTACGT");
+    EXPECT_EQ(stream.tellg(), 9);
+    EXPECT_TRUE(std::getline(stream, line));
+    EXPECT_EQ(line, "TTTT");
+    EXPECT_TRUE(stream.eof());
+}
+
+TEST_F(memory_mapped_istream_test, unget)
+{
+    memory_mapped_istream stream{filename};
+
+    EXPECT_EQ(stream.get(), 'A');
+    EXPECT_EQ(stream.get(), 'C');
+    EXPECT_TRUE(stream.unget());
+    EXPECT_TRUE(stream.unget());
+    EXPECT_EQ(stream.tellg(), 0);
+    EXPECT_FALSE(stream.unget());
+}
+
+TEST_F(memory_mapped_istream_test, seek)
+{
+    memory_mapped_istream stream{filename};
+
+    EXPECT_TRUE(stream.seekg(9));
+    EXPECT_EQ(stream.get(), 'T');
+    EXPECT_TRUE(stream.seekg(-4, std::ios_base::cur));
+    EXPECT_EQ(stream.get(), 'G');
+    EXPECT_TRUE(stream.seekg(-1, std::ios_base::end));
+    EXPECT_EQ(stream.get(), 'T');
+    EXPECT_EQ(stream.get(), std::char_traits<char>::eof());
+
+    stream.clear();
+    EXPECT_FALSE(stream.seekg(14));
+}
+
+TEST_F(memory_mapped_istream_test, consume_chunks)
+{
+    memory_mapped_istream stream{filename};
+    seqan3::detail::fast_istreambuf_iterator<char> it{*stream.rdbuf()};
+    std::string chars{};
+
+    EXPECT_FALSE(it.consume_chunks(
+        [&](std::string_view const chunk)
+        {
+            chars += chunk;
+            return chunk.size();
+        }));
+    EXPECT_EQ(chars, "ACGTACGT\nTTTT");
+    EXPECT_TRUE(it == std::default_sentinel);
+}
+
+TEST(memory_mapped_istream, empty_file)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "empty.txt";
+    std::ofstream{filename}.close();
+
+    memory_mapped_istream stream{filename};
+    EXPECT_EQ(stream.get(), std::char_traits<char>::eof());
+    EXPECT_TRUE(stream.eof());
+}
+
+TEST(memory_mapped_istream, missing_file)
+{
+    EXPECT_THROW(memory_mapped_istream{"/this/file/does/not/exist"}, seqan3::file_open_error);
+}
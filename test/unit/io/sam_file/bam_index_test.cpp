@@ -0,0 +1,295 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/debug_stream/tuple.hpp>
+#include <seqan3/io/sam_file/bam_index.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/output.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+using seqan3::operator""_cigar_operation;
+using seqan3::operator""_dna5;
+
+TEST(bam_index, invalid_parameters)
+{
+    EXPECT_THROW((seqan3::bam_index{0, 5}), std::invalid_argument);
+    EXPECT_THROW((seqan3::bam_index{14, 0}), std::invalid_argument);
+    EXPECT_THROW((seqan3::bam_index{14, 10}), std::invalid_argument);
+    EXPECT_THROW((seqan3::bam_index{40, 8}), std::invalid_argument);
+    EXPECT_NO_THROW((seqan3::bam_index{14, 6}));
+}
+
+TEST(bam_index, add_record)
+{
+    seqan3::bam_index index{};
+
+    index.add_record(0, 100, 200, true, 10u, 20u);
+    index.add_record(0, 150, 250, true, 20u, 30u); // same bin and adjacent: extends the chunk
+    index.add_record(0, 20000, 20100, true, 30u, 40u);
+    index.add_record(2, 5, 10, true, 40u, 50u);
+    index.add_record(-1, -1, -1, false, 50u, 60u);
+
+    EXPECT_EQ(index.reference_count(), 3u);
+    EXPECT_EQ(index.unplaced_count(), 1u);
+
+    using chunk = seqan3::bam_index::chunk;
+    EXPECT_EQ(index.query(0, 0, 1000), (std::vector<chunk>{{10u, 30u}}));
+    EXPECT_EQ(index.query(0, 0, 30000), (std::vector<chunk>{{10u, 40u}}));
+    EXPECT_EQ(index.query(0, 20050, 20060), (std::vector<chunk>{{30u, 40u}}));
+    EXPECT_TRUE(index.query(1, 0, 1000).empty());
+    EXPECT_EQ(index.query(2, 0, 1000), (std::vector<chunk>{{40u, 50u}}));
+
+    EXPECT_THROW(index.add_record(1, 0, 10, true, 60u, 70u), seqan3::format_error);   // unsorted reference
+    EXPECT_THROW(index.add_record(2, 0, 10, true, 60u, 70u), seqan3::format_error);   // unsorted position
+    EXPECT_THROW(index.add_record(3, 0, 1 << 29, true, 60u, 70u), seqan3::format_error); // not supported by BAI
+}
+
+TEST(bam_index, write_and_read)
+{
+    std::mt19937 generator{42u};
+    std::uniform_int_distribution<int32_t> length_distribution{1, 5000};
+
+    for (auto [extension, min_shift, depth] : {std::tuple{".bai", 14, 5}, std::tuple{".csi", 12, 7}})
+    {
+        seqan3::bam_index index{min_shift, depth};
+        uint64_t offset = 1u << 16;
+        for (int32_t ref_id = 0; ref_id < 3; ++ref_id)
+        {
+            for (int32_t position = 0; position < 1'000'000; position += 97)
+            {
+                int32_t const end = position + length_distribution(generator);
+                index.add_record(ref_id, position, end, true, offset, offset + 50);
+                offset += 50;
+            }
+        }
+        index.add_record(-1, -1, -1, false, offset, offset + 50);
+        index.reference_count(5u);
+
+        seqan3::test::tmp_directory tmp{};
+        std::filesystem::path const filename = tmp.path() / (std::string{"index"} + extension);
+
+#if !defined(SEQAN3_HAS_ZLIB)
+        if (extension == std::string{".csi"})
+        {
+            EXPECT_THROW(index.write(filename), seqan3::file_open_error);
+            continue;
+        }
+#endif
+        index.write(filename);
+
+        seqan3::bam_index read_index{filename};
+        EXPECT_EQ(read_index.min_shift(), min_shift);
+        EXPECT_EQ(read_index.depth(), depth);
+        EXPECT_EQ(read_index.reference_count(), 5u);
+        EXPECT_EQ(read_index.unplaced_count(), 1u);
+
+        for (int32_t ref_id = 0; ref_id < 5; ++ref_id)
+            for (int64_t begin : {0, 1000, 65000, 500'000, 999'000})
+                EXPECT_EQ(read_index.query(ref_id, begin, begin + 3000), index.query(ref_id, begin, begin + 3000));
+    }
+}
+
+TEST(bam_index, write_bai_with_csi_parameters)
+{
+    seqan3::bam_index index{14, 6};
+    seqan3::test::tmp_directory tmp{};
+    EXPECT_THROW(index.write(tmp.path() / "index.bai"), seqan3::format_error);
+}
+
+TEST(bam_index, region_requires_bam)
+{
+    std::string const sam_file{"@SQ\tSN:ref\tLN:100\n"
+                               "read\t0\tref\t1\t60\t4M\t*\t0\t0\tACGT\t*\n"};
+
+    seqan3::sam_file_input fin{std::istringstream{sam_file}, seqan3::format_sam{}};
+    EXPECT_THROW(fin.region("ref", 0, 10), seqan3::format_error);
+}
+
+#if defined(SEQAN3_HAS_ZLIB)
+struct bam_index_region_test : public ::testing::TestWithParam<seqan3::bam_index_type>
+{
+    using fields_t = seqan3::fields<seqan3::field::id,
+                                    seqan3::field::seq,
+                                    seqan3::field::ref_id,
+                                    seqan3::field::ref_offset,
+                                    seqan3::field::cigar,
+                                    seqan3::field::flag>;
+
+    struct record_info
+    {
+        std::string id;
+        int32_t ref_id;
+        int32_t begin;
+        int32_t end;
+    };
+
+    // Writes a sorted BAM file with many BGZF blocks and returns the written records.
+    std::vector<record_info> write_bam_file(std::filesystem::path const & filename)
+    {
+        std::mt19937 generator{42u};
+        std::uniform_int_distribution<int32_t> step_distribution{0, 120};
+        std::uniform_int_distribution<uint32_t> length_distribution{1u, 100u};
+        std::uniform_int_distribution<uint32_t> deletion_distribution{0u, 2000u};
+
+        seqan3::sam_file_output fout{filename, ref_ids, ref_lengths, fields_t{}};
+        fout.options.create_index = GetParam();
+
+        std::vector<record_info> records{};
+        for (int32_t ref_id = 0; ref_id < 3; ++ref_id)
+        {
+            if (ref_id == 1) // no records for the second reference
+                continue;
+
+            for (int32_t position = 0; position < 300'000; position += step_distribution(generator))
+            {
+                uint32_t const match_length = length_distribution(generator);
+                uint32_t const deletion_length = deletion_distribution(generator) % 10u == 0u ? 5000u : 3u;
+                std::vector<seqan3::cigar> cigar_sequence{{match_length, 'M'_cigar_operation},
+                                                          {deletion_length, 'D'_cigar_operation},
+                                                          {1u, 'M'_cigar_operation}};
+                std::vector<seqan3::dna5> sequence(match_length + 1u, 'A'_dna5);
+                std::string id = "r" + std::to_string(records.size());
+
+                fout.emplace_back(id, sequence, ref_id, position, cigar_sequence, seqan3::sam_flag::none);
+                int32_t const end = position + match_length + deletion_length + 1;
+                records.push_back({id, ref_id, position, end});
+            }
+        }
+
+        // Unmapped records without a position are stored at the end of the file.
+        fout.emplace_back(std::string{"unmapped"},
+                          std::vector<seqan3::dna5>{},
+                          std::optional<int32_t>{},
+                          std::optional<int32_t>{},
+                          std::vector<seqan3::cigar>{},
+                          seqan3::sam_flag::unmapped);
+
+        return records;
+    }
+
+    std::vector<std::string> ref_ids{"chr1", "chr2", "chr3"};
+    std::vector<size_t> ref_lengths{400'000, 1000, 400'000};
+};
+
+TEST_P(bam_index_region_test, region)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "sorted.bam";
+    std::vector<record_info> const records = write_bam_file(filename);
+
+    std::filesystem::path index_filename = filename;
+    index_filename += GetParam() == seqan3::bam_index_type::bai ? ".bai" : ".csi";
+    ASSERT_TRUE(std::filesystem::exists(index_filename));
+
+    seqan3::bam_index const index{index_filename};
+    EXPECT_EQ(index.reference_count(), 3u);
+    EXPECT_EQ(index.unplaced_count(), 1u);
+
+    seqan3::sam_file_input fin{filename, seqan3::fields<seqan3::field::id>{}};
+
+    for (auto [ref_name, begin, end] : {std::tuple{"chr1", 0, 1},
+                                        std::tuple{"chr1", 100'000, 100'001},
+                                        std::tuple{"chr1", 12'345, 40'000},
+                                        std::tuple{"chr1", 299'000, 400'000},
+                                        std::tuple{"chr2", 0, 1000},
+                                        std::tuple{"chr3", 0, 400'000},
+                                        std::tuple{"chr3", 150'000, 150'100},
+                                        std::tuple{"chr3", 350'000, 400'000}})
+    {
+        int32_t const ref_id = std::string{ref_name} == "chr1" ? 0 : std::string{ref_name} == "chr2" ? 1 : 2;
+        std::vector<std::string> expected{};
+        for (record_info const & record : records)
+            if (record.ref_id == ref_id && record.begin < end && record.end > begin)
+                expected.push_back(record.id);
+
+        std::vector<std::string> ids{};
+        for (auto & record : fin.region(ref_name, begin, end))
+            ids.push_back(record.id());
+
+        EXPECT_EQ(ids, expected) << ref_name << ":" << begin << "-" << end;
+    }
+
+    EXPECT_THROW(fin.region("chr4", 0, 10), std::invalid_argument);
+}
+
+INSTANTIATE_TEST_SUITE_P(bai_and_csi,
+                         bam_index_region_test,
+                         ::testing::Values(seqan3::bam_index_type::bai, seqan3::bam_index_type::csi));
+
+TEST(bam_index, create_index_requires_filename)
+{
+    std::vector<std::string> ref_ids{"chr1"};
+    std::vector<size_t> ref_lengths{1000};
+    std::ostringstream stream{};
+    seqan3::sam_file_output fout{stream,
+                                 ref_ids,
+                                 ref_lengths,
+                                 seqan3::format_bam{},
+                                 seqan3::fields<seqan3::field::id>{}};
+    fout.options.create_index = seqan3::bam_index_type::bai;
+    EXPECT_THROW(fout.emplace_back(std::string{"read"}), seqan3::format_error);
+}
+
+TEST(bam_index, close)
+{
+    std::vector<std::string> ref_ids{"chr1"};
+    std::vector<size_t> ref_lengths{1000};
+
+    // Without records, the options are checked when the file is closed. The destructor discards the error.
+    {
+        std::ostringstream stream{};
+        seqan3::sam_file_output fout{stream,
+                                     ref_ids,
+                                     ref_lengths,
+                                     seqan3::format_bam{},
+                                     seqan3::fields<seqan3::field::id>{}};
+        fout.options.create_index = seqan3::bam_index_type::bai;
+        EXPECT_THROW(fout.close(), seqan3::format_error);
+        EXPECT_NO_THROW(fout.close());
+    }
+    {
+        std::ostringstream stream{};
+        seqan3::sam_file_output fout{stream,
+                                     ref_ids,
+                                     ref_lengths,
+                                     seqan3::format_bam{},
+                                     seqan3::fields<seqan3::field::id>{}};
+        fout.options.create_index = seqan3::bam_index_type::bai;
+    }
+
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "closed.bam";
+    seqan3::sam_file_output fout{filename, ref_ids, ref_lengths, seqan3::fields<seqan3::field::id>{}};
+    fout.options.create_index = seqan3::bam_index_type::bai;
+    fout.close();
+    EXPECT_THROW(fout.emplace_back(std::string{"read"}), std::logic_error);
+    EXPECT_TRUE(std::filesystem::exists(tmp.path() / "closed.bam.bai"));
+    EXPECT_NO_THROW(seqan3::bam_index{tmp.path() / "closed.bam.bai"});
+}
+
+TEST(bam_index, missing_index)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "unindexed.bam";
+    {
+        std::vector<std::string> ref_ids{"chr1"};
+        std::vector<size_t> ref_lengths{1000};
+        seqan3::sam_file_output fout{filename, ref_ids, ref_lengths, seqan3::fields<seqan3::field::id>{}};
+    }
+
+    seqan3::sam_file_input fin{filename};
+    EXPECT_THROW(fin.region("chr1", 0, 10), seqan3::file_open_error);
+}
+#endif
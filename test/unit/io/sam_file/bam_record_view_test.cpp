@@ -0,0 +1,251 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/core/debug_stream/byte.hpp>
+#include <seqan3/core/debug_stream/tuple.hpp>
+#include <seqan3/core/debug_stream/variant.hpp>
+#include <seqan3/io/sam_file/bam_record_view.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/output.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+using seqan3::operator""_cigar_operation;
+using seqan3::operator""_dna5;
+using seqan3::operator""_phred42;
+using seqan3::operator""_tag;
+
+struct bam_record_view_test : public ::testing::Test
+{
+    using fields_t = seqan3::fields<seqan3::field::seq,
+                                    seqan3::field::id,
+                                    seqan3::field::ref_id,
+                                    seqan3::field::ref_offset,
+                                    seqan3::field::cigar,
+                                    seqan3::field::mapq,
+                                    seqan3::field::qual,
+                                    seqan3::field::flag,
+                                    seqan3::field::mate,
+                                    seqan3::field::tags>;
+
+    // Writes random records with all fields into the given file.
+    template <typename file_t>
+    void write_records(file_t & fout, size_t const count)
+    {
+        std::mt19937 generator{42u};
+        std::uniform_int_distribution<size_t> length_distribution{0u, 300u};
+        std::uniform_int_distribution<uint8_t> rank_distribution{0u, 4u};
+        std::uniform_int_distribution<uint8_t> quality_distribution{0u, 41u};
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t const length = length_distribution(generator);
+            std::vector<seqan3::dna5> sequence(length);
+            std::vector<seqan3::phred42> qualities(length);
+            for (size_t j = 0; j < length; ++j)
+            {
+                sequence[j].assign_rank(rank_distribution(generator));
+                qualities[j].assign_rank(quality_distribution(generator));
+            }
+
+            std::vector<seqan3::cigar> cigar_sequence{};
+            if (length > 1u)
+                cigar_sequence = {{1u, 'S'_cigar_operation},
+                                  {2u, 'D'_cigar_operation},
+                                  {static_cast<uint32_t>(length - 1u), 'M'_cigar_operation}};
+
+            seqan3::sam_tag_dictionary tags{};
+            tags["NM"_tag] = static_cast<int32_t>(i);
+            tags["XS"_tag] = std::string{"tag"};
+
+            bool const is_mapped = i % 7u != 0u;
+            fout.emplace_back(sequence,
+                              "read" + std::to_string(i),
+                              is_mapped ? std::optional<int32_t>{0} : std::nullopt,
+                              is_mapped ? std::optional<int32_t>{static_cast<int32_t>(i)} : std::nullopt,
+                              cigar_sequence,
+                              static_cast<uint8_t>(i % 61u),
+                              qualities,
+                              is_mapped ? seqan3::sam_flag::paired : seqan3::sam_flag::unmapped,
+                              std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t>{0, 10, -5},
+                              tags);
+        }
+    }
+
+    // Compares the lazily decoded records with the eagerly decoded ones.
+    template <typename open_file_t>
+    void compare_with_eager_records(open_file_t && open_file, size_t const count)
+    {
+        auto eager_file = open_file();
+        auto lazy_file = open_file();
+
+        auto eager_it = eager_file.begin();
+        size_t lazy_count = 0u;
+        for (seqan3::bam_record_view record : lazy_file.lazy_records())
+        {
+            ASSERT_NE(eager_it, eager_file.end());
+            auto & expected = *eager_it;
+
+            EXPECT_EQ(record.id(), expected.id());
+            EXPECT_RANGE_EQ(record.sequence() | seqan3::views::to_char, expected.sequence() | seqan3::views::to_char);
+            EXPECT_RANGE_EQ(record.base_qualities() | seqan3::views::to_char,
+                            expected.base_qualities() | seqan3::views::to_char);
+            EXPECT_EQ(record.sequence_size(), expected.sequence().size());
+            EXPECT_EQ(record.reference_id(), expected.reference_id());
+            EXPECT_EQ(record.reference_position(), expected.reference_position());
+            EXPECT_RANGE_EQ(record.cigar_sequence(), expected.cigar_sequence());
+            EXPECT_EQ(record.mapping_quality(), expected.mapping_quality());
+            EXPECT_EQ(record.flag(), expected.flag());
+            EXPECT_EQ(record.mate_reference_id(), expected.mate_reference_id());
+            EXPECT_EQ(record.mate_position(), expected.mate_position());
+            EXPECT_EQ(record.template_length(), expected.template_length());
+            EXPECT_EQ(record.tags(), expected.tags());
+
+            ++eager_it;
+            ++lazy_count;
+        }
+
+        EXPECT_EQ(eager_it, eager_file.end());
+        EXPECT_EQ(lazy_count, count);
+    }
+
+    std::vector<std::string> ref_ids{"ref"};
+    std::vector<size_t> ref_lengths{100'000};
+};
+
+TEST_F(bam_record_view_test, fields)
+{
+    std::ostringstream stream{};
+    {
+        seqan3::sam_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_bam{}, fields_t{}};
+        write_records(fout, 200u);
+    }
+    std::string const bam_file = stream.str();
+
+    compare_with_eager_records(
+        [&]()
+        {
+            return seqan3::sam_file_input{std::istringstream{bam_file}, seqan3::format_bam{}, fields_t{}};
+        },
+        200u);
+}
+
+TEST_F(bam_record_view_test, empty_file)
+{
+    std::ostringstream stream{};
+    {
+        seqan3::sam_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_bam{}, fields_t{}};
+    }
+
+    seqan3::sam_file_input fin{std::istringstream{stream.str()}, seqan3::format_bam{}};
+    auto records = fin.lazy_records();
+    EXPECT_TRUE(records.begin() == records.end());
+    EXPECT_RANGE_EQ(fin.header().ref_ids(), ref_ids);
+}
+
+TEST_F(bam_record_view_test, after_header)
+{
+    std::ostringstream stream{};
+    {
+        seqan3::sam_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_bam{}, fields_t{}};
+        write_records(fout, 3u);
+    }
+
+    // header() reads the first record, which must not be skipped.
+    seqan3::sam_file_input fin{std::istringstream{stream.str()}, seqan3::format_bam{}};
+    EXPECT_RANGE_EQ(fin.header().ref_ids(), ref_ids);
+
+    std::vector<std::string> ids{};
+    for (seqan3::bam_record_view record : fin.lazy_records())
+        ids.emplace_back(record.id());
+
+    EXPECT_EQ(ids, (std::vector<std::string>{"read0", "read1", "read2"}));
+}
+
+TEST_F(bam_record_view_test, requires_bam)
+{
+    std::string const sam_file{"@SQ\tSN:ref\tLN:100\n"
+                               "read\t0\tref\t1\t60\t4M\t*\t0\t0\tACGT\t*\n"};
+
+    seqan3::sam_file_input fin{std::istringstream{sam_file}, seqan3::format_sam{}};
+    EXPECT_THROW(fin.lazy_records(), seqan3::format_error);
+}
+
+#if defined(SEQAN3_HAS_ZLIB)
+TEST_F(bam_record_view_test, bgzf_blocks)
+{
+    // The records span multiple BGZF blocks and some of them are split between two blocks.
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "records.bam";
+    {
+        seqan3::sam_file_output fout{filename, ref_ids, ref_lengths, fields_t{}};
+        write_records(fout, 2000u);
+    }
+
+    compare_with_eager_records(
+        [&]()
+        {
+            return seqan3::sam_file_input{filename, fields_t{}};
+        },
+        2000u);
+}
+#endif
+
+TEST_F(bam_record_view_test, missing_qualities)
+{
+    std::ostringstream stream{};
+    {
+        seqan3::sam_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_bam{}, fields_t{}};
+        fout.emplace_back("ACGT"_dna5, "read", 0, 0, std::vector<seqan3::cigar>{}, 60u, std::vector<seqan3::phred42>{});
+    }
+
+    seqan3::sam_file_input fin{std::istringstream{stream.str()}, seqan3::format_bam{}};
+    for (seqan3::bam_record_view record : fin.lazy_records())
+    {
+        EXPECT_EQ(record.sequence_size(), 4u);
+        EXPECT_TRUE(std::ranges::empty(record.base_qualities()));
+    }
+}
+
+TEST_F(bam_record_view_test, malformed_record)
+{
+    std::ostringstream stream{};
+    {
+        seqan3::sam_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_bam{}, fields_t{}};
+        write_records(fout, 1u);
+    }
+    std::string const bam_file = stream.str();
+
+    // The record starts with the block_size field, which precedes the 32 bytes of fixed-length fields.
+    size_t const record_begin = bam_file.rfind("read0") - 32u - 4u;
+
+    auto read_modified = [&](size_t const offset, std::string_view const value)
+    {
+        std::string modified_file = bam_file;
+        modified_file.replace(record_begin + 4u + offset, value.size(), value);
+
+        seqan3::sam_file_input fin{std::istringstream{modified_file}, seqan3::format_bam{}};
+        for ([[maybe_unused]] seqan3::bam_record_view record : fin.lazy_records())
+        {}
+    };
+
+    EXPECT_NO_THROW(read_modified(0u, std::string_view{}));
+    EXPECT_THROW(read_modified(8u, std::string_view{"\0", 1u}), seqan3::format_error);                // l_read_name
+    EXPECT_THROW(read_modified(12u, std::string_view{"\xff\xff", 2u}), seqan3::format_error);         // n_cigar_op
+    EXPECT_THROW(read_modified(16u, std::string_view{"\0\0\1\0", 4u}), seqan3::format_error);         // l_seq
+    EXPECT_THROW(read_modified(16u, std::string_view{"\xff\xff\xff\xff", 4u}), seqan3::format_error); // l_seq < 0
+}
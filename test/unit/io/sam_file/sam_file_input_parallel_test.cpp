@@ -0,0 +1,264 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/debug_stream/byte.hpp>
+#include <seqan3/core/debug_stream/optional.hpp>
+#include <seqan3/core/debug_stream/tuple.hpp>
+#include <seqan3/core/debug_stream/variant.hpp>
+#include <seqan3/io/sam_file/input.hpp>
+#include <seqan3/io/sam_file/output.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+using seqan3::operator""_cigar_operation;
+using seqan3::operator""_tag;
+
+struct sam_file_input_parallel_test : public ::testing::TestWithParam<size_t>
+{
+    using fields_t = seqan3::fields<seqan3::field::seq,
+                                    seqan3::field::id,
+                                    seqan3::field::ref_id,
+                                    seqan3::field::ref_offset,
+                                    seqan3::field::cigar,
+                                    seqan3::field::mapq,
+                                    seqan3::field::qual,
+                                    seqan3::field::flag,
+                                    seqan3::field::mate,
+                                    seqan3::field::tags>;
+
+    // Writes random records with all fields into the given file.
+    template <typename file_t>
+    void write_records(file_t & fout, size_t const count)
+    {
+        std::mt19937 generator{42u};
+        std::uniform_int_distribution<size_t> length_distribution{2u, 300u};
+        std::uniform_int_distribution<uint8_t> rank_distribution{0u, 4u};
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t const length = length_distribution(generator);
+            std::vector<seqan3::dna5> sequence(length);
+            for (seqan3::dna5 & base : sequence)
+                base.assign_rank(rank_distribution(generator));
+
+            std::vector<seqan3::phred42> qualities(length);
+            for (size_t j = 0; j < length; ++j)
+                qualities[j].assign_rank(j % 42u);
+
+            std::vector<seqan3::cigar> cigar_sequence{{1u, 'S'_cigar_operation},
+                                                      {static_cast<uint32_t>(length - 1u), 'M'_cigar_operation}};
+
+            seqan3::sam_tag_dictionary tags{};
+            tags["NM"_tag] = static_cast<int32_t>(i);
+
+            bool const is_mapped = i % 5u != 0u;
+            fout.emplace_back(sequence,
+                              "read" + std::to_string(i),
+                              is_mapped ? std::optional<int32_t>{0} : std::nullopt,
+                              is_mapped ? std::optional<int32_t>{static_cast<int32_t>(i)} : std::nullopt,
+                              cigar_sequence,
+                              static_cast<uint8_t>(i % 61u),
+                              qualities,
+                              is_mapped ? seqan3::sam_flag::paired : seqan3::sam_flag::unmapped,
+                              std::tuple<std::optional<int32_t>, std::optional<int32_t>, int32_t>{0, 10, -5},
+                              tags);
+        }
+    }
+
+    // Writes `count` records into an uncompressed BAM file.
+    std::string bam_file(size_t const count)
+    {
+        std::ostringstream stream{};
+        {
+            seqan3::sam_file_output fout{stream, ref_ids, ref_lengths, seqan3::format_bam{}, fields_t{}};
+            write_records(fout, count);
+        }
+        return stream.str();
+    }
+
+    // Reads all records with the given number of threads.
+    template <typename open_file_t>
+    static auto read_records(open_file_t && open_file, size_t const thread_count)
+    {
+        auto fin = open_file();
+        fin.options.thread_count = thread_count;
+
+        std::vector<typename decltype(fin)::record_type> records{};
+        for (auto & record : fin)
+            records.push_back(std::move(record));
+
+        return records;
+    }
+
+    template <typename open_file_t>
+    void expect_same_records(open_file_t && open_file, size_t const count)
+    {
+        auto const expected = read_records(open_file, 1u);
+        auto const records = read_records(open_file, GetParam());
+        ASSERT_EQ(expected.size(), count);
+        ASSERT_EQ(records.size(), count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(records[i].id(), expected[i].id());
+            EXPECT_EQ(records[i].sequence(), expected[i].sequence());
+            EXPECT_EQ(records[i].base_qualities(), expected[i].base_qualities());
+            EXPECT_EQ(records[i].reference_id(), expected[i].reference_id());
+            EXPECT_EQ(records[i].reference_position(), expected[i].reference_position());
+            EXPECT_EQ(records[i].cigar_sequence(), expected[i].cigar_sequence());
+            EXPECT_EQ(records[i].mapping_quality(), expected[i].mapping_quality());
+            EXPECT_EQ(records[i].flag(), expected[i].flag());
+            EXPECT_EQ(records[i].mate_reference_id(), expected[i].mate_reference_id());
+            EXPECT_EQ(records[i].mate_position(), expected[i].mate_position());
+            EXPECT_EQ(records[i].template_length(), expected[i].template_length());
+            EXPECT_EQ(records[i].tags(), expected[i].tags());
+        }
+    }
+
+    std::vector<std::string> ref_ids{"ref"};
+    std::vector<size_t> ref_lengths{100'000};
+};
+
+TEST_P(sam_file_input_parallel_test, stream)
+{
+    std::string const file = bam_file(5000u);
+
+    expect_same_records(
+        [&]()
+        {
+            return seqan3::sam_file_input{std::istringstream{file}, seqan3::format_bam{}, fields_t{}};
+        },
+        5000u);
+}
+
+TEST_P(sam_file_input_parallel_test, few_records)
+{
+    std::string const file = bam_file(3u);
+
+    expect_same_records(
+        [&]()
+        {
+            return seqan3::sam_file_input{std::istringstream{file}, seqan3::format_bam{}, fields_t{}};
+        },
+        3u);
+}
+
+TEST_P(sam_file_input_parallel_test, empty_file)
+{
+    seqan3::sam_file_input fin{std::istringstream{bam_file(0u)}, seqan3::format_bam{}, fields_t{}};
+    fin.options.thread_count = GetParam();
+
+    EXPECT_TRUE(fin.begin() == fin.end());
+    EXPECT_EQ(fin.header().ref_ids(), (std::deque<std::string>{"ref"}));
+}
+
+TEST_P(sam_file_input_parallel_test, header_first)
+{
+    seqan3::sam_file_input fin{std::istringstream{bam_file(10u)}, seqan3::format_bam{}, fields_t{}};
+    fin.options.thread_count = GetParam();
+
+    EXPECT_EQ(fin.header().ref_ids(), (std::deque<std::string>{"ref"}));
+
+    size_t count = 0u;
+    for (auto & record : fin)
+    {
+        EXPECT_EQ(record.id(), "read" + std::to_string(count));
+        ++count;
+    }
+    EXPECT_EQ(count, 10u);
+}
+
+TEST_P(sam_file_input_parallel_test, reference_information)
+{
+    std::vector<std::vector<seqan3::dna5>> ref_sequences{std::vector<seqan3::dna5>(100'000)};
+    std::string const file = bam_file(2000u);
+
+    expect_same_records(
+        [&]()
+        {
+            return seqan3::sam_file_input{std::istringstream{file},
+                                          ref_ids,
+                                          ref_sequences,
+                                          seqan3::format_bam{},
+                                          fields_t{}};
+        },
+        2000u);
+}
+
+TEST_P(sam_file_input_parallel_test, invalid_record)
+{
+    std::string file = bam_file(3000u);
+
+    // Set the reference id of record 2500 to an invalid value.
+    size_t const id_position = file.find(std::string{"read2500"} + '\0');
+    ASSERT_NE(id_position, std::string::npos);
+    int32_t const invalid_ref_id = 5;
+    std::memcpy(file.data() + id_position - 32u, &invalid_ref_id, sizeof(invalid_ref_id));
+
+    seqan3::sam_file_input fin{std::istringstream{file}, seqan3::format_bam{}, fields_t{}};
+    fin.options.thread_count = GetParam();
+
+    // The records preceding the invalid record are returned before the error is reported.
+    size_t count = 0u;
+    EXPECT_THROW(
+        {
+            for (auto & record : fin)
+            {
+                EXPECT_EQ(record.id(), "read" + std::to_string(count));
+                ++count;
+            }
+        },
+        seqan3::format_error);
+    EXPECT_EQ(count, 2500u);
+}
+
+TEST_P(sam_file_input_parallel_test, sam_file)
+{
+    std::string const file{"@SQ\tSN:ref\tLN:100\n"
+                           "read1\t0\tref\t1\t60\t4M\t*\t0\t0\tACGT\t*\n"
+                           "read2\t0\tref\t2\t60\t4M\t*\t0\t0\tACGT\t*\n"};
+
+    seqan3::sam_file_input fin{std::istringstream{file}, seqan3::format_sam{}, fields_t{}};
+    fin.options.thread_count = GetParam();
+
+    std::vector<std::string> ids{};
+    for (auto & record : fin)
+        ids.push_back(record.id());
+
+    EXPECT_EQ(ids, (std::vector<std::string>{"read1", "read2"}));
+}
+
+#if defined(SEQAN3_HAS_ZLIB)
+TEST_P(sam_file_input_parallel_test, bgzf_file)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "records.bam";
+    {
+        seqan3::sam_file_output fout{filename, ref_ids, ref_lengths, fields_t{}};
+        write_records(fout, 20'000u);
+    }
+
+    expect_same_records(
+        [&]()
+        {
+            return seqan3::sam_file_input{filename, fields_t{}};
+        },
+        20'000u);
+}
+#endif
+
+INSTANTIATE_TEST_SUITE_P(threads, sam_file_input_parallel_test, ::testing::Values(2u, 4u));
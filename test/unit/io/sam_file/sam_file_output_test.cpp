@@ -354,6 +354,28 @@ TEST(row, emplace_back)
         });
 }
 
+TEST(row, write_after_close)
+{
+    std::ostringstream stream{};
+    seqan3::sam_file_output fout{stream,
+                                 seqan3::format_sam{},
+                                 seqan3::fields<seqan3::field::seq, seqan3::field::id>{}};
+    fout.emplace_back(seqs[0], ids[0]);
+    fout.close();
+    std::string const written = stream.str();
+
+    seqan3::record<seqan3::type_list<seqan3::dna5_vector, std::string>,
+                   seqan3::fields<seqan3::field::seq, seqan3::field::id>>
+        r{seqs[1], ids[1]};
+
+    EXPECT_THROW(fout.emplace_back(seqs[1], ids[1]), std::logic_error);
+    EXPECT_THROW(fout.push_back(r), std::logic_error);
+    EXPECT_THROW(fout.push_back(std::tie(seqs[1], ids[1])), std::logic_error);
+    EXPECT_THROW(std::ranges::begin(fout) = r, std::logic_error);
+    EXPECT_NO_THROW(fout.close());
+    EXPECT_EQ(stream.str(), written);
+}
+
 /* Here the record contains a different field composite than the file. The record knows about the
  * association of values and fields, so it does not need to be guessed from the file.
  */
@@ -209,6 +209,32 @@ TEST_F(sequence_file_input_f, empty_file)
     EXPECT_EQ(fin.begin(), fin.end());
 }
 
+TEST_F(sequence_file_input_f, record_reading_memory_map)
+{
+    seqan3::test::tmp_directory tmp;
+    auto filename = tmp.path() / "file.fasta";
+
+    {
+        std::ofstream filecreator{filename, std::ios::out | std::ios::binary};
+        filecreator << input;
+    }
+
+    seqan3::sequence_file_input_options<seqan3::dna15> options{};
+    options.memory_map = true;
+    options.truncate_ids = true;
+    seqan3::sequence_file_input fin{filename, default_fields{}, options};
+    EXPECT_TRUE(fin.options.memory_map);
+
+    size_t counter = 0;
+    for (auto & rec : fin)
+    {
+        EXPECT_RANGE_EQ(rec.id(), id_comp[counter].substr(0, id_comp[counter].find(' ')));
+        EXPECT_RANGE_EQ(rec.sequence(), seq_comp[counter]);
+        ++counter;
+    }
+    EXPECT_EQ(counter, 3u);
+}
+
 TEST_F(sequence_file_input_f, empty_stream)
 {
     seqan3::sequence_file_input fin{std::istringstream{std::string{}}, seqan3::format_fasta{}};
@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/alphabet/quality/phred42.hpp>
+#include <seqan3/alphabet/views/char_to.hpp>
+#include <seqan3/io/sequence_file/detail/letter_table.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+#include <seqan3/utility/char_operations/predicate.hpp>
+
+using seqan3::detail::letter_category;
+
+template <typename alphabet_t>
+letter_category classify(char const chr)
+{
+    if (seqan3::is_space(chr))
+        return letter_category::skip;
+    else if (chr == '>')
+        return letter_category::stop;
+    else if (seqan3::char_is_valid_for<alphabet_t>(chr))
+        return letter_category::letter;
+    else
+        return letter_category::invalid;
+}
+
+template <typename alphabet_t>
+seqan3::detail::letter_table<alphabet_t> const table{classify<alphabet_t>};
+
+template <typename alphabet_t>
+std::vector<alphabet_t> to_letters(std::string const & chars)
+{
+    std::vector<alphabet_t> letters{};
+    std::ranges::copy(chars | seqan3::views::char_to<alphabet_t>, std::back_inserter(letters));
+    return letters;
+}
+
+TEST(letter_table, category)
+{
+    EXPECT_TRUE(table<seqan3::dna5>.category('A') == letter_category::letter);
+    EXPECT_TRUE(table<seqan3::dna5>.category('n') == letter_category::letter);
+    EXPECT_TRUE(table<seqan3::dna5>.category('\n') == letter_category::skip);
+    EXPECT_TRUE(table<seqan3::dna5>.category('>') == letter_category::stop);
+    EXPECT_TRUE(table<seqan3::dna5>.category('!') == letter_category::invalid);
+    EXPECT_TRUE(table<seqan3::dna5>.category('\xFF') == letter_category::invalid);
+}
+
+TEST(letter_table, append_to)
+{
+    // The lines are longer than a SIMD block.
+    std::string const line{"ACGTNacgtnACGTNacgtnACGTNacgtnACGTNacgtnACG"};
+    std::string const chars = line + "\r\n" + line + "\n\n" + line;
+    std::vector<seqan3::dna5> sequence{};
+
+    EXPECT_EQ(table<seqan3::dna5>.append_to(chars, sequence), chars.size());
+    EXPECT_RANGE_EQ(sequence, to_letters<seqan3::dna5>(line + line + line));
+
+    // Appends to the existing letters.
+    EXPECT_EQ(table<seqan3::dna5>.append_to(line + ">next", sequence), line.size());
+    EXPECT_EQ(sequence.size(), 4u * line.size());
+}
+
+TEST(letter_table, append_to_invalid)
+{
+    // The invalid character is located within a SIMD block and the block is processed character by character.
+    std::string const chars{"ACGTACGTACGTACGTACGTACGTACGTACGTACGT!CGTACGTACGTACGTACGTACGTACGTACGT"};
+    std::vector<seqan3::dna5> sequence{};
+
+    EXPECT_EQ(table<seqan3::dna5>.append_to(chars, sequence), 36u);
+    EXPECT_RANGE_EQ(sequence, to_letters<seqan3::dna5>(chars.substr(0u, 36u)));
+
+    // Characters above 127 are never letters.
+    std::string const qualities{"!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!IIII\x80"};
+    std::vector<seqan3::phred42> quality_sequence{};
+
+    EXPECT_EQ(table<seqan3::phred42>.append_to(qualities, quality_sequence), qualities.size() - 1u);
+    EXPECT_RANGE_EQ(quality_sequence, to_letters<seqan3::phred42>(qualities.substr(0u, qualities.size() - 1u)));
+}
+
+TEST(letter_table, append_to_max_letters)
+{
+    std::string const chars{"ACGTACGTACGTACGTACGTACGTACGTACGTAC\nGTACGTACGTACGTACGTACGTACGTACGT"};
+    std::vector<seqan3::dna5> sequence{};
+
+    EXPECT_EQ(table<seqan3::dna5>.append_to(chars, sequence, 40u), 41u);
+    EXPECT_EQ(sequence.size(), 40u);
+
+    sequence.clear();
+    EXPECT_EQ(table<seqan3::dna5>.append_to(chars, sequence, 0u), 0u);
+    EXPECT_TRUE(sequence.empty());
+}
+
+TEST(letter_table, append_chars)
+{
+    std::string id{"read"};
+    seqan3::detail::append_chars(id, " 1");
+    EXPECT_EQ(id, "read 1");
+
+    std::vector<seqan3::dna5> sequence{};
+    seqan3::detail::append_chars(sequence, "ACGT");
+    EXPECT_RANGE_EQ(sequence, to_letters<seqan3::dna5>("ACGT"));
+}
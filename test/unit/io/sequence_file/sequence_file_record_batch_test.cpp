@@ -0,0 +1,172 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/detail/debug_stream_alphabet.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+#include <seqan3/utility/views/chunk.hpp>
+#include <seqan3/utility/views/zip.hpp>
+
+using seqan3::operator""_dna5;
+using seqan3::operator""_phred42;
+
+struct sequence_file_record_batch_test : public ::testing::Test
+{
+    // Returns a FASTQ file with `count` records.
+    static std::string fastq_file(size_t const count)
+    {
+        std::string file{};
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::string const sequence(1u + i % 7u, "ACGTN"[i % 5u]);
+            file += "@read" + std::to_string(i) + '\n' + sequence + "\n+\n" + std::string(sequence.size(), '!' + i % 40)
+                  + '\n';
+        }
+        return file;
+    }
+
+    // Reads all records with the range interface.
+    template <typename file_t>
+    static std::vector<typename file_t::record_type> read_records(file_t && fin)
+    {
+        std::vector<typename file_t::record_type> records{};
+        for (auto & record : fin)
+            records.push_back(std::move(record));
+        return records;
+    }
+};
+
+TEST_F(sequence_file_record_batch_test, fastq)
+{
+    std::string const file = fastq_file(1000u);
+    auto const expected = read_records(seqan3::sequence_file_input{std::istringstream{file}, seqan3::format_fastq{}});
+
+    seqan3::sequence_file_input fin{std::istringstream{file}, seqan3::format_fastq{}};
+    decltype(fin)::record_batch_type batch{};
+
+    size_t record_count = 0u;
+    size_t batch_count = 0u;
+    while (fin.read_batch(batch, 300u) > 0u)
+    {
+        EXPECT_EQ(batch.size(), batch_count < 3u ? 300u : 100u);
+        EXPECT_EQ(batch.sequences().size(), batch.size());
+        EXPECT_EQ(batch.ids().size(), batch.size());
+        EXPECT_EQ(batch.base_qualities().size(), batch.size());
+
+        for (size_t i = 0; i < batch.size(); ++i, ++record_count)
+        {
+            EXPECT_RANGE_EQ(batch.sequences()[i], expected[record_count].sequence());
+            EXPECT_RANGE_EQ(batch.ids()[i], expected[record_count].id());
+            EXPECT_RANGE_EQ(batch.base_qualities()[i], expected[record_count].base_qualities());
+        }
+        ++batch_count;
+    }
+
+    EXPECT_EQ(record_count, 1000u);
+    EXPECT_EQ(batch_count, 4u);
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(fin.read_batch(batch, 300u), 0u);
+}
+
+TEST_F(sequence_file_record_batch_test, selected_fields)
+{
+    seqan3::sequence_file_input fin{std::istringstream{fastq_file(10u)},
+                                    seqan3::format_fastq{},
+                                    seqan3::fields<seqan3::field::id>{}};
+    decltype(fin)::record_batch_type batch{};
+
+    EXPECT_EQ(fin.read_batch(batch, 100u), 10u);
+    EXPECT_EQ(batch.ids().size(), 10u);
+    EXPECT_RANGE_EQ(batch.ids()[9], std::string{"read9"});
+    EXPECT_TRUE(batch.sequences().empty());
+    EXPECT_TRUE(batch.base_qualities().empty());
+}
+
+TEST_F(sequence_file_record_batch_test, mixed_with_range_interface)
+{
+    std::string const file{">read0\nACGT\n>read1\nA\n>read2\nCC\n>read3\nGGG\n>read4\nTTTT\n"};
+    seqan3::sequence_file_input fin{std::istringstream{file}, seqan3::format_fasta{}};
+    decltype(fin)::record_batch_type batch{};
+
+    // The record buffered by begin() is the first record of the batch.
+    auto it = fin.begin();
+    EXPECT_EQ((*it).id(), "read0");
+    EXPECT_EQ(fin.read_batch(batch, 2u), 2u);
+    EXPECT_RANGE_EQ(batch.ids()[0], std::string{"read0"});
+    EXPECT_RANGE_EQ(batch.ids()[1], std::string{"read1"});
+
+    // begin() continues after the batch.
+    it = fin.begin();
+    EXPECT_EQ((*it).id(), "read2");
+    EXPECT_EQ((*it).sequence(), "CC"_dna5);
+    ++it;
+
+    EXPECT_EQ(fin.read_batch(batch, 0u), 0u);
+    EXPECT_EQ(fin.read_batch(batch, 5u), 2u);
+    EXPECT_RANGE_EQ(batch.ids()[0], std::string{"read3"});
+    EXPECT_RANGE_EQ(batch.sequences()[1], "TTTT"_dna5);
+
+    EXPECT_TRUE(fin.begin() == fin.end());
+    EXPECT_EQ(fin.read_batch(batch, 5u), 0u);
+}
+
+TEST_F(sequence_file_record_batch_test, empty_file)
+{
+    seqan3::sequence_file_input fin{std::istringstream{std::string{}}, seqan3::format_fasta{}};
+    decltype(fin)::record_batch_type batch{};
+
+    EXPECT_EQ(fin.read_batch(batch, 10u), 0u);
+    EXPECT_TRUE(batch.empty());
+}
+
+TEST_F(sequence_file_record_batch_test, push_back_and_clear)
+{
+    using record_t = seqan3::sequence_record<seqan3::type_list<std::vector<seqan3::dna5>, std::string>,
+                                             seqan3::fields<seqan3::field::seq, seqan3::field::id>>;
+    seqan3::sequence_record_batch<std::vector<seqan3::dna5>, std::string, std::vector<seqan3::phred42>> batch{};
+
+    batch.push_back(record_t{"ACGT"_dna5, "first"});
+    batch.push_back(record_t{""_dna5, "second"});
+    EXPECT_EQ(batch.size(), 2u);
+    EXPECT_RANGE_EQ(batch.sequences()[0], "ACGT"_dna5);
+    EXPECT_TRUE(batch.sequences()[1].empty());
+    EXPECT_RANGE_EQ(batch.ids()[1], std::string{"second"});
+    EXPECT_TRUE(batch.base_qualities().empty());
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    EXPECT_TRUE(batch.sequences().empty());
+    EXPECT_TRUE(batch.ids().empty());
+}
+
+TEST_F(sequence_file_record_batch_test, chunked_alignment)
+{
+    std::string const file{">read0\nACGT\n>read1\nGGTT\n>read2\nACGA\n>read3\nTTTT\n>read4\nCGTA\n"};
+    seqan3::sequence_file_input fin{std::istringstream{file}, seqan3::format_fasta{}};
+    decltype(fin)::record_batch_type batch{};
+    fin.read_batch(batch, 10u);
+
+    auto const config =
+        seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::output_score{};
+    std::vector<int> scores{};
+
+    // Every chunk of the batch could be processed by another thread.
+    for (auto && chunk : batch.sequences() | seqan3::views::chunk(2))
+        for (auto && result : seqan3::align_pairwise(seqan3::views::zip(chunk, chunk | std::views::reverse), config))
+            scores.push_back(result.score());
+
+    EXPECT_EQ(scores, (std::vector<int>{-3, -3, -4, -4, 0}));
+}
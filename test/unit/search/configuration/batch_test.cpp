@@ -0,0 +1,55 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/search/configuration/batch.hpp>
+
+TEST(search_config_batch, member_variable)
+{
+    { // default construction
+        seqan3::search_cfg::batch cfg{};
+        EXPECT_EQ(cfg.size, 64u);
+    }
+
+    { // construct with value
+        seqan3::search_cfg::batch cfg{16};
+        EXPECT_EQ(cfg.size, 16u);
+    }
+
+    { // assign value
+        seqan3::search_cfg::batch cfg{};
+        cfg.size = 16;
+        EXPECT_EQ(cfg.size, 16u);
+    }
+}
+
+TEST(search_config_batch, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::search_cfg::batch>));
+}
+
+TEST(search_config_batch, configuration)
+{
+    { // from lvalue.
+        seqan3::search_cfg::batch elem{16};
+        seqan3::configuration cfg{elem};
+        using ret_type = decltype(std::get<seqan3::search_cfg::batch>(cfg).size);
+        EXPECT_TRUE((std::is_same_v<std::remove_reference_t<ret_type>, size_t>));
+
+        EXPECT_EQ(std::get<seqan3::search_cfg::batch>(cfg).size, 16u);
+    }
+
+    { // from rvalue.
+        seqan3::configuration cfg{seqan3::search_cfg::batch{16}};
+        using ret_type = decltype(std::get<seqan3::search_cfg::batch>(cfg).size);
+        EXPECT_TRUE((std::is_same_v<std::remove_reference_t<ret_type>, size_t>));
+
+        EXPECT_EQ(std::get<seqan3::search_cfg::batch>(cfg).size, 16u);
+    }
+}
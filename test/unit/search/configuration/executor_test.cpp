@@ -0,0 +1,61 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/search/configuration/executor.hpp>
+
+TEST(search_config_executor, member_variable)
+{
+    seqan3::thread_pool pool{2};
+
+    { // default construction
+        seqan3::search_cfg::executor cfg{};
+        EXPECT_EQ(cfg.pool, nullptr);
+    }
+
+    { // construct with value
+        seqan3::search_cfg::executor cfg{pool};
+        EXPECT_EQ(cfg.pool, &pool);
+    }
+
+    { // assign value
+        seqan3::search_cfg::executor cfg{};
+        cfg.pool = &pool;
+        EXPECT_EQ(cfg.pool, &pool);
+    }
+}
+
+TEST(search_config_executor, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::search_cfg::executor>));
+}
+
+TEST(search_config_executor, configuration)
+{
+    seqan3::thread_pool pool{2};
+
+    { // from lvalue.
+        seqan3::search_cfg::executor elem{pool};
+        seqan3::configuration cfg{elem};
+        using ret_type = decltype(std::get<seqan3::search_cfg::executor>(cfg).pool);
+        EXPECT_TRUE((std::is_same_v<std::remove_reference_t<ret_type>, seqan3::thread_pool *>));
+
+        EXPECT_EQ(std::get<seqan3::search_cfg::executor>(cfg).pool, &pool);
+    }
+
+    { // from rvalue.
+        seqan3::configuration cfg{seqan3::search_cfg::executor{pool}};
+        using ret_type = decltype(std::get<seqan3::search_cfg::executor>(cfg).pool);
+        EXPECT_TRUE((std::is_same_v<std::remove_reference_t<ret_type>, seqan3::thread_pool *>));
+
+        EXPECT_EQ(std::get<seqan3::search_cfg::executor>(cfg).pool, &pool);
+    }
+}
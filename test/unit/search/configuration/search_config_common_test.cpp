@@ -47,7 +47,9 @@ using search_config_and_taboo_types = seqan3::type_list<
     std::pair<cfg::output_reference_begin_position, seqan3::type_list<cfg::output_reference_begin_position>>,
     std::pair<cfg::output_index_cursor, seqan3::type_list<cfg::output_index_cursor>>,
     // other configs
-    std::pair<cfg::parallel, seqan3::type_list<cfg::parallel>>,
+    std::pair<cfg::parallel, seqan3::type_list<cfg::parallel, cfg::executor>>,
+    std::pair<cfg::executor, seqan3::type_list<cfg::executor, cfg::parallel>>,
+    std::pair<cfg::batch, seqan3::type_list<cfg::batch>>,
     std::pair<cfg::on_result<callback_t>, seqan3::type_list<cfg::on_result<callback_t>>>,
     std::pair<cfg::detail::result_type<search_result_t>, seqan3::type_list<cfg::detail::result_type<search_result_t>>>>;
 
@@ -75,7 +77,7 @@ public:
     // NOTE: You must update this number if you add a new entity to seqan3::detail::search_config_id.
     // config_count is used to check that the config size is correct.
     // And don't forget to add the new config into the above test fixture (via search_config_and_taboo_types).
-    static constexpr int8_t config_count = 12;
+    static constexpr int8_t config_count = 14;
 };
 
 // Configuration element type list as gtest suitable testing::Types
@@ -0,0 +1,123 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+#include <seqan3/search/dream_index/hierarchical_interleaved_bloom_filter.hpp>
+#include <seqan3/test/cereal.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+template <typename hibf_type>
+struct hierarchical_interleaved_bloom_filter_test : public ::testing::Test
+{
+    // User bin i contains the values [100000 * i, 100000 * i + size_i).
+    static std::vector<std::vector<size_t>> user_bins(std::vector<size_t> const & sizes)
+    {
+        std::vector<std::vector<size_t>> result(sizes.size());
+        for (size_t i = 0; i < sizes.size(); ++i)
+        {
+            result[i].resize(sizes[i]);
+            std::iota(result[i].begin(), result[i].end(), 100'000u * i);
+        }
+        return result;
+    }
+
+    static hibf_type make_hibf(std::vector<std::vector<size_t>> const & values, seqan3::hibf_config const & config)
+    {
+        if constexpr (hibf_type::data_layout_mode == seqan3::data_layout::compressed)
+            return hibf_type{seqan3::hierarchical_interleaved_bloom_filter{values, config}};
+        else
+            return hibf_type{values, config};
+    }
+};
+
+using hibf_types = ::testing::Types<seqan3::hierarchical_interleaved_bloom_filter<seqan3::data_layout::uncompressed>,
+                                    seqan3::hierarchical_interleaved_bloom_filter<seqan3::data_layout::compressed>>;
+
+TYPED_TEST_SUITE(hierarchical_interleaved_bloom_filter_test, hibf_types, );
+
+TYPED_TEST(hierarchical_interleaved_bloom_filter_test, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_destructible_v<TypeParam>);
+
+    auto values = TestFixture::user_bins({10u, 20u});
+
+    EXPECT_THROW((seqan3::hierarchical_interleaved_bloom_filter{std::vector<std::vector<size_t>>{}}),
+                 std::invalid_argument);
+    EXPECT_THROW((seqan3::hierarchical_interleaved_bloom_filter{values, {.tmax = 100u}}), std::invalid_argument);
+    EXPECT_THROW((seqan3::hierarchical_interleaved_bloom_filter{values, {.maximum_false_positive_rate = 1.0}}),
+                 std::invalid_argument);
+    EXPECT_THROW((seqan3::hierarchical_interleaved_bloom_filter{values, {.number_of_hash_functions = 6u}}),
+                 std::invalid_argument);
+    EXPECT_THROW((seqan3::hierarchical_interleaved_bloom_filter{values, {.threads = 0u}}), std::invalid_argument);
+}
+
+TYPED_TEST(hierarchical_interleaved_bloom_filter_test, single_level)
+{
+    // Fewer user bins than technical bins: the largest user bin is split.
+    auto values = TestFixture::user_bins({5000u, 100u, 100u, 0u});
+    TypeParam hibf{TestFixture::make_hibf(values, {})};
+
+    EXPECT_EQ(hibf.user_bin_count(), 4u);
+    EXPECT_EQ(hibf.ibf_count(), 1u);
+
+    auto agent = hibf.membership_agent();
+    for (size_t user_bin = 0; user_bin < 3u; ++user_bin)
+        EXPECT_RANGE_EQ(agent.membership_for(values[user_bin], values[user_bin].size()),
+                        (std::vector<int64_t>{static_cast<int64_t>(user_bin)}));
+
+    // The values of user bin 0 are distributed over its technical bins.
+    EXPECT_RANGE_EQ(agent.membership_for(std::vector<size_t>{0u, 2500u, 4999u}, 3u), (std::vector<int64_t>{0}));
+}
+
+TYPED_TEST(hierarchical_interleaved_bloom_filter_test, multiple_levels)
+{
+    // 300 user bins of very different sizes do not fit into 64 technical bins.
+    std::vector<size_t> sizes(300u);
+    for (size_t i = 0; i < sizes.size(); ++i)
+        sizes[i] = (i % 7u == 0u) ? 2000u : 10u + i % 13u;
+
+    auto values = TestFixture::user_bins(sizes);
+    TypeParam hibf{TestFixture::make_hibf(values, {.tmax = 64u, .threads = 2u})};
+
+    EXPECT_EQ(hibf.user_bin_count(), 300u);
+    EXPECT_GT(hibf.ibf_count(), 1u);
+
+    // Every user bin is found with its own values.
+    auto agent = hibf.membership_agent();
+    for (size_t user_bin = 0; user_bin < sizes.size(); ++user_bin)
+    {
+        auto const & result = agent.membership_for(values[user_bin], values[user_bin].size());
+        EXPECT_TRUE(std::ranges::find(result, static_cast<int64_t>(user_bin)) != result.end()) << user_bin;
+        EXPECT_LE(result.size(), 2u); // At most a few false positives.
+    }
+
+    // Threshold 0 reports all user bins.
+    auto const & all = agent.membership_for(std::vector<size_t>{}, 0u);
+    EXPECT_EQ(all.size(), 300u);
+    EXPECT_TRUE(std::ranges::is_sorted(all));
+
+    // An Interleaved Bloom Filter sizes all bins for the largest user bin: 2000 values with 2 hash functions and a
+    // false positive rate of 0.05 need 15'774 bits.
+    seqan3::interleaved_bloom_filter flat{seqan3::bin_count{300u}, seqan3::bin_size{15'774u}};
+    EXPECT_LT(hibf.bit_size() * 2u, flat.bit_size());
+}
+
+TYPED_TEST(hierarchical_interleaved_bloom_filter_test, serialisation)
+{
+    auto values = TestFixture::user_bins(std::vector<size_t>(100u, 50u));
+    TypeParam hibf{TestFixture::make_hibf(values, {})};
+    seqan3::test::do_serialisation(hibf);
+}
@@ -7,9 +7,15 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <numeric>
+#include <thread>
+
 #include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
 #include <seqan3/test/cereal.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+#include <seqan3/utility/bloom_filter/bloom_filter.hpp>
 
 template <typename ibf_type>
 struct interleaved_bloom_filter_test : public ::testing::Test
@@ -133,6 +139,65 @@ TYPED_TEST(interleaved_bloom_filter_test, emplace)
     }
 }
 
+TYPED_TEST(interleaved_bloom_filter_test, bulk_contains_many_bins)
+{
+    // 1100 bins need 18 words, i.e. the vectorised and the remaining scalar part of bulk_contains are both used.
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{1100u},
+                                         seqan3::bin_size{1024u},
+                                         seqan3::hash_function_count{3u}};
+
+    for (size_t hash : std::views::iota(0, 1100))
+        ibf.emplace(hash, seqan3::bin_index{hash});
+
+    TypeParam ibf2{ibf};
+    auto agent = ibf2.membership_agent();
+    for (size_t hash : std::views::iota(0, 1100))
+    {
+        auto & res = agent.bulk_contains(hash);
+        EXPECT_EQ(res.size(), 1100u);
+        EXPECT_TRUE(res[hash]);
+    }
+
+    // The uncompressed and compressed Interleaved Bloom Filter must agree on all bins.
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed> ibf3{ibf};
+    auto agent3 = ibf3.membership_agent();
+    for (size_t hash : std::views::iota(0, 2000))
+        EXPECT_RANGE_EQ(agent.bulk_contains(hash), agent3.bulk_contains(hash));
+}
+
+TYPED_TEST(interleaved_bloom_filter_test, bulk_contains_range)
+{
+    // 1. Test uncompressed interleaved_bloom_filter directly because the compressed one is not mutable.
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{130u},
+                                         seqan3::bin_size{1024u},
+                                         seqan3::hash_function_count{2u}};
+
+    for (size_t hash : std::views::iota(0, 130))
+        ibf.emplace(hash, seqan3::bin_index{hash});
+
+    // 2. Construct either the uncompressed or compressed interleaved_bloom_filter and compare the results of the range
+    //    overload with the results for single values. 50 values span multiple prefetch blocks.
+    TypeParam ibf2{ibf};
+    auto agent = ibf2.membership_agent();
+    auto agent2 = ibf2.membership_agent();
+    std::vector<size_t> values(50);
+    std::iota(values.begin(), values.end(), 100u);
+
+    auto & results = agent.bulk_contains(values);
+    ASSERT_EQ(results.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_RANGE_EQ(results[i], agent2.bulk_contains(values[i]));
+
+    // Input ranges are supported and the buffer shrinks to the number of values.
+    auto & results2 = agent.bulk_contains(std::views::iota(100u, 103u));
+    ASSERT_EQ(results2.size(), 3u);
+    for (size_t i = 0; i < 3u; ++i)
+        EXPECT_RANGE_EQ(results2[i], agent2.bulk_contains(values[i]));
+
+    // An empty range yields no results.
+    EXPECT_TRUE(agent.bulk_contains(std::vector<size_t>{}).empty());
+}
+
 TYPED_TEST(interleaved_bloom_filter_test, clear)
 {
     // 1. Test uncompressed interleaved_bloom_filter directly because the compressed one is not mutable.
@@ -305,6 +370,47 @@ TYPED_TEST(interleaved_bloom_filter_test, counting_agent_no_ub)
     EXPECT_RANGE_EQ(agent2.bulk_count(std::views::iota(0u, 128u)), expected);
 }
 
+TYPED_TEST(interleaved_bloom_filter_test, threshold_agent)
+{
+    // 1. Test uncompressed interleaved_bloom_filter directly because the compressed one is not mutable.
+    //    Bin `i` contains the values [0, 10 * i), i.e. bin `i` contains 10 * i of the values [0, 1000).
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{100u},
+                                         seqan3::bin_size{8192u},
+                                         seqan3::hash_function_count{2u}};
+
+    for (size_t bin_idx : std::views::iota(0, 100))
+        for (size_t hash : std::views::iota(0u, 10u * bin_idx))
+            ibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+    // 2. Construct either the uncompressed or compressed interleaved_bloom_filter and compare with bulk_count
+    TypeParam ibf2{ibf};
+    auto agent = ibf2.threshold_agent();
+    auto counting_agent = ibf2.counting_agent();
+
+    std::vector<size_t> values(1000);
+    std::iota(values.begin(), values.end(), 0u);
+    auto & counts = counting_agent.bulk_count(values);
+
+    for (size_t threshold : {0u, 1u, 10u, 455u, 990u, 991u, 1000u, 1001u})
+    {
+        std::vector<size_t> expected{};
+        for (size_t bin = 0; bin < counts.size(); ++bin)
+            if (counts[bin] >= threshold)
+                expected.push_back(bin);
+
+        EXPECT_RANGE_EQ(agent.bulk_threshold(values, threshold), expected);
+    }
+
+    // Values that are not contained in any bin trigger the early exit.
+    EXPECT_TRUE(agent.bulk_threshold(std::views::iota(100'000u, 101'000u), 500u).empty());
+    EXPECT_TRUE(agent.bulk_threshold(std::vector<size_t>{}, 1u).empty());
+    EXPECT_EQ(agent.bulk_threshold(std::vector<size_t>{}, 0u).size(), 100u);
+
+    // Different counter type
+    auto agent2 = ibf2.template threshold_agent<uint8_t>();
+    EXPECT_RANGE_EQ(agent2.bulk_threshold(std::views::iota(0u, 250u), 250u), std::views::iota(25u, 100u));
+}
+
 TYPED_TEST(interleaved_bloom_filter_test, increase_bin_number_to)
 {
     seqan3::interleaved_bloom_filter ibf1{seqan3::bin_count{73u}, seqan3::bin_size{1024u}};
@@ -378,3 +484,148 @@ TEST(interleaved_bloom_filter_test, decompression)
 
     EXPECT_TRUE(ibf == ibf_decompressed);
 }
+
+TEST(interleaved_bloom_filter_test, mapped)
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{73u},
+                                         seqan3::bin_size{1024u},
+                                         seqan3::hash_function_count{3u}};
+
+    for (size_t bin_idx : std::views::iota(0, 73))
+        for (size_t hash : std::views::iota(bin_idx * 10, bin_idx * 10 + 20))
+            ibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "ibf.mapped";
+    ibf.save_mapped(filename);
+
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped> ibf_mapped{filename, {.populate = true}};
+
+    EXPECT_EQ(ibf_mapped.bin_count(), ibf.bin_count());
+    EXPECT_EQ(ibf_mapped.bin_size(), ibf.bin_size());
+    EXPECT_EQ(ibf_mapped.hash_function_count(), ibf.hash_function_count());
+    EXPECT_EQ(ibf_mapped.bit_size(), ibf.bit_size());
+
+    auto agent = ibf.membership_agent();
+    auto agent_mapped = ibf_mapped.membership_agent();
+    for (size_t hash : std::views::iota(0u, 800u))
+        EXPECT_RANGE_EQ(agent_mapped.bulk_contains(hash), agent.bulk_contains(hash));
+
+    auto counting_agent = ibf.counting_agent();
+    auto counting_agent_mapped = ibf_mapped.counting_agent();
+    EXPECT_RANGE_EQ(counting_agent_mapped.bulk_count(std::views::iota(0u, 800u)),
+                    counting_agent.bulk_count(std::views::iota(0u, 800u)));
+
+    // The mapping outlives the Interleaved Bloom Filter it was constructed from.
+    auto ibf_mapped_copy = ibf_mapped;
+    ibf_mapped = {};
+    auto agent_copy = ibf_mapped_copy.membership_agent();
+    EXPECT_RANGE_EQ(agent_copy.bulk_contains(15u), agent.bulk_contains(15u));
+
+    seqan3::interleaved_bloom_filter ibf_copied{ibf_mapped_copy};
+    EXPECT_TRUE(ibf == ibf_copied);
+}
+
+TEST(interleaved_bloom_filter_test, mapped_errors)
+{
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "ibf.mapped";
+
+    using mapped_ibf_t = seqan3::interleaved_bloom_filter<seqan3::data_layout::mapped>;
+
+    // The file does not exist.
+    EXPECT_THROW(mapped_ibf_t{filename}, seqan3::file_open_error);
+
+    // The file is too small to contain a header.
+    {
+        std::ofstream stream{filename};
+        stream << "SEQ3_IBF";
+    }
+    EXPECT_THROW(mapped_ibf_t{filename}, seqan3::format_error);
+
+    // The file contains a Bloom Filter.
+    seqan3::bloom_filter bf{seqan3::bin_size{1024u}};
+    bf.save_mapped(filename);
+    EXPECT_THROW(mapped_ibf_t{filename}, seqan3::format_error);
+
+    // The file is truncated.
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{64u}, seqan3::bin_size{1024u}};
+    ibf.save_mapped(filename);
+    std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 8u);
+    EXPECT_THROW(mapped_ibf_t{filename}, seqan3::format_error);
+}
+
+TEST(interleaved_bloom_filter_test, emplace_parallel)
+{
+    // 20 bins use a single word per row and need atomic operations, 1000 bins can be split into groups of 64 bins.
+    for (size_t const bin_count : {20u, 1000u})
+    {
+        std::vector<std::vector<size_t>> values_per_bin(bin_count);
+        for (size_t bin = 0; bin < bin_count; ++bin)
+            for (size_t value = bin; value < bin + 50u; ++value)
+                values_per_bin[bin].push_back(value * 7u);
+
+        seqan3::interleaved_bloom_filter expected{seqan3::bin_count{bin_count}, seqan3::bin_size{2048u}};
+        for (size_t bin = 0; bin < bin_count; ++bin)
+            for (size_t value : values_per_bin[bin])
+                expected.emplace(value, seqan3::bin_index{bin});
+
+        for (size_t const thread_count : {1u, 4u})
+        {
+            seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bin_count}, seqan3::bin_size{2048u}};
+            ibf.emplace_parallel(values_per_bin, thread_count);
+            EXPECT_TRUE(ibf == expected);
+        }
+
+        // A view over the values of each bin.
+        seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bin_count}, seqan3::bin_size{2048u}};
+        ibf.emplace_parallel(std::views::iota(0u, bin_count)
+                                 | std::views::transform(
+                                     [](size_t const bin)
+                                     {
+                                         return std::views::iota(bin, bin + 50u)
+                                              | std::views::transform(
+                                                    [](size_t const value)
+                                                    {
+                                                        return value * 7u;
+                                                    });
+                                     }),
+                             3u);
+        EXPECT_TRUE(ibf == expected);
+    }
+
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{8u}, seqan3::bin_size{1024u}};
+    std::vector<std::vector<size_t>> values_per_bin(9);
+    EXPECT_THROW(ibf.emplace_parallel(values_per_bin, 2u), std::invalid_argument);
+    values_per_bin.resize(8);
+    EXPECT_THROW(ibf.emplace_parallel(values_per_bin, 0u), std::invalid_argument);
+}
+
+TEST(interleaved_bloom_filter_test, emplace_concurrently)
+{
+    size_t const bin_count{130u};
+    seqan3::interleaved_bloom_filter expected{seqan3::bin_count{bin_count}, seqan3::bin_size{1024u}};
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bin_count}, seqan3::bin_size{1024u}};
+
+    for (size_t bin = 0; bin < bin_count; ++bin)
+        for (size_t value = 0; value < 100u; ++value)
+            expected.emplace(value, seqan3::bin_index{bin});
+
+    // Every thread inserts into every bin.
+    std::vector<std::thread> threads{};
+    for (size_t thread_id = 0; thread_id < 4u; ++thread_id)
+    {
+        threads.emplace_back(
+            [&ibf, thread_id, bin_count]()
+            {
+                for (size_t bin = 0; bin < bin_count; ++bin)
+                    for (size_t value = thread_id; value < 100u; value += 4u)
+                        ibf.emplace_concurrently(value, seqan3::bin_index{bin});
+            });
+    }
+
+    for (auto & thread : threads)
+        thread.join();
+
+    EXPECT_TRUE(ibf == expected);
+}
@@ -0,0 +1,191 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <ranges>
+
+#include <seqan3/search/dream_index/updatable_interleaved_bloom_filter.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+// Returns an Interleaved Bloom Filter where bin `i` contains the values [100 * i, 100 * i + 10).
+static seqan3::interleaved_bloom_filter<> make_ibf(size_t const bins)
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bins}, seqan3::bin_size{4096u}};
+
+    for (size_t bin = 0; bin < bins; ++bin)
+        for (size_t value = 100u * bin; value < 100u * bin + 10u; ++value)
+            ibf.emplace(value, seqan3::bin_index{bin});
+
+    return ibf;
+}
+
+// Compares all query results of the updatable Interleaved Bloom Filter with an uncompressed one.
+// Before merging, a value can only be a false positive for a bin if all its bits are set in one of the components.
+// Hence, the updatable Interleaved Bloom Filter reports a subset of the bins of the uncompressed one, including all
+// bins the value was inserted into.
+static void compare_results(seqan3::updatable_interleaved_bloom_filter const & uibf,
+                            seqan3::interleaved_bloom_filter<> const & expected,
+                            bool const merged = false)
+{
+    auto agent = uibf.membership_agent();
+    auto expected_agent = expected.membership_agent();
+
+    for (size_t value = 0; value < 100u * expected.bin_count(); ++value)
+    {
+        auto const & result = agent.bulk_contains(value);
+        auto const & expected_result = expected_agent.bulk_contains(value);
+
+        if (merged)
+        {
+            EXPECT_RANGE_EQ(result, expected_result);
+        }
+        else
+        {
+            for (size_t bin = 0; bin < expected.bin_count(); ++bin)
+                EXPECT_LE(result[bin], expected_result[bin]);
+        }
+    }
+
+    if (merged)
+    {
+        auto counting_agent = uibf.counting_agent();
+        auto expected_counting_agent = expected.counting_agent();
+        auto const values = std::views::iota(0u, 100u * expected.bin_count());
+        EXPECT_RANGE_EQ(counting_agent.bulk_count(values), expected_counting_agent.bulk_count(values));
+    }
+}
+
+// Checks that the values [first, last) are found in bin `value % bins`.
+static void expect_found(seqan3::updatable_interleaved_bloom_filter const & uibf, size_t const first, size_t const last)
+{
+    auto agent = uibf.membership_agent();
+
+    for (size_t value = first; value < last; ++value)
+        EXPECT_TRUE(agent.bulk_contains(value)[value % uibf.bin_count()]) << value;
+}
+
+TEST(updatable_interleaved_bloom_filter_test, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<seqan3::updatable_interleaved_bloom_filter>);
+    EXPECT_TRUE(std::is_copy_constructible_v<seqan3::updatable_interleaved_bloom_filter>);
+    EXPECT_TRUE(std::is_move_constructible_v<seqan3::updatable_interleaved_bloom_filter>);
+    EXPECT_TRUE(std::is_copy_assignable_v<seqan3::updatable_interleaved_bloom_filter>);
+    EXPECT_TRUE(std::is_move_assignable_v<seqan3::updatable_interleaved_bloom_filter>);
+    EXPECT_TRUE(std::is_destructible_v<seqan3::updatable_interleaved_bloom_filter>);
+
+    // A default constructed object does not merge after every insertion.
+    EXPECT_EQ(seqan3::updatable_interleaved_bloom_filter{}.merge_threshold(),
+              seqan3::updatable_interleaved_bloom_filter::default_merge_threshold);
+    EXPECT_GT(seqan3::updatable_interleaved_bloom_filter::default_merge_threshold, 1u);
+
+    auto ibf = make_ibf(70u);
+    seqan3::updatable_interleaved_bloom_filter uibf{ibf};
+    EXPECT_EQ(uibf.merge_threshold(), seqan3::updatable_interleaved_bloom_filter::default_merge_threshold);
+    EXPECT_EQ((seqan3::updatable_interleaved_bloom_filter{ibf, 42u}.merge_threshold()), 42u);
+
+    EXPECT_EQ(uibf.bin_count(), 70u);
+    EXPECT_EQ(uibf.bin_size(), 4096u);
+    EXPECT_EQ(uibf.hash_function_count(), 2u);
+    EXPECT_EQ(uibf.delta_size(), 0u);
+    EXPECT_FALSE(uibf.merge_pending());
+    compare_results(uibf, ibf, true);
+
+    // There is nothing to merge; the bits of the mask beyond the 70 bins are not cleared bins.
+    auto const * const compressed_ibf = &uibf.compressed_ibf();
+    uibf.merge();
+    EXPECT_EQ(&uibf.compressed_ibf(), compressed_ibf);
+}
+
+TEST(updatable_interleaved_bloom_filter_test, emplace_and_clear)
+{
+    auto ibf = make_ibf(70u);
+    seqan3::updatable_interleaved_bloom_filter uibf{seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>{
+        ibf}};
+
+    // Insert into the delta.
+    for (size_t value = 5000u; value < 5010u; ++value)
+    {
+        uibf.emplace(value, seqan3::bin_index{3u});
+        ibf.emplace(value, seqan3::bin_index{3u});
+    }
+    EXPECT_EQ(uibf.delta_size(), 10u);
+    compare_results(uibf, ibf);
+
+    // Clearing a bin masks the base and clears the delta.
+    uibf.clear(seqan3::bin_index{3u});
+    uibf.clear(seqan3::bin_index{65u});
+    ibf.clear(seqan3::bin_index{3u});
+    ibf.clear(seqan3::bin_index{65u});
+    compare_results(uibf, ibf);
+
+    // Values inserted after clearing are found.
+    uibf.emplace(4242u, seqan3::bin_index{65u});
+    ibf.emplace(4242u, seqan3::bin_index{65u});
+    compare_results(uibf, ibf);
+    auto agent = uibf.membership_agent();
+    EXPECT_TRUE(agent.bulk_contains(4242u)[65u]);
+
+    // Merging does not change any results.
+    uibf.merge();
+    EXPECT_EQ(uibf.delta_size(), 0u);
+    EXPECT_FALSE(uibf.merge_pending());
+    compare_results(uibf, ibf, true);
+    EXPECT_TRUE(seqan3::interleaved_bloom_filter<>{uibf.compressed_ibf()} == ibf);
+}
+
+TEST(updatable_interleaved_bloom_filter_test, background_merge)
+{
+    auto ibf = make_ibf(70u);
+    seqan3::updatable_interleaved_bloom_filter uibf{ibf, 25u};
+
+    for (size_t value = 10'000u; value < 10'030u; ++value)
+    {
+        uibf.emplace(value, seqan3::bin_index{value % 70u});
+        ibf.emplace(value, seqan3::bin_index{value % 70u});
+    }
+
+    // The 25th value started a merge, the remaining five values are in the new delta.
+    EXPECT_EQ(uibf.delta_size(), 5u);
+    compare_results(uibf, ibf);
+    expect_found(uibf, 10'000u, 10'030u);
+
+    // Clearing a bin while merging.
+    uibf.clear(seqan3::bin_index{10'001u % 70u});
+    ibf.clear(seqan3::bin_index{10'001u % 70u});
+    compare_results(uibf, ibf);
+
+    uibf.wait_for_merge();
+    EXPECT_FALSE(uibf.merge_pending());
+    compare_results(uibf, ibf);
+
+    uibf.merge();
+    compare_results(uibf, ibf, true);
+    EXPECT_TRUE(seqan3::interleaved_bloom_filter<>{uibf.compressed_ibf()} == ibf);
+}
+
+TEST(updatable_interleaved_bloom_filter_test, increase_bin_number_to)
+{
+    auto ibf = make_ibf(60u);
+    seqan3::updatable_interleaved_bloom_filter uibf{ibf};
+
+    uibf.emplace(7000u, seqan3::bin_index{1u});
+    ibf.emplace(7000u, seqan3::bin_index{1u});
+
+    EXPECT_THROW(uibf.increase_bin_number_to(seqan3::bin_count{50u}), std::invalid_argument);
+
+    uibf.increase_bin_number_to(seqan3::bin_count{80u});
+    ibf.increase_bin_number_to(seqan3::bin_count{80u});
+    EXPECT_EQ(uibf.bin_count(), 80u);
+
+    uibf.emplace(7100u, seqan3::bin_index{71u});
+    ibf.emplace(7100u, seqan3::bin_index{71u});
+    compare_results(uibf, ibf);
+
+    uibf.merge();
+    compare_results(uibf, ibf, true);
+}
@@ -15,3 +15,10 @@ INSTANTIATE_TYPED_TEST_SUITE_P(dna4, fm_index_test, t1, );
 using t2 =
     std::pair<seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::collection>, std::vector<seqan3::dna4_vector>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(dna4_collection, fm_index_collection_test, t2, );
+using t3 = std::pair<seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single, seqan3::sdsl_epr_index_type<2>>,
+                     seqan3::dna4_vector>;
+INSTANTIATE_TYPED_TEST_SUITE_P(dna4_epr, fm_index_test, t3, );
+using t4 =
+    std::pair<seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::collection, seqan3::sdsl_epr_index_type<3>>,
+              std::vector<seqan3::dna4_vector>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(dna4_collection_epr, fm_index_collection_test, t4, );
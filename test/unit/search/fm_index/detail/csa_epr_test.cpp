@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <seqan3/search/fm_index/detail/csa_epr.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+template <typename index_t>
+struct csa_epr_test : public ::testing::Test
+{
+    static constexpr size_t max_char = index_t::dictionary_type::max_char;
+
+    // Random characters in [1, max_char]; the SDSL appends the sentinel.
+    static index_t construct(size_t const size, size_t const sigma = max_char)
+    {
+        std::mt19937_64 engine{size};
+        std::uniform_int_distribution<uint8_t> dist{1u, static_cast<uint8_t>(sigma)};
+        sdsl::int_vector<8> text(size);
+        for (size_t i = 0; i < size; ++i)
+            text[i] = dist(engine);
+
+        index_t index{};
+        sdsl::construct_im(index, text, 0);
+        return index;
+    }
+
+    // Compares the bulk locate of all given intervals to the entry-wise access.
+    static void check(index_t const & index)
+    {
+        std::vector<uint64_t> expected(index.size());
+        for (size_t i = 0; i < index.size(); ++i)
+            expected[i] = index[i];
+
+        // The suffix array is a permutation of the text positions.
+        std::vector<uint64_t> sorted = expected;
+        std::ranges::sort(sorted);
+        for (size_t i = 0; i < sorted.size(); ++i)
+            ASSERT_EQ(sorted[i], i);
+
+        for (size_t lb : {size_t{}, size_t{1u}, index.size() / 3u, index.size() - 1u})
+        {
+            for (size_t length : {0u, 1u, 2u, 17u, 100u, 1000u})
+            {
+                length = std::min(length, index.size() - lb);
+                std::vector<uint64_t> actual(length);
+                index.locate(lb, std::span<uint64_t>{actual});
+                EXPECT_RANGE_EQ(actual, std::span{expected}.subspan(lb, length));
+            }
+        }
+
+        std::vector<uint64_t> actual(index.size());
+        index.locate(0u, std::span<uint64_t>{actual});
+        EXPECT_RANGE_EQ(actual, expected);
+    }
+};
+
+using index_types = ::testing::Types<seqan3::detail::csa_epr<2, 1>,
+                                     seqan3::detail::csa_epr<2, 4>,
+                                     seqan3::detail::csa_epr<2, 64>,
+                                     seqan3::detail::csa_epr<3, 7>,
+                                     seqan3::detail::csa_epr<3, 10'000'000>>;
+TYPED_TEST_SUITE(csa_epr_test, index_types, );
+
+TYPED_TEST(csa_epr_test, locate_random_text)
+{
+    this->check(this->construct(1u));
+    this->check(this->construct(10u));
+    this->check(this->construct(2000u));
+}
+
+TYPED_TEST(csa_epr_test, locate_repetitive_text)
+{
+    // Long runs in the Burrows-Wheeler transform, the intervals stay large during the LF mapping.
+    this->check(this->construct(500u, 1u));
+    this->check(this->construct(2000u, 2u));
+}
@@ -0,0 +1,138 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <seqan3/search/fm_index/detail/epr_dictionary.hpp>
+#include <seqan3/test/cereal.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+template <typename dictionary_t>
+struct epr_dictionary_test : public ::testing::Test
+{
+    static constexpr size_t max_char = dictionary_t::max_char;
+
+    // Random characters in [1, max_char] with a single sentinel at `sentinel_position`.
+    static std::vector<uint8_t> random_text(size_t const size, size_t const sentinel_position)
+    {
+        std::mt19937_64 engine{size};
+        std::uniform_int_distribution<uint8_t> dist{1u, max_char};
+        std::vector<uint8_t> text(size);
+        std::ranges::generate(text,
+                              [&]()
+                              {
+                                  return dist(engine);
+                              });
+        if (sentinel_position < size)
+            text[sentinel_position] = 0u;
+        return text;
+    }
+
+    // Compares all queries to the naive counts.
+    static void check(std::vector<uint8_t> const & text)
+    {
+        dictionary_t const dictionary{text};
+        ASSERT_EQ(dictionary.size(), text.size());
+
+        std::array<uint64_t, max_char + 1u> counts{};
+        for (size_t i = 0; i <= text.size(); ++i)
+        {
+            EXPECT_RANGE_EQ(dictionary.rank_all(i), counts);
+            for (size_t c = 0; c <= max_char + 1u; ++c)
+                EXPECT_EQ(dictionary.rank(i, c), c <= max_char ? counts[c] : 0u);
+
+            if (i == text.size())
+                break;
+
+            EXPECT_EQ(dictionary[i], text[i]);
+            EXPECT_EQ(dictionary.inverse_select(i), (std::pair<uint64_t, uint8_t>{counts[text[i]], text[i]}));
+            ++counts[text[i]];
+        }
+    }
+};
+
+using dictionary_types = ::testing::Types<seqan3::detail::epr_dictionary<2>, seqan3::detail::epr_dictionary<3>>;
+TYPED_TEST_SUITE(epr_dictionary_test, dictionary_types, );
+
+TYPED_TEST(epr_dictionary_test, empty)
+{
+    TypeParam dictionary{std::vector<uint8_t>{}};
+    EXPECT_EQ(dictionary.size(), 0u);
+    EXPECT_EQ(dictionary.rank(0u, 1u), 0u);
+    EXPECT_EQ(dictionary.rank_all(0u)[1], 0u);
+    EXPECT_EQ(TypeParam{}.size(), 0u);
+}
+
+TYPED_TEST(epr_dictionary_test, small)
+{
+    this->check({1, 2, 0, 1});
+    this->check({0});
+    this->check(std::vector<uint8_t>(5u, TestFixture::max_char));
+}
+
+TYPED_TEST(epr_dictionary_test, block_boundaries)
+{
+    for (size_t size : {63u, 64u, 65u, 127u, 128u, 129u, 191u, 192u, 193u, 384u, 385u})
+    {
+        this->check(this->random_text(size, size)); // without sentinel
+        this->check(this->random_text(size, 0u));
+        this->check(this->random_text(size, size / 2u));
+        this->check(this->random_text(size, size - 1u));
+    }
+}
+
+TYPED_TEST(epr_dictionary_test, superblocks)
+{
+    // More than two superblocks of 256 blocks.
+    this->check(this->random_text(120'000u, 70'000u));
+}
+
+TYPED_TEST(epr_dictionary_test, lex_count)
+{
+    std::vector<uint8_t> const text = this->random_text(1000u, 500u);
+    TypeParam const dictionary{text};
+
+    for (size_t i : {0u, 1u, 200u, 499u, 500u, 501u})
+    {
+        for (size_t j : {i, i + 1u, i + 64u, i + 400u})
+        {
+            for (uint8_t c = 0; c <= TestFixture::max_char + 1u; ++c)
+            {
+                uint64_t const rank = std::count(text.begin(), text.begin() + i, c);
+                uint64_t const smaller = std::count_if(text.begin() + i,
+                                                       text.begin() + j,
+                                                       [c](uint8_t const chr)
+                                                       {
+                                                           return chr < c;
+                                                       });
+                uint64_t const greater = std::count_if(text.begin() + i,
+                                                       text.begin() + j,
+                                                       [c](uint8_t const chr)
+                                                       {
+                                                           return chr > c;
+                                                       });
+                EXPECT_EQ(dictionary.lex_count(i, j, c), std::make_tuple(rank, smaller, greater));
+            }
+        }
+    }
+}
+
+TYPED_TEST(epr_dictionary_test, invalid_characters)
+{
+    EXPECT_THROW((TypeParam{std::vector<uint8_t>{1, TestFixture::max_char + 1u}}), std::invalid_argument);
+    EXPECT_THROW((TypeParam{std::vector<uint8_t>{1, 0, 2, 0}}), std::invalid_argument);
+}
+
+TYPED_TEST(epr_dictionary_test, serialisation)
+{
+    TypeParam dictionary{this->random_text(1000u, 10u)};
+    seqan3::test::do_serialisation(dictionary);
+}
@@ -0,0 +1,122 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <seqan3/search/fm_index/detail/suffix_array_construction.hpp>
+
+// The text must end with a unique smallest character, i.e. 0.
+std::vector<uint8_t> random_text(size_t const size, uint8_t const sigma, uint64_t const seed)
+{
+    std::mt19937_64 engine{seed};
+    std::uniform_int_distribution<uint8_t> dist{1u, sigma};
+    std::vector<uint8_t> text(size);
+    std::ranges::generate(text, [&]() { return dist(engine); });
+    text.back() = 0u;
+    return text;
+}
+
+std::vector<size_t> naive_suffix_array(std::vector<uint8_t> const & text)
+{
+    std::vector<size_t> suffix_array(text.size());
+    std::iota(suffix_array.begin(), suffix_array.end(), 0u);
+    std::ranges::sort(suffix_array,
+                      [&text](size_t const lhs, size_t const rhs)
+                      {
+                          return std::lexicographical_compare(text.begin() + lhs,
+                                                              text.end(),
+                                                              text.begin() + rhs,
+                                                              text.end());
+                      });
+    return suffix_array;
+}
+
+std::vector<size_t>
+construct_suffix_array(std::vector<uint8_t> const & text, size_t const threads, size_t const memory_budget)
+{
+    std::vector<size_t> suffix_array{};
+    seqan3::detail::construct_suffix_array(std::span<uint8_t const>{text},
+                                           threads,
+                                           memory_budget,
+                                           [&suffix_array](std::span<size_t const> const block)
+                                           {
+                                               suffix_array.insert(suffix_array.end(), block.begin(), block.end());
+                                           });
+    return suffix_array;
+}
+
+TEST(suffix_array_construction, random_text)
+{
+    for (size_t const size : {1u, 2u, 10u, 1000u, 20000u, 100000u})
+    {
+        std::vector<uint8_t> const text = random_text(size, 4u, size);
+        std::vector<size_t> const expected = naive_suffix_array(text);
+
+        for (size_t const threads : {1u, 3u})
+        {
+            EXPECT_EQ(construct_suffix_array(text, threads, 0u), expected);
+            EXPECT_EQ(construct_suffix_array(text, threads, 1u), expected);
+        }
+    }
+}
+
+TEST(suffix_array_construction, repetitive_text)
+{
+    // Long runs of a single character.
+    std::vector<uint8_t> text(70000, 1u);
+    text.back() = 0u;
+    std::vector<size_t> expected = naive_suffix_array(text);
+
+    for (size_t const threads : {1u, 4u})
+        EXPECT_EQ(construct_suffix_array(text, threads, 0u), expected);
+
+    // Long periodic repeats.
+    for (size_t i = 0; i < text.size(); ++i)
+        text[i] = 1u + (i % 7 == 3) + (i / 1500) % 2;
+    text.back() = 0u;
+    expected = naive_suffix_array(text);
+
+    for (size_t const threads : {1u, 4u})
+        EXPECT_EQ(construct_suffix_array(text, threads, 0u), expected);
+}
+
+TEST(suffix_array_construction, blocks)
+{
+    std::vector<uint8_t> text = random_text(30000, 3u, 0u);
+    std::copy(text.begin() + 5000, text.begin() + 15000, text.begin() + 10000); // Overlapping repeat.
+    std::vector<size_t> const expected = naive_suffix_array(text);
+
+    seqan3::detail::blockwise_suffix_sorter const sorter{std::span<uint8_t const>{text}, 2u};
+
+    for (size_t const block_size : {100u, 1000u, 7000u})
+    {
+        std::vector<size_t> suffix_array{};
+        size_t block_count{};
+        sorter.sort(block_size,
+                    [&](std::span<size_t const> const block)
+                    {
+                        ++block_count;
+                        suffix_array.insert(suffix_array.end(), block.begin(), block.end());
+                    });
+
+        EXPECT_EQ(suffix_array, expected);
+        EXPECT_GT(block_count, 1u);
+    }
+}
+
+TEST(suffix_array_construction, errors)
+{
+    std::vector<uint8_t> const text = random_text(10u, 4u, 0u);
+
+    EXPECT_THROW(construct_suffix_array({}, 1u, 0u), std::invalid_argument);
+    EXPECT_THROW(construct_suffix_array(text, 0u, 0u), std::invalid_argument);
+}
@@ -13,6 +13,7 @@
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/test/cereal.hpp>
+#include <seqan3/test/tmp_directory.hpp>
 
 template <typename T>
 class fm_index_collection_test : public ::testing::Test
@@ -144,4 +145,31 @@ TYPED_TEST_P(fm_index_collection_test, serialisation)
     seqan3::test::do_serialisation(fm);
 }
 
-REGISTER_TYPED_TEST_SUITE_P(fm_index_collection_test, ctr, swap, size, serialisation, empty_text);
+TYPED_TEST_P(fm_index_collection_test, construction_options)
+{
+    using index_t = typename TypeParam::first_type;
+    using text_t = typename TypeParam::second_type;
+    using inner_text_type = std::ranges::range_value_t<text_t>;
+
+    text_t text{inner_text_type(3000), inner_text_type{}, inner_text_type(2000)};
+    for (auto & sequence : text)
+        for (size_t i = 0; i < sequence.size(); ++i)
+            seqan3::assign_rank_to((i * 7 + i / 13) % 4, sequence[i]);
+
+    index_t const expected{text};
+    seqan3::test::tmp_directory tmp{};
+
+    EXPECT_EQ((index_t{text, seqan3::fm_index_construction_options{.threads = 3u}}), expected);
+    EXPECT_EQ((index_t{text, {.threads = 2u, .memory_budget = 1u, .tmp_directory = tmp.path()}}), expected);
+    EXPECT_TRUE(tmp.empty()); // temporary files are removed
+
+    EXPECT_THROW((index_t{text, {.threads = 0u}}), std::invalid_argument);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(fm_index_collection_test,
+                            ctr,
+                            swap,
+                            size,
+                            serialisation,
+                            empty_text,
+                            construction_options);
@@ -16,10 +16,28 @@ using t1 = std::pair<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single>
 INSTANTIATE_TYPED_TEST_SUITE_P(dna4, fm_index_test, t1, );
 using t2 = std::pair<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::collection>, std::vector<seqan3::dna4_vector>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(dna4_collection, fm_index_collection_test, t2, );
+using t3 = std::pair<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, seqan3::sdsl_epr_index_type<2>>,
+                     seqan3::dna4_vector>;
+INSTANTIATE_TYPED_TEST_SUITE_P(dna4_epr, fm_index_test, t3, );
+using t4 = std::pair<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::collection, seqan3::sdsl_epr_index_type<3>>,
+                     std::vector<seqan3::dna4_vector>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(dna4_collection_epr, fm_index_collection_test, t4, );
 
 TEST(fm_index_test, additional_concepts)
 {
     EXPECT_TRUE(seqan3::detail::sdsl_index<seqan3::default_sdsl_index_type>);
+    EXPECT_TRUE(seqan3::detail::sdsl_index<seqan3::sdsl_epr_index_type<2>>);
+    EXPECT_TRUE(seqan3::detail::sdsl_index<seqan3::sdsl_epr_index_type<3>>);
+}
+
+TEST(fm_index_test, epr_invalid_characters)
+{
+    using seqan3::operator""_dna4;
+
+    // The delimiter of the collection does not fit into 2 bits.
+    using index_t = seqan3::fm_index<seqan3::dna4, seqan3::text_layout::collection, seqan3::sdsl_epr_index_type<2>>;
+    std::vector<seqan3::dna4_vector> text{"ACGT"_dna4, "TGCA"_dna4};
+    EXPECT_THROW(index_t{text}, std::invalid_argument);
 }
 
 TEST(fm_index_test, cerealisation_errors)
@@ -12,6 +12,7 @@
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/test/cereal.hpp>
+#include <seqan3/test/tmp_directory.hpp>
 
 template <typename T>
 class fm_index_test : public ::testing::Test
@@ -107,4 +108,25 @@ TYPED_TEST_P(fm_index_test, serialisation)
     seqan3::test::do_serialisation(fm);
 }
 
-REGISTER_TYPED_TEST_SUITE_P(fm_index_test, ctr, swap, size, empty_text, serialisation);
+TYPED_TEST_P(fm_index_test, construction_options)
+{
+    using index_t = typename TypeParam::first_type;
+    using text_t = typename TypeParam::second_type;
+
+    text_t text(5000);
+    for (size_t i = 0; i < text.size(); ++i)
+        seqan3::assign_rank_to((i * 7 + i / 13) % 4, text[i]);
+
+    index_t const expected{text};
+    seqan3::test::tmp_directory tmp{};
+
+    EXPECT_EQ((index_t{text, seqan3::fm_index_construction_options{.threads = 3u}}), expected);
+    EXPECT_EQ((index_t{text, {.threads = 2u, .memory_budget = 1u, .tmp_directory = tmp.path()}}), expected);
+    EXPECT_TRUE(tmp.empty()); // temporary files are removed
+
+    EXPECT_THROW((index_t{text, {.threads = 0u}}), std::invalid_argument);
+    EXPECT_THROW((index_t{text, {.memory_budget = 1u, .tmp_directory = tmp.path() / "missing"}}),
+                 std::invalid_argument);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(fm_index_test, ctr, swap, size, empty_text, serialisation, construction_options);
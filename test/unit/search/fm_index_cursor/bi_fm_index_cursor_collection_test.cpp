@@ -53,3 +53,7 @@ INSTANTIATE_TYPED_TEST_SUITE_P(dna4, bi_fm_index_cursor_collection_test, it_t1,
 
 using it_t2 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna5, seqan3::text_layout::collection>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(dna5, bi_fm_index_cursor_collection_test, it_t2, );
+
+using it_t3 = seqan3::bi_fm_index_cursor<
+    seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::collection, seqan3::sdsl_epr_index_type<3>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(dna4_epr, bi_fm_index_cursor_collection_test, it_t3, );
@@ -61,3 +61,15 @@ INSTANTIATE_TYPED_TEST_SUITE_P(dna5_default_traits, fm_index_cursor_test, it_t5,
 // char
 using it_t6 = seqan3::fm_index_cursor<seqan3::fm_index<char, seqan3::text_layout::single>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(char_default_traits, fm_index_cursor_test, it_t6, );
+
+using it_t7 = seqan3::fm_index_cursor<
+    seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, seqan3::sdsl_epr_index_type<2>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(epr_traits, fm_index_cursor_test, it_t7, );
+
+using it_t8 = seqan3::bi_fm_index_cursor<
+    seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single, seqan3::sdsl_epr_index_type<2>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(bi_epr_traits, fm_index_cursor_test, it_t8, );
+
+using it_t9 = seqan3::fm_index_cursor<
+    seqan3::fm_index<seqan3::dna5, seqan3::text_layout::single, seqan3::sdsl_epr_index_type<3>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(dna5_epr_traits, fm_index_cursor_test, it_t9, );
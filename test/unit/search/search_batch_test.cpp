@@ -0,0 +1,257 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <type_traits>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/configuration/batch.hpp>
+#include <seqan3/search/configuration/hit.hpp>
+#include <seqan3/search/configuration/max_error.hpp>
+#include <seqan3/search/configuration/on_result.hpp>
+#include <seqan3/search/configuration/output.hpp>
+#include <seqan3/search/configuration/parallel.hpp>
+#include <seqan3/search/fm_index/bi_fm_index.hpp>
+#include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/search/search.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/utility/range/to.hpp>
+
+// The batched search explores the same search tree as the unidirectional backtracking. Hence, the results are
+// compared to the default search in an seqan3::fm_index over the same text.
+template <typename index_t>
+class search_batch_test : public ::testing::Test
+{
+public:
+    static constexpr bool is_collection = index_t::text_layout_mode == seqan3::text_layout::collection;
+
+    using text_t = std::conditional_t<is_collection, std::vector<seqan3::dna4_vector>, seqan3::dna4_vector>;
+    using reference_index_t = seqan3::fm_index<seqan3::dna4, index_t::text_layout_mode>;
+
+    static std::vector<seqan3::dna4_vector> generate_texts()
+    {
+        std::mt19937_64 engine{42u};
+        std::uniform_int_distribution<uint8_t> rank_dist{0u, 3u};
+
+        std::vector<seqan3::dna4_vector> texts(3);
+        for (auto & text : texts)
+        {
+            text.resize(500);
+            for (auto & symbol : text)
+                symbol.assign_rank(rank_dist(engine));
+        }
+        return texts;
+    }
+
+    static text_t generate_text()
+    {
+        auto texts = generate_texts();
+
+        if constexpr (is_collection)
+            return texts;
+        else
+            return texts.front();
+    }
+
+    // Queries are sampled from the text, some of them with errors, and some random queries that might not occur.
+    static std::vector<seqan3::dna4_vector> generate_queries()
+    {
+        std::mt19937_64 engine{7u};
+        std::uniform_int_distribution<uint8_t> rank_dist{0u, 3u};
+        std::uniform_int_distribution<size_t> length_dist{8u, 16u};
+        std::uniform_int_distribution<size_t> position_dist{0u, 480u};
+
+        auto texts = generate_texts();
+        std::vector<seqan3::dna4_vector> queries{};
+
+        for (size_t i = 0; i < 100; ++i)
+        {
+            auto const & text = texts[i % (is_collection ? texts.size() : 1u)];
+            size_t const position = position_dist(engine);
+            seqan3::dna4_vector query(text.begin() + position, text.begin() + position + length_dist(engine));
+
+            if (i % 3 == 1) // substitution
+                query[query.size() / 2].assign_rank(rank_dist(engine));
+            else if (i % 3 == 2) // deletion
+                query.erase(query.begin() + query.size() / 2);
+
+            if (i % 10 == 9) // random query
+                for (auto & symbol : query)
+                    symbol.assign_rank(rank_dist(engine));
+
+            queries.push_back(std::move(query));
+        }
+        queries.emplace_back(); // empty query
+
+        return queries;
+    }
+
+    template <typename configuration_t>
+    void expect_same_results(configuration_t const & config)
+    {
+        seqan3::configuration const cfg{config};
+        std::vector expected = seqan3::search(queries, reference_index, cfg) | seqan3::ranges::to<std::vector>();
+
+        for (size_t batch_size : {1u, 3u, 64u, 1000u})
+        {
+            auto batch_cfg = cfg | seqan3::search_cfg::batch{batch_size};
+            std::vector actual = seqan3::search(queries, index, batch_cfg) | seqan3::ranges::to<std::vector>();
+            EXPECT_RANGE_EQ(actual, expected);
+        }
+    }
+
+    text_t text{generate_text()};
+    std::vector<seqan3::dna4_vector> queries{generate_queries()};
+    index_t index{text};
+    reference_index_t reference_index{text};
+};
+
+using index_types = ::testing::Types<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single>,
+                                     seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single>,
+                                     seqan3::fm_index<seqan3::dna4, seqan3::text_layout::collection>,
+                                     seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::collection>,
+                                     seqan3::bi_fm_index<seqan3::dna4,
+                                                         seqan3::text_layout::single,
+                                                         seqan3::sdsl_epr_index_type<2>>,
+                                     seqan3::fm_index<seqan3::dna4,
+                                                      seqan3::text_layout::collection,
+                                                      seqan3::sdsl_epr_index_type<3>>>;
+
+TYPED_TEST_SUITE(search_batch_test, index_types, );
+
+TYPED_TEST(search_batch_test, error_free)
+{
+    this->expect_same_results(seqan3::search_cfg::hit_all{});
+    this->expect_same_results(seqan3::search_cfg::hit_all_best{});
+    this->expect_same_results(seqan3::search_cfg::hit_strata{0});
+}
+
+TYPED_TEST(search_batch_test, hit_all)
+{
+    this->expect_same_results(seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}}
+                              | seqan3::search_cfg::hit_all{});
+    this->expect_same_results(seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{2}}
+                              | seqan3::search_cfg::max_error_substitution{seqan3::search_cfg::error_count{1}}
+                              | seqan3::search_cfg::max_error_deletion{seqan3::search_cfg::error_count{1}}
+                              | seqan3::search_cfg::hit_all{});
+    this->expect_same_results(seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}}
+                              | seqan3::search_cfg::max_error_insertion{seqan3::search_cfg::error_count{1}}
+                              | seqan3::search_cfg::hit_all{});
+}
+
+TYPED_TEST(search_batch_test, hit_all_best)
+{
+    this->expect_same_results(seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{2}}
+                              | seqan3::search_cfg::hit_all_best{});
+}
+
+TYPED_TEST(search_batch_test, hit_strata)
+{
+    this->expect_same_results(seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{2}}
+                              | seqan3::search_cfg::hit_strata{1});
+}
+
+TYPED_TEST(search_batch_test, hit_dynamic)
+{
+    seqan3::search_cfg::hit dynamic_hit{seqan3::search_cfg::hit_all_best{}};
+    this->expect_same_results(seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}} | dynamic_hit);
+}
+
+TYPED_TEST(search_batch_test, hit_single_best)
+{
+    // The breadth-first search may report a different hit, but it must be one of the best hits.
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{2}}
+                                    | seqan3::search_cfg::hit_single_best{};
+    auto all_best_cfg = cfg.template remove<seqan3::search_cfg::hit_single_best>() | seqan3::search_cfg::hit_all_best{};
+
+    std::vector expected = seqan3::search(this->queries, this->reference_index, all_best_cfg)
+                         | seqan3::ranges::to<std::vector>();
+    std::vector actual = seqan3::search(this->queries, this->index, cfg | seqan3::search_cfg::batch{10})
+                       | seqan3::ranges::to<std::vector>();
+    std::vector reference = seqan3::search(this->queries, this->reference_index, cfg)
+                          | seqan3::ranges::to<std::vector>();
+
+    ASSERT_EQ(actual.size(), reference.size());
+    for (auto const & result : actual)
+        EXPECT_NE(std::ranges::find(expected, result), expected.end());
+}
+
+TYPED_TEST(search_batch_test, output_index_cursor)
+{
+    // Only the number of cursors is compared since the cursors are reported in a different order.
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}}
+                                    | seqan3::search_cfg::output_query_id{}
+                                    | seqan3::search_cfg::output_index_cursor{};
+
+    std::vector<size_t> expected(this->queries.size());
+    for (auto && result : seqan3::search(this->queries, this->reference_index, cfg))
+        ++expected[result.query_id()];
+
+    std::vector<size_t> actual(this->queries.size());
+    for (auto && result : seqan3::search(this->queries, this->index, cfg | seqan3::search_cfg::batch{7}))
+        ++actual[result.query_id()];
+
+    EXPECT_RANGE_EQ(actual, expected);
+}
+
+TYPED_TEST(search_batch_test, on_result)
+{
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}};
+    std::vector expected = seqan3::search(this->queries, this->reference_index, cfg)
+                         | seqan3::ranges::to<std::vector>();
+
+    using result_t = std::ranges::range_value_t<decltype(expected)>;
+    std::vector<result_t> actual{};
+    seqan3::search(this->queries,
+                   this->index,
+                   cfg | seqan3::search_cfg::batch{16}
+                       | seqan3::search_cfg::on_result{[&actual](auto && result)
+                                                       {
+                                                           actual.push_back(result);
+                                                       }});
+
+    EXPECT_RANGE_EQ(actual, expected);
+}
+
+TYPED_TEST(search_batch_test, parallel)
+{
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}};
+    std::vector expected = seqan3::search(this->queries, this->reference_index, cfg)
+                         | seqan3::ranges::to<std::vector>();
+
+    auto parallel_cfg = cfg | seqan3::search_cfg::batch{8} | seqan3::search_cfg::parallel{4};
+    std::vector actual = seqan3::search(this->queries, this->index, parallel_cfg) | seqan3::ranges::to<std::vector>();
+
+    // The parallel search reports the results of a batch in order, but the batches in arbitrary order.
+    auto by_query_id = [](auto const & lhs, auto const & rhs)
+    {
+        return lhs.query_id() < rhs.query_id();
+    };
+    std::ranges::stable_sort(actual, by_query_id);
+
+    EXPECT_RANGE_EQ(actual, expected);
+}
+
+TYPED_TEST(search_batch_test, single_query)
+{
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}};
+    auto const & query = this->queries.front();
+
+    std::vector expected = seqan3::search(query, this->reference_index, cfg) | seqan3::ranges::to<std::vector>();
+    std::vector actual = seqan3::search(query, this->index, cfg | seqan3::search_cfg::batch{})
+                       | seqan3::ranges::to<std::vector>();
+
+    EXPECT_RANGE_EQ(actual, expected);
+}
+
+TYPED_TEST(search_batch_test, invalid_batch_size)
+{
+    seqan3::configuration const cfg = seqan3::search_cfg::batch{0};
+    EXPECT_THROW(seqan3::search(this->queries, this->index, cfg), std::invalid_argument);
+}
@@ -19,6 +19,7 @@
 #include <seqan3/search/fm_index/fm_index.hpp>
 #include <seqan3/search/search.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/utility/parallel/thread_pool.hpp>
 
 #include "helper.hpp"
 
@@ -65,8 +66,12 @@ public:
     index_t index{text};
 };
 
-using fm_index_types = ::testing::Types<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::collection>,
-                                        seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::collection>>;
+using epr_index_t = seqan3::sdsl_epr_index_type<3>;
+using fm_index_types =
+    ::testing::Types<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::collection>,
+                     seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::collection>,
+                     seqan3::fm_index<seqan3::dna4, seqan3::text_layout::collection, epr_index_t>,
+                     seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::collection, epr_index_t>>;
 using fm_index_string_types = ::testing::Types<seqan3::fm_index<char, seqan3::text_layout::collection>,
                                                seqan3::bi_fm_index<char, seqan3::text_layout::collection>>;
 
@@ -208,6 +213,20 @@ TYPED_TEST(search_test, parallel_queries)
     EXPECT_RANGE_EQ(search(queries, this->index, cfg) | query_id, expected_query_ids);
 }
 
+TYPED_TEST(search_test, executor_queries)
+{
+    std::vector<std::vector<seqan3::dna4>> const queries{10u, {"ACGTACGTACGT"_dna4}};
+    seqan3::thread_pool pool{std::min<uint32_t>(2, std::thread::hardware_concurrency())};
+
+    seqan3::configuration const sequential_cfg =
+        seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}};
+    seqan3::configuration const cfg = sequential_cfg | seqan3::search_cfg::executor{pool};
+
+    // The pool is reused by both calls.
+    EXPECT_RANGE_EQ(search(queries, this->index, cfg), search(queries, this->index, sequential_cfg));
+    EXPECT_RANGE_EQ(search(queries, this->index, cfg), search(queries, this->index, sequential_cfg));
+}
+
 TYPED_TEST(search_test, parallel_without_parameter)
 {
     seqan3::configuration cfg = seqan3::search_cfg::parallel{};
@@ -215,6 +234,13 @@ TYPED_TEST(search_test, parallel_without_parameter)
     EXPECT_THROW(search("AAAA"_dna4, this->index, cfg), std::runtime_error);
 }
 
+TYPED_TEST(search_test, executor_without_pool)
+{
+    seqan3::configuration cfg = seqan3::search_cfg::executor{};
+
+    EXPECT_THROW(search("AAAA"_dna4, this->index, cfg), std::runtime_error);
+}
+
 TYPED_TEST(search_test, debug_streaming)
 {
     std::ostringstream oss;
@@ -21,6 +21,7 @@
 #include <seqan3/search/detail/unidirectional_search_algorithm.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/parallel/detail/work_stealing_scheduler.hpp>
 #include <seqan3/utility/range/to.hpp>
 #include <seqan3/utility/views/slice.hpp>
 
@@ -355,3 +356,65 @@ TEST(search_scheme_test, search_scheme_edit)
     test_search_scheme_edit(seqan3::detail::optimum_search_scheme<0, 2>, seed, 10);
     test_search_scheme_edit(seqan3::detail::optimum_search_scheme<0, 3>, seed, 10);
 }
+
+template <typename search_scheme_t>
+inline void test_search_scheme_task_splitting(search_scheme_t const & search_scheme, size_t const seed)
+{
+    seqan3::dna4_vector const text = seqan3::test::generate_sequence<seqan3::dna4>(5000, 0 /*variance*/, seed);
+    seqan3::bi_fm_index index{text};
+    using cursor_t = typename decltype(index)::cursor_type;
+
+    seqan3::detail::work_stealing_scheduler scheduler{4};
+
+    for (uint64_t query_length = 10; query_length < 30; query_length += 3)
+    {
+        seqan3::dna4_vector query = text | seqan3::views::slice(query_length, 2 * query_length)
+                                  | seqan3::ranges::to<seqan3::dna4_vector>();
+        seqan3::assign_rank_to((seqan3::to_rank(query[query_length / 2]) + 1) % 4, query[query_length / 2]);
+
+        for (seqan3::detail::search_param const error_left : {seqan3::detail::search_param{3, 3, 0, 0},
+                                                              seqan3::detail::search_param{3, 1, 1, 1},
+                                                              seqan3::detail::search_param{2, 2, 2, 2}})
+        {
+            std::vector<cursor_t> hits_sequential{};
+            seqan3::detail::search_ss<false>(index,
+                                             query,
+                                             error_left,
+                                             search_scheme,
+                                             [&hits_sequential](cursor_t const & cursor)
+                                             {
+                                                 hits_sequential.push_back(cursor);
+                                             });
+
+            // The search runs on a thread of the scheduler and is split into tasks.
+            std::vector<cursor_t> hits_parallel{};
+            seqan3::detail::task_group tasks{scheduler};
+            tasks.run(
+                [&]()
+                {
+                    EXPECT_EQ(seqan3::detail::work_stealing_scheduler::current(), &scheduler);
+                    seqan3::detail::search_ss<false>(index,
+                                                     query,
+                                                     error_left,
+                                                     search_scheme,
+                                                     [&hits_parallel](cursor_t const & cursor)
+                                                     {
+                                                         hits_parallel.push_back(cursor);
+                                                     });
+                });
+            tasks.wait();
+
+            // The hits are reported in the same order.
+            EXPECT_FALSE(hits_sequential.empty());
+            EXPECT_TRUE(hits_parallel == hits_sequential);
+        }
+    }
+}
+
+TEST(search_scheme_test, task_splitting)
+{
+    size_t seed = 42;
+
+    test_search_scheme_task_splitting(seqan3::detail::optimum_search_scheme<0, 3>, seed);
+    test_search_scheme_task_splitting(seqan3::detail::compute_ss(0, 3), seed);
+}
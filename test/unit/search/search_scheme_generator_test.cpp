@@ -0,0 +1,394 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/detail/search_scheme_algorithm.hpp>
+#include <seqan3/search/fm_index/bi_fm_index.hpp>
+#include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/search/search.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+
+#include "helper_search_scheme.hpp"
+
+// Converts a precomputed search scheme.
+template <typename search_scheme_t>
+seqan3::detail::search_scheme_dyn_type to_dyn(search_scheme_t const & search_scheme)
+{
+    seqan3::detail::search_scheme_dyn_type result{};
+    for (auto const & search : search_scheme)
+        result.push_back({{search.pi.begin(), search.pi.end()},
+                          {search.l.begin(), search.l.end()},
+                          {search.u.begin(), search.u.end()}});
+    return result;
+}
+
+// The cost of a search scheme with blocks of the same length.
+double cost(seqan3::detail::search_scheme_dyn_type const & search_scheme,
+            size_t const query_length = 100u,
+            seqan3::detail::search_scheme_cost_model const & cost_model = {})
+{
+    std::vector<size_t> const blocks_length =
+        seqan3::detail::search_scheme_blocks_length(search_scheme.front().blocks(), query_length, {});
+    return seqan3::detail::search_scheme_cost(search_scheme, blocks_length, cost_model);
+}
+
+TEST(search_scheme_generator_test, error_distribution_coverage)
+{
+    // Every error distribution is covered exactly once.
+    for (uint8_t max_error = 0; max_error <= 6; ++max_error)
+    {
+        for (uint8_t min_error : {uint8_t{0}, uint8_t{1}, max_error})
+        {
+            if (min_error > max_error)
+                continue;
+
+            seqan3::detail::search_scheme_generator_options options{};
+            options.improvement_limit = max_error == 6 ? 0u : options.improvement_limit;
+            seqan3::detail::weighted_search_scheme const search_scheme =
+                seqan3::detail::generate_search_scheme(min_error, max_error, options);
+            EXPECT_TRUE(search_scheme.block_weights.empty());
+
+            std::vector<std::vector<uint8_t>> expected{};
+            std::vector<std::vector<uint8_t>> actual{};
+            seqan3::search_scheme_error_distribution(actual, search_scheme.searches);
+            seqan3::search_scheme_error_distribution(
+                expected,
+                seqan3::trivial_search_scheme(min_error, max_error, search_scheme.searches.front().blocks()));
+            std::ranges::sort(expected);
+            std::ranges::sort(actual);
+            EXPECT_EQ(actual, expected) << "min_error: " << +min_error << ", max_error: " << +max_error;
+        }
+    }
+}
+
+TEST(search_scheme_generator_test, optimum_search_schemes)
+{
+    // The generated search schemes are as fast as the optimum search schemes according to the cost model.
+    EXPECT_LE(cost(seqan3::detail::compute_ss(0, 0)), cost(to_dyn(seqan3::detail::optimum_search_scheme<0, 0>)));
+    EXPECT_LE(cost(seqan3::detail::compute_ss(0, 1)), cost(to_dyn(seqan3::detail::optimum_search_scheme<0, 1>)));
+    EXPECT_LE(cost(seqan3::detail::compute_ss(0, 2)), cost(to_dyn(seqan3::detail::optimum_search_scheme<0, 2>)));
+    EXPECT_LE(cost(seqan3::detail::compute_ss(0, 3)), cost(to_dyn(seqan3::detail::optimum_search_scheme<0, 3>)));
+
+    // Much faster than trivial backtracking.
+    seqan3::detail::search_scheme_dyn_type const trivial{{{1}, {0}, {4}}};
+    EXPECT_LT(cost(seqan3::detail::compute_ss(0, 4)) * 100, cost(trivial));
+}
+
+TEST(search_scheme_generator_test, precomputed_search_schemes)
+{
+    // The precomputed search schemes are the generated ones.
+    EXPECT_EQ(cost(to_dyn(seqan3::detail::precomputed_search_scheme<0, 4>)), cost(seqan3::detail::compute_ss(0, 4)));
+    EXPECT_EQ(cost(to_dyn(seqan3::detail::precomputed_search_scheme<0, 5>)), cost(seqan3::detail::compute_ss(0, 5)));
+
+    for (auto const & search_scheme : {to_dyn(seqan3::detail::precomputed_search_scheme<0, 4>),
+                                       to_dyn(seqan3::detail::precomputed_search_scheme<0, 5>)})
+    {
+        uint8_t const max_error = search_scheme.front().u.back();
+        std::vector<std::vector<uint8_t>> expected{};
+        std::vector<std::vector<uint8_t>> actual{};
+        seqan3::search_scheme_error_distribution(actual, search_scheme);
+        seqan3::search_scheme_error_distribution(
+            expected,
+            seqan3::trivial_search_scheme(0, max_error, search_scheme.front().blocks()));
+        std::ranges::sort(expected);
+        std::ranges::sort(actual);
+        EXPECT_EQ(actual, expected) << "max_error: " << +max_error;
+    }
+}
+
+TEST(search_scheme_generator_test, sorted_searches)
+{
+    seqan3::detail::search_scheme_dyn_type const search_scheme = seqan3::detail::compute_ss(0, 4);
+    EXPECT_TRUE(std::ranges::is_sorted(search_scheme,
+                                       [](auto const & lhs, auto const & rhs)
+                                       {
+                                           return lhs.u < rhs.u;
+                                       }));
+}
+
+TEST(search_scheme_generator_test, invalid_errors)
+{
+    EXPECT_THROW(seqan3::detail::generate_search_scheme(2, 1), std::invalid_argument);
+    EXPECT_THROW(seqan3::detail::generate_search_scheme(0, 254), std::invalid_argument);
+
+    // The error distributions are not enumerated if there are too many.
+    EXPECT_THROW(seqan3::detail::generate_search_scheme(0, 14), std::invalid_argument);
+    EXPECT_THROW(seqan3::detail::generate_search_scheme(0, 253), std::invalid_argument);
+
+    seqan3::detail::search_scheme_generator_options options{};
+    options.improvement_limit = 0u;
+    options.distribution_limit = 1000u;
+    EXPECT_NO_THROW(seqan3::detail::generate_search_scheme(0, 5, options));
+    EXPECT_THROW(seqan3::detail::generate_search_scheme(0, 6, options), std::invalid_argument);
+}
+
+TEST(search_scheme_generator_test, many_errors)
+{
+    // A search with many errors does not generate a search scheme, which would take very long, but backtracks.
+    std::vector<seqan3::dna4> const text = seqan3::test::generate_sequence<seqan3::dna4>(200, 0, 42);
+    seqan3::bi_fm_index const index{text};
+    std::vector<seqan3::dna4> const query{text.begin() + 50, text.begin() + 70};
+
+    seqan3::configuration const config =
+        seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{12}}
+        | seqan3::search_cfg::max_error_substitution{seqan3::search_cfg::error_count{12}}
+        | seqan3::search_cfg::max_error_insertion{seqan3::search_cfg::error_count{0}}
+        | seqan3::search_cfg::max_error_deletion{seqan3::search_cfg::error_count{0}};
+
+    auto const start = std::chrono::steady_clock::now();
+    std::vector<size_t> positions{};
+    for (auto && result : seqan3::search(query, index, config))
+        positions.push_back(result.reference_begin_position());
+    std::chrono::duration<double> const duration = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(std::ranges::find(positions, 50u) != positions.end());
+    EXPECT_LT(duration.count(), 5.0);
+}
+
+TEST(search_scheme_generator_test, blocks_length)
+{
+    using seqan3::detail::search_scheme_blocks_length;
+
+    // Same length, the first blocks are longer.
+    EXPECT_EQ(search_scheme_blocks_length(3, 10, {}), (std::vector<size_t>{4, 3, 3}));
+    EXPECT_EQ(search_scheme_blocks_length(4, 2, {}), (std::vector<size_t>{1, 1, 0, 0}));
+    // Weighted.
+    EXPECT_EQ(search_scheme_blocks_length(3, 10, {1, 2, 2}), (std::vector<size_t>{2, 4, 4}));
+    EXPECT_EQ(search_scheme_blocks_length(3, 100, {5, 20, 25}), (std::vector<size_t>{10, 40, 50}));
+    EXPECT_EQ(search_scheme_blocks_length(2, 3, {1, 1}), (std::vector<size_t>{1, 2}));
+    // Invalid weights are ignored.
+    EXPECT_EQ(search_scheme_blocks_length(3, 10, {1, 2}), (std::vector<size_t>{4, 3, 3}));
+    EXPECT_EQ(search_scheme_blocks_length(3, 10, {0, 0, 0}), (std::vector<size_t>{4, 3, 3}));
+
+    // The block info uses the weights.
+    auto const block_info = seqan3::detail::search_scheme_block_info(seqan3::detail::optimum_search_scheme<0, 1>,
+                                                                     10,
+                                                                     std::vector<size_t>{1, 4});
+    EXPECT_EQ(std::get<0>(block_info[0]), (std::array<size_t, 2>{2, 10}));
+    EXPECT_EQ(std::get<1>(block_info[0]), 0u);
+    EXPECT_EQ(std::get<0>(block_info[1]), (std::array<size_t, 2>{8, 10}));
+    EXPECT_EQ(std::get<1>(block_info[1]), 2u);
+}
+
+TEST(search_scheme_generator_test, optimise_block_lengths)
+{
+    seqan3::detail::search_scheme_generator_options options{};
+    options.query_length = 50u;
+    options.optimise_block_lengths = true;
+
+    for (uint8_t max_error : {2, 4})
+    {
+        seqan3::detail::weighted_search_scheme const search_scheme =
+            seqan3::detail::generate_search_scheme(0, max_error, options);
+        ASSERT_EQ(search_scheme.block_weights.size(), search_scheme.searches.front().blocks());
+        EXPECT_EQ(std::accumulate(search_scheme.block_weights.begin(), search_scheme.block_weights.end(), size_t{}),
+                  50u);
+        EXPECT_LE(seqan3::detail::search_scheme_cost(search_scheme.searches, search_scheme.block_weights, {}),
+                  cost(search_scheme.searches, 50u));
+    }
+}
+
+TEST(search_scheme_generator_test, cost_model)
+{
+    seqan3::detail::search_scheme_cost_model const random_model{4u, 1'000'000u};
+    EXPECT_EQ(random_model.alphabet_size(), 4u);
+    EXPECT_DOUBLE_EQ(random_model.occurrence_probability(0), 1.0);
+    EXPECT_NEAR(random_model.occurrence_probability(5), 1.0, 1e-6);
+    EXPECT_NEAR(random_model.occurrence_probability(20), 1e6 / std::pow(4.0, 20), 1e-9);
+    EXPECT_THROW((seqan3::detail::search_scheme_cost_model{1u, 10u}), std::invalid_argument);
+
+    // Counts the distinct substrings of a random text up to depth 5 (4^5 <= 2000).
+    std::vector<seqan3::dna4> const text = seqan3::test::generate_sequence<seqan3::dna4>(100'000, 0, 0);
+    seqan3::detail::search_scheme_cost_model const index_model{seqan3::fm_index{text}, 2000u};
+    seqan3::detail::search_scheme_cost_model const uniform_model{4u, text.size() + 1};
+    for (size_t depth = 0; depth < 12; ++depth)
+        EXPECT_NEAR(index_model.occurrence_probability(depth), uniform_model.occurrence_probability(depth), 0.01);
+    EXPECT_LT(index_model.occurrence_probability(100), 1e-50);
+    EXPECT_EQ(index_model.occurrence_probability(1000), 0.0);
+
+    // A repetitive text has few distinct substrings.
+    std::vector<seqan3::dna4> repetitive_text{};
+    for (size_t i = 0; i < 10'000; ++i)
+        repetitive_text.insert(repetitive_text.end(), text.begin(), text.begin() + 10);
+    seqan3::detail::search_scheme_cost_model const repetitive_model{seqan3::bi_fm_index{repetitive_text}};
+    EXPECT_LT(repetitive_model.occurrence_probability(5), 0.02);
+    EXPECT_LT(repetitive_model.occurrence_probability(30), 1e-15);
+    EXPECT_NE(repetitive_model.description(), index_model.description());
+}
+
+TEST(search_scheme_generator_test, read_write)
+{
+    seqan3::detail::search_scheme_generator_options options{};
+    options.optimise_block_lengths = true;
+    seqan3::detail::weighted_search_scheme const expected = seqan3::detail::generate_search_scheme(1, 3, options);
+
+    std::stringstream stream{};
+    seqan3::detail::write_search_scheme(stream, expected);
+    seqan3::detail::weighted_search_scheme const actual = seqan3::detail::read_search_scheme(stream);
+
+    EXPECT_EQ(actual.block_weights, expected.block_weights);
+    ASSERT_EQ(actual.searches.size(), expected.searches.size());
+    for (size_t i = 0; i < actual.searches.size(); ++i)
+    {
+        EXPECT_EQ(actual.searches[i].pi, expected.searches[i].pi);
+        EXPECT_EQ(actual.searches[i].l, expected.searches[i].l);
+        EXPECT_EQ(actual.searches[i].u, expected.searches[i].u);
+    }
+
+    auto read = [](std::string const & input)
+    {
+        std::istringstream stream{input};
+        return seqan3::detail::read_search_scheme(stream);
+    };
+
+    EXPECT_NO_THROW(read("searches 2 blocks 2\nblock_weights 0\n1 2\n0 0\n0 1\n2 1\n0 1\n0 1\n"));
+    EXPECT_THROW(read(""), std::runtime_error);
+    EXPECT_THROW(read("searches 0 blocks 2\nblock_weights 0\n"), std::runtime_error);
+    EXPECT_THROW(read("searches 1 blocks 2\nblock_weights 1 5\n1 2\n0 0\n0 1\n"), std::runtime_error);
+    EXPECT_THROW(read("searches 1 blocks 2\nblock_weights 0\n1 2\n0 0\n"), std::runtime_error);     // truncated
+    EXPECT_THROW(read("searches 1 blocks 2\nblock_weights 0\n1 3\n0 0\n0 1\n"), std::runtime_error); // invalid block
+    EXPECT_THROW(read("searches 1 blocks 3\nblock_weights 0\n1 3 2\n0 0 0\n0 1 1\n"), std::runtime_error); // gap
+    EXPECT_THROW(read("searches 1 blocks 2\nblock_weights 0\n1 2\n0 2\n0 1\n"), std::runtime_error); // l > u
+    EXPECT_THROW(read("searches 1 blocks 2\nblock_weights 0\n1 2\n0 0\n1 0\n"), std::runtime_error); // decreasing
+    EXPECT_THROW(read("searches 1 blocks 2\nblock_weights 0\n1 2\n0 0\n0 256\n"), std::runtime_error);
+}
+
+TEST(search_scheme_generator_test, cache)
+{
+    seqan3::test::tmp_directory tmp{};
+    seqan3::detail::search_scheme_cache const cache{tmp.path() / "search_schemes"};
+
+    seqan3::detail::search_scheme_generator_options options{};
+    options.query_length = 30u;
+    options.optimise_block_lengths = true;
+
+    std::filesystem::path const file = cache.path(0, 4, options);
+    EXPECT_NE(file, cache.path(0, 4));
+    EXPECT_NE(file, cache.path(1, 4, options));
+    EXPECT_FALSE(std::filesystem::exists(file));
+
+    seqan3::detail::weighted_search_scheme const generated = cache.get(0, 4, options);
+    EXPECT_TRUE(std::filesystem::exists(file));
+    EXPECT_EQ(std::ranges::distance(std::filesystem::directory_iterator{tmp.path() / "search_schemes"}), 1);
+
+    // The second call reads the file.
+    {
+        std::ofstream stream{file, std::ios::app};
+        stream << "additional content is ignored\n";
+    }
+    seqan3::detail::weighted_search_scheme const cached = cache.get(0, 4, options);
+    EXPECT_EQ(cached.block_weights, generated.block_weights);
+    EXPECT_EQ(cached.searches.size(), generated.searches.size());
+
+    // A corrupted file is replaced.
+    {
+        std::ifstream stream{file};
+        std::string header{};
+        std::getline(stream, header);
+        std::ofstream{file} << header << "\nsearches 1 blocks 2\n";
+    }
+    EXPECT_EQ(cache.get(0, 4, options).searches.size(), generated.searches.size());
+    {
+        std::ifstream stream{file};
+        std::string header{};
+        std::getline(stream, header);
+        EXPECT_NO_THROW(seqan3::detail::read_search_scheme(stream));
+    }
+}
+
+TEST(search_scheme_generator_test, search)
+{
+    // Searching with a generated search scheme with weighted blocks finds all occurrences.
+    std::vector<seqan3::dna4> const text = seqan3::test::generate_sequence<seqan3::dna4>(2000, 0, 42);
+    seqan3::bi_fm_index const index{text};
+    seqan3::fm_index const unidirectional_index{text};
+
+    seqan3::detail::search_scheme_generator_options options{};
+    options.query_length = 20u;
+    options.optimise_block_lengths = true;
+    options.cost_model = seqan3::detail::search_scheme_cost_model{index};
+    seqan3::detail::weighted_search_scheme const search_scheme = seqan3::detail::generate_search_scheme(0, 4, options);
+
+    auto positions = [](auto const & cursors)
+    {
+        std::vector<size_t> result{};
+        for (auto const & cursor : cursors)
+            for (auto const & [reference_id, position] : cursor.locate())
+                result.push_back(position);
+        std::ranges::sort(result);
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    };
+
+    for (size_t query_length : {5u, 12u, 20u, 27u})
+    {
+        std::vector<seqan3::dna4> query{text.begin() + 100, text.begin() + 100 + query_length};
+        seqan3::assign_rank_to((seqan3::to_rank(query[query_length / 2]) + 1) % 4, query[query_length / 2]);
+
+        for (seqan3::detail::search_param const error_left :
+             {seqan3::detail::search_param{4, 4, 0, 0}, seqan3::detail::search_param{4, 2, 1, 1}})
+        {
+            std::vector<typename decltype(index)::cursor_type> hits{};
+            seqan3::detail::search_ss<false>(index,
+                                             query,
+                                             error_left,
+                                             search_scheme,
+                                             [&hits](auto const & cursor)
+                                             {
+                                                 hits.push_back(cursor);
+                                             });
+
+            // Backtracking in the unidirectional index.
+            std::vector<typename decltype(unidirectional_index)::cursor_type> expected_hits{};
+            auto backtrack = [&](auto & self, auto cursor, size_t const position, seqan3::detail::search_param left)
+            {
+                if (position == query.size())
+                {
+                    expected_hits.push_back(cursor);
+                    return;
+                }
+
+                // Returns the remaining errors after spending an error of the given kind.
+                auto spend = [left](uint8_t seqan3::detail::search_param::*kind)
+                {
+                    seqan3::detail::search_param result = left;
+                    --result.total;
+                    --(result.*kind);
+                    return result;
+                };
+
+                if (left.total > 0 && left.insertion > 0)
+                    self(self, cursor, position + 1, spend(&seqan3::detail::search_param::insertion));
+
+                if (!cursor.extend_right())
+                    return;
+                do
+                {
+                    if (cursor.last_rank() == seqan3::to_rank(query[position]))
+                        self(self, cursor, position + 1, left);
+                    else if (left.total > 0 && left.substitution > 0)
+                        self(self, cursor, position + 1, spend(&seqan3::detail::search_param::substitution));
+                    if (left.total > 0 && left.deletion > 0)
+                        self(self, cursor, position, spend(&seqan3::detail::search_param::deletion));
+                }
+                while (cursor.cycle_back());
+            };
+            backtrack(backtrack, unidirectional_index.cursor(), 0u, error_left);
+
+            EXPECT_EQ(positions(hits), positions(expected_hits)) << "query length " << query_length;
+        }
+    }
+}
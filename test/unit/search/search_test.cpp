@@ -21,6 +21,7 @@
 #include <seqan3/search/fm_index/fm_index.hpp>
 #include <seqan3/search/search.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/utility/range/to.hpp>
 
 #include "helper.hpp"
 
@@ -58,8 +59,11 @@ public:
     index_t index{text};
 };
 
+using epr_index_t = seqan3::sdsl_epr_index_type<2>;
 using fm_index_types = ::testing::Types<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single>,
-                                        seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single>>;
+                                        seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single>,
+                                        seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, epr_index_t>,
+                                        seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single, epr_index_t>>;
 using fm_index_string_types = ::testing::Types<seqan3::fm_index<char, seqan3::text_layout::single>,
                                                seqan3::bi_fm_index<char, seqan3::text_layout::single>>;
 
@@ -155,6 +159,26 @@ TYPED_TEST(search_test, parallel_queries)
     EXPECT_RANGE_EQ(search(queries, this->index, cfg) | position, std::vector(num_queries, 0));
 }
 
+TYPED_TEST(search_test, parallel_queries_with_errors)
+{
+    // The search schemes of the seqan3::bi_fm_index are split into tasks for two or more errors.
+    std::vector<std::vector<seqan3::dna4>> const queries{"ACGTACGTACGT"_dna4, "ACGAACGTTCGT"_dna4, "CGTAGGTA"_dna4};
+
+    for (uint8_t errors : {2u, 3u})
+    {
+        seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{errors}};
+        for (auto const & hit_cfg : {seqan3::search_cfg::hit{seqan3::search_cfg::hit_all{}},
+                                     seqan3::search_cfg::hit{seqan3::search_cfg::hit_all_best{}},
+                                     seqan3::search_cfg::hit{seqan3::search_cfg::hit_strata{1}}})
+        {
+            auto const expected = search(queries, this->index, cfg | hit_cfg) | seqan3::ranges::to<std::vector>();
+            auto const actual = search(queries, this->index, cfg | hit_cfg | seqan3::search_cfg::parallel{4})
+                              | seqan3::ranges::to<std::vector>();
+            EXPECT_RANGE_EQ(actual, expected);
+        }
+    }
+}
+
 TYPED_TEST(search_test, invalid_error_configuration)
 {
     seqan3::configuration const cfg1 = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_rate{-0.5}};
@@ -0,0 +1,247 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <seqan3/test/cereal.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_directory.hpp>
+#include <seqan3/utility/bloom_filter/blocked_bloom_filter.hpp>
+
+template <typename bf_type>
+struct blocked_bloom_filter_test : public ::testing::Test
+{
+    static bf_type make_bf(seqan3::bin_size bits)
+    {
+        return bf_type{seqan3::blocked_bloom_filter{bits}};
+    }
+
+    static bf_type make_bf(seqan3::bin_size bits, seqan3::hash_function_count funs)
+    {
+        return bf_type{seqan3::blocked_bloom_filter{bits, funs}};
+    }
+};
+
+using bf_types = ::testing::Types<seqan3::blocked_bloom_filter<seqan3::data_layout::uncompressed>,
+                                  seqan3::blocked_bloom_filter<seqan3::data_layout::compressed>>;
+
+TYPED_TEST_SUITE(blocked_bloom_filter_test, bf_types, );
+
+TYPED_TEST(blocked_bloom_filter_test, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_destructible_v<TypeParam>);
+
+    // num hash functions defaults to two
+    TypeParam bf1{TestFixture::make_bf(seqan3::bin_size{1024u})};
+    TypeParam bf2{TestFixture::make_bf(seqan3::bin_size{1024u}, seqan3::hash_function_count{2u})};
+    EXPECT_TRUE(bf1 == bf2);
+
+    // bin_size parameter is too small
+    EXPECT_THROW((TestFixture::make_bf(seqan3::bin_size{0u})), std::logic_error);
+    // not enough hash functions
+    EXPECT_THROW((TestFixture::make_bf(seqan3::bin_size{32u}, seqan3::hash_function_count{0u})), std::logic_error);
+    // too many hash functions
+    EXPECT_THROW((TestFixture::make_bf(seqan3::bin_size{32u}, seqan3::hash_function_count{6u})), std::logic_error);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, member_getter)
+{
+    TypeParam t1{TestFixture::make_bf(seqan3::bin_size{1024u})};
+    EXPECT_EQ(t1.bit_size(), 1024u);
+    EXPECT_EQ(t1.hash_function_count(), 2u);
+
+    // The size is rounded up to a multiple of the block size.
+    TypeParam t2{TestFixture::make_bf(seqan3::bin_size{1019u}, seqan3::hash_function_count{3u})};
+    EXPECT_EQ(t2.bit_size(), 1024u);
+    EXPECT_EQ(t2.hash_function_count(), 3u);
+
+    TypeParam t3{TestFixture::make_bf(seqan3::bin_size{1u})};
+    EXPECT_EQ(t3.bit_size(), 512u);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, contains)
+{
+    TypeParam bf{TestFixture::make_bf(seqan3::bin_size{1024u})};
+
+    for (size_t hash : std::views::iota(0u, 64u)) // test some hashes
+    {
+        // Expect false for all queries since we did not insert anything
+        EXPECT_FALSE(bf.contains(hash));
+    }
+}
+
+TYPED_TEST(blocked_bloom_filter_test, emplace)
+{
+    // 1. Test uncompressed blocked Bloom Filter directly because the compressed one is not mutable.
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}, seqan3::hash_function_count{2u}};
+
+    for (size_t hash : std::views::iota(0u, 64u))
+        bf.emplace(hash);
+
+    // 2. Construct either the uncompressed or compressed blocked Bloom Filter and test via contains
+    TypeParam bf2{bf};
+    for (size_t hash : std::views::iota(0u, 64u))
+        EXPECT_TRUE(bf2.contains(hash));
+}
+
+TYPED_TEST(blocked_bloom_filter_test, counting)
+{
+    // 1. Test uncompressed blocked Bloom Filter directly because the compressed one is not mutable.
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{8192u}, seqan3::hash_function_count{3u}};
+
+    for (size_t hash : std::views::iota(0u, 128u))
+        bf.emplace(hash);
+
+    // 2. Construct either the uncompressed or compressed blocked Bloom Filter and test set with count
+    TypeParam bf2{bf};
+
+    // Test counting with all elements
+    EXPECT_EQ(bf2.count(std::views::iota(0u, 128u)), 128u);
+
+    // Test counting with some elements
+    EXPECT_EQ(bf2.count(std::views::iota(22u, 42u)), 20u);
+
+    // Counting a range of values, which is processed in batches, is the same as calling contains for each value.
+    size_t expected{};
+    for (size_t hash : std::views::iota(0u, 10'000u))
+        expected += bf2.contains(hash);
+    EXPECT_EQ(bf2.count(std::views::iota(0u, 10'000u)), expected);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, reset)
+{
+    // 1. Test uncompressed blocked Bloom Filter directly because the compressed one is not mutable.
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}, seqan3::hash_function_count{2u}};
+
+    for (size_t hash : std::views::iota(0u, 64u))
+        bf.emplace(hash);
+
+    // 2. Reset the blocked Bloom Filter
+    bf.reset();
+
+    // 3. Construct either the uncompressed or compressed blocked Bloom Filter and test set with count
+    TypeParam bf2{bf};
+    EXPECT_EQ(bf2.count(std::views::iota(0u, 64u)), 0u); // nothing should be present in the blocked Bloom Filter
+}
+
+TYPED_TEST(blocked_bloom_filter_test, data_access)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}};
+    EXPECT_EQ(bf.raw_data().size(), 1024u);
+
+    // Every block starts at a cache line, also in copies.
+    seqan3::blocked_bloom_filter const copy{bf};
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(bf.raw_data().data()) % 64u, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(copy.raw_data().data()) % 64u, 0u);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, serialisation)
+{
+    TypeParam bf{TestFixture::make_bf(seqan3::bin_size{1024u})};
+    seqan3::test::do_serialisation(bf);
+}
+
+TEST(blocked_bloom_filter_test, serialisation_as_sdsl_bit_vector)
+{
+#if SEQAN3_WITH_CEREAL
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}};
+    bf.emplace(42u);
+
+    // The bits are archived like a sdsl::bit_vector.
+    std::stringstream stream{};
+    {
+        cereal::BinaryOutputArchive oarchive{stream};
+        oarchive(bf.raw_data());
+    }
+
+    sdsl::bit_vector bits{};
+    {
+        cereal::BinaryInputArchive iarchive{stream};
+        iarchive(bits);
+    }
+
+    EXPECT_TRUE(bits == bf.raw_data().to_sdsl());
+    EXPECT_TRUE(seqan3::detail::aligned_bit_vector{bits} == bf.raw_data());
+#endif // SEQAN3_WITH_CEREAL
+}
+
+TEST(blocked_bloom_filter_test, single_block)
+{
+    for (size_t funs = 1u; funs <= 5u; ++funs)
+    {
+        for (size_t hash : std::views::iota(0u, 100u))
+        {
+            seqan3::blocked_bloom_filter bf{seqan3::bin_size{1u << 16}, seqan3::hash_function_count{funs}};
+            bf.emplace(hash);
+
+            // All bits of a value are set in the same block of 8 words.
+            std::vector<size_t> set_words;
+            size_t set_bits{};
+            for (size_t word = 0; word < bf.bit_size() / 64u; ++word)
+            {
+                if (uint64_t const bits = bf.raw_data().get_int(word * 64u); bits != 0u)
+                {
+                    set_words.push_back(word);
+                    set_bits += std::popcount(bits);
+                }
+            }
+
+            ASSERT_FALSE(set_words.empty());
+            EXPECT_EQ(set_words.front() / 8u, set_words.back() / 8u);
+            EXPECT_GE(set_bits, 1u);
+            EXPECT_LE(set_bits, funs);
+        }
+    }
+}
+
+TEST(blocked_bloom_filter_test, false_positive_rate)
+{
+    // 10'000 values in 2^17 bits, i.e. about 13 bits per value. The false positive rate of a Bloom Filter with
+    // 3 hash functions is about 0.01.
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1u << 17}, seqan3::hash_function_count{3u}};
+
+    for (size_t hash : std::views::iota(0u, 10'000u))
+        bf.emplace(hash);
+
+    EXPECT_EQ(bf.count(std::views::iota(0u, 10'000u)), 10'000u);
+    EXPECT_LT(bf.count(std::views::iota(1'000'000u, 1'100'000u)), 3'000u);
+}
+
+TEST(blocked_bloom_filter_test, mapped)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{8000u}, seqan3::hash_function_count{3u}};
+
+    for (size_t hash : std::views::iota(0u, 500u))
+        bf.emplace(hash);
+
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "bbf.mapped";
+    bf.save_mapped(filename);
+
+    seqan3::blocked_bloom_filter<seqan3::data_layout::mapped> bf_mapped{filename};
+
+    EXPECT_EQ(bf_mapped.bit_size(), bf.bit_size());
+    EXPECT_EQ(bf_mapped.hash_function_count(), bf.hash_function_count());
+
+    for (size_t hash : std::views::iota(0u, 1000u))
+        EXPECT_EQ(bf_mapped.contains(hash), bf.contains(hash));
+
+    EXPECT_EQ(bf_mapped.count(std::views::iota(0u, 1000u)), bf.count(std::views::iota(0u, 1000u)));
+
+    // The file does not contain a blocked Bloom Filter.
+    seqan3::interleaved_bloom_filter other{seqan3::bin_count{64u}, seqan3::bin_size{1024u}};
+    other.save_mapped(filename);
+    using mapped_bf_t = seqan3::blocked_bloom_filter<seqan3::data_layout::mapped>;
+    EXPECT_THROW(mapped_bf_t{filename}, seqan3::format_error);
+}
@@ -9,6 +9,7 @@
 
 #include <seqan3/test/cereal.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_directory.hpp>
 #include <seqan3/utility/bloom_filter/bloom_filter.hpp>
 
 template <typename bf_type>
@@ -133,3 +134,31 @@ TYPED_TEST(bloom_filter_test, serialisation)
     TypeParam bf{TestFixture::make_bf(seqan3::bin_size{1024u})};
     seqan3::test::do_serialisation(bf);
 }
+
+TEST(bloom_filter_test, mapped)
+{
+    seqan3::bloom_filter bf{seqan3::bin_size{8000u}, seqan3::hash_function_count{3u}};
+
+    for (size_t hash : std::views::iota(0u, 500u))
+        bf.emplace(hash);
+
+    seqan3::test::tmp_directory tmp{};
+    std::filesystem::path const filename = tmp.path() / "bf.mapped";
+    bf.save_mapped(filename);
+
+    seqan3::bloom_filter<seqan3::data_layout::mapped> bf_mapped{filename};
+
+    EXPECT_EQ(bf_mapped.bit_size(), bf.bit_size());
+    EXPECT_EQ(bf_mapped.hash_function_count(), bf.hash_function_count());
+
+    for (size_t hash : std::views::iota(0u, 1000u))
+        EXPECT_EQ(bf_mapped.contains(hash), bf.contains(hash));
+
+    EXPECT_EQ(bf_mapped.count(std::views::iota(0u, 1000u)), bf.count(std::views::iota(0u, 1000u)));
+
+    // The file does not contain a Bloom Filter.
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{64u}, seqan3::bin_size{1024u}};
+    ibf.save_mapped(filename);
+    using mapped_bf_t = seqan3::bloom_filter<seqan3::data_layout::mapped>;
+    EXPECT_THROW(mapped_bf_t{filename}, seqan3::format_error);
+}
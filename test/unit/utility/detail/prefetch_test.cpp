@@ -0,0 +1,38 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/utility/detail/prefetch.hpp>
+
+TEST(prefetch, noexcept)
+{
+    uint64_t const value{};
+
+    EXPECT_TRUE(noexcept(seqan3::detail::prefetch_for_read(&value)));
+    EXPECT_TRUE(noexcept(seqan3::detail::prefetch_for_read<0>(&value)));
+    EXPECT_TRUE(noexcept(seqan3::detail::prefetch_for_write(&value)));
+}
+
+TEST(prefetch, does_not_modify_memory)
+{
+    std::vector<uint64_t> data(1024, 42u);
+
+    for (size_t i = 0; i < data.size(); i += 8)
+    {
+        seqan3::detail::prefetch_for_read(data.data() + i);
+        seqan3::detail::prefetch_for_read<0>(data.data() + i);
+        seqan3::detail::prefetch_for_write(data.data() + i);
+    }
+
+    // The past-the-end pointer of a range may be prefetched, e.g. by a loop that prefetches ahead.
+    seqan3::detail::prefetch_for_read(data.data() + data.size());
+
+    EXPECT_EQ(data, std::vector<uint64_t>(1024, 42u));
+}
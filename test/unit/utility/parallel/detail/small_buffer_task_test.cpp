@@ -0,0 +1,126 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include <seqan3/utility/parallel/detail/small_buffer_task.hpp>
+
+// Counts the living instances.
+struct counted
+{
+    static inline int instances{};
+
+    counted() noexcept
+    {
+        ++instances;
+    }
+    counted(counted const &) noexcept
+    {
+        ++instances;
+    }
+    ~counted()
+    {
+        --instances;
+    }
+};
+
+TEST(small_buffer_task, concepts)
+{
+    EXPECT_EQ(sizeof(seqan3::detail::small_buffer_task), 64u);
+    EXPECT_TRUE(std::is_nothrow_move_constructible_v<seqan3::detail::small_buffer_task>);
+    EXPECT_TRUE(std::is_nothrow_move_assignable_v<seqan3::detail::small_buffer_task>);
+    EXPECT_FALSE(std::is_copy_constructible_v<seqan3::detail::small_buffer_task>);
+
+    auto small = []() {};
+    auto large = [data = std::array<char, 100>{}]()
+    {
+        (void)data;
+    };
+    EXPECT_TRUE(seqan3::detail::small_buffer_task::is_stored_inline<decltype(small)>);
+    EXPECT_FALSE(seqan3::detail::small_buffer_task::is_stored_inline<decltype(large)>);
+}
+
+TEST(small_buffer_task, invoke)
+{
+    seqan3::detail::small_buffer_task empty{};
+    EXPECT_FALSE(empty);
+
+    int calls{};
+    seqan3::detail::small_buffer_task small{[&calls]()
+                                            {
+                                                ++calls;
+                                            }};
+    EXPECT_TRUE(small);
+    small();
+    small();
+    EXPECT_EQ(calls, 2);
+
+    std::array<int, 50> values{};
+    values.fill(1);
+    seqan3::detail::small_buffer_task large{[&calls, values]()
+                                            {
+                                                for (int value : values)
+                                                    calls += value;
+                                            }};
+    large();
+    EXPECT_EQ(calls, 52);
+
+    // Move-only callables.
+    seqan3::detail::small_buffer_task move_only{[&calls, value = std::make_unique<int>(10)]()
+                                                {
+                                                    calls += *value;
+                                                }};
+    move_only();
+    EXPECT_EQ(calls, 62);
+
+    seqan3::detail::small_buffer_task throwing{[]()
+                                               {
+                                                   throw std::runtime_error{"task failed"};
+                                               }};
+    EXPECT_THROW(throwing(), std::runtime_error);
+}
+
+TEST(small_buffer_task, move)
+{
+    {
+        seqan3::detail::small_buffer_task small{[value = counted{}]()
+                                                {
+                                                    (void)value;
+                                                }};
+        seqan3::detail::small_buffer_task large{[value = counted{}, data = std::array<char, 100>{}]()
+                                                {
+                                                    (void)value;
+                                                    (void)data;
+                                                }};
+        EXPECT_EQ(counted::instances, 2);
+
+        seqan3::detail::small_buffer_task moved{std::move(small)};
+        EXPECT_FALSE(small);
+        EXPECT_TRUE(moved);
+        EXPECT_EQ(counted::instances, 2);
+
+        moved = std::move(large);
+        EXPECT_FALSE(large);
+        EXPECT_EQ(counted::instances, 1);
+
+        moved = seqan3::detail::small_buffer_task{};
+        EXPECT_FALSE(moved);
+        EXPECT_EQ(counted::instances, 0);
+
+        small = [value = counted{}]()
+        {
+            (void)value;
+        };
+        EXPECT_EQ(counted::instances, 1);
+    }
+    EXPECT_EQ(counted::instances, 0);
+}
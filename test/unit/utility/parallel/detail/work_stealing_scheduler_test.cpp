@@ -0,0 +1,205 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <seqan3/utility/parallel/detail/work_stealing_scheduler.hpp>
+
+TEST(work_stealing_scheduler, construction)
+{
+    seqan3::detail::work_stealing_scheduler scheduler{3};
+    EXPECT_EQ(scheduler.thread_count(), 3u);
+    EXPECT_FALSE(scheduler.is_worker_thread());
+    EXPECT_EQ(seqan3::detail::work_stealing_scheduler::current(), nullptr);
+
+    EXPECT_THROW(seqan3::detail::work_stealing_scheduler{0}, std::invalid_argument);
+}
+
+TEST(work_stealing_scheduler, run_tasks)
+{
+    seqan3::detail::work_stealing_scheduler scheduler{4};
+    seqan3::detail::task_group tasks{scheduler};
+
+    std::atomic<size_t> sum{};
+    std::atomic<size_t> on_worker_thread{};
+    for (size_t i = 1; i <= 1000; ++i)
+    {
+        tasks.run(
+            [&, i]()
+            {
+                sum += i;
+                on_worker_thread += seqan3::detail::work_stealing_scheduler::current() == &scheduler;
+            });
+    }
+    tasks.wait();
+
+    EXPECT_EQ(sum.load(), 500500u);
+    EXPECT_EQ(on_worker_thread.load(), 1000u);
+}
+
+// Every task splits its range into two tasks and waits for them.
+static size_t parallel_sum(seqan3::detail::work_stealing_scheduler & scheduler, size_t const begin, size_t const end)
+{
+    if (end - begin <= 16u)
+    {
+        size_t sum{};
+        for (size_t i = begin; i < end; ++i)
+            sum += i;
+        return sum;
+    }
+
+    size_t const middle = begin + (end - begin) / 2u;
+    size_t left{};
+    size_t right{};
+    seqan3::detail::task_group tasks{scheduler};
+    tasks.run(
+        [&]()
+        {
+            left = parallel_sum(scheduler, begin, middle);
+        });
+    tasks.run(
+        [&]()
+        {
+            right = parallel_sum(scheduler, middle, end);
+        });
+    tasks.wait();
+    return left + right;
+}
+
+TEST(work_stealing_scheduler, nested_task_groups)
+{
+    // The threads waiting for a nested task group process the pending tasks, even with a single thread.
+    for (size_t thread_count : {1u, 2u, 4u})
+    {
+        seqan3::detail::work_stealing_scheduler scheduler{thread_count};
+        seqan3::detail::task_group tasks{scheduler};
+
+        size_t sum{};
+        tasks.run(
+            [&]()
+            {
+                sum = parallel_sum(scheduler, 0u, 10'000u);
+            });
+        tasks.wait();
+
+        EXPECT_EQ(sum, 49'995'000u);
+    }
+}
+
+TEST(work_stealing_scheduler, exception)
+{
+    seqan3::detail::work_stealing_scheduler scheduler{2};
+    seqan3::detail::task_group tasks{scheduler};
+
+    std::atomic<size_t> count{};
+    for (size_t i = 0; i < 100; ++i)
+    {
+        tasks.run(
+            [&, i]()
+            {
+                ++count;
+                if (i == 50)
+                    throw std::runtime_error{"task failed"};
+            });
+    }
+
+    EXPECT_THROW(tasks.wait(), std::runtime_error);
+    EXPECT_EQ(count.load(), 100u); // All other tasks are completed.
+
+    // The task group can be reused.
+    tasks.run(
+        [&]()
+        {
+            ++count;
+        });
+    EXPECT_NO_THROW(tasks.wait());
+    EXPECT_EQ(count.load(), 101u);
+}
+
+TEST(work_stealing_scheduler, shared)
+{
+    std::shared_ptr<seqan3::detail::work_stealing_scheduler> scheduler =
+        seqan3::detail::work_stealing_scheduler::shared(3);
+    EXPECT_EQ(scheduler->thread_count(), 3u);
+    EXPECT_EQ(seqan3::detail::work_stealing_scheduler::shared(3), scheduler);
+    EXPECT_NE(seqan3::detail::work_stealing_scheduler::shared(2), scheduler);
+    EXPECT_THROW(seqan3::detail::work_stealing_scheduler::shared(0), std::invalid_argument);
+
+    // Only the most recently requested scheduler is kept if it is not in use.
+    std::weak_ptr<seqan3::detail::work_stealing_scheduler> const unused{
+        seqan3::detail::work_stealing_scheduler::shared(3)};
+    scheduler.reset();
+    EXPECT_FALSE(unused.expired());
+    EXPECT_EQ(seqan3::detail::work_stealing_scheduler::shared(3), unused.lock());
+    std::weak_ptr<seqan3::detail::work_stealing_scheduler> const replaced{
+        seqan3::detail::work_stealing_scheduler::shared(2)};
+    EXPECT_TRUE(unused.expired());
+    EXPECT_FALSE(replaced.expired());
+    scheduler = seqan3::detail::work_stealing_scheduler::shared(3);
+
+    // Task groups of different threads share the scheduler.
+    std::atomic<size_t> sum{};
+    std::vector<std::thread> threads{};
+    for (size_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                seqan3::detail::task_group tasks{*scheduler};
+                for (size_t i = 1; i <= 100; ++i)
+                    tasks.run(
+                        [&, i]()
+                        {
+                            sum += i;
+                        });
+                tasks.wait();
+            });
+    }
+    for (auto & thread : threads)
+        thread.join();
+
+    EXPECT_EQ(sum.load(), 4u * 5050u);
+}
+
+TEST(work_stealing_scheduler, move_only_tasks)
+{
+    seqan3::detail::work_stealing_scheduler scheduler{2};
+    seqan3::detail::task_group tasks{scheduler};
+
+    std::atomic<size_t> sum{};
+    for (size_t i = 1; i <= 100; ++i)
+        tasks.run(
+            [&, value = std::make_unique<size_t>(i)]()
+            {
+                sum += *value;
+            });
+    tasks.wait();
+
+    EXPECT_EQ(sum.load(), 5050u);
+}
+
+TEST(work_stealing_scheduler, destruction_processes_remaining_tasks)
+{
+    std::atomic<size_t> count{};
+    {
+        seqan3::detail::work_stealing_scheduler scheduler{2};
+        for (size_t i = 0; i < 100; ++i)
+            scheduler.submit(
+                [&]()
+                {
+                    ++count;
+                });
+    }
+
+    EXPECT_EQ(count.load(), 100u);
+}
@@ -0,0 +1,84 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2023, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2023, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/utility/parallel/thread_pool.hpp>
+
+TEST(thread_pool, construction)
+{
+    EXPECT_FALSE(std::is_default_constructible_v<seqan3::thread_pool>);
+    EXPECT_FALSE(std::is_copy_constructible_v<seqan3::thread_pool>);
+    EXPECT_FALSE(std::is_move_constructible_v<seqan3::thread_pool>);
+
+    seqan3::thread_pool pool{3};
+    EXPECT_EQ(pool.thread_count(), 3u);
+    EXPECT_EQ(pool.scheduler().thread_count(), 3u);
+
+    EXPECT_THROW(seqan3::thread_pool{0}, std::invalid_argument);
+}
+
+TEST(thread_pool, reuse)
+{
+    seqan3::thread_pool pool{2};
+
+    // The same threads execute the tasks of several task groups.
+    for (size_t round = 0; round < 3; ++round)
+    {
+        std::atomic<size_t> sum{};
+        seqan3::detail::task_group tasks{pool.scheduler()};
+        for (size_t i = 1; i <= 100; ++i)
+            tasks.run(
+                [&, i]()
+                {
+                    EXPECT_TRUE(pool.scheduler().is_worker_thread());
+                    sum += i;
+                });
+        tasks.wait();
+
+        EXPECT_EQ(sum.load(), 5050u);
+    }
+}
+
+TEST(thread_pool, pinning)
+{
+    // The threads are pinned to the CPUs round-robin; pinning to CPU 0 is always possible.
+    seqan3::thread_pool pool{2, std::vector<size_t>{0}};
+    EXPECT_EQ(pool.thread_count(), 2u);
+
+    std::atomic<size_t> sum{};
+    {
+        seqan3::detail::task_group tasks{pool.scheduler()};
+        for (size_t i = 1; i <= 100; ++i)
+            tasks.run(
+                [&, i]()
+                {
+                    sum += i;
+                });
+    }
+    EXPECT_EQ(sum.load(), 5050u);
+
+    // No CPUs: the threads are not pinned.
+    seqan3::thread_pool unpinned_pool{2, std::vector<size_t>{}};
+    EXPECT_EQ(unpinned_pool.thread_count(), 2u);
+}
+
+TEST(thread_pool, numa_node_cpus)
+{
+    // The CPUs of a node are sorted and unique. The list is empty if NUMA information is not available.
+    std::vector<size_t> const cpus = seqan3::thread_pool::numa_node_cpus(0);
+    EXPECT_TRUE(std::ranges::is_sorted(cpus));
+    EXPECT_EQ(std::ranges::adjacent_find(cpus), cpus.end());
+
+    EXPECT_TRUE(seqan3::thread_pool::numa_node_cpus(1'000'000).empty());
+}